@@ -216,6 +216,24 @@ public:
 
     bool is_nullable() const override { return false; }
 
+    bool has_large_column() const override { return _elements->has_large_column(); }
+
+    ColumnPtr upgrade_if_overflow() override {
+        ColumnPtr column = _elements->upgrade_if_overflow();
+        if (column != nullptr) {
+            _elements = std::move(column);
+        }
+        return nullptr;
+    }
+
+    ColumnPtr downgrade() override {
+        ColumnPtr column = _elements->downgrade();
+        if (column != nullptr) {
+            _elements = std::move(column);
+        }
+        return nullptr;
+    }
+
     // Only used for debug one item in this column
     std::string debug_item(uint32_t idx) const override;
 
@@ -4,6 +4,8 @@
 
 #include <immintrin.h>
 
+#include <limits>
+
 #include "column/bytes.h"
 #include "common/logging.h"
 #include "gutil/bits.h"
@@ -16,8 +18,9 @@
 
 namespace starrocks::vectorized {
 
-void BinaryColumn::append(const Column& src, size_t offset, size_t count) {
-    const auto& b = down_cast<const BinaryColumn&>(src);
+template <typename T>
+template <typename S>
+void BinaryColumnBase<T>::_append(const BinaryColumnBase<S>& b, size_t offset, size_t count) {
     const unsigned char* p = &b._bytes[b._offsets[offset]];
     const unsigned char* e = &b._bytes[b._offsets[offset + count]];
 
@@ -30,8 +33,19 @@ void BinaryColumn::append(const Column& src, size_t offset, size_t count) {
     _slices_cache = false;
 }
 
-void BinaryColumn::append_selective(const Column& src, const uint32_t* indexes, uint32_t from, uint32_t size) {
-    const auto& src_column = down_cast<const BinaryColumn&>(src);
+template <typename T>
+void BinaryColumnBase<T>::append(const Column& src, size_t offset, size_t count) {
+    if (src.has_large_column()) {
+        _append(down_cast<const LargeBinaryColumn&>(src), offset, count);
+    } else {
+        _append(down_cast<const BinaryColumn&>(src), offset, count);
+    }
+}
+
+template <typename T>
+template <typename S>
+void BinaryColumnBase<T>::_append_selective(const BinaryColumnBase<S>& src_column, const uint32_t* indexes,
+                                            uint32_t from, uint32_t size) {
     const auto& src_offsets = src_column.get_offset();
     const auto& src_bytes = src_column.get_bytes();
 
@@ -41,7 +55,7 @@ void BinaryColumn::append_selective(const Column& src, const uint32_t* indexes,
     _offsets.resize(cur_row_count + size + 1);
     for (size_t i = 0; i < size; i++) {
         uint32_t row_idx = indexes[from + i];
-        uint32_t str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
+        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
         _offsets[cur_row_count + i + 1] = _offsets[cur_row_count + i] + str_size;
         cur_byte_size += str_size;
     }
@@ -50,7 +64,7 @@ void BinaryColumn::append_selective(const Column& src, const uint32_t* indexes,
     auto* dest_bytes = _bytes.data();
     for (uint32_t i = 0; i < size; i++) {
         uint32_t row_idx = indexes[from + i];
-        uint32_t str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
+        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
         strings::memcpy_inlined(dest_bytes + _offsets[cur_row_count + i], src_bytes.data() + src_offsets[row_idx],
                                 str_size);
     }
@@ -58,8 +72,19 @@ void BinaryColumn::append_selective(const Column& src, const uint32_t* indexes,
     _slices_cache = false;
 }
 
-void BinaryColumn::append_value_multiple_times(const Column& src, uint32_t index, uint32_t size) {
-    auto& src_column = down_cast<const BinaryColumn&>(src);
+template <typename T>
+void BinaryColumnBase<T>::append_selective(const Column& src, const uint32_t* indexes, uint32_t from, uint32_t size) {
+    if (src.has_large_column()) {
+        _append_selective(down_cast<const LargeBinaryColumn&>(src), indexes, from, size);
+    } else {
+        _append_selective(down_cast<const BinaryColumn&>(src), indexes, from, size);
+    }
+}
+
+template <typename T>
+template <typename S>
+void BinaryColumnBase<T>::_append_value_multiple_times(const BinaryColumnBase<S>& src_column, uint32_t index,
+                                                       uint32_t size) {
     auto& src_offsets = src_column.get_offset();
     auto& src_bytes = src_column.get_bytes();
 
@@ -69,7 +94,7 @@ void BinaryColumn::append_value_multiple_times(const Column& src, uint32_t index
     _offsets.resize(cur_row_count + size + 1);
     for (size_t i = 0; i < size; i++) {
         uint32_t row_idx = index;
-        uint32_t str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
+        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
         _offsets[cur_row_count + i + 1] = _offsets[cur_row_count + i] + str_size;
         cur_byte_size += str_size;
     }
@@ -78,7 +103,7 @@ void BinaryColumn::append_value_multiple_times(const Column& src, uint32_t index
     auto* dest_bytes = _bytes.data();
     for (uint32_t i = 0; i < size; i++) {
         uint32_t row_idx = index;
-        uint32_t str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
+        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
         strings::memcpy_inlined(dest_bytes + _offsets[cur_row_count + i], src_bytes.data() + src_offsets[row_idx],
                                 str_size);
     }
@@ -86,7 +111,17 @@ void BinaryColumn::append_value_multiple_times(const Column& src, uint32_t index
     _slices_cache = false;
 }
 
-bool BinaryColumn::append_strings(const std::vector<Slice>& strs) {
+template <typename T>
+void BinaryColumnBase<T>::append_value_multiple_times(const Column& src, uint32_t index, uint32_t size) {
+    if (src.has_large_column()) {
+        _append_value_multiple_times(down_cast<const LargeBinaryColumn&>(src), index, size);
+    } else {
+        _append_value_multiple_times(down_cast<const BinaryColumn&>(src), index, size);
+    }
+}
+
+template <typename T>
+bool BinaryColumnBase<T>::append_strings(const std::vector<Slice>& strs) {
     for (const auto& s : strs) {
         const uint8_t* const p = reinterpret_cast<const Bytes::value_type*>(s.data);
         _bytes.insert(_bytes.end(), p, p + s.size);
@@ -98,12 +133,11 @@ bool BinaryColumn::append_strings(const std::vector<Slice>& strs) {
 
 // NOTE: this function should not be inlined. If this function is inlined,
 // the append_strings_overflow will be slower by 30%
-template <size_t copy_length>
-void append_fixed_length(const std::vector<Slice>& strs, Bytes* bytes, BinaryColumn::Offsets* offsets)
-        __attribute__((noinline));
+template <size_t copy_length, typename Offsets>
+void append_fixed_length(const std::vector<Slice>& strs, Bytes* bytes, Offsets* offsets) __attribute__((noinline));
 
-template <size_t copy_length>
-void append_fixed_length(const std::vector<Slice>& strs, Bytes* bytes, BinaryColumn::Offsets* offsets) {
+template <size_t copy_length, typename Offsets>
+void append_fixed_length(const std::vector<Slice>& strs, Bytes* bytes, Offsets* offsets) {
     size_t size = bytes->size();
     for (const auto& s : strs) {
         size += s.size;
@@ -119,7 +153,8 @@ void append_fixed_length(const std::vector<Slice>& strs, Bytes* bytes, BinaryCol
     bytes->resize(offset);
 }
 
-bool BinaryColumn::append_strings_overflow(const std::vector<Slice>& strs, size_t max_length) {
+template <typename T>
+bool BinaryColumnBase<T>::append_strings_overflow(const std::vector<Slice>& strs, size_t max_length) {
     if (max_length <= 16) {
         append_fixed_length<16>(strs, &_bytes, &_offsets);
     } else if (max_length <= 32) {
@@ -139,7 +174,8 @@ bool BinaryColumn::append_strings_overflow(const std::vector<Slice>& strs, size_
     return true;
 }
 
-bool BinaryColumn::append_continuous_strings(const std::vector<Slice>& strs) {
+template <typename T>
+bool BinaryColumnBase<T>::append_continuous_strings(const std::vector<Slice>& strs) {
     if (strs.empty()) {
         return true;
     }
@@ -156,7 +192,8 @@ bool BinaryColumn::append_continuous_strings(const std::vector<Slice>& strs) {
     return true;
 }
 
-void BinaryColumn::append_value_multiple_times(const void* value, size_t count) {
+template <typename T>
+void BinaryColumnBase<T>::append_value_multiple_times(const void* value, size_t count) {
     const Slice* slice = reinterpret_cast<const Slice*>(value);
     size_t size = slice->size * count;
     _bytes.reserve(size);
@@ -170,7 +207,53 @@ void BinaryColumn::append_value_multiple_times(const void* value, size_t count)
     _slices_cache = false;
 }
 
-void BinaryColumn::_build_slices() const {
+template <typename T>
+ColumnPtr BinaryColumnBase<T>::upgrade_if_overflow() {
+    if constexpr (std::is_same_v<T, uint32_t>) {
+        if (_bytes.size() < std::numeric_limits<uint32_t>::max()) {
+            return nullptr;
+        }
+        auto large = LargeBinaryColumn::create();
+        auto& large_offsets = large->get_offset();
+        large_offsets.resize(_offsets.size());
+        large_offsets[0] = 0;
+        for (size_t i = 1; i < _offsets.size(); i++) {
+            // The difference of two wrapped-around offsets is still the right length.
+            large_offsets[i] = large_offsets[i - 1] + static_cast<uint32_t>(_offsets[i] - _offsets[i - 1]);
+        }
+        DCHECK_EQ(_bytes.size(), large_offsets.back());
+        large->get_bytes().swap(_bytes);
+        _offsets.resize(1, 0);
+        _slices_cache = false;
+        return large;
+    } else {
+        return nullptr;
+    }
+}
+
+template <typename T>
+ColumnPtr BinaryColumnBase<T>::downgrade() {
+    if constexpr (std::is_same_v<T, uint64_t>) {
+        if (_bytes.size() >= std::numeric_limits<uint32_t>::max()) {
+            return nullptr;
+        }
+        auto binary = BinaryColumn::create();
+        auto& offsets = binary->get_offset();
+        offsets.resize(_offsets.size());
+        for (size_t i = 0; i < _offsets.size(); i++) {
+            offsets[i] = static_cast<uint32_t>(_offsets[i]);
+        }
+        binary->get_bytes().swap(_bytes);
+        _offsets.resize(1, 0);
+        _slices_cache = false;
+        return binary;
+    } else {
+        return nullptr;
+    }
+}
+
+template <typename T>
+void BinaryColumnBase<T>::_build_slices() const {
     DCHECK(_offsets.size() > 0);
     _slices_cache = false;
     _slices.clear();
@@ -184,7 +267,8 @@ void BinaryColumn::_build_slices() const {
     _slices_cache = true;
 }
 
-void BinaryColumn::assign(size_t n, size_t idx) {
+template <typename T>
+void BinaryColumnBase<T>::assign(size_t n, size_t idx) {
     std::string value = std::string((char*)_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
     _bytes.clear();
     _offsets.clear();
@@ -199,26 +283,28 @@ void BinaryColumn::assign(size_t n, size_t idx) {
 }
 
 //TODO(kks): improve this
-void BinaryColumn::remove_first_n_values(size_t count) {
+template <typename T>
+void BinaryColumnBase<T>::remove_first_n_values(size_t count) {
     DCHECK_LE(count, _offsets.size() - 1);
     size_t remain_size = _offsets.size() - 1 - count;
 
     ColumnPtr column = cut(count, remain_size);
-    auto* binary_column = down_cast<BinaryColumn*>(column.get());
+    auto* binary_column = down_cast<BinaryColumnBase<T>*>(column.get());
     _offsets = std::move(binary_column->_offsets);
     _bytes = std::move(binary_column->_bytes);
     _slices_cache = false;
 }
 
-ColumnPtr BinaryColumn::cut(size_t start, size_t length) const {
-    auto result = create();
+template <typename T>
+ColumnPtr BinaryColumnBase<T>::cut(size_t start, size_t length) const {
+    auto result = this->create();
 
     if (start >= size() || length == 0) {
         return result;
     }
 
     size_t upper = std::min(start + length, _offsets.size());
-    size_t start_offset = _offsets[start];
+    T start_offset = _offsets[start];
 
     // offset re-compute
     result->get_offset().resize(upper - start + 1);
@@ -235,7 +321,8 @@ ColumnPtr BinaryColumn::cut(size_t start, size_t length) const {
     return result;
 }
 
-size_t BinaryColumn::filter_range(const Column::Filter& filter, size_t from, size_t to) {
+template <typename T>
+size_t BinaryColumnBase<T>::filter_range(const Column::Filter& filter, size_t from, size_t to) {
     auto start_offset = from;
     auto result_offset = from;
 
@@ -258,11 +345,11 @@ size_t BinaryColumn::filter_range(const Column::Filter& filter, size_t from, siz
             // all hit, copy all
 
             // copy data
-            uint32_t size = _offsets[start_offset + batch_nums] - _offsets[start_offset];
+            T size = _offsets[start_offset + batch_nums] - _offsets[start_offset];
             memmove(data + _offsets[result_offset], data + _offsets[start_offset], size);
 
             // set offsets, try vectorized
-            uint32_t* offset_data = _offsets.data();
+            T* offset_data = _offsets.data();
             for (int i = 0; i < batch_nums; ++i) {
                 // TODO: performance, all sub one same offset ?
                 offset_data[result_offset + i + 1] = offset_data[result_offset + i] +
@@ -279,7 +366,7 @@ size_t BinaryColumn::filter_range(const Column::Filter& filter, size_t from, siz
             while (i < batch_nums) {
                 mask = zero_count < 31 ? mask >> (zero_count + 1) : 0;
 
-                uint32_t size = _offsets[start_offset + i + 1] - _offsets[start_offset + i];
+                T size = _offsets[start_offset + i + 1] - _offsets[start_offset + i];
                 // copy date
                 memmove(data + _offsets[result_offset], data + _offsets[start_offset + i], size);
 
@@ -297,7 +384,7 @@ size_t BinaryColumn::filter_range(const Column::Filter& filter, size_t from, siz
     for (auto i = start_offset; i < to; ++i) {
         if (filter[i]) {
             DCHECK_GE(_offsets[i + 1], _offsets[i]);
-            uint32_t size = _offsets[i + 1] - _offsets[i];
+            T size = _offsets[i + 1] - _offsets[i];
             // copy date
             memmove(data + _offsets[result_offset], data + _offsets[i], size);
 
@@ -312,25 +399,28 @@ size_t BinaryColumn::filter_range(const Column::Filter& filter, size_t from, siz
     return result_offset;
 }
 
-int BinaryColumn::compare_at(size_t left, size_t right, const Column& rhs, int nan_direction_hint) const {
-    const BinaryColumn& right_column = down_cast<const BinaryColumn&>(rhs);
+template <typename T>
+int BinaryColumnBase<T>::compare_at(size_t left, size_t right, const Column& rhs, int nan_direction_hint) const {
+    const auto& right_column = down_cast<const BinaryColumnBase<T>&>(rhs);
     return get_slice(left).compare(right_column.get_slice(right));
 }
 
-uint32_t BinaryColumn::max_one_element_serialize_size() const {
+template <typename T>
+uint32_t BinaryColumnBase<T>::max_one_element_serialize_size() const {
     uint32_t max_size = 0;
     auto prev_offset = _offsets[0];
     for (size_t i = 0; i < _offsets.size() - 1; ++i) {
         auto curr_offset = _offsets[i + 1];
-        max_size = std::max(max_size, curr_offset - prev_offset);
+        max_size = std::max(max_size, static_cast<uint32_t>(curr_offset - prev_offset));
         prev_offset = curr_offset;
     }
     return max_size + sizeof(uint32_t);
 }
 
-uint32_t BinaryColumn::serialize(size_t idx, uint8_t* pos) {
+template <typename T>
+uint32_t BinaryColumnBase<T>::serialize(size_t idx, uint8_t* pos) {
     uint32_t binary_size = _offsets[idx + 1] - _offsets[idx];
-    uint32_t offset = _offsets[idx];
+    T offset = _offsets[idx];
 
     strings::memcpy_inlined(pos, &binary_size, sizeof(uint32_t));
     strings::memcpy_inlined(pos + sizeof(uint32_t), &_bytes[offset], binary_size);
@@ -338,20 +428,23 @@ uint32_t BinaryColumn::serialize(size_t idx, uint8_t* pos) {
     return sizeof(uint32_t) + binary_size;
 }
 
-uint32_t BinaryColumn::serialize_default(uint8_t* pos) {
+template <typename T>
+uint32_t BinaryColumnBase<T>::serialize_default(uint8_t* pos) {
     uint32_t binary_size = 0;
     strings::memcpy_inlined(pos, &binary_size, sizeof(uint32_t));
     return sizeof(uint32_t);
 }
 
-void BinaryColumn::serialize_batch(uint8_t* dst, Buffer<uint32_t>& slice_sizes, size_t chunk_size,
-                                   uint32_t max_one_row_size) {
+template <typename T>
+void BinaryColumnBase<T>::serialize_batch(uint8_t* dst, Buffer<uint32_t>& slice_sizes, size_t chunk_size,
+                                          uint32_t max_one_row_size) {
     for (size_t i = 0; i < chunk_size; ++i) {
         slice_sizes[i] += serialize(i, dst + i * max_one_row_size + slice_sizes[i]);
     }
 }
 
-const uint8_t* BinaryColumn::deserialize_and_append(const uint8_t* pos) {
+template <typename T>
+const uint8_t* BinaryColumnBase<T>::deserialize_and_append(const uint8_t* pos) {
     uint32_t string_size{};
     strings::memcpy_inlined(&string_size, pos, sizeof(uint32_t));
     pos += sizeof(uint32_t);
@@ -363,7 +456,8 @@ const uint8_t* BinaryColumn::deserialize_and_append(const uint8_t* pos) {
     return pos + string_size;
 }
 
-void BinaryColumn::deserialize_and_append_batch(std::vector<Slice>& srcs, size_t batch_size) {
+template <typename T>
+void BinaryColumnBase<T>::deserialize_and_append_batch(std::vector<Slice>& srcs, size_t batch_size) {
     uint32_t string_size = *((uint32_t*)srcs[0].data);
     _bytes.reserve(batch_size * string_size * 2);
     for (size_t i = 0; i < batch_size; ++i) {
@@ -371,33 +465,54 @@ void BinaryColumn::deserialize_and_append_batch(std::vector<Slice>& srcs, size_t
     }
 }
 
-uint8_t* BinaryColumn::serialize_column(uint8_t* dst) {
-    uint32_t bytes_size = _bytes.size() * sizeof(uint8_t);
-    encode_fixed32_le(dst, bytes_size);
-    dst += sizeof(uint32_t);
+// The sizes are encoded with the width of offsets, so the format of BinaryColumn is unchanged.
+template <typename T>
+static inline void encode_offset(uint8_t* dst, T value) {
+    if constexpr (std::is_same_v<T, uint32_t>) {
+        encode_fixed32_le(dst, value);
+    } else {
+        encode_fixed64_le(dst, value);
+    }
+}
+
+template <typename T>
+static inline T decode_offset(const uint8_t* src) {
+    if constexpr (std::is_same_v<T, uint32_t>) {
+        return decode_fixed32_le(src);
+    } else {
+        return decode_fixed64_le(src);
+    }
+}
+
+template <typename T>
+uint8_t* BinaryColumnBase<T>::serialize_column(uint8_t* dst) {
+    T bytes_size = _bytes.size() * sizeof(uint8_t);
+    encode_offset<T>(dst, bytes_size);
+    dst += sizeof(T);
 
     strings::memcpy_inlined(dst, _bytes.data(), bytes_size);
     dst += bytes_size;
 
-    uint32_t offsets_size = _offsets.size() * sizeof(Offset);
-    encode_fixed32_le(dst, offsets_size);
-    dst += sizeof(uint32_t);
+    T offsets_size = _offsets.size() * sizeof(Offset);
+    encode_offset<T>(dst, offsets_size);
+    dst += sizeof(T);
 
     strings::memcpy_inlined(dst, _offsets.data(), offsets_size);
     dst += offsets_size;
     return dst;
 }
 
-const uint8_t* BinaryColumn::deserialize_column(const uint8_t* src) {
-    uint32_t bytes_size = decode_fixed32_le(src);
-    src += sizeof(uint32_t);
+template <typename T>
+const uint8_t* BinaryColumnBase<T>::deserialize_column(const uint8_t* src) {
+    T bytes_size = decode_offset<T>(src);
+    src += sizeof(T);
 
     _bytes.resize(bytes_size);
     strings::memcpy_inlined(_bytes.data(), src, bytes_size);
     src += bytes_size;
 
-    uint32_t offsets_size = decode_fixed32_le(src);
-    src += sizeof(uint32_t);
+    T offsets_size = decode_offset<T>(src);
+    src += sizeof(T);
 
     _offsets.resize(offsets_size / sizeof(Offset));
     strings::memcpy_inlined(_offsets.data(), src, offsets_size);
@@ -405,26 +520,30 @@ const uint8_t* BinaryColumn::deserialize_column(const uint8_t* src) {
     return src;
 }
 
-void BinaryColumn::fvn_hash(uint32_t* hashes, uint16_t from, uint16_t to) const {
+template <typename T>
+void BinaryColumnBase<T>::fvn_hash(uint32_t* hashes, uint16_t from, uint16_t to) const {
     for (uint16_t i = from; i < to; ++i) {
         hashes[i] = HashUtil::fnv_hash(_bytes.data() + _offsets[i], _offsets[i + 1] - _offsets[i], hashes[i]);
     }
 }
 
-void BinaryColumn::crc32_hash(uint32_t* hashes, uint16_t from, uint16_t to) const {
+template <typename T>
+void BinaryColumnBase<T>::crc32_hash(uint32_t* hashes, uint16_t from, uint16_t to) const {
     // keep hash if _bytes is empty
     for (uint16_t i = from; i < to && !_bytes.empty(); ++i) {
         hashes[i] = HashUtil::zlib_crc_hash(_bytes.data() + _offsets[i], _offsets[i + 1] - _offsets[i], hashes[i]);
     }
 }
 
-void BinaryColumn::put_mysql_row_buffer(MysqlRowBuffer* buf, size_t idx) const {
-    uint32_t start = _offsets[idx];
-    uint32_t len = _offsets[idx + 1] - start;
+template <typename T>
+void BinaryColumnBase<T>::put_mysql_row_buffer(MysqlRowBuffer* buf, size_t idx) const {
+    T start = _offsets[idx];
+    T len = _offsets[idx + 1] - start;
     buf->push_string((const char*)_bytes.data() + start, len);
 }
 
-std::string BinaryColumn::debug_item(uint32_t idx) const {
+template <typename T>
+std::string BinaryColumnBase<T>::debug_item(uint32_t idx) const {
     std::string s;
     auto slice = get_slice(idx);
     s.reserve(slice.size + 2);
@@ -434,4 +553,7 @@ std::string BinaryColumn::debug_item(uint32_t idx) const {
     return s;
 }
 
+template class BinaryColumnBase<uint32_t>;
+template class BinaryColumnBase<uint64_t>;
+
 } // namespace starrocks::vectorized
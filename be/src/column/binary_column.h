@@ -8,14 +8,22 @@
 
 namespace starrocks::vectorized {
 
-class BinaryColumn final : public ColumnFactory<Column, BinaryColumn> {
-    friend class ColumnFactory<Column, BinaryColumn>;
+// BinaryColumnBase stores strings in one byte array, with an offset array of type `T`.
+//
+// BinaryColumn (32-bit offsets) is the column type of string values everywhere. LargeBinaryColumn
+// (64-bit offsets) is only used by operators materializing their whole input into one chunk,
+// e.g. the build side of hash join and full sort, which call upgrade_if_overflow() once a column
+// reaches the 4GB limit of 32-bit offsets, and downgrade() before handing chunks downstream.
+// Expressions and the storage layer only see BinaryColumn.
+template <typename T>
+class BinaryColumnBase final : public ColumnFactory<Column, BinaryColumnBase<T>> {
+    friend class ColumnFactory<Column, BinaryColumnBase>;
 
 public:
     using ValueType = Slice;
 
-    using Offset = uint32_t;
-    using Offsets = Buffer<uint32_t>;
+    using Offset = T;
+    using Offsets = Buffer<T>;
 
     using Bytes = starrocks::raw::RawVectorPad16<uint8_t>;
 
@@ -23,8 +31,8 @@ public:
 
     // TODO(kks): when we create our own vector, we could let vector[-1] = 0,
     // and then we don't need explicitly emplace_back zero value
-    BinaryColumn() { _offsets.emplace_back(0); }
-    BinaryColumn(Bytes bytes, Offsets offsets) : _bytes(std::move(bytes)), _offsets(std::move(offsets)) {
+    BinaryColumnBase() { _offsets.emplace_back(0); }
+    BinaryColumnBase(Bytes bytes, Offsets offsets) : _bytes(std::move(bytes)), _offsets(std::move(offsets)) {
         if (_offsets.empty()) {
             _offsets.emplace_back(0);
         }
@@ -32,29 +40,30 @@ public:
 
     // Copy constructor
     // NOTE: do *NOT* copy |_slices|
-    BinaryColumn(const BinaryColumn& rhs) : _bytes(rhs._bytes), _offsets(rhs._offsets) {}
+    BinaryColumnBase(const BinaryColumnBase& rhs) : _bytes(rhs._bytes), _offsets(rhs._offsets) {}
 
     // Move constructor
     // NOTE: do *NOT* copy |_slices|
-    BinaryColumn(BinaryColumn&& rhs) : _bytes(std::move(rhs._bytes)), _offsets(std::move(rhs._offsets)) {}
+    BinaryColumnBase(BinaryColumnBase&& rhs) : _bytes(std::move(rhs._bytes)), _offsets(std::move(rhs._offsets)) {}
 
     // Copy assignment
-    BinaryColumn& operator=(const BinaryColumn& rhs) {
-        BinaryColumn tmp(rhs);
+    BinaryColumnBase& operator=(const BinaryColumnBase& rhs) {
+        BinaryColumnBase tmp(rhs);
         this->swap_column(tmp);
         return *this;
     }
 
     // Move assignment
-    BinaryColumn& operator=(BinaryColumn&& rhs) {
-        BinaryColumn tmp(std::move(rhs));
+    BinaryColumnBase& operator=(BinaryColumnBase&& rhs) {
+        BinaryColumnBase tmp(std::move(rhs));
         this->swap_column(tmp);
         return *this;
     }
 
-    ~BinaryColumn() override {
+    ~BinaryColumnBase() override {
         if (!_offsets.empty()) {
-            DCHECK_EQ(_bytes.size(), _offsets.back());
+            // offsets may have wrapped around if the column was upgraded after it overflowed.
+            DCHECK_EQ(static_cast<T>(_bytes.size()), _offsets.back());
         } else {
             DCHECK_EQ(_bytes.size(), 0);
         }
@@ -62,6 +71,11 @@ public:
 
     bool low_cardinality() const override { return false; }
     bool is_binary() const override { return true; }
+    bool has_large_column() const override { return std::is_same_v<T, uint64_t>; }
+
+    ColumnPtr upgrade_if_overflow() override;
+
+    ColumnPtr downgrade() override;
 
     const uint8_t* raw_data() const override {
         if (!_slices_cache) {
@@ -88,7 +102,7 @@ public:
         return (_offsets[from + size] - _offsets[from]) + size * sizeof(Offset);
     }
 
-    size_t byte_size(size_t idx) const override { return _offsets[idx + 1] - _offsets[idx] + sizeof(uint32_t); }
+    size_t byte_size(size_t idx) const override { return _offsets[idx + 1] - _offsets[idx] + sizeof(Offset); }
 
     Slice get_slice(size_t idx) const {
         return Slice(_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
@@ -182,18 +196,20 @@ public:
 
     void deserialize_and_append_batch(std::vector<Slice>& srcs, size_t batch_size) override;
 
-    uint32_t serialize_size(size_t idx) const override { return sizeof(uint32_t) + _offsets[idx + 1] - _offsets[idx]; }
+    uint32_t serialize_size(size_t idx) const override {
+        return sizeof(uint32_t) + static_cast<uint32_t>(_offsets[idx + 1] - _offsets[idx]);
+    }
 
     size_t serialize_size() const override {
         DCHECK_EQ(_bytes.size(), _offsets.back());
-        return byte_size() + sizeof(uint32_t) * 2; // _offsets size + _bytes size;
+        return byte_size() + sizeof(Offset) * 2; // _offsets size + _bytes size;
     }
 
     uint8_t* serialize_column(uint8_t* dst) override;
 
     const uint8_t* deserialize_column(const uint8_t* src) override;
 
-    MutableColumnPtr clone_empty() const override { return create_mutable(); }
+    MutableColumnPtr clone_empty() const override { return this->create_mutable(); }
 
     ColumnPtr cut(size_t start, size_t length) const;
     size_t filter_range(const Column::Filter& filter, size_t start, size_t to) override;
@@ -240,9 +256,9 @@ public:
     }
 
     void swap_column(Column& rhs) override {
-        auto& r = down_cast<BinaryColumn&>(rhs);
+        auto& r = down_cast<BinaryColumnBase&>(rhs);
         using std::swap;
-        swap(_delete_state, r._delete_state);
+        swap(this->_delete_state, r._delete_state);
         swap(_bytes, r._bytes);
         swap(_offsets, r._offsets);
         swap(_slices, r._slices);
@@ -273,8 +289,20 @@ public:
     }
 
 private:
+    template <typename>
+    friend class BinaryColumnBase;
+
     void _build_slices() const;
 
+    template <typename S>
+    void _append(const BinaryColumnBase<S>& src, size_t offset, size_t count);
+
+    template <typename S>
+    void _append_selective(const BinaryColumnBase<S>& src, const uint32_t* indexes, uint32_t from, uint32_t size);
+
+    template <typename S>
+    void _append_value_multiple_times(const BinaryColumnBase<S>& src, uint32_t index, uint32_t size);
+
     Bytes _bytes;
     Offsets _offsets;
 
@@ -282,5 +310,9 @@ private:
     mutable bool _slices_cache = false;
 };
 
+using BinaryColumn = BinaryColumnBase<uint32_t>;
+using LargeBinaryColumn = BinaryColumnBase<uint64_t>;
+
 using Offsets = BinaryColumn::Offsets;
+using LargeOffsets = LargeBinaryColumn::Offsets;
 } // namespace starrocks::vectorized
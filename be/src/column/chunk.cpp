@@ -5,9 +5,11 @@
 #include "column/column_helper.h"
 #include "column/datum_tuple.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "gen_cpp/data.pb.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptors.h"
+#include "simd/simd.h"
 #include "util/coding.h"
 
 namespace starrocks::vectorized {
@@ -45,6 +47,7 @@ void Chunk::reset() {
         c->reset_column();
     }
     _delete_state = DEL_NOT_SATISFIED;
+    _selection.clear();
 }
 
 void Chunk::swap_chunk(Chunk& other) {
@@ -54,12 +57,18 @@ void Chunk::swap_chunk(Chunk& other) {
     _slot_id_to_index.swap(other._slot_id_to_index);
     _tuple_id_to_index.swap(other._tuple_id_to_index);
     std::swap(_delete_state, other._delete_state);
+    _selection.swap(other._selection);
+    std::swap(_num_selected_rows, other._num_selected_rows);
 }
 
 void Chunk::set_num_rows(size_t count) {
     for (ColumnPtr& c : _columns) {
         c->resize(count);
     }
+    if (has_selection()) {
+        _selection.resize(count, 1);
+        _update_selection();
+    }
 }
 
 std::string Chunk::get_column_name(size_t idx) const {
@@ -276,16 +285,74 @@ void Chunk::append_selective(const Chunk& src, const uint32_t* indexes, uint32_t
 }
 
 size_t Chunk::filter(const Buffer<uint8_t>& selection) {
-    for (auto& column : _columns) {
-        column->filter(selection);
-    }
-    return num_rows();
+    return filter_range(selection, 0, selection.size());
 }
 
 size_t Chunk::filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to) {
     for (auto& column : _columns) {
         column->filter_range(selection, from, to);
     }
+    if (has_selection()) {
+        size_t new_size = from;
+        for (size_t i = from; i < _selection.size(); i++) {
+            if (i >= to || selection[i]) {
+                _selection[new_size++] = _selection[i];
+            }
+        }
+        _selection.resize(new_size);
+        _update_selection();
+    }
+    return num_rows();
+}
+
+void Chunk::set_selection(Buffer<uint8_t>&& selection) {
+    DCHECK_EQ(selection.size(), num_rows());
+    _selection = std::move(selection);
+    _update_selection();
+}
+
+void Chunk::_update_selection() {
+    _num_selected_rows = SIMD::count_nonzero(_selection.data(), _selection.size());
+    if (_num_selected_rows == _selection.size()) {
+        _selection.clear();
+    }
+}
+
+Buffer<uint8_t> Chunk::release_selection() {
+    Buffer<uint8_t> selection;
+    selection.swap(_selection);
+    return selection;
+}
+
+size_t Chunk::materialize_selection() {
+    if (has_selection()) {
+        Buffer<uint8_t> selection = release_selection();
+        // A projection may output one column under several slots, or wrap the column of another
+        // slot in a NullableColumn, so every underlying column is filtered only once.
+        std::vector<const Column*> filtered;
+        auto is_filtered = [&filtered](const Column* column) {
+            return std::find(filtered.begin(), filtered.end(), column) != filtered.end();
+        };
+        for (auto& column : _columns) {
+            if (is_filtered(column.get())) {
+                continue;
+            }
+            if (column->is_nullable() && !column->is_constant()) {
+                auto* nullable_column = down_cast<NullableColumn*>(column.get());
+                const Column* data_column = nullable_column->data_column().get();
+                if (is_filtered(data_column)) {
+                    nullable_column->mutable_null_column()->filter(selection);
+                    nullable_column->update_has_null();
+                } else {
+                    column->filter(selection);
+                    filtered.emplace_back(data_column);
+                }
+            } else {
+                column->filter(selection);
+            }
+            filtered.emplace_back(column.get());
+        }
+    }
     return num_rows();
 }
 
@@ -356,6 +423,10 @@ void Chunk::check_or_die() {
             CHECK_EQ(num_rows(), c->size());
         }
     }
+    if (has_selection()) {
+        CHECK_EQ(num_rows(), _selection.size());
+        CHECK_EQ(_num_selected_rows, SIMD::count_nonzero(_selection.data(), _selection.size()));
+    }
 
     if (_schema != nullptr) {
         for (const auto& kv : _cid_to_index) {
@@ -417,4 +488,35 @@ bool Chunk::has_const_column() const {
     return false;
 }
 
+bool Chunk::has_large_column() const {
+    for (const auto& c : _columns) {
+        if (c->has_large_column()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Chunk::upgrade_if_overflow() {
+    for (auto& c : _columns) {
+        ColumnPtr column = c->upgrade_if_overflow();
+        if (column != nullptr) {
+            c = std::move(column);
+        }
+    }
+}
+
+Status Chunk::downgrade() {
+    for (auto& c : _columns) {
+        ColumnPtr column = c->downgrade();
+        if (column != nullptr) {
+            c = std::move(column);
+        }
+        if (c->has_large_column()) {
+            return Status::InternalError("column holds too much data to downgrade to 32-bit offsets");
+        }
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks::vectorized
@@ -174,6 +174,28 @@ public:
     // Return the number of rows after filter.
     size_t filter_range(const Buffer<uint8_t>& selection, size_t from, size_t to);
 
+    // Instead of being compacted after each filter, a chunk may carry a selection vector:
+    // the n-th row is filtered out if selection()[n] is zero. Physical row operations such as
+    // filter, filter_range and set_num_rows work on all rows and keep the selection aligned.
+    // Only the nodes that asked their child for it, see ExecNode::set_keep_selection, get a
+    // chunk with a selection.
+    bool has_selection() const { return !_selection.empty(); }
+    const Buffer<uint8_t>& selection() const { return _selection; }
+
+    // The size of |selection| must be equal to the number of rows, a selection keeping all
+    // rows is dropped.
+    void set_selection(Buffer<uint8_t>&& selection);
+
+    // Take the selection out of this chunk, leaving the chunk without selection.
+    Buffer<uint8_t> release_selection();
+
+    // The number of rows not filtered out by the selection.
+    size_t num_selected_rows() const { return has_selection() ? _num_selected_rows : num_rows(); }
+
+    // Remove the rows filtered out by the selection and drop it.
+    // Return the number of rows after filter.
+    size_t materialize_selection();
+
     // Return the data of n-th row.
     // This method is relatively slow and mainly used for unit tests now.
     DatumTuple get(size_t n) const;
@@ -214,6 +236,14 @@ public:
 
     bool has_const_column() const;
 
+    // Whether any column uses 64-bit offsets, see LargeBinaryColumn.
+    bool has_large_column() const;
+    // Switch the binary columns reaching the 4GB limit of 32-bit offsets to 64-bit offsets.
+    void upgrade_if_overflow();
+    // Switch the columns using 64-bit offsets back to 32-bit offsets, fails if some column
+    // holds 4GB or more data.
+    Status downgrade();
+
 #ifndef NDEBUG
     // check whether the internal state is consistent, abort the program if check failed.
     void check_or_die();
@@ -236,6 +266,8 @@ public:
 
 private:
     void rebuild_cid_index();
+    // Refresh _num_selected_rows, and drop the selection if it keeps all rows.
+    void _update_selection();
 
     Columns _columns;
     std::shared_ptr<Schema> _schema;
@@ -244,6 +276,9 @@ private:
     butil::FlatMap<SlotId, size_t> _slot_id_to_index;
     butil::FlatMap<TupleId, size_t> _tuple_id_to_index;
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
+    // Empty if all rows are selected.
+    Buffer<uint8_t> _selection;
+    size_t _num_selected_rows = 0;
 };
 
 inline const ColumnPtr& Chunk::get_column_by_name(const std::string& column_name) const {
@@ -305,6 +305,20 @@ public:
 
     virtual void reset_column() { _delete_state = DEL_NOT_SATISFIED; }
 
+    // Whether this column, or a column nested in it, is a binary column with 64-bit offsets.
+    virtual bool has_large_column() const { return false; }
+
+    // If this binary column reaches the 4GB limit of 32-bit offsets, move its data to a new column
+    // using 64-bit offsets and return it, otherwise return nullptr. Columns nesting others
+    // (e.g. NullableColumn) upgrade the nested column in place and return nullptr.
+    // It's fine to call this after the offsets have overflowed, as long as every string is
+    // shorter than 4GB.
+    virtual ColumnPtr upgrade_if_overflow() { return nullptr; }
+
+    // The reverse of upgrade_if_overflow(): move the data to a new column using 32-bit offsets
+    // if this column uses 64-bit offsets and its data fits in 4GB, otherwise return nullptr.
+    virtual ColumnPtr downgrade() { return nullptr; }
+
 protected:
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
 };
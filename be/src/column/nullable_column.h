@@ -247,6 +247,24 @@ public:
         _has_null = false;
     }
 
+    bool has_large_column() const override { return _data_column->has_large_column(); }
+
+    ColumnPtr upgrade_if_overflow() override {
+        ColumnPtr column = _data_column->upgrade_if_overflow();
+        if (column != nullptr) {
+            _data_column = std::move(column);
+        }
+        return nullptr;
+    }
+
+    ColumnPtr downgrade() override {
+        ColumnPtr column = _data_column->downgrade();
+        if (column != nullptr) {
+            _data_column = std::move(column);
+        }
+        return nullptr;
+    }
+
     std::string debug_item(uint32_t idx) const override {
         DCHECK(_null_column->size() == _data_column->size());
         std::stringstream ss;
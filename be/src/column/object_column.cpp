@@ -3,9 +3,11 @@
 #include "column/object_column.h"
 
 #include "gutil/casts.h"
+#include "gutil/strings/fastmem.h"
 #include "storage/hll.h"
 #include "util/bitmap_value.h"
 #include "util/mysql_row_buffer.h"
+#include "util/raw_container.h"
 
 namespace starrocks::vectorized {
 
@@ -98,6 +100,33 @@ bool ObjectColumn<T>::append_strings(const vector<starrocks::Slice>& strs) {
     return true;
 }
 
+// Bitmaps read from storage are mostly counted or merged into an aggregate state, so they
+// are kept frozen in one shared buffer instead of being deserialized one by one.
+template <>
+bool ObjectColumn<BitmapValue>::append_strings(const vector<starrocks::Slice>& strs) {
+    size_t total_size = 0;
+    for (const Slice& s : strs) {
+        total_size += s.size;
+    }
+    auto buffer = std::make_shared<std::string>();
+    raw::stl_string_resize_uninitialized(buffer.get(), total_size);
+
+    _pool.reserve(_pool.size() + strs.size());
+    char* pos = buffer->data();
+    for (const Slice& s : strs) {
+        if (s.size == 0) {
+            _pool.emplace_back(s);
+            continue;
+        }
+        strings::memcpy_inlined(pos, s.data, s.size);
+        _pool.emplace_back(Slice(pos, s.size), buffer);
+        pos += s.size;
+    }
+
+    _cache_ok = false;
+    return true;
+}
+
 template <typename T>
 void ObjectColumn<T>::append_value_multiple_times(const void* value, size_t count) {
     const Slice* slice = reinterpret_cast<const Slice*>(value);
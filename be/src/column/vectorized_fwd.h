@@ -1,5 +1,6 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -30,7 +31,11 @@ template <typename T>
 using Buffer = std::vector<T>;
 
 class ArrayColumn;
-class BinaryColumn;
+
+template <typename T>
+class BinaryColumnBase;
+using BinaryColumn = BinaryColumnBase<uint32_t>;
+using LargeBinaryColumn = BinaryColumnBase<uint64_t>;
 
 template <typename T>
 class FixedLengthColumn;
@@ -62,6 +62,10 @@ CONF_mInt64(tc_free_memory_rate, "20");
 //            https://github.com/gperftools/gperftools/issues/1111
 CONF_Int64(tc_max_total_thread_cache_bytes, "1073741824");
 
+// Whether to charge every tcmalloc allocation to the memory tracker of the allocating thread
+// through allocator hooks, instead of the explicit accounting of some operators.
+CONF_Bool(enable_mem_hook, "false");
+
 // process memory limit specified as number of bytes
 // ('<int>[bB]?'), megabytes ('<float>[mM]'), gigabytes ('<float>[gG]'),
 // or percentage of the physical memory ('<int>%').
@@ -199,6 +203,12 @@ CONF_mInt32(doris_scan_range_row_count, "524288");
 CONF_mInt32(doris_scanner_queue_size, "1024");
 // single read execute fragment row size
 CONF_mInt32(doris_scanner_row_num, "16384");
+// Scan tasks of a query get lower priority in the scanner thread pool each time the scan time
+// taken by the query doubles, counted in slices of this time.
+CONF_mInt64(scan_query_time_slice_ms, "100");
+// The maximum number of scan tasks of one query running at the same time before the other tasks of
+// the query get the lowest priority. 0 means no quota.
+CONF_mInt32(scan_tasks_per_query_quota, "0");
 // number of max scan keys
 CONF_mInt32(doris_max_scan_key_num, "1024");
 // the max number of push down values of a single column.
@@ -234,7 +244,18 @@ CONF_String(storage_root_path, "${STARROCKS_HOME}/storage");
 // BE process will exit if the percentage of error disk reach this value.
 CONF_mInt32(max_percentage_of_error_disk, "0");
 // CONF_Int32(default_num_rows_per_data_block, "1024");
+// The number of rows of each block of the short key index, unless the table sets its own.
 CONF_mInt32(default_num_rows_per_column_file_block, "1024");
+// The maximum number of key columns encoded by the short key index. The key columns beyond the
+// short key columns of the table are indexed up to the first CHAR/VARCHAR column, whose encoded
+// prefix is truncated. 0 to index the short key columns only. The last key of every block is written
+// too if more columns are indexed. Changes the segment format, see the note above
+// dictionary_encoding_ratio_for_non_string_column.
+CONF_mInt32(short_key_index_max_columns, "0");
+// Also write the last key of every block of the short key index, which lets a key lookup start at
+// the first block that may contain the key instead of the block before it. Changes the segment format
+// like short_key_index_max_columns.
+CONF_mBool(short_key_index_write_block_max_key, "false");
 CONF_Int32(max_tablet_num_per_shard, "1024");
 // pending data policy
 CONF_mInt32(pending_data_expire_time_sec, "1800");
@@ -262,7 +283,12 @@ CONF_String(storage_page_cache_limit, "0");
 // whether to disable page cache feature in storage
 CONF_Bool(disable_storage_page_cache, "true");
 
-CONF_mInt32(base_compaction_check_interval_seconds, "60");
+// Local disk cache for blocks of remote (HDFS) files read by HdfsScanNode.
+// Block cache is disabled when block_cache_disk_size is smaller than block_cache_block_size.
+CONF_String(block_cache_disk_path, "${STARROCKS_HOME}/block_cache");
+CONF_Int64(block_cache_disk_size, "0");
+CONF_Int64(block_cache_block_size, "1048576");
+
 CONF_mInt64(base_compaction_num_cumulative_deltas, "5");
 CONF_Int32(base_compaction_num_threads_per_disk, "1");
 CONF_mDouble(base_cumulative_delta_ratio, "0.3");
@@ -296,6 +322,25 @@ CONF_mInt64(min_compaction_failure_interval_sec, "120"); // 2 min
 // This config can be set to 0, which means to forbid any compaction, for some special cases.
 CONF_Int32(max_compaction_concurrency, "-1");
 
+// Max number of base and cumulative compaction tasks running on one disk at the same time.
+// <= 0 means only max_compaction_concurrency limits the tasks.
+CONF_mInt32(compaction_max_tasks_per_disk, "2");
+// Bytes merged per second by compaction tasks on one disk, in MB. 0 means unlimited.
+CONF_mInt64(compaction_disk_io_mbytes_per_sec, "0");
+// Compaction stops picking new tasks and pauses running tasks while query_scan_bytes_per_second
+// is larger than this value. 0 means compaction is never preempted by queries.
+CONF_mInt64(compaction_preempt_query_scan_bytes_per_second, "0");
+// Max seconds a running compaction task keeps pausing when preempted, since it holds tablet locks.
+CONF_mInt32(compaction_max_preempt_seconds, "60");
+// A compaction splits the key space of its input rowsets into at most this many ranges by
+// short key index and merges the ranges in parallel. <= 1 disables parallel merging.
+CONF_mInt32(compaction_max_parallel_ranges, "4");
+// Min bytes of input data merged by one range of a parallel compaction, so that only large
+// compaction (usually base compaction) is split.
+CONF_mInt64(compaction_min_bytes_per_parallel_range, "4294967296");
+// Number of threads merging the ranges of parallel compaction, shared by all compactions.
+CONF_Int32(compaction_parallel_merge_num_threads, "8");
+
 // Threshold to logging compaction trace, in seconds.
 CONF_mInt32(base_compaction_trace_threshold, "120");
 CONF_mInt32(cumulative_compaction_trace_threshold, "60");
@@ -319,6 +364,37 @@ CONF_Int32(number_tablet_writer_threads, "16");
 // turn off dictionary dictionary encoding. This only will detect first chunk
 // set to 1 means always use dictionary encoding
 CONF_Double(dictionary_encoding_ratio, "0.7");
+// The encodings below change the segment format and are off by default. The backends of older versions
+// fail to read the segments written with any of them, so enable them only once all the backends are
+// upgraded.
+//
+// Like dictionary_encoding_ratio but for int/bigint/date/datetime columns, whose dictionary encoded
+// pages fall back to bitshuffle once the dictionary page is full. 0 means never use dictionary encoding.
+CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
+// Use frame-of-reference encoding, which stores the deltas between consecutive values, for the int/bigint/
+// date/datetime columns that are not dictionary encoded and whose first rows are mostly ascending, e.g.
+// event time and auto-increment keys.
+CONF_Bool(enable_delta_encoding_for_ascending_column, "false");
+// Use decimal scaling encoding, which stores float/double values as integers scaled by a power of 10,
+// for the float/double columns whose first rows have few decimal digits, e.g. the readings of sensors.
+CONF_Bool(enable_decimal_scaling_encoding_for_float_column, "false");
+// The number of the first data pages of a fixed length column with the default encoding, which are
+// encoded by all the encodings and compressed by both the compression of the column and ZSTD, the
+// smallest combination of the sampled pages is used for the rest pages. 0 to disable the sampling.
+CONF_Int32(adaptive_encoding_sample_pages, "0");
+// ZSTD decompresses slower than LZ4, use it only if it saves at least this ratio of space more.
+CONF_Double(adaptive_encoding_zstd_min_space_saving, "0.1");
+// Compress the string columns not dictionary encoded by a symbol table built for each page, whose
+// values are read and compared for equality without decompressing the others.
+CONF_Bool(enable_fsst_encoding_for_string_column, "false");
+
+// Write the statistics of the values of each column, a HyperLogLog sketch of the distinct values
+// and an equi-depth histogram, into the footer of each segment. They take up to about 1KB per
+// column in the footers, which are kept in memory once the segments are opened. The backends of
+// older versions ignore them.
+CONF_Bool(enable_segment_column_statistics, "false");
+// The number of buckets of the equi-depth histogram of each column in a segment.
+CONF_Int32(segment_column_statistics_histogram_buckets, "16");
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 
@@ -561,6 +637,20 @@ CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// AND, OR and CASE evaluate their right operand or later branches only on the rows not
+// decided yet, when these rows are less than this ratio of the chunk. Otherwise the whole
+// chunk is evaluated, which is cheaper than copying most of the rows. 0 disables it.
+CONF_mDouble(expr_short_circuit_density_threshold, "0.5");
+
+// Conjuncts of a node are evaluated in the order adapted to their selectivity and cost measured
+// at runtime. They are measured on the first chunks and then once per this many chunks.
+// 0 means only the first chunks are measured.
+CONF_mInt32(conjuncts_reorder_sample_interval, "64");
+
+// When the parent of a node can read a selection vector, the filtered chunk is not compacted
+// as long as at least this ratio of its rows are selected. 1 means always compact.
+CONF_mDouble(chunk_selection_min_ratio, "0.8");
+
 // valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -571,6 +661,10 @@ CONF_Int32(late_materialization_ratio, "10");
 // `1000` will enable late materialization always select metric type.
 CONF_Int32(metric_late_materialization_ratio, "1000");
 
+// Evaluate a predicate on the run-length and frame-of-reference encoded values of its column to skip
+// the rows filtered out by it before reading any column.
+CONF_Bool(enable_predicate_evaluation_on_encoded_pages, "false");
+
 // Max batched bytes for each transmit request
 CONF_Int64(max_transmit_batched_bytes, "65536");
 
@@ -619,6 +713,20 @@ CONF_Int64(pipeline_yield_max_chunks_moved, "100");
 // yield PipelineDriver when maximum time in nano-seconds has spent
 // in current execution round.
 CONF_Int64(pipeline_yield_max_time_spent, "100000000");
+// resource groups of the pipeline engine, separated by ';', each of them is
+// `name:cpu_weight=<n>,mem_limit=<bytes or percent>,concurrency=<n>`, e.g.
+// "etl:cpu_weight=1,mem_limit=30%,concurrency=4;dashboard:cpu_weight=8".
+// The queries not classified into a group run in the group `default`.
+CONF_String(resource_groups, "");
+// classifiers of the queries into resource groups, separated by ';', each of them is
+// `group:user=<user>,query_type=<select|load|external>`, the first matched one is used.
+CONF_String(resource_group_classifiers, "");
+
+// capacity in bytes of the cache of per-tablet pre-aggregation results of the pipeline engine,
+// 0 disables the cache.
+CONF_Int64(query_cache_capacity, "0");
+// the results of a tablet larger than this are not cached.
+CONF_mInt64(query_cache_entry_max_bytes, "4194304");
 } // namespace config
 
 } // namespace starrocks
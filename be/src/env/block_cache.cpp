@@ -0,0 +1,277 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "env/block_cache.h"
+
+#include <algorithm>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "util/metrics.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+IntGauge g_block_cache_hit_count(MetricUnit::OPERATIONS);  // NOLINT
+IntGauge g_block_cache_miss_count(MetricUnit::OPERATIONS); // NOLINT
+IntGauge g_block_cache_hit_bytes(MetricUnit::BYTES);       // NOLINT
+IntGauge g_block_cache_miss_bytes(MetricUnit::BYTES);      // NOLINT
+IntGauge g_block_cache_used_bytes(MetricUnit::BYTES);      // NOLINT
+
+[[maybe_unused]] static void update_block_cache_metrics() {
+    BlockCache::Stats stats;
+    BlockCache::instance()->get_stats(&stats);
+    g_block_cache_hit_count.set_value(stats.hit_count);
+    g_block_cache_miss_count.set_value(stats.miss_count);
+    g_block_cache_hit_bytes.set_value(stats.hit_bytes);
+    g_block_cache_miss_bytes.set_value(stats.miss_bytes);
+    g_block_cache_used_bytes.set_value(stats.used_bytes);
+}
+
+BlockCache* BlockCache::_s_instance = nullptr;
+
+Status BlockCache::create_global_cache(const std::string& dir, size_t capacity, size_t block_size) {
+    if (_s_instance != nullptr || block_size == 0 || capacity < block_size) {
+        return Status::OK();
+    }
+    auto cache = std::make_unique<BlockCache>(dir, capacity, block_size);
+    RETURN_IF_ERROR(cache->init());
+    _s_instance = cache.release();
+#ifndef BE_TEST
+    MetricRegistry* reg = StarRocksMetrics::instance()->metrics();
+    reg->register_hook("block_cache_hook", update_block_cache_metrics);
+    reg->register_metric("block_cache_hit_count", &g_block_cache_hit_count);
+    reg->register_metric("block_cache_miss_count", &g_block_cache_miss_count);
+    reg->register_metric("block_cache_hit_bytes", &g_block_cache_hit_bytes);
+    reg->register_metric("block_cache_miss_bytes", &g_block_cache_miss_bytes);
+    reg->register_metric("block_cache_used_bytes", &g_block_cache_used_bytes);
+#endif
+    LOG(INFO) << "block cache initialized, dir=" << dir << ", capacity=" << capacity << ", block_size=" << block_size;
+    return Status::OK();
+}
+
+void BlockCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+std::string BlockCache::block_key(const std::string& path, int64_t modification_time, int64_t block_index) {
+    std::string key(path);
+    key.append((const char*)&modification_time, sizeof(modification_time));
+    key.append((const char*)&block_index, sizeof(block_index));
+    return key;
+}
+
+BlockCache::BlockCache(std::string dir, size_t capacity, size_t block_size)
+        : _dir(std::move(dir)), _block_size(block_size), _num_slots(block_size > 0 ? capacity / block_size : 0) {}
+
+BlockCache::~BlockCache() {
+    if (_data_file != nullptr) {
+        WARN_IF_ERROR(_data_file->close(), "fail to close block cache data file");
+    }
+}
+
+Status BlockCache::init() {
+    if (_num_slots == 0) {
+        return Status::InvalidArgument("block cache capacity is smaller than block size");
+    }
+    Env* env = Env::Default();
+    RETURN_IF_ERROR(env->create_dir_if_missing(_dir));
+    // Index is not persisted, so the old content is useless after restart.
+    RandomRWFileOptions opts;
+    opts.mode = Env::CREATE_OR_OPEN_WITH_TRUNCATE;
+    RETURN_IF_ERROR(env->new_random_rw_file(opts, _dir + "/block_cache.data", &_data_file));
+
+    _slots.resize(_num_slots);
+    _free_slots.reserve(_num_slots);
+    for (size_t i = _num_slots; i > 0; --i) {
+        _free_slots.push_back(i - 1);
+    }
+    return Status::OK();
+}
+
+void BlockCache::_touch(uint32_t slot_id) {
+    Slot& slot = _slots[slot_id];
+    if (slot.in_lru) {
+        _lru.splice(_lru.begin(), _lru, slot.lru_pos);
+    } else {
+        _lru.push_front(slot_id);
+        slot.lru_pos = _lru.begin();
+        slot.in_lru = true;
+    }
+}
+
+uint32_t BlockCache::_alloc_slot() {
+    if (!_free_slots.empty()) {
+        uint32_t slot_id = _free_slots.back();
+        _free_slots.pop_back();
+        return slot_id;
+    }
+    for (auto it = _lru.rbegin(); it != _lru.rend(); ++it) {
+        uint32_t slot_id = *it;
+        Slot& slot = _slots[slot_id];
+        if (slot.pins > 0) {
+            continue;
+        }
+        _index.erase(slot.key);
+        _lru.erase(slot.lru_pos);
+        slot.in_lru = false;
+        _used_bytes -= slot.size;
+        slot.key.clear();
+        slot.size = 0;
+        _evict_count++;
+        return slot_id;
+    }
+    return kInvalidSlot;
+}
+
+Status BlockCache::read(const std::string& key, size_t offset, const Slice& buf) {
+    uint32_t slot_id;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        auto it = _index.find(key);
+        if (it == _index.end() || offset + buf.size > _slots[it->second].size) {
+            _miss_count++;
+            _miss_bytes += buf.size;
+            return Status::NotFound("block not cached");
+        }
+        slot_id = it->second;
+        _slots[slot_id].pins++;
+        _touch(slot_id);
+    }
+    Status st = _data_file->read_at(static_cast<uint64_t>(slot_id) * _block_size + offset, buf);
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _slots[slot_id].pins--;
+    }
+    if (st.ok()) {
+        _hit_count++;
+        _hit_bytes += buf.size;
+    }
+    return st;
+}
+
+Status BlockCache::write(const std::string& key, const Slice& data) {
+    DCHECK_LE(data.size, _block_size);
+    if (data.size > _block_size) {
+        return Status::InvalidArgument(strings::Substitute("block size $0 exceeds $1", data.size, _block_size));
+    }
+    uint32_t slot_id;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_index.count(key) > 0) {
+            return Status::OK();
+        }
+        slot_id = _alloc_slot();
+        if (slot_id == kInvalidSlot) {
+            return Status::OK();
+        }
+        // Not visible in _index until data is on disk, pin it so that it won't be handed out twice.
+        _slots[slot_id].pins++;
+    }
+    Status st = _data_file->write_at(static_cast<uint64_t>(slot_id) * _block_size, data);
+
+    std::lock_guard<std::mutex> l(_lock);
+    Slot& slot = _slots[slot_id];
+    slot.pins--;
+    // Another writer may have cached the same block concurrently.
+    if (!st.ok() || _index.count(key) > 0) {
+        _free_slots.push_back(slot_id);
+        return st;
+    }
+    slot.key = key;
+    slot.size = data.size;
+    _index.emplace(key, slot_id);
+    _touch(slot_id);
+    _used_bytes += data.size;
+    return Status::OK();
+}
+
+void BlockCache::get_stats(Stats* stats) const {
+    stats->hit_count = _hit_count.load();
+    stats->miss_count = _miss_count.load();
+    stats->hit_bytes = _hit_bytes.load();
+    stats->miss_bytes = _miss_bytes.load();
+    stats->evict_count = _evict_count.load();
+    stats->used_bytes = _used_bytes.load();
+}
+
+CachedRandomAccessFile::CachedRandomAccessFile(std::shared_ptr<RandomAccessFile> file, BlockCache* cache,
+                                               uint64_t file_size, int64_t modification_time)
+        : _file(std::move(file)), _cache(cache), _file_size(file_size), _modification_time(modification_time) {}
+
+Status CachedRandomAccessFile::_read_block(int64_t block_index, size_t offset, const Slice& buf) const {
+    std::string key = BlockCache::block_key(_file->file_name(), _modification_time, block_index);
+    Status st = _cache->read(key, offset, buf);
+    if (st.ok()) {
+        _stats.hit_count++;
+        _stats.hit_bytes += buf.size;
+        return st;
+    }
+    if (!st.is_not_found()) {
+        LOG(WARNING) << "fail to read block cache, file=" << _file->file_name() << ", error=" << st.to_string();
+    }
+
+    uint64_t block_start = block_index * _cache->block_size();
+    size_t block_len = std::min<uint64_t>(_cache->block_size(), _file_size - block_start);
+    _block_buffer.resize(block_len);
+    RETURN_IF_ERROR(_file->read_at(block_start, Slice(_block_buffer)));
+    _stats.miss_count++;
+    _stats.miss_bytes += block_len;
+
+    st = _cache->write(key, Slice(_block_buffer));
+    if (!st.ok()) {
+        LOG(WARNING) << "fail to write block cache, file=" << _file->file_name() << ", error=" << st.to_string();
+    }
+    memcpy(buf.data, _block_buffer.data() + offset, buf.size);
+    return Status::OK();
+}
+
+Status CachedRandomAccessFile::read_at(uint64_t offset, const Slice& res) const {
+    if (offset + res.size > _file_size) {
+        return Status::InternalError(
+                strings::Substitute("fail to read enough data, file=$0, offset=$1, size=$2, file_size=$3",
+                                    _file->file_name(), offset, res.size, _file_size));
+    }
+    const size_t block_size = _cache->block_size();
+    size_t bytes_read = 0;
+    while (bytes_read < res.size) {
+        uint64_t cur = offset + bytes_read;
+        int64_t block_index = cur / block_size;
+        size_t offset_in_block = cur % block_size;
+        size_t to_read = std::min(res.size - bytes_read, block_size - offset_in_block);
+        RETURN_IF_ERROR(_read_block(block_index, offset_in_block, Slice(res.data + bytes_read, to_read)));
+        bytes_read += to_read;
+    }
+    return Status::OK();
+}
+
+Status CachedRandomAccessFile::read(uint64_t offset, Slice* res) const {
+    if (offset >= _file_size) {
+        res->size = 0;
+        return Status::OK();
+    }
+    res->size = std::min<uint64_t>(res->size, _file_size - offset);
+    return read_at(offset, *res);
+}
+
+Status CachedRandomAccessFile::readv_at(uint64_t offset, const Slice* res, size_t res_cnt) const {
+    for (size_t i = 0; i < res_cnt; ++i) {
+        RETURN_IF_ERROR(read_at(offset, res[i]));
+        offset += res[i].size;
+    }
+    return Status::OK();
+}
+
+Status CachedRandomAccessFile::size(uint64_t* size) const {
+    *size = _file_size;
+    return Status::OK();
+}
+
+void CachedRandomAccessFile::get_and_clear_stats(Stats* stats) {
+    *stats = _stats;
+    _stats = Stats();
+}
+
+} // namespace starrocks
@@ -0,0 +1,151 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "env/env.h"
+#include "gutil/macros.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// BlockCache keeps recently read blocks of remote files (HDFS, object store)
+// on a local disk. Cached data lives in one pre-sized data file which is split
+// into fixed-size slots; the index from block key to slot is kept in memory only,
+// so the cache starts empty after a restart.
+//
+// A block key is built from file path, file modification time and block index,
+// so a rewritten remote file never hits stale data.
+//
+// This class is thread-safe.
+class BlockCache {
+public:
+    struct Stats {
+        int64_t hit_count = 0;
+        int64_t miss_count = 0;
+        int64_t hit_bytes = 0;
+        int64_t miss_bytes = 0;
+        int64_t evict_count = 0;
+        int64_t used_bytes = 0;
+    };
+
+    // Create global instance of this class. Does nothing if capacity is smaller than one block.
+    static Status create_global_cache(const std::string& dir, size_t capacity, size_t block_size);
+
+    static void release_global_cache();
+
+    // Return global instance, nullptr if block cache is disabled.
+    static BlockCache* instance() { return _s_instance; }
+
+    static std::string block_key(const std::string& path, int64_t modification_time, int64_t block_index);
+
+    BlockCache(std::string dir, size_t capacity, size_t block_size);
+    ~BlockCache();
+
+    Status init();
+
+    size_t block_size() const { return _block_size; }
+    size_t capacity() const { return _num_slots * _block_size; }
+
+    // Read `buf.size` bytes starting at `offset` inside the cached block `key`.
+    // Return NotFound if the block is not cached or shorter than requested.
+    Status read(const std::string& key, size_t offset, const Slice& buf);
+
+    // Cache one block, `data.size` must not be larger than block_size().
+    // When all slots are in use the least recently used one is evicted. If the
+    // block cannot be cached (e.g. every slot is being read), OK is returned
+    // and nothing is cached.
+    Status write(const std::string& key, const Slice& data);
+
+    void get_stats(Stats* stats) const;
+
+private:
+    static constexpr uint32_t kInvalidSlot = UINT32_MAX;
+
+    struct Slot {
+        std::string key;
+        uint32_t size = 0;
+        // number of readers/writers currently accessing this slot on disk,
+        // pinned slot can not be evicted.
+        int32_t pins = 0;
+        bool in_lru = false;
+        std::list<uint32_t>::iterator lru_pos;
+    };
+
+    // Must hold _lock.
+    uint32_t _alloc_slot();
+    void _touch(uint32_t slot_id);
+
+    static BlockCache* _s_instance;
+
+    const std::string _dir;
+    const size_t _block_size;
+    const size_t _num_slots;
+
+    std::unique_ptr<RandomRWFile> _data_file;
+
+    mutable std::mutex _lock;
+    std::vector<Slot> _slots;
+    std::unordered_map<std::string, uint32_t> _index;
+    // most recently used slot at the front.
+    std::list<uint32_t> _lru;
+    std::vector<uint32_t> _free_slots;
+
+    std::atomic<int64_t> _hit_count{0};
+    std::atomic<int64_t> _miss_count{0};
+    std::atomic<int64_t> _hit_bytes{0};
+    std::atomic<int64_t> _miss_bytes{0};
+    std::atomic<int64_t> _evict_count{0};
+    std::atomic<int64_t> _used_bytes{0};
+
+    DISALLOW_COPY_AND_ASSIGN(BlockCache);
+};
+
+// CachedRandomAccessFile serves reads of a remote file from BlockCache and
+// falls back to the underlying file on miss, populating the cache with whole
+// blocks. Like HdfsRandomAccessFile, this is not thread-safe.
+class CachedRandomAccessFile final : public RandomAccessFile {
+public:
+    struct Stats {
+        int64_t hit_bytes = 0;
+        int64_t miss_bytes = 0;
+        int64_t hit_count = 0;
+        int64_t miss_count = 0;
+    };
+
+    CachedRandomAccessFile(std::shared_ptr<RandomAccessFile> file, BlockCache* cache, uint64_t file_size,
+                           int64_t modification_time);
+    ~CachedRandomAccessFile() override = default;
+
+    Status read(uint64_t offset, Slice* res) const override;
+    Status read_at(uint64_t offset, const Slice& res) const override;
+    Status readv_at(uint64_t offset, const Slice* res, size_t res_cnt) const override;
+
+    Status size(uint64_t* size) const override;
+    const std::string& file_name() const override { return _file->file_name(); }
+
+    RandomAccessFile* underlying_file() const { return _file.get(); }
+
+    // Return statistics accumulated since last call and reset them.
+    void get_and_clear_stats(Stats* stats);
+
+private:
+    Status _read_block(int64_t block_index, size_t offset, const Slice& buf) const;
+
+    std::shared_ptr<RandomAccessFile> _file;
+    BlockCache* _cache;
+    uint64_t _file_size;
+    int64_t _modification_time;
+    mutable std::string _block_buffer;
+    mutable Stats _stats;
+};
+
+} // namespace starrocks
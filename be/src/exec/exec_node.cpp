@@ -827,6 +827,14 @@ void ExecNode::eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorized:
     chunk->filter(*raw_filter);
 }
 
+void ExecNode::eval_conjuncts_adaptively(vectorized::Chunk* chunk) {
+    // conjuncts may be pushed down to this node until it is opened, so init lazily.
+    if (!_conjuncts_evaluator.initialized()) {
+        _conjuncts_evaluator.init(_conjunct_ctxs, _runtime_profile.get());
+    }
+    _conjuncts_evaluator.evaluate(chunk, keep_selection());
+}
+
 void ExecNode::eval_join_runtime_filters(vectorized::Chunk* chunk) {
     if (chunk == nullptr) return;
     _runtime_filter_collector.evaluate(chunk);
@@ -29,6 +29,7 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
+#include "exec/vectorized/adaptive_conjuncts_evaluator.h"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/bufferpool/buffer_pool.h"
@@ -184,6 +185,11 @@ public:
     static void eval_conjuncts(const std::vector<ExprContext*>& ctxs, vectorized::Chunk* chunk,
                                vectorized::FilterPtr* filter_ptr = nullptr);
 
+    // evaluate `_conjunct_ctxs` over chunk and filter it, in the order adapted to the
+    // selectivity and cost of the conjuncts measured at runtime. The result may be left as the
+    // selection of chunk if keep_selection().
+    void eval_conjuncts_adaptively(vectorized::Chunk* chunk);
+
     Status init_join_runtime_filters(const TPlanNode& tnode, RuntimeState* state);
     void register_runtime_filter_descriptor(RuntimeState* state, vectorized::RuntimeFilterProbeDescriptor* rf_desc);
     void eval_join_runtime_filters(vectorized::Chunk* chunk);
@@ -217,6 +223,12 @@ public:
     int64_t rows_returned() const { return _num_rows_returned; }
     int64_t limit() const { return _limit; }
     bool reached_limit() { return _limit != -1 && _num_rows_returned >= _limit; }
+
+    // Called by a parent reading Chunk::selection(), so the conjuncts of this node may filter out
+    // rows of the returned chunks by a selection vector instead of compacting them.
+    void set_keep_selection(bool keep) { _keep_selection = keep; }
+    // A node with a limit always compacts its chunks to cut them at the limit.
+    bool keep_selection() const { return _keep_selection && _limit == -1; }
     const std::vector<TupleId>& get_tuple_ids() const { return _tuple_ids; }
 
     RuntimeProfile* runtime_profile() { return _runtime_profile.get(); }
@@ -310,6 +322,8 @@ protected:
     std::vector<Expr*> _conjuncts;
     std::vector<ExprContext*> _conjunct_ctxs;
     std::vector<TupleId> _tuple_ids;
+    vectorized::AdaptiveConjunctsEvaluator _conjuncts_evaluator;
+    bool _keep_selection = false;
 
     vectorized::RuntimeFilterProbeCollector _runtime_filter_collector;
 
@@ -22,6 +22,8 @@
 #include "exec/hash_table.hpp"
 
 #include "exprs/expr.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_hook.h"
 #include "runtime/mem_tracker.h"
 #include "runtime/raw_value.h"
 #include "runtime/runtime_state.h"
@@ -55,7 +57,7 @@ HashTable::HashTable(const std::vector<ExprContext*>& build_expr_ctxs, const std
     _buckets.resize(num_buckets);
     _num_buckets = num_buckets;
     _num_buckets_till_resize = MAX_BUCKET_OCCUPANCY_FRACTION * _num_buckets;
-    _mem_tracker->consume(_buckets.capacity() * sizeof(Bucket));
+    _consume_memory(_buckets.capacity() * sizeof(Bucket));
 
     // Compute the layout and buffer size to store the evaluated expr results
     _results_buffer_size =
@@ -68,8 +70,7 @@ HashTable::HashTable(const std::vector<ExprContext*>& build_expr_ctxs, const std
     _nodes = reinterpret_cast<uint8_t*>(malloc(_nodes_capacity * _node_byte_size));
     memset(_nodes, 0, _nodes_capacity * _node_byte_size);
 
-    _mem_tracker->consume(_nodes_capacity * _node_byte_size);
-    if (_mem_tracker->limit_exceeded()) {
+    if (!_consume_memory(_nodes_capacity * _node_byte_size)) {
         mem_limit_exceeded(_nodes_capacity * _node_byte_size);
     }
 }
@@ -81,8 +82,20 @@ void HashTable::close() {
     delete[] _expr_values_buffer;
     delete[] _expr_value_null_bits;
     free(_nodes);
-    _mem_tracker->release(_nodes_capacity * _node_byte_size);
-    _mem_tracker->release(_buckets.size() * sizeof(Bucket));
+    if (!MemHook::installed()) {
+        _mem_tracker->release(_nodes_capacity * _node_byte_size);
+        _mem_tracker->release(_buckets.size() * sizeof(Bucket));
+    }
+}
+
+bool HashTable::_consume_memory(int64_t bytes) {
+    if (MemHook::installed()) {
+        // MemHook has charged the memory to the tracker of current thread, only check the limits.
+        CurrentThread::mem_tracker_flush();
+        return !_mem_tracker->any_limit_exceeded();
+    }
+    _mem_tracker->consume(bytes);
+    return !_mem_tracker->limit_exceeded();
 }
 
 bool HashTable::eval_row(TupleRow* row, const std::vector<ExprContext*>& ctxs) {
@@ -185,7 +198,13 @@ void HashTable::resize_buckets(int64_t num_buckets) {
 
     int64_t old_num_buckets = _num_buckets;
     int64_t delta_bytes = (num_buckets - old_num_buckets) * sizeof(Bucket);
-    if (!_mem_tracker->try_consume(delta_bytes)) {
+    if (MemHook::installed()) {
+        CurrentThread::mem_tracker_flush();
+        if (_mem_tracker->any_limit_exceeded()) {
+            mem_limit_exceeded(delta_bytes);
+            return;
+        }
+    } else if (!_mem_tracker->try_consume(delta_bytes)) {
         mem_limit_exceeded(delta_bytes);
         return;
     }
@@ -246,8 +265,7 @@ void HashTable::grow_node_array() {
     free(_nodes);
     _nodes = new_nodes;
 
-    _mem_tracker->consume(new_size - old_size);
-    if (_mem_tracker->limit_exceeded()) {
+    if (!_consume_memory(new_size - old_size)) {
         mem_limit_exceeded(new_size - old_size);
     }
 }
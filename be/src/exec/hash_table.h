@@ -321,6 +321,10 @@ private:
     // Grow the node array.
     void grow_node_array();
 
+    // Charge `bytes` allocated by the hash table to _mem_tracker, unless MemHook already
+    // charged them. Returns false if a memory limit is exceeded.
+    bool _consume_memory(int64_t bytes);
+
     // Sets _mem_tracker_exceeded to true and MEM_LIMIT_EXCEEDED for the query.
     // allocation_size is the attempted size of the allocation that would have
     // brought us over the mem limit.
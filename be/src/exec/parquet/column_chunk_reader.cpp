@@ -107,6 +107,32 @@ Status ColumnChunkReader::next_page() {
     return Status::OK();
 }
 
+Status ColumnChunkReader::next_header() {
+    return _parse_page_header();
+}
+
+bool ColumnChunkReader::current_page_is_data_page() const {
+    return _page_reader->current_header()->type == tparquet::PageType::DATA_PAGE;
+}
+
+uint32_t ColumnChunkReader::current_page_num_values() const {
+    return _page_reader->current_header()->data_page_header.num_values;
+}
+
+Status ColumnChunkReader::load_page() {
+    return _parse_page_data();
+}
+
+Status ColumnChunkReader::skip_page() {
+    if (_page_parse_state != PAGE_HEADER_PARSED) {
+        return Status::InternalError("Error state");
+    }
+    _page_reader->skip_page_data();
+    _num_values = 0;
+    _page_parse_state = PAGE_DATA_PARSED;
+    return Status::OK();
+}
+
 Status ColumnChunkReader::_parse_page_header() {
     DCHECK(_page_parse_state == INITIALIZED || _page_parse_state == PAGE_DATA_PARSED);
     RETURN_IF_ERROR(_page_reader->next_header());
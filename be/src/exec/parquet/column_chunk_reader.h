@@ -40,6 +40,22 @@ public:
 
     Status next_page();
 
+    // Parse header of next page only. Caller must call load_page() or skip_page()
+    // before parsing another header.
+    Status next_header();
+
+    // Return true if the page whose header was just parsed is a data page.
+    bool current_page_is_data_page() const;
+
+    // Number of values in the page whose header was just parsed.
+    uint32_t current_page_num_values() const;
+
+    // Read, decompress and parse the page whose header was just parsed.
+    Status load_page();
+
+    // Skip the page whose header was just parsed without reading its data.
+    Status skip_page();
+
     uint32_t num_values() const { return _num_values; }
 
     // Try to decode n definition levels into 'levels'
@@ -355,6 +355,15 @@ public:
 
     Status finish_batch() override { return Status::OK(); }
 
+    Status skip(size_t* num_records, vectorized::Column* dst) override {
+        if (!_need_convert) {
+            return _reader->skip_records(num_records, dst);
+        }
+        auto data_column = _create_column(_field->physical_type);
+        vectorized::ColumnPtr column = vectorized::NullableColumn::create(data_column, vectorized::NullColumn::create());
+        return _reader->skip_records(num_records, column.get());
+    }
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         _reader->get_levels(def_levels, rep_levels, num_levels);
     }
@@ -641,6 +650,13 @@ private:
     std::unique_ptr<ColumnReader> _element_reader;
 };
 
+Status ColumnReader::skip(size_t* num_records, vectorized::Column* dst) {
+    size_t old_size = dst->size();
+    Status st = next_batch(num_records, ColumnContentType::VALUE, dst);
+    dst->resize(old_size);
+    return st;
+}
+
 Status ColumnReader::create(RandomAccessFile* file, const ParquetField* field, const tparquet::RowGroup& row_group,
                             const TypeDescriptor& col_type, const ColumnReaderOptions& opts,
                             std::unique_ptr<ColumnReader>* output) {
@@ -45,6 +45,10 @@ public:
         return finish_batch();
     }
 
+    // Skip num_records records without materializing them. `dst` must be a column that
+    // next_batch accepts, it may be used as scratch space but is left unchanged.
+    virtual Status skip(size_t* num_records, vectorized::Column* dst);
+
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
 
     virtual Status get_dict_values(vectorized::Column* column) {
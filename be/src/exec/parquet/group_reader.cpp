@@ -6,6 +6,7 @@
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
 #include "exprs/expr.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/types.h"
 #include "simd/simd.h"
 #include "storage/vectorized/chunk_helper.h"
@@ -53,6 +54,24 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
         }
     }
 
+    if (!_lazy_read_columns.empty()) {
+        size_t hit_count = 0;
+        {
+            SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+            hit_count = _filter_active_columns(count);
+        }
+        {
+            SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
+            RETURN_IF_ERROR(_read_lazy_columns(count, hit_count));
+        }
+        _read_chunk->check_or_die();
+        *row_count = _read_chunk->num_rows();
+
+        SCOPED_RAW_TIMER(&_param.stats->group_dict_decode_ns);
+        RETURN_IF_ERROR(_dict_decode(chunk));
+        return status;
+    }
+
     // dict filter
     if (has_dict_filter) {
         SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
@@ -111,15 +130,20 @@ void GroupReader::_pre_process_columns_and_conjunct_ctxs() {
         if (_can_using_dict_filter(slots[chunk_index], conjunct_ctxs_by_slot, column_metadata)) {
             _dict_filter_columns.emplace_back(column);
             _dict_filter_conjunct_ctxs[slot_id] = conjunct_ctxs_by_slot.at(slot_id);
-        } else {
+        } else if (conjunct_ctxs_by_slot.find(slot_id) != conjunct_ctxs_by_slot.end()) {
             _direct_read_columns.emplace_back(column);
-            if (conjunct_ctxs_by_slot.find(slot_id) != conjunct_ctxs_by_slot.end()) {
-                for (ExprContext* ctx : conjunct_ctxs_by_slot.at(slot_id)) {
-                    _left_conjunct_ctxs.emplace_back(ctx);
-                }
+            for (ExprContext* ctx : conjunct_ctxs_by_slot.at(slot_id)) {
+                _left_conjunct_ctxs.emplace_back(ctx);
             }
+        } else {
+            _lazy_read_columns.emplace_back(column);
         }
     }
+
+    // Lazy read only pays off when there are filters on other columns.
+    if (_dict_filter_columns.empty() && _direct_read_columns.empty()) {
+        _direct_read_columns.swap(_lazy_read_columns);
+    }
 }
 
 bool GroupReader::_can_using_dict_filter(const SlotDescriptor* slot, const SlotIdExprContextsMap& conjunct_ctxs_by_slot,
@@ -278,33 +302,119 @@ void GroupReader::_init_read_chunk() {
 
 Status GroupReader::_read(size_t* row_count) {
     size_t count = *row_count;
+    if (!_dict_filter_columns.empty()) {
+        count = *row_count;
+        RETURN_IF_ERROR(_read_columns(_dict_filter_columns, ColumnContentType::DICT_CODE, &count));
+    }
+    if (!_direct_read_columns.empty()) {
+        count = *row_count;
+        RETURN_IF_ERROR(_read_columns(_direct_read_columns, ColumnContentType::VALUE, &count));
+    }
 
-    for (const auto& column : _dict_filter_columns) {
+    if (count != *row_count) {
+        *row_count = count;
+        return Status::EndOfFile("");
+    }
+
+    *row_count = count;
+    return Status::OK();
+}
+
+Status GroupReader::_read_columns(const std::vector<GroupReaderParam::Column>& columns,
+                                  ColumnContentType content_type, size_t* row_count) {
+    size_t count = *row_count;
+    for (const auto& column : columns) {
         SlotId slot_id = column.slot_id;
         count = *row_count;
-        Status status = _column_readers[slot_id]->next_batch(&count, ColumnContentType::DICT_CODE,
+        Status status = _column_readers[slot_id]->next_batch(&count, content_type,
                                                              _read_chunk->get_column_by_slot_id(slot_id).get());
         if (!status.ok() && !status.is_end_of_file()) {
             return status;
         }
     }
+    *row_count = count;
+    return Status::OK();
+}
+
+size_t GroupReader::_filter_active_columns(size_t count) {
+    if (count == 0) {
+        return 0;
+    }
 
+    // chunk of columns which have been read, shares columns with _read_chunk.
+    vectorized::Chunk active_chunk;
+    for (const auto& column : _dict_filter_columns) {
+        active_chunk.append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+    }
     for (const auto& column : _direct_read_columns) {
+        active_chunk.append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+    }
+
+    size_t hit_count = count;
+    if (!_dict_filter_preds.empty()) {
+        SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+        auto iter = _dict_filter_preds.begin();
+        iter->second->evaluate(active_chunk.get_column_by_slot_id(iter->first).get(), _selection.data());
+        while (++iter != _dict_filter_preds.end()) {
+            iter->second->evaluate_and(active_chunk.get_column_by_slot_id(iter->first).get(), _selection.data());
+        }
+        hit_count = SIMD::count_nonzero(_selection.data(), count);
+        if (hit_count == 0) {
+            active_chunk.set_num_rows(0);
+            return 0;
+        }
+        if (hit_count != count) {
+            active_chunk.filter_range(_selection, 0, count);
+        }
+    } else {
+        memset(_selection.data(), 1, count);
+    }
+
+    if (!_left_conjunct_ctxs.empty()) {
+        vectorized::FilterPtr filter;
+        ExecNode::eval_conjuncts(_left_conjunct_ctxs, &active_chunk, &filter);
+        if (active_chunk.num_rows() == 0) {
+            return 0;
+        }
+        if (active_chunk.num_rows() != hit_count) {
+            // map the filter of selected rows back to all rows of this batch.
+            const uint8_t* filter_data = filter->data();
+            for (size_t i = 0, j = 0; i < count; ++i) {
+                if (_selection[i]) {
+                    _selection[i] = filter_data[j++];
+                }
+            }
+            hit_count = active_chunk.num_rows();
+        }
+    }
+    return hit_count;
+}
+
+Status GroupReader::_read_lazy_columns(size_t count, size_t hit_count) {
+    for (const auto& column : _lazy_read_columns) {
         SlotId slot_id = column.slot_id;
-        count = *row_count;
-        Status status = _column_readers[slot_id]->next_batch(&count, ColumnContentType::VALUE,
-                                                             _read_chunk->get_column_by_slot_id(slot_id).get());
+        vectorized::Column* dst = _read_chunk->get_column_by_slot_id(slot_id).get();
+        size_t num_rows = count;
+        Status status;
+        if (hit_count == 0) {
+            status = _column_readers[slot_id]->skip(&num_rows, dst);
+        } else {
+            status = _column_readers[slot_id]->next_batch(&num_rows, ColumnContentType::VALUE, dst);
+        }
         if (!status.ok() && !status.is_end_of_file()) {
             return status;
         }
+        if (num_rows != count) {
+            return Status::Corruption(strings::Substitute("parquet row group has inconsistent row count, $0 vs $1",
+                                                          num_rows, count));
+        }
+        if (hit_count != 0 && hit_count != count) {
+            dst->filter_range(_selection, 0, count);
+        }
     }
-
-    if (count != *row_count) {
-        *row_count = count;
-        return Status::EndOfFile("");
+    if (hit_count == 0) {
+        _param.stats->late_materialize_skip_rows += count;
     }
-
-    *row_count = count;
     return Status::OK();
 }
 
@@ -359,6 +469,11 @@ Status GroupReader::_dict_decode(vectorized::ChunkPtr* chunk) {
         SlotId slot_id = column.slot_id;
         (*chunk)->get_column_by_slot_id(slot_id)->swap_column(*(_read_chunk->get_column_by_slot_id(slot_id)));
     }
+
+    for (const auto& column : _lazy_read_columns) {
+        SlotId slot_id = column.slot_id;
+        (*chunk)->get_column_by_slot_id(slot_id)->swap_column(*(_read_chunk->get_column_by_slot_id(slot_id)));
+    }
     return Status::OK();
 }
 } // namespace starrocks::parquet
\ No newline at end of file
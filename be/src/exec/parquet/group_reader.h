@@ -74,7 +74,14 @@ private:
     void _init_read_chunk();
 
     Status _read(size_t* row_count);
+    Status _read_columns(const std::vector<GroupReaderParam::Column>& columns, ColumnContentType content_type,
+                         size_t* row_count);
     void _dict_filter();
+    // Evaluate dict filter and conjuncts on the active columns of first `count` rows in _read_chunk,
+    // store the selection of these rows in _selection and return the number of selected rows.
+    size_t _filter_active_columns(size_t count);
+    // Read lazy columns of `count` rows, keep only rows selected in _selection.
+    Status _read_lazy_columns(size_t count, size_t hit_count);
     Status _dict_decode(vectorized::ChunkPtr* chunk);
 
     RandomAccessFile* _file;
@@ -101,6 +108,9 @@ private:
     std::vector<GroupReaderParam::Column> _dict_filter_columns;
     // direct read conlumns
     std::vector<GroupReaderParam::Column> _direct_read_columns;
+    // columns without conjuncts, they are read after the other columns are filtered,
+    // and are skipped without decoding when no row in the batch is selected.
+    std::vector<GroupReaderParam::Column> _lazy_read_columns;
 
     // dict value is empty after conjunct eval, file group can be skipped
     bool _is_group_filtered = false;
@@ -93,6 +93,8 @@ public:
         }
     }
 
+    Status skip_records(size_t* num_records, vectorized::Column* dst) override;
+
     void set_needs_levels(bool needs_levels) { _needs_levels = needs_levels; }
 
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
@@ -150,6 +152,8 @@ public:
 
     Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) override;
 
+    Status skip_records(size_t* num_rows, vectorized::Column* dst) override;
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) {
         *def_levels = nullptr;
         *rep_levels = nullptr;
@@ -167,6 +171,36 @@ private:
     size_t _num_values_left_in_cur_page = 0;
 };
 
+Status StoredColumnReader::skip_records(size_t* num_rows, vectorized::Column* dst) {
+    size_t old_size = dst->size();
+    Status st = read_records(num_rows, ColumnContentType::VALUE, dst);
+    dst->resize(old_size);
+    return st;
+}
+
+// Move to the next page which has values to read. Data pages whose values are all
+// to be skipped are not read from file, `*num_skipped` is increased by their values.
+// For non-repeated columns, one value in data page is one row.
+static Status next_page_skipping(ColumnChunkReader* reader, size_t num_to_skip, size_t* num_skipped,
+                                 size_t* num_values_in_page) {
+    *num_values_in_page = 0;
+    while (*num_skipped < num_to_skip) {
+        RETURN_IF_ERROR(reader->next_header());
+        if (reader->current_page_is_data_page() &&
+            reader->current_page_num_values() <= num_to_skip - *num_skipped) {
+            *num_skipped += reader->current_page_num_values();
+            RETURN_IF_ERROR(reader->skip_page());
+            continue;
+        }
+        RETURN_IF_ERROR(reader->load_page());
+        *num_values_in_page = reader->num_values();
+        if (*num_values_in_page > 0) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
 void RepeatedStoredColumnReader::reset() {
     size_t num_levels = _levels_decoded - _levels_parsed;
     if (_levels_parsed == 0 || num_levels == 0) {
@@ -430,6 +464,32 @@ Status OptionalStoredColumnReader::_read_records_only(size_t* num_records, Colum
     return Status::OK();
 }
 
+Status OptionalStoredColumnReader::skip_records(size_t* num_records, vectorized::Column* dst) {
+    if (_eof) {
+        return Status::EndOfFile("");
+    }
+    size_t records_skipped = 0;
+    while (records_skipped < *num_records) {
+        if (_num_values_left_in_cur_page == 0) {
+            SCOPED_RAW_TIMER(&_opts.stats->page_read_ns);
+            auto st = next_page_skipping(_reader.get(), *num_records, &records_skipped, &_num_values_left_in_cur_page);
+            if (st.is_end_of_file()) {
+                _eof = true;
+                break;
+            } else if (!st.ok()) {
+                return st;
+            }
+            continue;
+        }
+        // skip values inside current page by decoding them.
+        size_t records_to_skip = std::min(*num_records - records_skipped, _num_values_left_in_cur_page);
+        RETURN_IF_ERROR(StoredColumnReader::skip_records(&records_to_skip, dst));
+        records_skipped += records_to_skip;
+    }
+    *num_records = records_skipped;
+    return Status::OK();
+}
+
 Status OptionalStoredColumnReader::_next_page() {
     do {
         RETURN_IF_ERROR(_reader->next_page());
@@ -483,6 +543,26 @@ Status RequiredStoredColumnReader::read_records(size_t* num_records, ColumnConte
     return Status::OK();
 }
 
+Status RequiredStoredColumnReader::skip_records(size_t* num_records, vectorized::Column* dst) {
+    size_t records_skipped = 0;
+    while (records_skipped < *num_records) {
+        if (_num_values_left_in_cur_page == 0) {
+            auto st = next_page_skipping(_reader.get(), *num_records, &records_skipped, &_num_values_left_in_cur_page);
+            if (st.is_end_of_file()) {
+                break;
+            } else if (!st.ok()) {
+                return st;
+            }
+            continue;
+        }
+        size_t records_to_skip = std::min(*num_records - records_skipped, _num_values_left_in_cur_page);
+        RETURN_IF_ERROR(StoredColumnReader::skip_records(&records_to_skip, dst));
+        records_skipped += records_to_skip;
+    }
+    *num_records = records_skipped;
+    return Status::OK();
+}
+
 Status RequiredStoredColumnReader::_next_page() {
     do {
         RETURN_IF_ERROR(_reader->next_page());
@@ -50,6 +50,11 @@ public:
     // this function will fill (1, 2, 3, 4, 5, 6) into 'dst'.
     virtual Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) = 0;
 
+    // Skip values that can assemble up to num_rows rows. Values are decoded into `dst` and
+    // then dropped, readers which know how many rows a page holds override this to skip
+    // whole pages without reading them from file.
+    virtual Status skip_records(size_t* num_rows, vectorized::Column* dst);
+
     // This function can only be called after calling read_values. This function returns the
     // levels for last read_values.
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
@@ -631,6 +631,21 @@ Status AggregateBaseOperator::_check_hash_set_memory_usage(RuntimeState* state)
     return Status::OK();
 }
 
+void AggregateBaseOperator::_reset_hash_map() {
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                  \
+    else if (_hash_map_variant.type == vectorized::HashMapVariant::Type::NAME) \
+            _release_agg_memory<decltype(_hash_map_variant.NAME)::element_type>(*_hash_map_variant.NAME);
+    APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+    _mem_pool->clear();
+    _hash_map_variant = vectorized::HashMapVariant();
+    _init_agg_hash_variant(_hash_map_variant);
+    _it_hash.reset();
+    _is_ht_done = false;
+}
+
 void AggregateBaseOperator::_try_convert_to_two_level_map() {
     if (_last_ht_memory_usage > two_level_memory_threshold) {
         if (_hash_map_variant.type == vectorized::HashMapVariant::Type::phase1_slice) {
@@ -290,6 +290,9 @@ protected:
     // two level hash map is better in large data set.
     void _try_convert_to_two_level_map();
 
+    // Destroy the agg states in the hash map and start with an empty one.
+    void _reset_hash_map();
+
 #ifdef NDEBUG
     static constexpr size_t two_level_memory_threshold = 33554432; // 32M, L3 Cache
     static constexpr size_t streaming_hash_table_size_threshold = 10000000;
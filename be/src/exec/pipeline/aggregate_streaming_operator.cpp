@@ -24,6 +24,10 @@ bool AggregateStreamingOperator::has_output() const {
         return true;
     }
 
+    if (!_cached_morsel_chunks.empty() || (_query_cache_ctx != nullptr && _query_cache_ctx->has_hit_chunk())) {
+        return true;
+    }
+
     // There are two cases where _curr_chunk is null,
     // it will apply local aggregate, so need to wait all the input chunks
     // case1：streaming mode is 'FORCE_PREAGGREGATION'
@@ -53,6 +57,9 @@ void AggregateStreamingOperator::finish(RuntimeState* state) {
         return;
     }
     _is_finished = true;
+    if (_query_cache_ctx != nullptr) {
+        _finish_cached_morsels(_query_cache_ctx->num_missed_morsels());
+    }
 }
 
 StatusOr<vectorized::ChunkPtr> AggregateStreamingOperator::pull_chunk(RuntimeState* state) {
@@ -61,6 +68,14 @@ StatusOr<vectorized::ChunkPtr> AggregateStreamingOperator::pull_chunk(RuntimeSta
         _curr_chunk = nullptr;
         return chunk;
     }
+    if (!_cached_morsel_chunks.empty()) {
+        vectorized::ChunkPtr chunk = std::move(_cached_morsel_chunks.front());
+        _cached_morsel_chunks.pop_front();
+        return chunk;
+    }
+    if (_query_cache_ctx != nullptr && _query_cache_ctx->has_hit_chunk()) {
+        return _query_cache_ctx->pop_hit_chunk();
+    }
 
     vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
     _output_chunk_from_hash_map(&chunk);
@@ -72,6 +87,12 @@ StatusOr<vectorized::ChunkPtr> AggregateStreamingOperator::pull_chunk(RuntimeSta
 Status AggregateStreamingOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
     size_t chunk_size = chunk->num_rows();
 
+    if (_query_cache_ctx != nullptr) {
+        // the chunk belongs to the last missed morsel, the previous ones are finished.
+        DCHECK_GT(_query_cache_ctx->num_missed_morsels(), 0);
+        _finish_cached_morsels(_query_cache_ctx->num_missed_morsels() - 1);
+    }
+
     _num_input_rows += chunk_size;
     COUNTER_SET(_input_row_count, _num_input_rows);
     RETURN_IF_ERROR(_check_hash_map_memory_usage(state));
@@ -79,13 +100,20 @@ Status AggregateStreamingOperator::push_chunk(RuntimeState* state, const vectori
     _evaluate_group_by_exprs(chunk.get());
     _evaluate_agg_fn_exprs(chunk.get());
 
+    const vectorized::Chunk* prev_chunk = _curr_chunk.get();
+    Status status;
     if (_streaming_preaggregation_mode == TStreamingPreaggregationMode::FORCE_STREAMING) {
-        return _push_chunk_by_force_streaming();
+        status = _push_chunk_by_force_streaming();
     } else if (_streaming_preaggregation_mode == TStreamingPreaggregationMode::FORCE_PREAGGREGATION) {
-        return _push_chunk_by_force_preaggregation(chunk->num_rows());
+        status = _push_chunk_by_force_preaggregation(chunk->num_rows());
     } else {
-        return _push_chunk_by_auto(chunk->num_rows());
+        status = _push_chunk_by_auto(chunk->num_rows());
     }
+    // the rows passed through by streaming are results of the morsel too.
+    if (_query_cache_ctx != nullptr && _curr_chunk != nullptr && _curr_chunk.get() != prev_chunk) {
+        _query_cache_ctx->collect(_cached_morsel_index, *_curr_chunk);
+    }
+    return status;
 }
 
 Status AggregateStreamingOperator::_push_chunk_by_force_streaming() {
@@ -221,4 +249,18 @@ void AggregateStreamingOperator::_output_chunk_from_hash_map(vectorized::ChunkPt
     }
 }
 
-} // namespace starrocks::pipeline
\ No newline at end of file
+void AggregateStreamingOperator::_finish_cached_morsels(size_t end) {
+    while (_cached_morsel_index < end) {
+        while (_hash_map_variant.size() > 0 && !_is_ht_done) {
+            vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
+            _output_chunk_from_hash_map(&chunk);
+            _query_cache_ctx->collect(_cached_morsel_index, *chunk);
+            _cached_morsel_chunks.emplace_back(std::move(chunk));
+        }
+        _reset_hash_map();
+        _query_cache_ctx->finish_morsel(_cached_morsel_index);
+        ++_cached_morsel_index;
+    }
+}
+
+} // namespace starrocks::pipeline
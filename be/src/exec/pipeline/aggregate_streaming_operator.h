@@ -3,6 +3,7 @@
 #pragma once
 
 #include "aggregate_base_operator.h"
+#include "exec/pipeline/query_cache.h"
 
 namespace starrocks::pipeline {
 
@@ -19,13 +20,26 @@ public:
     StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
     Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
 
+    // Aggregate the morsels separately and cache their results, see QueryCacheContext.
+    void set_query_cache_ctx(std::shared_ptr<QueryCacheContext> query_cache_ctx) {
+        _query_cache_ctx = std::move(query_cache_ctx);
+    }
+
 private:
     Status _push_chunk_by_force_streaming();
     Status _push_chunk_by_force_preaggregation(const size_t chunk_size);
     Status _push_chunk_by_auto(const size_t chunk_size);
     void _output_chunk_from_hash_map(vectorized::ChunkPtr* chunk);
+    // Output the hash map of each missed morsel before `end`, and start over.
+    void _finish_cached_morsels(size_t end);
 
     vectorized::ChunkPtr _curr_chunk = nullptr;
+
+    std::shared_ptr<QueryCacheContext> _query_cache_ctx;
+    // the missed morsel being aggregated.
+    size_t _cached_morsel_index = 0;
+    // results of the finished morsels to output.
+    std::deque<vectorized::ChunkPtr> _cached_morsel_chunks;
 };
 
 class AggregateStreamingOperatorFactory final : public AggregateBaseOperatorFactory {
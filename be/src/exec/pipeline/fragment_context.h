@@ -9,6 +9,7 @@
 #include "exec/pipeline/pipeline.h"
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/resource_group.h"
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/HeartbeatService.h"
 #include "gen_cpp/InternalService_types.h"
@@ -84,6 +85,10 @@ public:
 
     MorselQueueMap& morsel_queues() { return _morsel_queues; }
 
+    // nullptr if the fragment is not classified, its drivers are scheduled as the default group.
+    ResourceGroup* resource_group() const { return _resource_group; }
+    void set_resource_group(ResourceGroup* resource_group) { _resource_group = resource_group; }
+
 private:
     // Id of this query
     TUniqueId _query_id;
@@ -94,6 +99,7 @@ private:
     std::unique_ptr<MemTracker> _mem_tracker = nullptr;
     std::shared_ptr<RuntimeState> _runtime_state = nullptr;
     ExecNode* _plan = nullptr; // lives in _runtime_state->obj_pool()
+    ResourceGroup* _resource_group = nullptr; // owned by ResourceGroupManager
     Pipelines _pipelines;
     Drivers _drivers;
     // _morsel_queues is mapping from an source_id to its corresponding
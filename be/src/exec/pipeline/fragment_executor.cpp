@@ -5,11 +5,14 @@
 #include <unordered_map>
 
 #include "exec/exchange_node.h"
+#include "exec/pipeline/aggregate_streaming_operator.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/morsel.h"
 #include "exec/pipeline/pipeline_builder.h"
+#include "exec/pipeline/query_cache.h"
+#include "exec/pipeline/resource_group.h"
 #include "exec/pipeline/result_sink_operator.h"
 #include "exec/pipeline/scan_operator.h"
 #include "exec/scan_node.h"
@@ -54,10 +57,21 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
             std::make_unique<RuntimeState>(request, request.query_options, request.query_globals, exec_env));
     auto* runtime_state = _fragment_ctx->runtime_state();
 
+    std::string requested_group;
+    std::string user;
+    if (request.__isset.resource_info) {
+        requested_group = request.resource_info.group;
+        user = request.resource_info.user;
+    }
+    auto* resource_group = ResourceGroupManager::instance()->classify(requested_group, user,
+                                                                      request.query_options.query_type);
+    RETURN_IF_ERROR(_query_ctx->set_resource_group(resource_group));
+    _fragment_ctx->set_resource_group(_query_ctx->resource_group());
+
     int64_t bytes_limit = request.query_options.mem_limit;
     // NOTE: this MemTracker only for olap
-    _fragment_ctx->set_mem_tracker(
-            std::make_unique<MemTracker>(bytes_limit, "fragment mem-limit", exec_env->query_pool_mem_tracker(), true));
+    _fragment_ctx->set_mem_tracker(std::make_unique<MemTracker>(bytes_limit, "fragment mem-limit",
+                                                                _query_ctx->resource_group()->mem_tracker(), true));
     auto mem_tracker = _fragment_ctx->mem_tracker();
 
     runtime_state->set_batch_size(config::vector_chunk_size);
@@ -117,6 +131,13 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
         pipeline_scan_mode = request.query_options.pipeline_scan_mode;
     }
 
+    // the results of each tablet are cached if the fragment is a pre-aggregation over the tablets.
+    int64_t query_cache_digest = 0;
+    QueryCache* query_cache = QueryCache::instance();
+    if (query_cache != nullptr && !QueryCache::fragment_digest(request, &query_cache_digest)) {
+        query_cache = nullptr;
+    }
+
     PipelineBuilderContext context(*_fragment_ctx, driver_instance_count);
     PipelineBuilder builder(context);
     _fragment_ctx->set_pipelines(builder.build(*_fragment_ctx, plan));
@@ -179,6 +200,14 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
                 } else {
                     scan_operator->set_io_threads(nullptr);
                 }
+                auto* agg_operator = operators.size() > 1
+                                             ? dynamic_cast<AggregateStreamingOperator*>(operators[1].get())
+                                             : nullptr;
+                if (query_cache != nullptr && agg_operator != nullptr) {
+                    auto query_cache_ctx = std::make_shared<QueryCacheContext>(query_cache, query_cache_digest);
+                    scan_operator->set_query_cache_ctx(query_cache_ctx);
+                    agg_operator->set_query_cache_ctx(std::move(query_cache_ctx));
+                }
                 drivers.emplace_back(std::move(driver));
             }
         } else {
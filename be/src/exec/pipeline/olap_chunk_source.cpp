@@ -7,6 +7,7 @@
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "exprs/vectorized/runtime_filter.h"
 #include "gutil/map_util.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/current_mem_tracker.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -122,10 +123,17 @@ Status OlapChunkSource::_init_reader_params(const std::vector<OlapScanRange*>& k
     params->chunk_size = config::vector_chunk_size;
 
     PredicateParser parser(_tablet->tablet_schema());
+    details::normalize_contains_predicates(_tablet->tablet_schema(), *_slots, _conjunct_ctxs, _normalized_conjuncts,
+                                           _olap_filter);
 
     // Condition
     for (auto& filter : _olap_filter) {
         vectorized::ColumnPredicate* p = parser.parse(filter);
+        if (p == nullptr) {
+            return Status::InternalError(
+                    strings::Substitute("failed to parse the $0 condition on column $1", filter.condition_op,
+                                        filter.column_name));
+        }
         p->set_index_filter_only(filter.is_index_filter_only);
         _predicate_free_pool.emplace_back(p);
         if (parser.can_pushdown(p)) {
@@ -222,6 +230,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     if (!_un_push_down_conjuncts.empty() || !_un_push_down_predicates.empty()) {
         _expr_filter_timer = ADD_TIMER(_scan_profile, "ExprFilterTime");
     }
+    _conjuncts_evaluator.init(_un_push_down_conjuncts, _scan_profile);
     Status res = _reader->init(params);
     if (!res.ok()) {
         std::stringstream ss;
@@ -288,7 +297,7 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
         if (!_un_push_down_conjuncts.empty()) {
             int64_t old_mem_usage = chunk->memory_usage();
             SCOPED_TIMER(_expr_filter_timer);
-            ExecNode::eval_conjuncts(_un_push_down_conjuncts, chunk);
+            _conjuncts_evaluator.evaluate(chunk);
             CurrentMemTracker::consume((int64_t)chunk->memory_usage() - old_mem_usage);
             DCHECK_CHUNK(chunk);
         }
@@ -5,6 +5,7 @@
 #include "exec/olap_common.h"
 #include "exec/olap_utils.h"
 #include "exec/pipeline/chunk_source.h"
+#include "exec/vectorized/adaptive_conjuncts_evaluator.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "gen_cpp/InternalService_types.h"
@@ -71,6 +72,7 @@ private:
     std::vector<bool> _normalized_conjuncts;
     // The conjuncts couldn't push down to storage engine
     std::vector<ExprContext*> _un_push_down_conjuncts;
+    vectorized::AdaptiveConjunctsEvaluator _conjuncts_evaluator;
     vectorized::ConjunctivePredicates _un_push_down_predicates;
     std::vector<uint8_t> _selection;
 
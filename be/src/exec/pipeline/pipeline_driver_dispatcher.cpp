@@ -3,10 +3,11 @@
 #include "exec/pipeline/pipeline_driver_dispatcher.h"
 
 #include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
 namespace starrocks {
 namespace pipeline {
 GlobalDriverDispatcher::GlobalDriverDispatcher(std::unique_ptr<ThreadPool> thread_pool)
-        : _driver_queue(new QuerySharedDriverQueue()),
+        : _driver_queue(new ResourceGroupDriverQueue()),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()) {}
@@ -52,8 +53,15 @@ void GlobalDriverDispatcher::run() {
             continue;
         }
 
-        auto status = driver->process(runtime_state);
+        StatusOr<DriverState> status;
+        {
+            ScopedThreadMemTracker mem_tracker_guard(fragment_ctx->mem_tracker());
+            status = driver->process(runtime_state);
+        }
         this->_driver_queue->get_sub_queue(queue_index)->update_accu_time(driver);
+        if (auto* resource_group = fragment_ctx->resource_group(); resource_group != nullptr) {
+            resource_group->incr_cpu_time(driver->driver_acct().get_last_time_spent());
+        }
 
         if (!status.ok()) {
             VLOG_ROW << "[Driver] Process error: error=" << status.status().to_string();
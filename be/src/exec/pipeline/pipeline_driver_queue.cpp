@@ -2,63 +2,177 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include "exec/pipeline/resource_group.h"
 #include "gutil/strings/substitute.h"
 namespace starrocks {
 namespace pipeline {
-void QuerySharedDriverQueue::put_back(const DriverPtr& driver) {
-    int level = driver->driver_acct().get_level();
-    {
-        std::unique_lock<std::mutex> lock(_global_mutex);
-        _queues[level % QUEUE_SIZE].queue.emplace(driver);
-        if (_is_empty) {
-            _is_empty = false;
-            _cv.notify_one();
-        }
+DriverLevelQueues::DriverLevelQueues() {
+    double factor = 1;
+    for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
+        // initialize factor for every sub queue,
+        // Higher priority queues have more execution time,
+        // so they have a larger factor.
+        _queues[i].factor_for_normal = factor;
+        factor *= RATIO_OF_ADJACENT_QUEUE;
     }
 }
 
-DriverPtr QuerySharedDriverQueue::take(size_t* queue_index) {
+void DriverLevelQueues::put(const DriverPtr& driver) {
+    int level = driver->driver_acct().get_level();
+    _queues[level % QUEUE_SIZE].queue.emplace(driver);
+    ++_num_drivers;
+}
+
+DriverPtr DriverLevelQueues::take(size_t* level) {
     // -1 means no candidates; else has candidate.
     int queue_idx = -1;
     double target_accu_time = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        // we just search for queue has element
+        if (!_queues[i].queue.empty()) {
+            double local_target_time = _queues[i].accu_time_after_divisor();
+            // if this is first queue that has element, we select it;
+            // else we choose queue that the execution time is less sufficient,
+            // and record time.
+            if (queue_idx < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                queue_idx = i;
+            }
+        }
+    }
+    if (queue_idx < 0) {
+        return nullptr;
+    }
+    // record queue's index to accumulate time for it.
+    *level = queue_idx;
+    DriverPtr driver_ptr = _queues[queue_idx].queue.front();
+    _queues[queue_idx].queue.pop();
+    --_num_drivers;
+    return driver_ptr;
+}
+
+int64_t DriverLevelQueues::accu_time() const {
+    int64_t accu_time = 0;
+    for (const auto& queue : _queues) {
+        accu_time += queue.accu_time();
+    }
+    return accu_time;
+}
+
+void QuerySharedDriverQueue::put_back(const DriverPtr& driver) {
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    _queues.put(driver);
+    if (_is_empty) {
+        _is_empty = false;
+        _cv.notify_one();
+    }
+}
+
+DriverPtr QuerySharedDriverQueue::take(size_t* queue_index) {
     DriverPtr driver_ptr;
+    {
+        std::unique_lock<std::mutex> lock(_global_mutex);
+        while ((driver_ptr = _queues.take(queue_index)) == nullptr) {
+            _is_empty = true;
+            _cv.wait(lock);
+        }
+    }
+
+    // next pipeline driver to execute.
+    return driver_ptr;
+}
+
+SubQuerySharedDriverQueue* QuerySharedDriverQueue::get_sub_queue(size_t index) {
+    return _queues.get_sub_queue(index);
+}
+
+static std::vector<int> resource_group_cpu_weights() {
+    std::vector<int> cpu_weights;
+    for (const auto& group : ResourceGroupManager::instance()->groups()) {
+        cpu_weights.emplace_back(group->cpu_weight());
+    }
+    return cpu_weights;
+}
+
+ResourceGroupDriverQueue::ResourceGroupDriverQueue() : ResourceGroupDriverQueue(resource_group_cpu_weights()) {}
+
+ResourceGroupDriverQueue::ResourceGroupDriverQueue(const std::vector<int>& cpu_weights) {
+    // the default group always exists.
+    size_t num_groups = std::max<size_t>(cpu_weights.size(), 1);
+    for (size_t i = 0; i < num_groups; ++i) {
+        auto group = std::make_unique<GroupQueue>();
+        group->cpu_weight = i < cpu_weights.size() ? std::max(cpu_weights[i], 1) : 1;
+        _groups.emplace_back(std::move(group));
+    }
+}
+
+void ResourceGroupDriverQueue::put_back(const DriverPtr& driver) {
+    auto* resource_group = driver->fragment_ctx()->resource_group();
+    int group_id = resource_group != nullptr ? resource_group->id() : 0;
+    if (group_id < 0 || group_id >= _groups.size()) {
+        group_id = 0;
+    }
+    std::unique_lock<std::mutex> lock(_global_mutex);
+    _put_back(group_id, driver);
+    if (_is_empty) {
+        _is_empty = false;
+        _cv.notify_one();
+    }
+}
+
+void ResourceGroupDriverQueue::_put_back(int group_id, const DriverPtr& driver) {
+    auto& group = *_groups[group_id];
+    if (group.queues.empty()) {
+        // The group is runnable again, it must not be behind the least runnable group.
+        bool has_runnable = false;
+        double min_vruntime = 0;
+        for (const auto& other : _groups) {
+            if (!other->queues.empty() && (!has_runnable || other->vruntime() < min_vruntime)) {
+                has_runnable = true;
+                min_vruntime = other->vruntime();
+            }
+        }
+        if (has_runnable && group.vruntime() < min_vruntime) {
+            group.base_time = group.queues.accu_time() - static_cast<int64_t>(min_vruntime * group.cpu_weight);
+        }
+    }
+    group.queues.put(driver);
+}
 
+DriverPtr ResourceGroupDriverQueue::take(size_t* queue_index) {
+    DriverPtr driver_ptr;
     {
         std::unique_lock<std::mutex> lock(_global_mutex);
         while (true) {
-            for (int i = 0; i < QUEUE_SIZE; ++i) {
-                // we just search for queue has element
-                if (!_queues[i].queue.empty()) {
-                    double local_target_time = _queues[i].accu_time_after_divisor();
-                    // if this is first queue that has element, we select it;
-                    // else we choose queue that the execution time is less sufficient,
-                    // and record time.
-                    if (queue_idx < 0 || local_target_time < target_accu_time) {
-                        target_accu_time = local_target_time;
-                        queue_idx = i;
+            int group_idx = -1;
+            double target_vruntime = 0;
+            for (int i = 0; i < _groups.size(); ++i) {
+                if (!_groups[i]->queues.empty()) {
+                    double vruntime = _groups[i]->vruntime();
+                    if (group_idx < 0 || vruntime < target_vruntime) {
+                        target_vruntime = vruntime;
+                        group_idx = i;
                     }
                 }
             }
-
-            if (queue_idx >= 0) {
+            if (group_idx >= 0) {
+                size_t level = 0;
+                driver_ptr = _groups[group_idx]->queues.take(&level);
+                *queue_index = group_idx * QUEUE_SIZE + level;
                 break;
             }
             _is_empty = true;
             _cv.wait(lock);
         }
-        // record queue's index to accumulate time for it.
-        *queue_index = queue_idx;
-        driver_ptr = _queues[queue_idx].queue.front();
-        _queues[queue_idx].queue.pop();
     }
 
     // next pipeline driver to execute.
     return driver_ptr;
 }
 
-SubQuerySharedDriverQueue* QuerySharedDriverQueue::get_sub_queue(size_t index) {
-    return _queues + index;
+SubQuerySharedDriverQueue* ResourceGroupDriverQueue::get_sub_queue(size_t index) {
+    return _groups[index / QUEUE_SIZE]->queues.get_sub_queue(index % QUEUE_SIZE);
 }
 
 } // namespace pipeline
-} // namespace starrocks
\ No newline at end of file
+} // namespace starrocks
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <queue>
+#include <vector>
 
 #include "exec/pipeline/pipeline_driver.h"
 #include "util/factory_method.h"
@@ -19,6 +20,8 @@ public:
 
     double accu_time_after_divisor() { return _accu_consume_time.load() / factor_for_normal; }
 
+    int64_t accu_time() const { return _accu_consume_time.load(); }
+
     std::queue<DriverPtr> queue;
     // factor for normalization
     double factor_for_normal = 0;
@@ -35,35 +38,87 @@ public:
     virtual SubQuerySharedDriverQueue* get_sub_queue(size_t) = 0;
 };
 
+// The multi-level queues of drivers, a driver is put into the level given by the time it has
+// spent, and the level whose accumulated time normalized by its factor is the least is taken.
+// Not thread-safe, the owner guards it.
+class DriverLevelQueues {
+public:
+    static const size_t QUEUE_SIZE = 8;
+    // maybe other value for ratio.
+    static constexpr double RATIO_OF_ADJACENT_QUEUE = 1.7;
+
+    DriverLevelQueues();
+
+    void put(const DriverPtr& driver);
+    // Return nullptr if all the levels are empty.
+    DriverPtr take(size_t* level);
+    bool empty() const { return _num_drivers == 0; }
+    SubQuerySharedDriverQueue* get_sub_queue(size_t level) { return _queues + level; }
+    // The time spent by the drivers taken from all the levels.
+    int64_t accu_time() const;
+
+private:
+    SubQuerySharedDriverQueue _queues[QUEUE_SIZE];
+    size_t _num_drivers = 0;
+};
+
 class QuerySharedDriverQueue : public FactoryMethod<DriverQueue, QuerySharedDriverQueue> {
     friend class FactoryMethod<DriverQueue, QuerySharedDriverQueue>;
 
 public:
-    QuerySharedDriverQueue() : _is_empty(true) {
-        double factor = 1;
-        for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
-            // initialize factor for every sub queue,
-            // Higher priority queues have more execution time,
-            // so they have a larger factor.
-            _queues[i].factor_for_normal = factor;
-            factor *= RATIO_OF_ADJACENT_QUEUE;
-        }
-    }
+    QuerySharedDriverQueue() : _is_empty(true) {}
     ~QuerySharedDriverQueue() override {}
 
-    static const size_t QUEUE_SIZE = 8;
-    // maybe other value for ratio.
-    static constexpr double RATIO_OF_ADJACENT_QUEUE = 1.7;
-    void put_back(const DriverPtr& driver);
+    static const size_t QUEUE_SIZE = DriverLevelQueues::QUEUE_SIZE;
+    void put_back(const DriverPtr& driver) override;
     DriverPtr take(size_t* queue_index) override;
     SubQuerySharedDriverQueue* get_sub_queue(size_t) override;
 
 private:
-    SubQuerySharedDriverQueue _queues[QUEUE_SIZE];
+    DriverLevelQueues _queues;
     std::mutex _global_mutex;
     std::condition_variable _cv;
     std::atomic<bool> _is_empty;
 };
 
+// Shares the executor threads among the resource groups in proportion to their cpu weights.
+// The group whose time spent divided by its cpu weight is the least is taken first, and the
+// drivers of a group are taken from its own DriverLevelQueues. A group that becomes runnable
+// again is moved forward to the least group, so it does not monopolize the threads by the
+// time it has saved while idle.
+//
+// queue_index is group_id * QUEUE_SIZE + level.
+class ResourceGroupDriverQueue : public FactoryMethod<DriverQueue, ResourceGroupDriverQueue> {
+    friend class FactoryMethod<DriverQueue, ResourceGroupDriverQueue>;
+
+public:
+    // One queue for each of the groups of ResourceGroupManager.
+    ResourceGroupDriverQueue();
+    explicit ResourceGroupDriverQueue(const std::vector<int>& cpu_weights);
+    ~ResourceGroupDriverQueue() override {}
+
+    static const size_t QUEUE_SIZE = DriverLevelQueues::QUEUE_SIZE;
+    void put_back(const DriverPtr& driver) override;
+    DriverPtr take(size_t* queue_index) override;
+    SubQuerySharedDriverQueue* get_sub_queue(size_t) override;
+
+private:
+    struct GroupQueue {
+        DriverLevelQueues queues;
+        int cpu_weight = 1;
+        // subtracted from the time spent, to move the group forward when it becomes runnable.
+        int64_t base_time = 0;
+
+        double vruntime() const { return static_cast<double>(queues.accu_time() - base_time) / cpu_weight; }
+    };
+
+    void _put_back(int group_id, const DriverPtr& driver);
+
+    std::vector<std::unique_ptr<GroupQueue>> _groups;
+    std::mutex _global_mutex;
+    std::condition_variable _cv;
+    bool _is_empty = true;
+};
+
 } // namespace pipeline
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,229 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/query_cache.h"
+
+#include <cstdlib>
+#include <unordered_set>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "runtime/current_thread.h"
+#include "util/hash_util.hpp"
+#include "util/metrics.h"
+#include "util/starrocks_metrics.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::pipeline {
+
+static IntAtomicCounter g_query_cache_lookup_count(MetricUnit::OPERATIONS); // NOLINT
+static IntAtomicCounter g_query_cache_hit_count(MetricUnit::OPERATIONS);    // NOLINT
+static IntGauge g_query_cache_bytes(MetricUnit::BYTES);                     // NOLINT
+
+QueryCache* QueryCache::_s_instance = nullptr;
+
+void QueryCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr && capacity > 0) {
+        _s_instance = new QueryCache(mem_tracker, capacity);
+#ifndef BE_TEST
+        MetricRegistry* reg = StarRocksMetrics::instance()->metrics();
+        reg->register_hook("query_cache_bytes_hook",
+                           []() { g_query_cache_bytes.set_value(QueryCache::instance()->memory_usage()); });
+        reg->register_metric("query_cache_lookup_count", &g_query_cache_lookup_count);
+        reg->register_metric("query_cache_hit_count", &g_query_cache_hit_count);
+        reg->register_metric("query_cache_bytes", &g_query_cache_bytes);
+#endif
+    }
+}
+
+void QueryCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+#ifndef BE_TEST
+        StarRocksMetrics::instance()->metrics()->deregister_hook("query_cache_bytes_hook");
+#endif
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+QueryCache::QueryCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+// The results of these functions differ from run to run.
+static bool is_deterministic(const std::vector<TExpr>& exprs) {
+    static const std::unordered_set<std::string> non_deterministic_functions = {
+            "rand", "random", "uuid", "now", "current_timestamp", "localtime", "localtimestamp", "curtime",
+            "current_time", "curdate", "current_date", "utc_timestamp", "unix_timestamp", "sleep", "connection_id"};
+    for (const auto& expr : exprs) {
+        for (const auto& node : expr.nodes) {
+            if (node.__isset.fn && non_deterministic_functions.count(node.fn.name.function_name) > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool QueryCache::fragment_digest(const TExecPlanFragmentParams& request, int64_t* digest) {
+    const auto& nodes = request.fragment.plan.nodes;
+    if (nodes.size() != 2) {
+        return false;
+    }
+    const TPlanNode& agg_node = nodes[0];
+    const TPlanNode& scan_node = nodes[1];
+    if (agg_node.node_type != TPlanNodeType::AGGREGATION_NODE || !agg_node.__isset.agg_node ||
+        scan_node.node_type != TPlanNodeType::OLAP_SCAN_NODE) {
+        return false;
+    }
+    // Only the results of a pre-aggregation are partial, so they can be merged across tablets.
+    const TAggregationNode& agg = agg_node.agg_node;
+    if (agg.need_finalize || !agg.use_streaming_preaggregation || agg.grouping_exprs.empty() ||
+        agg.aggregate_functions.empty()) {
+        return false;
+    }
+    if (agg_node.limit != -1 || scan_node.limit != -1 || !scan_node.probe_runtime_filters.empty()) {
+        return false;
+    }
+    if (!is_deterministic(agg_node.conjuncts) || !is_deterministic(agg.grouping_exprs) ||
+        !is_deterministic(agg.aggregate_functions) || !is_deterministic(scan_node.conjuncts)) {
+        return false;
+    }
+
+    ThriftSerializer serializer(false, 4096);
+    uint8_t* buffer = nullptr;
+    uint32_t len = 0;
+    TPlan plan = request.fragment.plan;
+    if (!serializer.serialize(&plan, &len, &buffer).ok()) {
+        return false;
+    }
+    uint64_t hash = HashUtil::hash64(buffer, len, 0);
+    TDescriptorTable desc_tbl = request.desc_tbl;
+    if (!serializer.serialize(&desc_tbl, &len, &buffer).ok()) {
+        return false;
+    }
+    hash = HashUtil::hash64(buffer, len, hash);
+    // the results of the functions on datetime depend on the time zone.
+    const std::string& time_zone = request.query_globals.time_zone;
+    hash = HashUtil::hash64(time_zone.data(), time_zone.size(), hash);
+    *digest = static_cast<int64_t>(hash);
+    return true;
+}
+
+std::string QueryCache::make_key(int64_t digest, int64_t tablet_id, int64_t version) {
+    std::string key;
+    key.append(reinterpret_cast<const char*>(&digest), sizeof(digest));
+    key.append(reinterpret_cast<const char*>(&tablet_id), sizeof(tablet_id));
+    key.append(reinterpret_cast<const char*>(&version), sizeof(version));
+    return key;
+}
+
+namespace {
+struct CacheValue {
+    MemTracker* mem_tracker;
+    std::vector<vectorized::ChunkPtr> chunks;
+};
+} // namespace
+
+bool QueryCache::lookup(const std::string& key, std::vector<vectorized::ChunkPtr>* chunks) {
+    g_query_cache_lookup_count.increment(1);
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        return false;
+    }
+    g_query_cache_hit_count.increment(1);
+    const auto* value = reinterpret_cast<const CacheValue*>(_cache->value(handle));
+    for (const auto& chunk : value->chunks) {
+        // the downstream operators may modify the chunks.
+        auto copy = chunk->clone_empty_with_slot(chunk->num_rows());
+        copy->append(*chunk);
+        chunks->emplace_back(std::move(copy));
+    }
+    _cache->release(handle);
+    return true;
+}
+
+void QueryCache::insert(const std::string& key, std::vector<vectorized::ChunkPtr>&& chunks) {
+    auto* value = new CacheValue{_mem_tracker, std::move(chunks)};
+    size_t charge = key.size();
+    for (const auto& chunk : value->chunks) {
+        charge += chunk->memory_usage();
+    }
+    auto deleter = [](const CacheKey& key, void* value) {
+        auto* cache_value = reinterpret_cast<CacheValue*>(value);
+        ScopedThreadMemTracker mem_tracker_guard(cache_value->mem_tracker);
+        delete cache_value;
+    };
+    _cache->release(_cache->insert(key, value, charge, deleter));
+}
+
+vectorized::ChunkPtr QueryCache::copy_chunk(const vectorized::Chunk& chunk) {
+    ScopedThreadMemTracker mem_tracker_guard(_mem_tracker);
+    auto copy = chunk.clone_empty_with_slot(chunk.num_rows());
+    copy->append(chunk);
+    return copy;
+}
+
+void QueryCache::release_chunks(std::vector<vectorized::ChunkPtr>* chunks) {
+    ScopedThreadMemTracker mem_tracker_guard(_mem_tracker);
+    chunks->clear();
+}
+
+QueryCacheContext::~QueryCacheContext() {
+    _cache->release_chunks(&_collecting_chunks);
+}
+
+bool QueryCacheContext::probe(const TInternalScanRange& scan_range) {
+    int64_t version = std::strtoll(scan_range.version.c_str(), nullptr, 10);
+    std::string key = QueryCache::make_key(_digest, scan_range.tablet_id, version);
+    std::vector<vectorized::ChunkPtr> chunks;
+    if (_cache->lookup(key, &chunks)) {
+        for (auto& chunk : chunks) {
+            _hit_chunks.emplace_back(std::move(chunk));
+        }
+        return true;
+    }
+    _missed_keys.emplace_back(std::move(key));
+    return false;
+}
+
+vectorized::ChunkPtr QueryCacheContext::pop_hit_chunk() {
+    DCHECK(!_hit_chunks.empty());
+    vectorized::ChunkPtr chunk = std::move(_hit_chunks.front());
+    _hit_chunks.pop_front();
+    return chunk;
+}
+
+void QueryCacheContext::finish_scan() {
+    DCHECK_LT(_num_scanned_morsels, _missed_keys.size());
+    _num_scanned_morsels = _missed_keys.size();
+}
+
+void QueryCacheContext::collect(size_t index, const vectorized::Chunk& chunk) {
+    DCHECK_EQ(_collecting_index, index);
+    if (_collecting_abandoned || chunk.num_rows() == 0) {
+        return;
+    }
+    _collecting_bytes += chunk.memory_usage();
+    if (_collecting_bytes > config::query_cache_entry_max_bytes) {
+        _collecting_abandoned = true;
+        _cache->release_chunks(&_collecting_chunks);
+        return;
+    }
+    _collecting_chunks.emplace_back(_cache->copy_chunk(chunk));
+}
+
+void QueryCacheContext::finish_morsel(size_t index) {
+    DCHECK_EQ(_collecting_index, index);
+    DCHECK_LT(index, _missed_keys.size());
+    // the driver is canceled or failed before the morsel is scanned to its end, so its results are
+    // incomplete and must not be cached.
+    if (!_collecting_abandoned && index < _num_scanned_morsels) {
+        // the empty results are cached too, the tablet is skipped next time.
+        _cache->insert(_missed_keys[index], std::move(_collecting_chunks));
+    }
+    _cache->release_chunks(&_collecting_chunks);
+    _collecting_bytes = 0;
+    _collecting_abandoned = false;
+    ++_collecting_index;
+}
+
+} // namespace starrocks::pipeline
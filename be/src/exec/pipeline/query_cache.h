@@ -0,0 +1,106 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "gen_cpp/InternalService_types.h"
+#include "storage/lru_cache.h"
+
+namespace starrocks {
+class MemTracker;
+namespace pipeline {
+
+// QueryCache keeps the partial aggregation results of the pipeline fragments that scan olap
+// tablets and pre-aggregate them, one entry for each fragment digest and tablet version. When
+// the fragment runs again, the tablets that are not changed since return their cached results,
+// and only the tablets having new versions are scanned. The results of all the tablets are
+// merged by the downstream aggregation as usual, since they are partial results.
+class QueryCache {
+public:
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+    static void release_global_cache();
+    // nullptr if the cache is disabled.
+    static QueryCache* instance() { return _s_instance; }
+
+    QueryCache(MemTracker* mem_tracker, size_t capacity);
+    ~QueryCache() = default;
+
+    // Return false if the fragment cannot be cached, otherwise its digest that is part of the
+    // cache keys. A fragment is cached if it is a streaming pre-aggregation directly over an olap
+    // scan, without limit, runtime filter or non-deterministic function.
+    static bool fragment_digest(const TExecPlanFragmentParams& request, int64_t* digest);
+
+    static std::string make_key(int64_t digest, int64_t tablet_id, int64_t version);
+
+    // Append the cached chunks of `key` to `chunks`, return false if `key` is not cached.
+    // The chunks are copies owned by the caller.
+    bool lookup(const std::string& key, std::vector<vectorized::ChunkPtr>* chunks);
+
+    // Cache `chunks`, which must be copied by copy_chunk, under `key`.
+    void insert(const std::string& key, std::vector<vectorized::ChunkPtr>&& chunks);
+
+    // Copy a chunk to be inserted, the copy is accounted to the cache.
+    vectorized::ChunkPtr copy_chunk(const vectorized::Chunk& chunk);
+    // Release the copies that are not inserted.
+    void release_chunks(std::vector<vectorized::ChunkPtr>* chunks);
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+
+private:
+    static QueryCache* _s_instance;
+
+    MemTracker* _mem_tracker;
+    std::unique_ptr<Cache> _cache;
+};
+
+// QueryCacheContext connects the ScanOperator and the AggregateStreamingOperator of a driver
+// whose results are cached. The ScanOperator probes each morsel before scanning it: a hit morsel
+// is skipped and its cached results are emitted by the aggregation. A missed morsel is scanned,
+// and the aggregation flushes its hash table when the ScanOperator moves on to the next morsel,
+// so the results of each missed morsel are collected and cached separately. Only the results of
+// the morsels scanned to their ends are cached, the scan of a canceled or failed driver is partial.
+class QueryCacheContext {
+public:
+    QueryCacheContext(QueryCache* cache, int64_t digest) : _cache(cache), _digest(digest) {}
+    ~QueryCacheContext();
+
+    // Return true if the results of `scan_range` are cached.
+    bool probe(const TInternalScanRange& scan_range);
+
+    bool has_hit_chunk() const { return !_hit_chunks.empty(); }
+    vectorized::ChunkPtr pop_hit_chunk();
+
+    // Number of the missed morsels, the last one is being scanned.
+    size_t num_missed_morsels() const { return _missed_keys.size(); }
+    // The last missed morsel is scanned to its end.
+    void finish_scan();
+
+    // Collect a result chunk of the missed morsel `index`.
+    void collect(size_t index, const vectorized::Chunk& chunk);
+    // The results of the missed morsel `index` are all collected, they are cached if the morsel
+    // is scanned to its end.
+    void finish_morsel(size_t index);
+
+private:
+    QueryCache* const _cache;
+    const int64_t _digest;
+
+    std::deque<vectorized::ChunkPtr> _hit_chunks;
+    std::vector<std::string> _missed_keys;
+    // the missed morsels before it are scanned to their ends.
+    size_t _num_scanned_morsels = 0;
+    // results of the missed morsel being collected.
+    size_t _collecting_index = 0;
+    std::vector<vectorized::ChunkPtr> _collecting_chunks;
+    size_t _collecting_bytes = 0;
+    // the results are too large to be cached.
+    bool _collecting_abandoned = false;
+};
+
+} // namespace pipeline
+} // namespace starrocks
@@ -2,6 +2,22 @@
 #include "exec/pipeline/query_context.h"
 namespace starrocks {
 namespace pipeline {
+QueryContext::~QueryContext() {
+    if (_resource_group != nullptr) {
+        _resource_group->release_query();
+    }
+}
+
+Status QueryContext::set_resource_group(ResourceGroup* resource_group) {
+    std::lock_guard lock(_resource_group_lock);
+    if (_resource_group != nullptr) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(resource_group->acquire_query());
+    _resource_group = resource_group;
+    return Status::OK();
+}
+
 QueryContextManager::QueryContextManager() {}
 QueryContextManager::~QueryContextManager() {}
 QueryContext* QueryContextManager::get_or_register(const TUniqueId& query_id) {
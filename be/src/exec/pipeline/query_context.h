@@ -7,6 +7,7 @@
 #include <unordered_map>
 
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/resource_group.h"
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
 #include "gen_cpp/Types_types.h"           // for TUniqueId
 #include "runtime/mem_tracker.h"
@@ -21,6 +22,7 @@ namespace pipeline {
 class QueryContext {
 public:
     QueryContext() : _num_fragments_initialized(false), _num_fragments(0) {}
+    ~QueryContext();
     RuntimeState* get_runtime_state() { return _runtime_state.get(); }
     void set_num_fragments(size_t num_fragments) {
         bool old_value = false;
@@ -30,6 +32,11 @@ public:
     }
     bool count_down_fragment() { return _num_fragments.fetch_sub(1) == 1; }
 
+    // Admit the query into `resource_group` for its first fragment, the later fragments share
+    // the admission. The query leaves the group when the context is destroyed.
+    Status set_resource_group(ResourceGroup* resource_group);
+    ResourceGroup* resource_group() const { return _resource_group; }
+
 private:
     std::unique_ptr<RuntimeState> _runtime_state;
     std::shared_ptr<RuntimeProfile> _runtime_profile;
@@ -38,6 +45,8 @@ private:
     TUniqueId _query_id;
     std::atomic<bool> _num_fragments_initialized;
     std::atomic<size_t> _num_fragments;
+    std::mutex _resource_group_lock;
+    ResourceGroup* _resource_group = nullptr;
 };
 
 class QueryContextManager {
@@ -0,0 +1,201 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/resource_group.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include "common/config.h"
+#include "gutil/strings/split.h"
+#include "gutil/strings/strip.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/mem_tracker.h"
+#include "util/parse_util.h"
+#include "util/starrocks_metrics.h"
+#include "util/string_parser.hpp"
+
+namespace starrocks::pipeline {
+
+ResourceGroup::ResourceGroup(int id, std::string name, int cpu_weight, int64_t mem_limit, int max_concurrency)
+        : _id(id),
+          _name(std::move(name)),
+          _cpu_weight(cpu_weight),
+          _mem_limit(mem_limit),
+          _max_concurrency(max_concurrency) {}
+
+ResourceGroup::~ResourceGroup() {
+    if (_metrics_registered) {
+        StarRocksMetrics::instance()->metrics()->deregister_hook("resource_group_" + _name);
+    }
+}
+
+void ResourceGroup::init(MemTracker* parent) {
+    _mem_tracker = std::make_unique<MemTracker>(_mem_limit > 0 ? _mem_limit : -1, "resource_group_" + _name, parent);
+
+    auto* registry = StarRocksMetrics::instance()->metrics();
+    MetricLabels labels = MetricLabels().add("name", _name);
+    registry->register_metric("resource_group_running_queries", labels, &_running_queries);
+    registry->register_metric("resource_group_rejected_queries", labels, &_rejected_queries);
+    registry->register_metric("resource_group_cpu_time_us", labels, &_cpu_time_us);
+    registry->register_metric("resource_group_mem_bytes", labels, &_mem_bytes);
+    registry->register_hook("resource_group_" + _name, [this]() {
+        _running_queries.set_value(_num_running_queries.load());
+        _mem_bytes.set_value(_mem_tracker->consumption());
+    });
+    _metrics_registered = true;
+}
+
+Status ResourceGroup::acquire_query() {
+    int num_running = _num_running_queries.fetch_add(1);
+    if (_max_concurrency > 0 && num_running >= _max_concurrency) {
+        _num_running_queries.fetch_sub(1);
+        _rejected_queries.increment(1);
+        return Status::TooManyTasks(
+                strings::Substitute("Resource group $0 reaches its concurrency limit $1", _name, _max_concurrency));
+    }
+    return Status::OK();
+}
+
+void ResourceGroup::release_query() {
+    _num_running_queries.fetch_sub(1);
+}
+
+ResourceGroupManager::ResourceGroupManager() = default;
+
+ResourceGroupManager::~ResourceGroupManager() = default;
+
+Status ResourceGroupManager::init(MemTracker* parent) {
+    DCHECK(parent != nullptr);
+    RETURN_IF_ERROR(parse(config::resource_groups, config::resource_group_classifiers, &_groups, &_classifiers));
+    for (auto& group : _groups) {
+        group->init(parent);
+    }
+    return Status::OK();
+}
+
+static Status parse_int(const std::string& key, const std::string& value, int* result) {
+    StringParser::ParseResult parse_result;
+    *result = StringParser::string_to_int<int>(value.data(), value.size(), &parse_result);
+    if (parse_result != StringParser::PARSE_SUCCESS || *result < 0) {
+        return Status::InvalidArgument(strings::Substitute("Invalid resource group $0: $1", key, value));
+    }
+    return Status::OK();
+}
+
+static std::pair<std::string, std::string> split_key_value(const std::string& item, const char* delimiter) {
+    std::pair<std::string, std::string> kv = strings::Split(item, strings::delimiter::Limit(delimiter, 1));
+    StripWhiteSpace(&kv.first);
+    StripWhiteSpace(&kv.second);
+    return kv;
+}
+
+Status ResourceGroupManager::parse(const std::string& groups_spec, const std::string& classifiers_spec,
+                                   std::vector<ResourceGroupPtr>* groups,
+                                   std::vector<ResourceGroupClassifier>* classifiers) {
+    groups->clear();
+    classifiers->clear();
+    groups->emplace_back(std::make_shared<ResourceGroup>(0, kDefaultGroupName, 1, 0, 0));
+
+    auto find_group = [groups](const std::string& name) -> int {
+        for (const auto& group : *groups) {
+            if (group->name() == name) {
+                return group->id();
+            }
+        }
+        return -1;
+    };
+
+    std::vector<std::string> group_specs = strings::Split(groups_spec, ";", strings::SkipWhitespace());
+    for (const std::string& group_spec : group_specs) {
+        auto [name, props] = split_key_value(group_spec, ":");
+        if (name.empty()) {
+            return Status::InvalidArgument("Resource group without name: " + group_spec);
+        }
+        int cpu_weight = 1;
+        int64_t mem_limit = 0;
+        int max_concurrency = 0;
+        std::vector<std::string> prop_list = strings::Split(props, ",", strings::SkipWhitespace());
+        for (const std::string& prop : prop_list) {
+            auto [key, value] = split_key_value(prop, "=");
+            if (key == "cpu_weight") {
+                RETURN_IF_ERROR(parse_int(key, value, &cpu_weight));
+                if (cpu_weight == 0) {
+                    return Status::InvalidArgument("Resource group cpu_weight must be positive: " + group_spec);
+                }
+            } else if (key == "mem_limit") {
+                bool is_percent = false;
+                mem_limit = ParseUtil::parse_mem_spec(value, &is_percent);
+                if (mem_limit < 0) {
+                    return Status::InvalidArgument("Invalid resource group mem_limit: " + value);
+                }
+            } else if (key == "concurrency") {
+                RETURN_IF_ERROR(parse_int(key, value, &max_concurrency));
+            } else {
+                return Status::InvalidArgument("Unknown resource group property: " + key);
+            }
+        }
+
+        int id = find_group(name);
+        if (id > 0) {
+            return Status::InvalidArgument("Duplicated resource group: " + name);
+        }
+        // the default group may be configured.
+        id = id == 0 ? 0 : groups->size();
+        auto group = std::make_shared<ResourceGroup>(id, name, cpu_weight, mem_limit, max_concurrency);
+        if (id == 0) {
+            (*groups)[0] = std::move(group);
+        } else {
+            groups->emplace_back(std::move(group));
+        }
+    }
+
+    std::vector<std::string> classifier_specs = strings::Split(classifiers_spec, ";", strings::SkipWhitespace());
+    for (const std::string& classifier_spec : classifier_specs) {
+        auto [name, conditions] = split_key_value(classifier_spec, ":");
+        ResourceGroupClassifier classifier;
+        classifier.group_id = find_group(name);
+        if (classifier.group_id < 0) {
+            return Status::InvalidArgument("Classifier of unknown resource group: " + classifier_spec);
+        }
+        std::vector<std::string> condition_list = strings::Split(conditions, ",", strings::SkipWhitespace());
+        for (const std::string& condition : condition_list) {
+            auto [key, value] = split_key_value(condition, "=");
+            if (key == "user") {
+                classifier.user = value;
+            } else if (key == "query_type") {
+                classifier.has_query_type = true;
+                if (boost::iequals(value, "select")) {
+                    classifier.query_type = TQueryType::SELECT;
+                } else if (boost::iequals(value, "load")) {
+                    classifier.query_type = TQueryType::LOAD;
+                } else if (boost::iequals(value, "external")) {
+                    classifier.query_type = TQueryType::EXTERNAL;
+                } else {
+                    return Status::InvalidArgument("Unknown query type of classifier: " + value);
+                }
+            } else {
+                return Status::InvalidArgument("Unknown classifier condition: " + key);
+            }
+        }
+        classifiers->emplace_back(std::move(classifier));
+    }
+    return Status::OK();
+}
+
+ResourceGroup* ResourceGroupManager::classify(const std::string& requested_group, const std::string& user,
+                                              TQueryType::type query_type) const {
+    if (!requested_group.empty()) {
+        for (const auto& group : _groups) {
+            if (group->name() == requested_group) {
+                return group.get();
+            }
+        }
+    }
+    for (const auto& classifier : _classifiers) {
+        if (classifier.match(user, query_type)) {
+            return _groups[classifier.group_id].get();
+        }
+    }
+    return _groups[0].get();
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,118 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/InternalService_types.h" // for TQueryType
+#include "storage/olap_define.h"
+#include "util/metrics.h"
+
+namespace starrocks {
+class MemTracker;
+namespace pipeline {
+
+// A resource group isolates the pipeline queries classified into it from the other groups:
+// - the executor threads are shared among the groups in proportion to their cpu_weight,
+//   see ResourceGroupDriverQueue.
+// - the memory of all its queries is limited by the group's MemTracker.
+// - at most max_concurrency queries run at the same time, a new query is rejected beyond it.
+class ResourceGroup {
+public:
+    ResourceGroup(int id, std::string name, int cpu_weight, int64_t mem_limit, int max_concurrency);
+    ~ResourceGroup();
+
+    ResourceGroup(const ResourceGroup&) = delete;
+    ResourceGroup& operator=(const ResourceGroup&) = delete;
+
+    // Create the MemTracker under `parent`, and register the metrics of this group.
+    void init(MemTracker* parent);
+
+    int id() const { return _id; }
+    const std::string& name() const { return _name; }
+    int cpu_weight() const { return _cpu_weight; }
+    int64_t mem_limit() const { return _mem_limit; }
+    int max_concurrency() const { return _max_concurrency; }
+    MemTracker* mem_tracker() const { return _mem_tracker.get(); }
+
+    // Admit a new query into this group, fail with TooManyTasks if max_concurrency queries are
+    // running. An admitted query must call release_query once finished.
+    Status acquire_query();
+    void release_query();
+    int num_running_queries() const { return _num_running_queries.load(); }
+
+    // Account the time a driver of this group spent on an executor thread.
+    void incr_cpu_time(int64_t time_ns) { _cpu_time_us.increment(time_ns / 1000); }
+
+private:
+    const int _id;
+    const std::string _name;
+    const int _cpu_weight;
+    const int64_t _mem_limit;
+    const int _max_concurrency;
+
+    std::unique_ptr<MemTracker> _mem_tracker;
+    std::atomic<int> _num_running_queries{0};
+
+    bool _metrics_registered = false;
+    IntGauge _running_queries{MetricUnit::NOUNIT};
+    IntAtomicCounter _rejected_queries{MetricUnit::REQUESTS};
+    IntAtomicCounter _cpu_time_us{MetricUnit::MICROSECONDS};
+    IntGauge _mem_bytes{MetricUnit::BYTES};
+};
+
+using ResourceGroupPtr = std::shared_ptr<ResourceGroup>;
+
+// Maps a query to a resource group by its user and type.
+struct ResourceGroupClassifier {
+    // empty if any user matches.
+    std::string user;
+    // unset if any type matches.
+    bool has_query_type = false;
+    TQueryType::type query_type = TQueryType::SELECT;
+    int group_id = 0;
+
+    // `query_user` may be qualified by the cluster name, as `cluster:user`.
+    bool match(const std::string& query_user, TQueryType::type query_query_type) const {
+        return (user.empty() || user == query_user || user == query_user.substr(query_user.rfind(':') + 1)) &&
+               (!has_query_type || query_type == query_query_type);
+    }
+};
+
+// ResourceGroupManager holds the resource groups defined by config::resource_groups, e.g.
+//     etl:cpu_weight=1,mem_limit=30%,concurrency=4;dashboard:cpu_weight=8
+// and the classifiers defined by config::resource_group_classifiers, e.g.
+//     etl:query_type=load;etl:user=etl_user;dashboard:user=bi,query_type=select
+// A query runs in the group it names through the `resource_group` session variable if that group
+// exists, otherwise in the group of the first classifier matching it, otherwise in the group
+// named `default`, which is created with cpu weight 1 and no limit unless it is configured.
+class ResourceGroupManager {
+    DECLARE_SINGLETON(ResourceGroupManager);
+
+public:
+    static constexpr const char* kDefaultGroupName = "default";
+
+    // Parse the groups and the classifiers, the memory of the groups is tracked under `parent`.
+    Status init(MemTracker* parent);
+
+    // Parse `groups_spec` and `classifiers_spec` without registering the groups.
+    static Status parse(const std::string& groups_spec, const std::string& classifiers_spec,
+                        std::vector<ResourceGroupPtr>* groups, std::vector<ResourceGroupClassifier>* classifiers);
+
+    ResourceGroup* classify(const std::string& requested_group, const std::string& user,
+                            TQueryType::type query_type) const;
+
+    // Indexed by ResourceGroup::id, the default group is the first one.
+    const std::vector<ResourceGroupPtr>& groups() const { return _groups; }
+
+private:
+    std::vector<ResourceGroupPtr> _groups;
+    std::vector<ResourceGroupClassifier> _classifiers;
+};
+
+} // namespace pipeline
+} // namespace starrocks
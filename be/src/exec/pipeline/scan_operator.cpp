@@ -4,6 +4,7 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/olap_chunk_source.h"
+#include "gutil/casts.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 
@@ -14,6 +15,10 @@ void ScanOperator::_pickup_morsel(RuntimeState* state) {
         _chunk_source->close(state);
     }
     auto maybe_morsel = _morsel_queue->try_get();
+    while (maybe_morsel.has_value() && _query_cache_ctx != nullptr &&
+           _query_cache_ctx->probe(*down_cast<OlapMorsel*>(maybe_morsel.value().get())->get_scan_range())) {
+        maybe_morsel = _morsel_queue->try_get();
+    }
     if (!maybe_morsel.has_value()) {
         // release _chunk_source before _curr_morsel, because _chunk_source depends on _curr_morsel.
         _chunk_source = nullptr;
@@ -150,6 +155,9 @@ StatusOr<vectorized::ChunkPtr> ScanOperator::_pull_chunk_blocking(RuntimeState*
     if (chunk.ok() || !chunk.status().is_end_of_file()) {
         return chunk;
     }
+    if (_query_cache_ctx != nullptr) {
+        _query_cache_ctx->finish_scan();
+    }
     _pickup_morsel(state);
     return std::make_shared<vectorized::Chunk>();
 }
@@ -174,6 +182,9 @@ StatusOr<vectorized::ChunkPtr> ScanOperator::_pull_chunk_nonblocking(RuntimeStat
     // processed and the EndOfFile is encountered, then ScanOperator has no chunk
     // to output and should pick up next morsel. so here return nullptr instead of
     // empty chunk.
+    if (_query_cache_ctx != nullptr) {
+        _query_cache_ctx->finish_scan();
+    }
     _pickup_morsel(state);
     return std::make_shared<vectorized::Chunk>();
 }
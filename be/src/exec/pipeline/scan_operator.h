@@ -4,6 +4,7 @@
 
 #include <optional>
 
+#include "exec/pipeline/query_cache.h"
 #include "exec/pipeline/source_operator.h"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "util/priority_thread_pool.hpp"
@@ -39,6 +40,10 @@ public:
 
     StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
     void set_io_threads(PriorityThreadPool* io_threads) { _io_threads = io_threads; }
+    // Skip the morsels whose results are cached, see QueryCacheContext.
+    void set_query_cache_ctx(std::shared_ptr<QueryCacheContext> query_cache_ctx) {
+        _query_cache_ctx = std::move(query_cache_ctx);
+    }
 
 private:
     void _pickup_morsel(RuntimeState* state);
@@ -55,6 +60,7 @@ private:
     const vectorized::RuntimeFilterProbeCollector& _runtime_filters;
     PriorityThreadPool* _io_threads = nullptr;
     OptionalChunkSourceFuture _pending_chunk_source_future;
+    std::shared_ptr<QueryCacheContext> _query_cache_ctx;
 };
 
 class ScanOperatorFactory final : public OperatorFactory {
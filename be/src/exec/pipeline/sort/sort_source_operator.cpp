@@ -18,7 +18,11 @@
 namespace starrocks::pipeline {
 StatusOr<vectorized::ChunkPtr> SortSourceOperator::pull_chunk(RuntimeState* state) {
     ChunkPtr chunk;
-    if (_chunks_sorter->pull_chunk(&chunk)) {
+    auto pulled_all = _chunks_sorter->pull_chunk(&chunk);
+    if (!pulled_all.ok()) {
+        return pulled_all.status();
+    }
+    if (pulled_all.value()) {
         _is_source_complete = true;
     }
 
@@ -112,9 +112,9 @@ Status SelectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     }
     {
         SCOPED_TIMER(_conjunct_evaluate_timer);
-        ExecNode::eval_conjuncts(_conjunct_ctxs, (*chunk).get());
+        eval_conjuncts_adaptively((*chunk).get());
     }
-    _num_rows_returned += (*chunk)->num_rows();
+    _num_rows_returned += (*chunk)->num_selected_rows();
 
     if (reached_limit()) {
         int64_t num_rows_over = _num_rows_returned - _limit;
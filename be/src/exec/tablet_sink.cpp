@@ -31,7 +31,9 @@
 #include "exprs/expr.h"
 #include "gutil/strings/fastmem.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "runtime/mem_hook.h"
 #include "runtime/row_batch.h"
 #include "runtime/runtime_state.h"
 #include "runtime/tuple_row.h"
@@ -51,6 +53,20 @@ static const uint8_t VALID_SEL_OK_AND_NULL = 0x3;
 
 namespace starrocks::stream_load {
 
+// Chunks pending in a channel are charged to its tracker explicitly, unless MemHook has
+// charged their memory to the tracker of the sink thread already.
+static void consume_chunk_memory(MemTracker* tracker, int64_t bytes) {
+    if (!MemHook::installed()) {
+        tracker->consume(bytes);
+    }
+}
+
+static void release_chunk_memory(MemTracker* tracker, int64_t bytes) {
+    if (!MemHook::installed()) {
+        tracker->release(bytes);
+    }
+}
+
 NodeChannel::NodeChannel(OlapTableSink* parent, int64_t index_id, int64_t node_id, int32_t schema_hash)
         : _parent(parent), _index_id(index_id), _node_id(node_id), _schema_hash(schema_hash) {
     // restrict the chunk memory usage of send queue
@@ -260,6 +276,10 @@ Status NodeChannel::add_chunk(vectorized::Chunk* chunk, const int64_t* tablet_id
     // But there is still some unfinished things, we do mem limit here temporarily.
     // _cancelled may be set by rpc callback, and it's possible that _cancelled might be set in any of the steps below.
     // It's fine to do a fake add_row() and return OK, because we will check _cancelled in next add_row() or mark_close().
+    if (MemHook::installed()) {
+        // the limits of the ancestors are checked against what MemHook charged.
+        CurrentThread::mem_tracker_flush();
+    }
     while (!_cancelled && ((_mem_tracker->any_limit_exceeded() && _pending_batches_num > 0) ||
                            _pending_batches_num >= _max_pending_batches_num)) {
         SCOPED_RAW_TIMER(&_mem_exceeded_block_ns);
@@ -268,7 +288,7 @@ Status NodeChannel::add_chunk(vectorized::Chunk* chunk, const int64_t* tablet_id
 
     if (_cur_chunk->columns().empty()) {
         _cur_chunk = chunk->clone_empty_with_slot();
-        _mem_tracker->consume(_cur_chunk->memory_usage());
+        consume_chunk_memory(_mem_tracker.get(), _cur_chunk->memory_usage());
     }
 
     if (_cur_chunk->num_rows() >= config::vector_chunk_size) {
@@ -279,14 +299,14 @@ Status NodeChannel::add_chunk(vectorized::Chunk* chunk, const int64_t* tablet_id
             _pending_batches_num++;
         }
         _cur_chunk = chunk->clone_empty_with_slot();
-        _mem_tracker->consume(_cur_chunk->memory_usage());
+        consume_chunk_memory(_mem_tracker.get(), _cur_chunk->memory_usage());
         _cur_add_chunk_request.clear_tablet_ids();
     }
 
     int64_t chunk_memory_usage = _cur_chunk->memory_usage();
     _cur_chunk->append_selective(*chunk, indexes, from, size);
     chunk_memory_usage = static_cast<int64_t>(_cur_chunk->memory_usage()) - chunk_memory_usage;
-    _mem_tracker->consume(chunk_memory_usage);
+    consume_chunk_memory(_mem_tracker.get(), chunk_memory_usage);
     for (size_t i = 0; i < size; ++i) {
         _cur_add_chunk_request.add_tablet_ids(tablet_ids[indexes[from + i]]);
     }
@@ -467,7 +487,7 @@ int NodeChannel::try_send_chunk_and_fetch_status() {
         _add_batch_closure->set_in_flight();
         _stub->tablet_writer_add_chunk(&_add_batch_closure->cntl, &request, &_add_batch_closure->result,
                                        _add_batch_closure);
-        _mem_tracker->release(chunk->memory_usage());
+        release_chunk_memory(_mem_tracker.get(), chunk->memory_usage());
         _next_packet_seq++;
     }
 
@@ -494,11 +514,11 @@ void NodeChannel::clear_all_batches() {
     if (_is_vectorized) {
         while (!_pending_chunks.empty()) {
             auto& chunk = _pending_chunks.front().first;
-            _mem_tracker->release(chunk->memory_usage());
+            release_chunk_memory(_mem_tracker.get(), chunk->memory_usage());
             _pending_chunks.pop();
         }
         if (_cur_chunk != nullptr) {
-            _mem_tracker->release(_cur_chunk->memory_usage());
+            release_chunk_memory(_mem_tracker.get(), _cur_chunk->memory_usage());
             _cur_chunk.reset();
         }
     } else {
@@ -0,0 +1,150 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/adaptive_conjuncts_evaluator.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "exec/exec_node.h"
+#include "exprs/expr_context.h"
+#include "simd/simd.h"
+#include "util/time.h"
+
+namespace starrocks::vectorized {
+
+void AdaptiveConjunctsEvaluator::init(const std::vector<ExprContext*>& ctxs, RuntimeProfile* profile) {
+    _ctxs = ctxs;
+    _order.resize(_ctxs.size());
+    std::iota(_order.begin(), _order.end(), 0);
+    _stats.assign(_ctxs.size(), ConjunctStats());
+    _num_chunks = 0;
+    _profile = profile;
+    if (_profile != nullptr && _ctxs.size() > 1) {
+        _reorder_counter = ADD_COUNTER(_profile, "ConjunctsReorderTimes", TUnit::UNIT);
+        _update_profile();
+    }
+    _initialized = true;
+}
+
+bool AdaptiveConjunctsEvaluator::_should_sample() const {
+    if (_num_chunks < kInitialSampleChunks) {
+        return true;
+    }
+    int32_t interval = config::conjuncts_reorder_sample_interval;
+    return interval > 0 && _num_chunks % interval == 0;
+}
+
+void AdaptiveConjunctsEvaluator::evaluate(Chunk* chunk, bool keep_selection) {
+    chunk->materialize_selection();
+    if (chunk->num_rows() == 0) {
+        return;
+    }
+    // nothing to reorder.
+    if (_ctxs.size() <= 1 && !keep_selection) {
+        ExecNode::eval_conjuncts(_ctxs, chunk);
+        return;
+    }
+
+    const bool sample = _ctxs.size() > 1 && _should_sample();
+    if (sample && _num_chunks >= kInitialSampleChunks) {
+        for (auto& stats : _stats) {
+            stats.input_rows /= 2;
+            stats.output_rows /= 2;
+            stats.cost_ns /= 2;
+        }
+    }
+    _num_chunks++;
+
+    // the chunk is compacted once less than `min_ratio` of its rows are selected,
+    // i.e. after each conjunct filtering out rows if the selection can't be kept.
+    const double min_ratio = keep_selection ? config::chunk_selection_min_ratio : 1.0;
+    // rows selected by the evaluated conjuncts, empty if all rows are selected.
+    Column::Filter filter;
+    size_t selected_rows = chunk->num_rows();
+    for (size_t idx : _order) {
+        const size_t input_rows = selected_rows;
+        const int64_t start_ns = sample ? MonotonicNanos() : 0;
+
+        ColumnPtr column = _ctxs[idx]->evaluate(chunk);
+        if (filter.empty()) {
+            size_t true_count = ColumnHelper::count_true_with_notnull(column);
+            if (true_count != column->size()) {
+                filter.assign(chunk->num_rows(), 1);
+                ColumnHelper::merge_two_filters(column, &filter, nullptr);
+            }
+            selected_rows = true_count;
+        } else {
+            ColumnHelper::merge_two_filters(column, &filter, nullptr);
+            selected_rows = SIMD::count_nonzero(filter.data(), filter.size());
+        }
+
+        if (selected_rows == 0) {
+            chunk->set_num_rows(0);
+            filter.clear();
+        } else if (!filter.empty() && selected_rows < min_ratio * chunk->num_rows()) {
+            chunk->filter(filter);
+            filter.clear();
+        }
+
+        if (sample) {
+            ConjunctStats& stats = _stats[idx];
+            stats.input_rows += input_rows;
+            stats.output_rows += selected_rows;
+            stats.cost_ns += MonotonicNanos() - start_ns;
+        }
+        if (selected_rows == 0) {
+            break;
+        }
+    }
+
+    if (!filter.empty()) {
+        chunk->set_selection(std::move(filter));
+    }
+    if (sample) {
+        _reorder();
+    }
+}
+
+void AdaptiveConjunctsEvaluator::_reorder() {
+    std::vector<double> ranks(_ctxs.size(), 0);
+    for (size_t i = 0; i < _ctxs.size(); i++) {
+        const ConjunctStats& stats = _stats[i];
+        // not measured yet, evaluate it first to learn about it.
+        if (stats.input_rows <= 0) {
+            continue;
+        }
+        double cost_per_row = std::max(stats.cost_ns, 1.0) / stats.input_rows;
+        double selectivity = stats.output_rows / stats.input_rows;
+        ranks[i] = cost_per_row / std::max(1 - selectivity, 1e-6);
+    }
+
+    std::vector<size_t> order(_ctxs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&ranks](size_t a, size_t b) { return ranks[a] < ranks[b]; });
+    if (order == _order) {
+        return;
+    }
+    _order.swap(order);
+    _num_reorders++;
+
+    if (_profile != nullptr) {
+        COUNTER_UPDATE(_reorder_counter, 1);
+        _update_profile();
+    }
+}
+
+void AdaptiveConjunctsEvaluator::_update_profile() {
+    std::string order_str;
+    for (size_t idx : _order) {
+        if (!order_str.empty()) {
+            order_str.append(",");
+        }
+        order_str.append(std::to_string(idx));
+    }
+    _profile->add_info_string("ConjunctsOrder", order_str);
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,79 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class ExprContext;
+
+namespace vectorized {
+
+// AdaptiveConjunctsEvaluator filters chunks by a list of conjuncts like ExecNode::eval_conjuncts,
+// but does not stick to the planner order. It measures the selectivity and the cost per row of
+// each conjunct on the first few chunks and then once every conjuncts_reorder_sample_interval
+// chunks, and evaluates the conjuncts in ascending order of
+//     cost_per_row / (1 - selectivity)
+// i.e. cheap and selective conjuncts first. The chunk is shrunk after each conjunct which
+// filters out rows, so later conjuncts only see the surviving rows.
+//
+// If the caller can return a chunk with a selection vector, the chunk is not shrunk while at
+// least config::chunk_selection_min_ratio of its rows are selected, the remaining filter is
+// left as the selection of the chunk.
+//
+// The evaluation order in use, as indexes into the planner order, is shown in the runtime
+// profile as `ConjunctsOrder`.
+//
+// This class is not thread-safe.
+class AdaptiveConjunctsEvaluator {
+public:
+    // `profile` may be nullptr. It should not be shared with other evaluators, whose orders
+    // would overwrite each other.
+    void init(const std::vector<ExprContext*>& ctxs, RuntimeProfile* profile);
+
+    bool initialized() const { return _initialized; }
+
+    // Remove rows of `chunk` not satisfying all conjuncts, or with `keep_selection`, possibly
+    // filter them out by the selection of `chunk` only.
+    void evaluate(Chunk* chunk, bool keep_selection = false);
+
+    // indexes of conjuncts in the order of evaluation.
+    const std::vector<size_t>& order() const { return _order; }
+
+    // number of times the order has changed.
+    int64_t num_reorders() const { return _num_reorders; }
+
+private:
+    // Number of first chunks always sampled.
+    static constexpr int64_t kInitialSampleChunks = 4;
+
+    // Statistics are decayed on each periodic sample, so recent chunks weigh more.
+    struct ConjunctStats {
+        double input_rows = 0;
+        double output_rows = 0;
+        double cost_ns = 0;
+    };
+
+    bool _should_sample() const;
+    void _reorder();
+    void _update_profile();
+
+    bool _initialized = false;
+    std::vector<ExprContext*> _ctxs;
+    std::vector<size_t> _order;
+    std::vector<ConjunctStats> _stats;
+    int64_t _num_chunks = 0;
+    int64_t _num_reorders = 0;
+
+    RuntimeProfile* _profile = nullptr;
+    RuntimeProfile::Counter* _reorder_counter = nullptr;
+};
+
+} // namespace vectorized
+} // namespace starrocks
@@ -11,6 +11,7 @@
 #include "runtime/mem_pool.h"
 #include "runtime/mem_tracker.h"
 #include "util/hash_util.hpp"
+#include "util/inline_slice.h"
 #include "util/phmap/phmap.h"
 #include "util/phmap/phmap_dump.h"
 
@@ -32,6 +33,16 @@ using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, Std
 template <PhmapSeed seed>
 using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
 
+template <PhmapSeed seed>
+struct InlineSliceHashWithSeed {
+    std::size_t operator()(const InlineSlice& key) const { return SliceHashWithSeed<seed>()(key.to_slice()); }
+};
+
+// Keys of at most InlineSlice::kInlineSize bytes are stored in the hash map slot, they are
+// hashed and compared without loading the strings and don't need a copy in the MemPool.
+template <PhmapSeed seed>
+using InlineSliceAggHashMap = phmap::flat_hash_map<InlineSlice, AggDataPtr, InlineSliceHashWithSeed<seed>>;
+
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
 
@@ -43,6 +54,16 @@ using SliceAggTwoLevelHashMap =
         phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
                                       phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
 
+// The key points to the chunk, copy it to the pool before insert unless it's inlined.
+inline InlineSlice persist_key(const InlineSlice& key, MemPool* pool) {
+    if (key.is_inline()) {
+        return key;
+    }
+    uint8_t* pos = pool->allocate(key.size());
+    strings::memcpy_inlined(pos, key.data(), key.size());
+    return {reinterpret_cast<const char*>(pos), key.size()};
+}
+
 // TODO(kks): Remove redundant code for compute_agg_states method
 // handle one number hash key
 template <typename FieldType, typename HashMap>
@@ -228,14 +249,10 @@ struct AggHashMapWithOneStringKey {
         auto column = down_cast<BinaryColumn*>(key_columns[0].get());
 
         for (size_t i = 0; i < column->size(); i++) {
-            auto key = column->get_slice(i);
+            InlineSlice key(column->get_slice(i));
             auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) {
-                // we must persist the slice before insert
-                uint8_t* pos = pool->allocate(key.size);
-                strings::memcpy_inlined(pos, key.data, key.size);
-                Slice pk{pos, key.size};
                 AggDataPtr pv = allocate_func();
-                ctor(pk, pv);
+                ctor(persist_key(key, pool), pv);
             });
             (*agg_states)[i] = iter->second;
         }
@@ -252,7 +269,7 @@ struct AggHashMapWithOneStringKey {
         not_founds->assign(chunk_size, 0);
 
         for (size_t i = 0; i < chunk_size; i++) {
-            auto key = column->get_slice(i);
+            InlineSlice key(column->get_slice(i));
             if (auto iter = hash_map.find(key); iter != hash_map.end()) {
                 (*agg_states)[i] = iter->second;
             } else {
@@ -355,20 +372,17 @@ struct AggHashMapWithOneNullableStringKey {
     template <typename Func>
     void _handle_data_key_column(BinaryColumn* data_column, size_t row, MemPool* pool, Func&& allocate_func,
                                  Buffer<AggDataPtr>* agg_states) {
-        auto key = data_column->get_slice(row);
+        InlineSlice key(data_column->get_slice(row));
         auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) {
-            uint8_t* pos = pool->allocate(key.size);
-            strings::memcpy_inlined(pos, key.data, key.size);
-            Slice pk{pos, key.size};
             AggDataPtr pv = allocate_func();
-            ctor(pk, pv);
+            ctor(persist_key(key, pool), pv);
         });
         (*agg_states)[row] = iter->second;
     }
 
     void _handle_data_key_column(BinaryColumn* data_column, size_t row, Buffer<AggDataPtr>* agg_states,
                                  std::vector<uint8_t>* not_founds) {
-        auto key = data_column->get_slice(row);
+        InlineSlice key(data_column->get_slice(row));
         if (auto iter = hash_map.find(key); iter != hash_map.end()) {
             (*agg_states)[row] = iter->second;
         } else {
@@ -112,9 +112,9 @@ using NullTimeStampAggHashMapWithOneNumberKey =
         AggHashMapWithOneNullableNumberKey<TimestampValue, TimeStampAggHashMap<seed>>;
 // For string type, we use slice type as hashmap key
 template <PhmapSeed seed>
-using OneStringAggHashMap = AggHashMapWithOneStringKey<SliceAggHashMap<seed>>;
+using OneStringAggHashMap = AggHashMapWithOneStringKey<InlineSliceAggHashMap<seed>>;
 template <PhmapSeed seed>
-using NullOneStringAggHashMap = AggHashMapWithOneNullableStringKey<SliceAggHashMap<seed>>;
+using NullOneStringAggHashMap = AggHashMapWithOneNullableStringKey<InlineSliceAggHashMap<seed>>;
 template <PhmapSeed seed>
 using SerializedKeyAggHashMap = AggHashMapWithSerializedKey<SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
@@ -122,8 +122,8 @@ Status AggregateBlockingNode::get_next(RuntimeState* state, ChunkPtr* chunk, boo
 
     // For having
     size_t old_size = (*chunk)->num_rows();
-    ExecNode::eval_conjuncts(_conjunct_ctxs, (*chunk).get());
-    _num_rows_returned -= (old_size - (*chunk)->num_rows());
+    eval_conjuncts_adaptively((*chunk).get());
+    _num_rows_returned -= (old_size - (*chunk)->num_selected_rows());
 
     _process_limit(chunk);
 
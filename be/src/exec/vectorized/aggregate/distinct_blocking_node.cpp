@@ -97,8 +97,8 @@ Status DistinctBlockingNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool
 
     // For having
     size_t old_size = (*chunk)->num_rows();
-    ExecNode::eval_conjuncts(_conjunct_ctxs, (*chunk).get());
-    _num_rows_returned -= (old_size - (*chunk)->num_rows());
+    eval_conjuncts_adaptively((*chunk).get());
+    _num_rows_returned -= (old_size - (*chunk)->num_selected_rows());
 
     _process_limit(chunk);
 
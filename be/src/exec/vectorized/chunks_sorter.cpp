@@ -7,6 +7,8 @@
 #include "column/type_traits.h"
 #include "exprs/expr.h"
 #include "gutil/casts.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_hook.h"
 #include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "util/orlp/pdqsort.h"
@@ -56,8 +58,13 @@ void ChunksSorter::setup_runtime(MemTracker* mem_tracker, RuntimeProfile* profil
 
 Status ChunksSorter::_consume_and_check_memory_limit(RuntimeState* state, int64_t mem_bytes) {
     if ((_mem_tracker != nullptr) && (state != nullptr)) {
-        _mem_tracker->consume(mem_bytes);
-        _last_memory_usage += mem_bytes;
+        if (MemHook::installed()) {
+            // MemHook has charged the memory to the tracker of current thread, make it visible to the check.
+            CurrentThread::mem_tracker_flush();
+        } else {
+            _mem_tracker->consume(mem_bytes);
+            _last_memory_usage += mem_bytes;
+        }
         RETURN_IF_ERROR(state->check_query_state("ChunksSorter"));
     }
     return Status::OK();
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "column/vectorized_fwd.h"
+#include "common/statusor.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
 
@@ -280,14 +281,14 @@ public:
     // Finish seeding Chunk, and get sorted data with top OFFSET rows have been skipped.
     virtual Status done(RuntimeState* state) = 0;
     // get_next only works after done().
-    virtual void get_next(ChunkPtr* chunk, bool* eos) = 0;
+    virtual Status get_next(ChunkPtr* chunk, bool* eos) = 0;
 
     // This
     Status finish(RuntimeState* state);
     bool sink_complete();
 
-    // pull_chunk for pipeline.
-    virtual bool pull_chunk(ChunkPtr* chunk) = 0;
+    // pull_chunk for pipeline, return true if all data has been pulled.
+    virtual StatusOr<bool> pull_chunk(ChunkPtr* chunk) = 0;
 
 protected:
     inline size_t _get_number_of_order_by_columns() const { return _sort_exprs->size(); }
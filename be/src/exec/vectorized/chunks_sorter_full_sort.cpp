@@ -138,8 +138,8 @@ private:
     static void sort_on_not_null_binary_column(Column* column, bool is_asc_order, Permutation& perm, size_t offset,
                                                size_t count = 0) {
         const size_t row_num = (count == 0 || offset + count > perm.size()) ? (perm.size() - offset) : count;
-        auto* binary_column = reinterpret_cast<BinaryColumn*>(column);
-        auto& data = binary_column->get_data();
+        // the column may be a LargeBinaryColumn, both expose their values as slices.
+        const auto* data = reinterpret_cast<const Slice*>(column->raw_data());
         std::vector<SortItem<Slice>> sort_items(row_num);
         for (uint32_t i = 0; i < row_num; ++i) {
             sort_items[i] = {data[perm[i + offset].index_in_chunk], perm[i + offset].index_in_chunk, i};
@@ -254,6 +254,7 @@ Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk)
     }
 
     _big_chunk->append(*chunk);
+    _big_chunk->upgrade_if_overflow();
 
     DCHECK(!_big_chunk->has_const_column());
     return Status::OK();
@@ -268,18 +269,20 @@ Status ChunksSorterFullSort::done(RuntimeState* state) {
     return Status::OK();
 }
 
-void ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
+Status ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
     SCOPED_TIMER(_output_timer);
     if (_next_output_row >= _sorted_permutation.size()) {
         *chunk = nullptr;
         *eos = true;
-        return;
+        return Status::OK();
     }
     *eos = false;
     size_t count = std::min(size_t(config::vector_chunk_size), _sorted_permutation.size() - _next_output_row);
     chunk->reset(_sorted_segment->chunk->clone_empty(count).release());
-    _append_rows_to_chunk(chunk->get(), _sorted_segment->chunk.get(), _sorted_permutation, _next_output_row, count);
+    RETURN_IF_ERROR(_append_rows_to_chunk(chunk->get(), _sorted_segment->chunk.get(), _sorted_permutation,
+                                          _next_output_row, count));
     _next_output_row += count;
+    return Status::OK();
 }
 
 /*
@@ -290,7 +293,7 @@ void ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
  * so we use _next_output_row and _sorted_permutation to get datas from _sorted_segment->chunk, 
  * and copy it in chunk as output.
  */
-bool ChunksSorterFullSort::pull_chunk(ChunkPtr* chunk) {
+StatusOr<bool> ChunksSorterFullSort::pull_chunk(ChunkPtr* chunk) {
     // _next_output_row used to record next row to get,
     // This condition is used to determine whether all data has been retrieved.
     if (_next_output_row >= _sorted_permutation.size()) {
@@ -299,7 +302,8 @@ bool ChunksSorterFullSort::pull_chunk(ChunkPtr* chunk) {
     }
     size_t count = std::min(size_t(config::vector_chunk_size), _sorted_permutation.size() - _next_output_row);
     chunk->reset(_sorted_segment->chunk->clone_empty(count).release());
-    _append_rows_to_chunk(chunk->get(), _sorted_segment->chunk.get(), _sorted_permutation, _next_output_row, count);
+    RETURN_IF_ERROR(_append_rows_to_chunk(chunk->get(), _sorted_segment->chunk.get(), _sorted_permutation,
+                                          _next_output_row, count));
     _next_output_row += count;
 
     if (_next_output_row >= _sorted_permutation.size()) {
@@ -327,7 +331,14 @@ Status ChunksSorterFullSort::_build_sorting_data(RuntimeState* state) {
     SCOPED_TIMER(_build_timer);
     size_t row_count = _big_chunk->num_rows();
 
-    _sorted_segment = std::make_unique<DataSegment>(_sort_exprs, ChunkPtr(_big_chunk.release()));
+    _sorted_segment = std::make_unique<DataSegment>();
+    _sorted_segment->chunk.reset(_big_chunk.release());
+    _sorted_segment->order_by_columns.reserve(_sort_exprs->size());
+    for (ExprContext* expr_ctx : *_sort_exprs) {
+        auto res = expr_ctx->evaluate_with_large_columns(_sorted_segment->chunk.get());
+        RETURN_IF_ERROR(res.status());
+        _sorted_segment->order_by_columns.push_back(std::move(res).value());
+    }
 
     int64_t mem_usage = row_count * sizeof(PermutationItem);
     RETURN_IF_ERROR(_consume_and_check_memory_limit(state, mem_usage));
@@ -483,14 +494,19 @@ void ChunksSorterFullSort::_sort_by_columns() {
     }
 }
 
-void ChunksSorterFullSort::_append_rows_to_chunk(Chunk* dest, Chunk* src, const Permutation& permutation, size_t offset,
-                                                 size_t count) {
+Status ChunksSorterFullSort::_append_rows_to_chunk(Chunk* dest, Chunk* src, const Permutation& permutation,
+                                                   size_t offset, size_t count) {
     for (size_t i = offset; i < offset + count; ++i) {
         _selective_values[i - offset] = permutation[i].index_in_chunk;
     }
     dest->append_selective(*src, _selective_values.data(), 0, count);
+    if (dest->has_large_column()) {
+        // Operators downstream only handle BinaryColumn.
+        RETURN_IF_ERROR(dest->downgrade());
+    }
 
     DCHECK(!dest->has_const_column());
+    return Status::OK();
 }
 
 } // namespace starrocks::vectorized
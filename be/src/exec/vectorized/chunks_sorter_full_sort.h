@@ -24,8 +24,8 @@ public:
     // Append a Chunk for sort.
     Status update(RuntimeState* state, const ChunkPtr& chunk) override;
     Status done(RuntimeState* state) override;
-    void get_next(ChunkPtr* chunk, bool* eos) override;
-    bool pull_chunk(ChunkPtr* chunk) override;
+    Status get_next(ChunkPtr* chunk, bool* eos) override;
+    StatusOr<bool> pull_chunk(ChunkPtr* chunk) override;
 
     friend class SortHelper;
 
@@ -36,7 +36,7 @@ private:
     void _sort_by_row_cmp();
     void _sort_by_columns();
 
-    void _append_rows_to_chunk(Chunk* dest, Chunk* src, const Permutation& permutation, size_t offset, size_t count);
+    Status _append_rows_to_chunk(Chunk* dest, Chunk* src, const Permutation& permutation, size_t offset, size_t count);
 
     ChunkUniquePtr _big_chunk;
     std::unique_ptr<DataSegment> _sorted_segment;
@@ -83,18 +83,19 @@ Status ChunksSorterTopn::done(RuntimeState* state) {
     return Status::OK();
 }
 
-void ChunksSorterTopn::get_next(ChunkPtr* chunk, bool* eos) {
+Status ChunksSorterTopn::get_next(ChunkPtr* chunk, bool* eos) {
     ScopedTimer<MonotonicStopWatch> timer(_output_timer);
     if (_next_output_row >= _merged_segment.chunk->num_rows()) {
         *chunk = nullptr;
         *eos = true;
-        return;
+        return Status::OK();
     }
     *eos = false;
     size_t count = std::min(size_t(config::vector_chunk_size), _merged_segment.chunk->num_rows() - _next_output_row);
     chunk->reset(_merged_segment.chunk->clone_empty(count).release());
     (*chunk)->append_safe(*_merged_segment.chunk, _next_output_row, count);
     _next_output_row += count;
+    return Status::OK();
 }
 
 /*
@@ -103,7 +104,7 @@ void ChunksSorterTopn::get_next(ChunkPtr* chunk, bool* eos) {
  * so we use _next_output_row to get datas from _merged_segment.chunk, 
  * and copy it in chunk as output.
  */
-bool ChunksSorterTopn::pull_chunk(ChunkPtr* chunk) {
+StatusOr<bool> ChunksSorterTopn::pull_chunk(ChunkPtr* chunk) {
     if (_next_output_row >= _merged_segment.chunk->num_rows()) {
         *chunk = nullptr;
         return true;
@@ -30,9 +30,9 @@ public:
     // Finish seeding Chunk, and get sorted data with top OFFSET rows have been skipped.
     Status done(RuntimeState* state) override;
     // get_next only works after done().
-    void get_next(ChunkPtr* chunk, bool* eos) override;
+    Status get_next(ChunkPtr* chunk, bool* eos) override;
     // pull_chunk for pipeline.
-    bool pull_chunk(ChunkPtr* chunk) override;
+    StatusOr<bool> pull_chunk(ChunkPtr* chunk) override;
 
 private:
     inline size_t _get_number_of_rows_to_sort() const { return _offset + _limit; }
@@ -286,7 +286,7 @@ Status CrossJoinNode::get_next_internal(RuntimeState* state, ChunkPtr* chunk, bo
                     return Status::OK();
                 } else {
                     // should output (*chunk) first before EOS
-                    ExecNode::eval_conjuncts(_conjunct_ctxs, (*chunk).get());
+                    eval_conjuncts_adaptively((*chunk).get());
                     break;
                 }
             }
@@ -385,13 +385,13 @@ Status CrossJoinNode::get_next_internal(RuntimeState* state, ChunkPtr* chunk, bo
             continue;
         }
 
-        ExecNode::eval_conjuncts(_conjunct_ctxs, (*chunk).get());
+        eval_conjuncts_adaptively((*chunk).get());
 
         // we get result chunk.
         break;
     }
 
-    _num_rows_returned += (*chunk)->num_rows();
+    _num_rows_returned += (*chunk)->num_selected_rows();
     if (reached_limit()) {
         (*chunk)->set_num_rows((*chunk)->num_rows() - (_num_rows_returned - _limit));
         _num_rows_returned = _limit;
@@ -66,6 +66,9 @@ Status FileScanNode::prepare(RuntimeState* state) {
 
     _scanner_file_reader_timer = ADD_TIMER(p->create_child("FilePRead", true, true), "FileReadTimer");
 
+    _scanner_json_parse_timer = ADD_TIMER(p, "JsonParseTimer");
+    _scanner_json_parse_bytes = ADD_COUNTER(p, "JsonParseBytes", TUnit::BYTES);
+
     return Status::OK();
 }
 
@@ -319,6 +322,8 @@ void FileScanNode::scanner_worker(int start_idx, int length) {
         COUNTER_UPDATE(_scanner_init_chunk_timer, counter.init_chunk_ns);
 
         COUNTER_UPDATE(_scanner_file_reader_timer, counter.file_read_ns);
+        COUNTER_UPDATE(_scanner_json_parse_timer, counter.json_parse_ns);
+        COUNTER_UPDATE(_scanner_json_parse_bytes, counter.json_parse_bytes);
     }
 
     // scanner is going to finish
@@ -112,6 +112,8 @@ private:
     RuntimeProfile::Counter* _scanner_materialize_timer = nullptr;
     RuntimeProfile::Counter* _scanner_init_chunk_timer = nullptr;
     RuntimeProfile::Counter* _scanner_file_reader_timer = nullptr;
+    RuntimeProfile::Counter* _scanner_json_parse_timer = nullptr;
+    RuntimeProfile::Counter* _scanner_json_parse_bytes = nullptr;
 };
 
 } // namespace vectorized
@@ -26,6 +26,10 @@ struct ScannerCounter {
     int64_t init_chunk_ns = 0;
 
     int64_t file_read_ns = 0;
+
+    // json load
+    int64_t json_parse_ns = 0;
+    int64_t json_parse_bytes = 0;
 };
 
 class FileScanner {
@@ -306,7 +306,7 @@ Status HashJoinNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     }
 
     DCHECK_LE((*chunk)->num_rows(), config::vector_chunk_size);
-    _num_rows_returned += (*chunk)->num_rows();
+    _num_rows_returned += (*chunk)->num_selected_rows();
     _output_chunk_count++;
     if (reached_limit()) {
         (*chunk)->set_num_rows((*chunk)->num_rows() - (_num_rows_returned - _limit));
@@ -352,7 +352,9 @@ Status HashJoinNode::_build(RuntimeState* state) {
         SCOPED_TIMER(_build_conjunct_evaluate_timer);
         for (auto& _build_expr_ctx : _build_expr_ctxs) {
             const TypeDescriptor& data_type = _build_expr_ctx->root()->type();
-            ColumnPtr column_ptr = _build_expr_ctx->evaluate(_ht.get_build_chunk().get());
+            auto res = _build_expr_ctx->evaluate_with_large_columns(_ht.get_build_chunk().get());
+            RETURN_IF_ERROR(res.status());
+            ColumnPtr column_ptr = std::move(res).value();
             if (column_ptr->is_nullable() && column_ptr->is_constant()) {
                 ColumnPtr column = ColumnHelper::create_column(data_type, true);
                 column->append_nulls(_ht.get_build_chunk()->num_rows());
@@ -487,7 +489,7 @@ Status HashJoinNode::_probe(RuntimeState* state, ScopedTimer<MonotonicStopWatch>
 
         if (!_conjunct_ctxs.empty()) {
             SCOPED_TIMER(_where_conjunct_evaluate_timer);
-            eval_conjuncts(_conjunct_ctxs, (*chunk).get());
+            eval_conjuncts_adaptively((*chunk).get());
 
             if ((*chunk)->num_rows() <= 0) {
                 // TODO: It's better to reuse the chunk object.
@@ -517,7 +519,7 @@ Status HashJoinNode::_probe_remain(ChunkPtr* chunk, bool& eos) {
         }
 
         if (!_conjunct_ctxs.empty()) {
-            eval_conjuncts(_conjunct_ctxs, (*chunk).get());
+            eval_conjuncts_adaptively((*chunk).get());
 
             if ((*chunk)->num_rows() <= 0) {
                 // TODO: It's better to reuse the chunk object.
@@ -678,6 +680,7 @@ Status HashJoinNode::_push_down_in_filter(RuntimeState* state) {
         for (size_t i = 0; i < size; i++) {
             if (!to_build[i]) continue;
             ColumnPtr column = _ht.get_key_columns()[i];
+            if (column->has_large_column()) continue;
             Expr* probe_expr = _probe_expr_ctxs[i]->root();
             // create and fill runtime IN filter.
             ExprContext* filter =
@@ -714,6 +717,8 @@ Status HashJoinNode::_do_publish_runtime_filters(RuntimeState* state, int64_t li
         filter->set_join_mode(rf_desc->join_mode());
         filter->init(_ht.get_row_count());
         ColumnPtr column = _ht.get_key_columns()[rf_desc->build_expr_order()];
+        // runtime filters read key columns as BinaryColumn.
+        if (column->has_large_column()) continue;
         RETURN_IF_ERROR(RuntimeFilterHelper::fill_runtime_bloom_filter(column, build_type, filter));
         rf_desc->set_runtime_filter(filter);
     }
@@ -4,6 +4,7 @@
 
 #include <memory>
 
+#include "env/block_cache.h"
 #include "env/env_hdfs.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
@@ -14,6 +15,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/vectorized/chunk_helper.h"
 #include "util/priority_thread_pool.hpp"
+#include "util/time.h"
 
 namespace starrocks::vectorized {
 HdfsScanNode::HdfsScanNode(ObjectPool* pool, const TPlanNode& tnode, const DescriptorTbl& descs)
@@ -78,6 +80,7 @@ Status HdfsScanNode::prepare(RuntimeState* state) {
     _init_counter(state);
 
     _runtime_state = state;
+    _query_acct = ScanQueryAcctManager::instance()->get_or_register(state->query_id());
     return Status::OK();
 }
 
@@ -200,12 +203,12 @@ Status HdfsScanNode::_create_and_init_scanner(RuntimeState* state, const HdfsFil
 
 bool HdfsScanNode::_submit_scanner(HdfsScanner* scanner, bool blockable) {
     auto* thread_pool = _runtime_state->exec_env()->thread_pool();
-    int delta = static_cast<int>(!scanner->keep_priority());
-    int32_t num_submit = _scanner_submit_count.fetch_add(delta, std::memory_order_relaxed);
+    const int64_t submit_ns = MonotonicNanos();
 
     PriorityThreadPool::Task task;
-    task.work_function = [this, scanner] { _scanner_thread(scanner); };
-    task.priority = _compute_priority(num_submit);
+    task.work_function = [this, scanner, submit_ns] { _scanner_thread(scanner, MonotonicNanos() - submit_ns); };
+    // tasks of the queries having taken less scan time go first.
+    task.priority = _query_acct->compute_priority();
     _running_threads.fetch_add(1, std::memory_order_release);
 
     if (thread_pool->try_offer(task)) {
@@ -218,46 +221,18 @@ bool HdfsScanNode::_submit_scanner(HdfsScanner* scanner, bool blockable) {
 
     LOG(WARNING) << "thread pool busy";
     _running_threads.fetch_sub(1, std::memory_order_release);
-    _scanner_submit_count.fetch_sub(delta, std::memory_order_relaxed);
     return false;
 }
 
-// The more tasks you submit, the less priority you get.
-int HdfsScanNode::_compute_priority(int32_t num_submitted_tasks) {
-    // int nice = 20;
-    // while (nice > 0 && num_submitted_tasks > (22 - nice) * (20 - nice) * 6) {
-    //     --nice;
-    // }
-    // return nice;
-    if (num_submitted_tasks < 5) return 20;
-    if (num_submitted_tasks < 19) return 19;
-    if (num_submitted_tasks < 49) return 18;
-    if (num_submitted_tasks < 91) return 17;
-    if (num_submitted_tasks < 145) return 16;
-    if (num_submitted_tasks < 211) return 15;
-    if (num_submitted_tasks < 289) return 14;
-    if (num_submitted_tasks < 379) return 13;
-    if (num_submitted_tasks < 481) return 12;
-    if (num_submitted_tasks < 595) return 11;
-    if (num_submitted_tasks < 721) return 10;
-    if (num_submitted_tasks < 859) return 9;
-    if (num_submitted_tasks < 1009) return 8;
-    if (num_submitted_tasks < 1171) return 7;
-    if (num_submitted_tasks < 1345) return 6;
-    if (num_submitted_tasks < 1531) return 5;
-    if (num_submitted_tasks < 1729) return 4;
-    if (num_submitted_tasks < 1939) return 3;
-    if (num_submitted_tasks < 2161) return 2;
-    if (num_submitted_tasks < 2395) return 1;
-    return 0;
-}
+void HdfsScanNode::_scanner_thread(HdfsScanner* scanner, int64_t queue_time_ns) {
+    COUNTER_UPDATE(_scanner_queue_timer, queue_time_ns);
+    _query_acct->start_task(queue_time_ns);
+    const int64_t start_ns = MonotonicNanos();
 
-void HdfsScanNode::_scanner_thread(HdfsScanner* scanner) {
     Status status = scanner->open(_runtime_state);
     if (!status.ok()) {
         _update_status(status);
     }
-    scanner->set_keep_priority(false);
 
     bool resubmit = false;
     int64_t raw_rows_threshold = scanner->raw_rows_read() + config::doris_scanner_row_num;
@@ -268,7 +243,6 @@ void HdfsScanNode::_scanner_thread(HdfsScanner* scanner) {
         {
             std::lock_guard<std::mutex> l(_mtx);
             if (_chunk_pool.empty()) {
-                scanner->set_keep_priority(true);
                 _pending_scanners.push(scanner);
                 scanner = nullptr;
                 break;
@@ -292,6 +266,8 @@ void HdfsScanNode::_scanner_thread(HdfsScanner* scanner) {
             break;
         }
     }
+    // account the time before resubmitting, so the next task of the query gets the updated priority.
+    _query_acct->finish_task(MonotonicNanos() - start_ns);
 
     Status global_status = _get_status();
     if (global_status.ok()) {
@@ -432,6 +408,9 @@ Status HdfsScanNode::close(RuntimeState* state) {
     }
 
     _close_pending_scanners();
+    if (_query_acct != nullptr) {
+        _query_acct->update_profile(_runtime_profile.get());
+    }
 
     Expr::close(_min_max_conjunct_ctxs, state);
     Expr::close(_partition_conjunct_ctxs, state);
@@ -554,6 +533,12 @@ Status HdfsScanNode::_find_and_insert_hdfs_file(const THdfsScanRange& scan_range
         hdfs_file_desc->hdfs_fs = hdfs;
         hdfs_file_desc->hdfs_file = file;
         hdfs_file_desc->fs = std::make_shared<HdfsRandomAccessFile>(hdfs, file, native_file_path);
+        if (BlockCache::instance() != nullptr) {
+            int64_t modification_time = 0;
+            RETURN_IF_ERROR(_get_modification_time(hdfs, native_file_path, scan_range, &modification_time));
+            hdfs_file_desc->fs = std::make_shared<CachedRandomAccessFile>(
+                    std::move(hdfs_file_desc->fs), BlockCache::instance(), scan_range.file_length, modification_time);
+        }
         hdfs_file_desc->partition_id = scan_range.partition_id;
         hdfs_file_desc->path = scan_range.relative_path;
         hdfs_file_desc->file_length = scan_range.file_length;
@@ -565,6 +550,45 @@ Status HdfsScanNode::_find_and_insert_hdfs_file(const THdfsScanRange& scan_range
     return Status::OK();
 }
 
+Status HdfsScanNode::_get_modification_time(hdfsFS hdfs, const std::string& path, const THdfsScanRange& scan_range,
+                                            int64_t* modification_time) {
+    if (scan_range.__isset.modification_time) {
+        *modification_time = scan_range.modification_time;
+        return Status::OK();
+    }
+    // List the directory of the file once for all the files in it, one namenode RPC instead of one per file.
+    std::filesystem::path file_path(path);
+    std::string dir = file_path.parent_path().native();
+    auto dir_iter = _modification_times.find(dir);
+    if (dir_iter == _modification_times.end()) {
+        auto& times = _modification_times[dir];
+        int num_entries = 0;
+        hdfsFileInfo* infos = hdfsListDirectory(hdfs, dir.c_str(), &num_entries);
+        if (infos != nullptr) {
+            for (int i = 0; i < num_entries; i++) {
+                if (infos[i].mKind == kObjectKindFile) {
+                    times.emplace(std::filesystem::path(infos[i].mName).filename().native(), infos[i].mLastMod);
+                }
+            }
+            hdfsFreeFileInfo(infos, num_entries);
+        }
+        dir_iter = _modification_times.find(dir);
+    }
+    auto time_iter = dir_iter->second.find(file_path.filename().native());
+    if (time_iter != dir_iter->second.end()) {
+        *modification_time = time_iter->second;
+        return Status::OK();
+    }
+    // the listing failed, or the file was added after it.
+    hdfsFileInfo* info = hdfsGetPathInfo(hdfs, path.c_str());
+    if (info == nullptr) {
+        return Status::InternalError(strings::Substitute("get file info failed, file=$0", path));
+    }
+    *modification_time = info->mLastMod;
+    hdfsFreeFileInfo(info, 1);
+    return Status::OK();
+}
+
 Status HdfsScanNode::_get_name_node_from_path(const std::string& path, std::string* namenode) {
     const string local_fs("file:/");
     size_t n = path.find("://");
@@ -601,6 +625,7 @@ void HdfsScanNode::_update_status(const Status& status) {
 
 void HdfsScanNode::_init_counter(RuntimeState* state) {
     _scan_timer = ADD_TIMER(_runtime_profile, "ScanTime");
+    _scanner_queue_timer = ADD_TIMER(_runtime_profile, "ScannerQueueTime");
     _reader_init_timer = ADD_TIMER(_runtime_profile, "ReaderInit");
     _open_file_timer = ADD_TIMER(_runtime_profile, "OpenFile");
     _raw_rows_counter = ADD_COUNTER(_runtime_profile, "RawRowsRead", TUnit::UNIT);
@@ -621,6 +646,12 @@ void HdfsScanNode::_init_counter(RuntimeState* state) {
     _bytes_read_dn_cache = ADD_COUNTER(_runtime_profile, "BytesReadDataNodeCache", TUnit::BYTES);
     _bytes_read_remote = ADD_COUNTER(_runtime_profile, "BytesReadRemote", TUnit::BYTES);
 
+    // block cache
+    _block_cache_hit_bytes = ADD_COUNTER(_runtime_profile, "BlockCacheHitBytes", TUnit::BYTES);
+    _block_cache_miss_bytes = ADD_COUNTER(_runtime_profile, "BlockCacheMissBytes", TUnit::BYTES);
+    _block_cache_hit_count = ADD_COUNTER(_runtime_profile, "BlockCacheHitCount", TUnit::UNIT);
+    _block_cache_miss_count = ADD_COUNTER(_runtime_profile, "BlockCacheMissCount", TUnit::UNIT);
+
     // reader init
     _footer_read_timer = ADD_TIMER(_runtime_profile, "ReaderInitFooterRead");
     _column_reader_init_timer = ADD_TIMER(_runtime_profile, "ReaderInitColumnReaderInit");
@@ -629,6 +660,9 @@ void HdfsScanNode::_init_counter(RuntimeState* state) {
     _group_chunk_read_timer = ADD_TIMER(_runtime_profile, "GroupChunkRead");
     _group_dict_filter_timer = ADD_TIMER(_runtime_profile, "GroupDictFilter");
     _group_dict_decode_timer = ADD_TIMER(_runtime_profile, "GroupDictDecode");
+
+    // late materialization
+    _late_materialize_skip_rows = ADD_COUNTER(_runtime_profile, "LateMaterializeSkipRows", TUnit::UNIT);
 }
 
 } // namespace starrocks::vectorized
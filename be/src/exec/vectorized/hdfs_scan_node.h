@@ -8,6 +8,7 @@
 #include "exec/scan_node.h"
 #include "exec/vectorized/hdfs_scanner.h"
 #include "exec/vectorized/hdfs_scanner_orc.h"
+#include "exec/vectorized/scan_query_acct.h"
 #include "hdfs/hdfs.h"
 #include "runtime/tuple.h"
 
@@ -78,15 +79,16 @@ private:
     void _init_partition_expr_map();
     bool _filter_partition(const std::vector<ExprContext*>& partition_exprs);
     Status _find_and_insert_hdfs_file(const THdfsScanRange& scan_range);
+    Status _get_modification_time(hdfsFS hdfs, const std::string& path, const THdfsScanRange& scan_range,
+                                  int64_t* modification_time);
     Status _create_and_init_scanner(RuntimeState* state, const HdfsFileDesc& hdfs_file_desc);
 
     bool _submit_scanner(HdfsScanner* scanner, bool blockable);
-    void _scanner_thread(HdfsScanner* scanner);
+    void _scanner_thread(HdfsScanner* scanner, int64_t queue_time_ns);
     void _update_status(const Status& status);
     Status _get_status();
     void _fill_chunk_pool(int count);
     void _close_pending_scanners();
-    static int _compute_priority(int32_t num_submitted_tasks);
 
     void _init_counter(RuntimeState* state);
 
@@ -128,6 +130,8 @@ private:
 
     std::vector<THdfsScanRange> _scan_ranges;
     std::vector<HdfsFileDesc*> _hdfs_files;
+    // directory -> file name -> last modification time, listed for the scan ranges without modification time.
+    std::unordered_map<std::string, std::unordered_map<std::string, int64_t>> _modification_times;
     const HdfsTableDescriptor* _hdfs_table = nullptr;
     std::vector<std::string> _hive_column_names;
 
@@ -145,13 +149,16 @@ private:
     Status _status;
     RuntimeState* _runtime_state = nullptr;
 
-    std::atomic<int32_t> _scanner_submit_count = 0;
+    // used to compute task priority.
+    ScanQueryAcctPtr _query_acct;
     std::atomic<int32_t> _running_threads = 0;
     std::atomic<int32_t> _closed_scanners = 0;
 
     UnboundedBlockingQueue<ChunkPtr> _result_chunks;
 
     RuntimeProfile::Counter* _scan_timer = nullptr;
+    // time the scanner tasks wait in the thread pool.
+    RuntimeProfile::Counter* _scanner_queue_timer = nullptr;
     RuntimeProfile::Counter* _reader_init_timer = nullptr;
     RuntimeProfile::Counter* _open_file_timer = nullptr;
     RuntimeProfile::Counter* _raw_rows_counter = nullptr;
@@ -172,6 +179,12 @@ private:
     RuntimeProfile::Counter* _bytes_read_dn_cache = nullptr;
     RuntimeProfile::Counter* _bytes_read_remote = nullptr;
 
+    // block cache
+    RuntimeProfile::Counter* _block_cache_hit_bytes = nullptr;
+    RuntimeProfile::Counter* _block_cache_miss_bytes = nullptr;
+    RuntimeProfile::Counter* _block_cache_hit_count = nullptr;
+    RuntimeProfile::Counter* _block_cache_miss_count = nullptr;
+
     // reader init
     RuntimeProfile::Counter* _footer_read_timer = nullptr;
     RuntimeProfile::Counter* _column_reader_init_timer = nullptr;
@@ -180,5 +193,8 @@ private:
     RuntimeProfile::Counter* _group_chunk_read_timer = nullptr;
     RuntimeProfile::Counter* _group_dict_filter_timer = nullptr;
     RuntimeProfile::Counter* _group_dict_decode_timer = nullptr;
+
+    // late materialization
+    RuntimeProfile::Counter* _late_materialize_skip_rows = nullptr;
 };
 } // namespace starrocks::vectorized
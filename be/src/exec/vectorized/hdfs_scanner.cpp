@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "env/block_cache.h"
 #include "env/env_hdfs.h"
 #include "exec/exec_node.h"
 #include "exec/parquet/file_reader.h"
@@ -168,8 +169,19 @@ static void get_hdfs_statistics(hdfsFile file, HdfsReadStats* stats) {
 
 void HdfsScanner::update_counter() {
 #ifndef BE_TEST
+    RandomAccessFile* file = _scanner_params.fs.get();
+    if (auto* cached_file = dynamic_cast<CachedRandomAccessFile*>(file); cached_file != nullptr) {
+        CachedRandomAccessFile::Stats cache_stats;
+        cached_file->get_and_clear_stats(&cache_stats);
+        COUNTER_UPDATE(_scanner_params.parent->_block_cache_hit_bytes, cache_stats.hit_bytes);
+        COUNTER_UPDATE(_scanner_params.parent->_block_cache_miss_bytes, cache_stats.miss_bytes);
+        COUNTER_UPDATE(_scanner_params.parent->_block_cache_hit_count, cache_stats.hit_count);
+        COUNTER_UPDATE(_scanner_params.parent->_block_cache_miss_count, cache_stats.miss_count);
+        file = cached_file->underlying_file();
+    }
+
     HdfsReadStats hdfs_stats;
-    auto hdfs_file = down_cast<HdfsRandomAccessFile*>(_scanner_params.fs.get())->hdfs_file();
+    auto hdfs_file = down_cast<HdfsRandomAccessFile*>(file)->hdfs_file();
     get_hdfs_statistics(hdfs_file, &hdfs_stats);
 
     COUNTER_UPDATE(_scanner_params.parent->_bytes_total_read, hdfs_stats.bytes_total_read);
@@ -222,6 +234,7 @@ void HdfsParquetScanner::update_counter() {
     COUNTER_UPDATE(_scanner_params.parent->_group_chunk_read_timer, _stats.group_chunk_read_ns);
     COUNTER_UPDATE(_scanner_params.parent->_group_dict_filter_timer, _stats.group_dict_filter_ns);
     COUNTER_UPDATE(_scanner_params.parent->_group_dict_decode_timer, _stats.group_dict_decode_ns);
+    COUNTER_UPDATE(_scanner_params.parent->_late_materialize_skip_rows, _stats.late_materialize_skip_rows);
 #endif
 }
 
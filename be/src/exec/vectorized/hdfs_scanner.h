@@ -35,6 +35,8 @@ struct HdfsScanStats {
     int64_t group_chunk_read_ns = 0;
     int64_t group_dict_filter_ns = 0;
     int64_t group_dict_decode_ns = 0;
+    // late materialization
+    int64_t late_materialize_skip_rows = 0;
 };
 
 struct HdfsScannerParams {
@@ -144,8 +146,6 @@ public:
     Status init(RuntimeState* runtime_state, const HdfsScannerParams& scanner_params);
 
     int64_t raw_rows_read() const { return _stats.raw_rows_read; }
-    void set_keep_priority(bool v) { _keep_priority = v; }
-    bool keep_priority() const { return _keep_priority; }
     void update_counter();
 
     virtual Status do_open(RuntimeState* runtime_state) = 0;
@@ -156,7 +156,6 @@ public:
 private:
     bool _is_open = false;
     bool _is_closed = false;
-    bool _keep_priority = false;
     void _build_file_read_param();
 
 protected:
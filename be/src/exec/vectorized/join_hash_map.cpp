@@ -211,6 +211,80 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
     }
 }
 
+// Convert all rows of a (nullable) BinaryColumn, the keys of null rows are empty strings.
+static void build_inline_keys(const ColumnPtr& key_column, Buffer<InlineSlice>* keys) {
+    const BinaryColumn* column = nullptr;
+    if (key_column->is_nullable()) {
+        column = ColumnHelper::as_raw_column<BinaryColumn>(
+                ColumnHelper::as_raw_column<NullableColumn>(key_column)->data_column());
+    } else {
+        column = ColumnHelper::as_raw_column<BinaryColumn>(key_column);
+    }
+    const auto& offsets = column->get_offset();
+    const auto* bytes = reinterpret_cast<const char*>(column->get_bytes().data());
+    const size_t size = column->size();
+    keys->resize(size);
+    for (size_t i = 0; i < size; i++) {
+        (*keys)[i] = InlineSlice(bytes + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+}
+
+Status StringJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items,
+                                    HashTableProbeState* probe_state) {
+    size_t key_mem_usage = sizeof(InlineSlice) * (table_items->row_count + 1);
+    RETURN_IF_ERROR(JoinHashMapHelper::check_and_add_memory_usage(state, table_items, key_mem_usage));
+    return Status::OK();
+}
+
+Status StringJoinBuildFunc::construct_hash_table(JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
+    build_inline_keys(table_items->key_columns[0], &table_items->build_inline_keys);
+    const auto& data = table_items->build_inline_keys;
+
+    if (table_items->key_columns[0]->is_nullable()) {
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+        auto& null_array = nullable_column->null_column()->get_data();
+        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            if (null_array[i] == 0) {
+                uint32_t bucket_num =
+                        JoinHashMapHelper::calc_bucket_num<InlineSlice>(data[i], table_items->bucket_size);
+                table_items->next[i] = table_items->first[bucket_num];
+                table_items->first[bucket_num] = i;
+            }
+        }
+    } else {
+        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<InlineSlice>(data[i], table_items->bucket_size);
+            table_items->next[i] = table_items->first[bucket_num];
+            table_items->first[bucket_num] = i;
+        }
+    }
+    return Status::OK();
+}
+
+Status StringJoinProbeFunc::lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state) {
+    const ColumnPtr& key_column = (*probe_state->key_columns)[0];
+    build_inline_keys(key_column, &probe_state->probe_inline_keys);
+    const auto& data = probe_state->probe_inline_keys;
+    size_t probe_row_count = probe_state->probe_row_count;
+    JoinHashMapHelper::calc_bucket_nums<InlineSlice>(data, table_items.bucket_size, &probe_state->buckets, 0,
+                                                     probe_row_count);
+
+    probe_state->null_array = nullptr;
+    if (key_column->is_nullable() && key_column->has_null()) {
+        auto& null_array = ColumnHelper::as_raw_column<NullableColumn>(key_column)->null_column()->get_data();
+        for (size_t i = 0; i < probe_row_count; i++) {
+            probe_state->next[i] = null_array[i] == 0 ? table_items.first[probe_state->buckets[i]] : 0;
+        }
+        probe_state->null_array = &null_array;
+        return Status::OK();
+    }
+
+    for (size_t i = 0; i < probe_row_count; i++) {
+        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+    }
+    return Status::OK();
+}
+
 JoinHashTable::~JoinHashTable() {
     _table_items.mem_tracker->release(_table_items.last_memory_usage);
 }
@@ -384,6 +458,9 @@ Status JoinHashTable::append_chunk(RuntimeState* state, const ChunkPtr& chunk) {
 
     RETURN_IF_ERROR(JoinHashMapHelper::check_and_add_memory_usage(state, &_table_items, chunk_memory_size));
 
+    // The whole build side is in one chunk, so string columns may exceed the limit of 32-bit offsets.
+    _table_items.build_chunk->upgrade_if_overflow();
+
     _table_items.row_count += chunk->num_rows();
     return Status::OK();
 }
@@ -448,6 +525,10 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
             return JoinHashMapType::keydouble;
         case PrimitiveType::TYPE_VARCHAR:
         case PrimitiveType::TYPE_CHAR:
+            // keystring reads the key column as BinaryColumn, the serialized one works with any column.
+            if (_table_items.key_columns[0]->has_large_column()) {
+                return JoinHashMapType::slice;
+            }
             return JoinHashMapType::keystring;
         case PrimitiveType::TYPE_DATE:
             // date will be convert to datetime, so current can't reach here
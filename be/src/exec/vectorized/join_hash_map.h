@@ -9,7 +9,10 @@
 #include "column/chunk.h"
 #include "column/column_hash.h"
 #include "column/column_helper.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_hook.h"
 #include "runtime/mem_tracker.h"
+#include "util/inline_slice.h"
 #include "util/phmap/phmap.h"
 
 namespace starrocks::vectorized {
@@ -84,6 +87,8 @@ struct JoinHashTableItems {
     Buffer<uint32_t> first;
     Buffer<uint32_t> next;
     Buffer<Slice> build_slice;
+    // keys of keystring, see StringJoinBuildFunc.
+    Buffer<InlineSlice> build_inline_keys;
     ColumnPtr build_key_column;
     uint32_t bucket_size = 0;
     uint32_t row_count = 0; // real row count
@@ -115,6 +120,7 @@ struct HashTableProbeState {
     Buffer<uint32_t> probe_index;
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
+    Buffer<InlineSlice> probe_inline_keys;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
@@ -188,6 +194,13 @@ struct JoinKeyHash<Slice> {
     std::size_t operator()(const Slice& slice) const { return crc_hash_32(slice.data, slice.size, CRC_SEED); }
 };
 
+// Same hash value as the Slice of the key, short keys are hashed without touching the column.
+template <>
+struct JoinKeyHash<InlineSlice> {
+    static const uint32_t CRC_SEED = 0x811C9DC5;
+    std::size_t operator()(const InlineSlice& key) const { return crc_hash_32(key.data(), key.size(), CRC_SEED); }
+};
+
 template <typename T>
 struct JoinKeyEqual {
     bool operator()(const T& x, const T& y) const { return x == y; }
@@ -232,8 +245,13 @@ public:
     }
 
     static Status check_and_add_memory_usage(RuntimeState* state, JoinHashTableItems* table_items, size_t size) {
-        table_items->mem_tracker->consume(size);
-        table_items->last_memory_usage += size;
+        if (MemHook::installed()) {
+            // MemHook has charged the memory to the tracker of current thread, make it visible to the check.
+            CurrentThread::mem_tracker_flush();
+        } else {
+            table_items->mem_tracker->consume(size);
+            table_items->last_memory_usage += size;
+        }
         RETURN_IF_ERROR(state->check_query_state("HashJoinNode"));
         return Status::OK();
     }
@@ -304,6 +322,8 @@ private:
 
 class SerializedJoinBuildFunc {
 public:
+    using CppType = Slice;
+
     static Status prepare(RuntimeState* state, JoinHashTableItems* table_items, HashTableProbeState* probe_state);
     static const Buffer<Slice>& get_key_data(const JoinHashTableItems& table_items) { return table_items.build_slice; }
     static Status construct_hash_table(JoinHashTableItems* table_items, HashTableProbeState* probe_state);
@@ -317,6 +337,20 @@ private:
                                         uint32_t count, uint8_t** ptr);
 };
 
+// Build func of one VARCHAR/CHAR key. Keys are converted to InlineSlice, so for the short
+// keys that make up most join keys the bucket chains are walked without loading the
+// strings of the build column.
+class StringJoinBuildFunc {
+public:
+    using CppType = InlineSlice;
+
+    static Status prepare(RuntimeState* state, JoinHashTableItems* table_items, HashTableProbeState* probe_state);
+    static const Buffer<InlineSlice>& get_key_data(const JoinHashTableItems& table_items) {
+        return table_items.build_inline_keys;
+    }
+    static Status construct_hash_table(JoinHashTableItems* table_items, HashTableProbeState* probe_state);
+};
+
 template <PrimitiveType PT>
 class JoinProbeFunc {
 public:
@@ -356,8 +390,25 @@ private:
                                        const Columns& data_columns, const NullColumns& null_columns);
 };
 
+class StringJoinProbeFunc {
+public:
+    using CppType = InlineSlice;
+
+    static void prepare(JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
+        probe_state->probe_inline_keys.resize(probe_state->probe_row_count);
+    }
+
+    static Status lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
+
+    static const Buffer<InlineSlice>& get_key_data(const HashTableProbeState& probe_state) {
+        return probe_state.probe_inline_keys;
+    }
+};
+
 class SerializedJoinProbeFunc {
 public:
+    using CppType = Slice;
+
     static const Buffer<Slice>& get_key_data(const HashTableProbeState& probe_state) { return probe_state.probe_slice; }
 
     static void prepare(JoinHashTableItems* table_items, HashTableProbeState* probe_state) {
@@ -378,7 +429,7 @@ private:
 template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
 class JoinHashMap {
 public:
-    using CppType = typename RunTimeTypeTraits<PT>::CppType;
+    using CppType = typename BuildFunc::CppType;
 
     explicit JoinHashMap(JoinHashTableItems* table_items, HashTableProbeState* probe_state)
             : _table_items(table_items), _probe_state(probe_state) {}
@@ -483,6 +534,7 @@ private:
 
 #define JoinHashMapForOneKey(PT) JoinHashMap<PT, JoinBuildFunc<PT>, JoinProbeFunc<PT>>
 #define JoinHashMapForFixedSizeKey(PT) JoinHashMap<PT, FixedSizeJoinBuildFunc<PT>, FixedSizeJoinProbeFunc<PT>>
+#define JoinHashMapForStringKey(PT) JoinHashMap<PT, StringJoinBuildFunc, StringJoinProbeFunc>
 #define JoinHashMapForSerializedKey(PT) JoinHashMap<PT, SerializedJoinBuildFunc, SerializedJoinProbeFunc>
 
 class JoinHashTable {
@@ -527,7 +579,7 @@ private:
     std::unique_ptr<JoinHashMapForOneKey(TYPE_LARGEINT)> _key128 = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_FLOAT)> _keyfloat = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DOUBLE)> _keydouble = nullptr;
-    std::unique_ptr<JoinHashMapForOneKey(TYPE_VARCHAR)> _keystring = nullptr;
+    std::unique_ptr<JoinHashMapForStringKey(TYPE_VARCHAR)> _keystring = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DATE)> _keydate = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DATETIME)> _keydatetime = nullptr;
     std::unique_ptr<JoinHashMapForOneKey(TYPE_DECIMALV2)> _keydecimal = nullptr;
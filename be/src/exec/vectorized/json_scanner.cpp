@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "column/array_column.h"
+#include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
@@ -222,6 +223,17 @@ ChunkPtr JsonScanner::_cast_chunk(starrocks::vectorized::ChunkPtr src_chunk) {
     return cast_chunk;
 }
 
+// Same as `column->append_strings({str})` without building a temporary vector for every value.
+static inline void append_string(Column* column, const Slice& str) {
+    if (column->is_nullable()) {
+        auto* nullable_column = down_cast<NullableColumn*>(column);
+        down_cast<BinaryColumn*>(nullable_column->mutable_data_column())->append(str);
+        nullable_column->null_column_data().emplace_back(0);
+    } else {
+        down_cast<BinaryColumn*>(column)->append(str);
+    }
+}
+
 JsonReader::JsonReader(starrocks::RuntimeState* state, starrocks::vectorized::ScannerCounter* counter,
                        JsonScanner* scanner, std::shared_ptr<SequentialFile> file)
         : _state(state),
@@ -272,6 +284,16 @@ Status JsonReader::close() {
  *      value2     30
  */
 Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read, const std::vector<SlotDescriptor*>& slot_descs) {
+    if (!_slot_index_inited) {
+        _init_slot_index(slot_descs);
+    }
+    std::vector<Column*> columns(slot_descs.size(), nullptr);
+    for (size_t i = 0; i < slot_descs.size(); i++) {
+        if (slot_descs[i] != nullptr) {
+            columns[i] = chunk->get_column_by_slot_id(slot_descs[i]->id()).get();
+        }
+    }
+
     Status st = Status::OK();
     do {
         if (_next_line >= _total_lines) {
@@ -285,18 +307,7 @@ Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read, const std::vec
                 objectValue = &(*_json_doc)[_next_line];
             }
             if (_scanner->_json_paths.empty()) {
-                for (SlotDescriptor* slot_desc : slot_descs) {
-                    if (slot_desc == nullptr) {
-                        continue;
-                    }
-                    ColumnPtr& column = chunk->get_column_by_slot_id(slot_desc->id());
-                    const char* column_name = slot_desc->col_name().c_str();
-                    if (!objectValue->IsObject() || !objectValue->HasMember(column_name)) {
-                        column->append_nulls(1);
-                    } else {
-                        _construct_column((*objectValue)[column_name], column.get(), slot_desc->type());
-                    }
-                }
+                _construct_row_by_name(objectValue, columns, slot_descs);
             } else {
                 size_t slot_size = slot_descs.size();
                 size_t jsonpath_size = _scanner->_json_paths.size();
@@ -304,7 +315,7 @@ Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read, const std::vec
                     if (slot_descs[i] == nullptr) {
                         continue;
                     }
-                    ColumnPtr& column = chunk->get_column_by_slot_id(slot_descs[i]->id());
+                    Column* column = columns[i];
                     if (i >= jsonpath_size) {
                         column->append_nulls(1);
                         continue;
@@ -314,7 +325,7 @@ Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read, const std::vec
                     if (json_values == nullptr) {
                         column->append_nulls(1);
                     } else {
-                        _construct_column(*json_values, column.get(), slot_descs[i]->type());
+                        _construct_column(*json_values, column, slot_descs[i]->type());
                     }
                 }
             }
@@ -325,16 +336,64 @@ Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read, const std::vec
     return Status::OK();
 }
 
+void JsonReader::_init_slot_index(const std::vector<SlotDescriptor*>& slot_descs) {
+    _slot_index.clear();
+    for (size_t i = 0; i < slot_descs.size(); i++) {
+        if (slot_descs[i] == nullptr) {
+            continue;
+        }
+        // column names of source slots are unique.
+        _slot_index.emplace(std::string_view(slot_descs[i]->col_name()), i);
+    }
+    _slot_filled.resize(slot_descs.size());
+    _slot_index_inited = true;
+}
+
+void JsonReader::_construct_row_by_name(const rapidjson::Value* objectValue, const std::vector<Column*>& columns,
+                                        const std::vector<SlotDescriptor*>& slot_descs) {
+    std::fill(_slot_filled.begin(), _slot_filled.end(), 0);
+    if (objectValue->IsObject()) {
+        size_t num_filled = 0;
+        for (auto it = objectValue->MemberBegin(); it != objectValue->MemberEnd() && num_filled < _slot_index.size();
+             ++it) {
+            auto iter = _slot_index.find(std::string_view(it->name.GetString(), it->name.GetStringLength()));
+            if (iter == _slot_index.end()) {
+                continue;
+            }
+            size_t pos = iter->second;
+            // for duplicated keys, the first one wins.
+            if (_slot_filled[pos]) {
+                continue;
+            }
+            _construct_column(it->value, columns[pos], slot_descs[pos]->type());
+            _slot_filled[pos] = 1;
+            num_filled++;
+        }
+    }
+    for (size_t i = 0; i < slot_descs.size(); i++) {
+        if (slot_descs[i] != nullptr && !_slot_filled[i]) {
+            columns[i]->append_nulls(1);
+        }
+    }
+}
+
+void JsonReader::_parse_json_insitu(size_t length) {
+    DCHECK_LE(length + 1 + kParsePadding, _buf.size());
+    memset(_buf.data() + length, 0, 1 + kParsePadding);
+    SCOPED_RAW_TIMER(&_counter->json_parse_ns);
+    // Parsing in-situ avoids copying every string value into the document allocator.
+    _origin_json_doc.ParseInsitu(_buf.data());
+}
+
 // read one json string from file read and parse it to json doc.
 Status JsonReader::_read_and_parse_json() {
 #ifdef BE_TEST
-    [[maybe_unused]] size_t message_size = 0;
-    Slice result(_buf.data(), _buf_size);
+    Slice result(_buf.data(), _buf.size() - 1 - kParsePadding);
     RETURN_IF_ERROR(_file->read(&result));
     if (result.size == 0) {
         return Status::EndOfFile("EOF of reading file");
     }
-    _origin_json_doc.Parse(result.data, result.size);
+    size_t length = result.size;
 #else
     std::unique_ptr<uint8_t[]> json_binary = nullptr;
     size_t length = 0;
@@ -343,8 +402,13 @@ Status JsonReader::_read_and_parse_json() {
     if (length == 0) {
         return Status::EndOfFile("EOF of reading file");
     }
-    _origin_json_doc.Parse((char*)json_binary.get(), length);
+    if (length + 1 + kParsePadding > _buf.size()) {
+        _buf.resize(length + 1 + kParsePadding);
+    }
+    memcpy(_buf.data(), json_binary.get(), length);
 #endif
+    _parse_json_insitu(length);
+    _counter->json_parse_bytes += length;
 
     if (_origin_json_doc.HasParseError()) {
         std::string err_msg = strings::Substitute("Failed to parse string to json. code=$0, error=$1",
@@ -398,35 +462,34 @@ void JsonReader::_construct_column(const rapidjson::Value& objectValue, Column*
         break;
     }
     case rapidjson::Type::kFalseType: {
-        column->append_strings(std::vector<Slice>{Slice("0")});
+        append_string(column, Slice("0", 1));
         break;
     }
     case rapidjson::Type::kTrueType: {
-        column->append_strings(std::vector<Slice>{Slice("1")});
+        append_string(column, Slice("1", 1));
         break;
     }
     case rapidjson::Type::kNumberType: {
         if (objectValue.IsUint()) {
             auto f = fmt::format_int(objectValue.GetUint());
-            column->append_strings(std::vector<Slice>{Slice(f.data(), f.size())});
+            append_string(column, Slice(f.data(), f.size()));
         } else if (objectValue.IsInt()) {
             auto f = fmt::format_int(objectValue.GetInt());
-            column->append_strings(std::vector<Slice>{Slice(f.data(), f.size())});
+            append_string(column, Slice(f.data(), f.size()));
         } else if (objectValue.IsUint64()) {
             auto f = fmt::format_int(objectValue.GetUint64());
-            column->append_strings(std::vector<Slice>{Slice(f.data(), f.size())});
+            append_string(column, Slice(f.data(), f.size()));
         } else if (objectValue.IsInt64()) {
             auto f = fmt::format_int(objectValue.GetInt64());
-            column->append_strings(std::vector<Slice>{Slice(f.data(), f.size())});
+            append_string(column, Slice(f.data(), f.size()));
         } else {
             int len = d2s_buffered_n(objectValue.GetDouble(), buf);
-            column->append_strings(std::vector<Slice>{Slice(buf, len)});
+            append_string(column, Slice(buf, len));
         }
         break;
     }
     case rapidjson::Type::kStringType: {
-        const char* str_value = objectValue.GetString();
-        column->append_strings(std::vector<Slice>{Slice(str_value, objectValue.GetStringLength())});
+        append_string(column, Slice(objectValue.GetString(), objectValue.GetStringLength()));
         break;
     }
     case rapidjson::Type::kArrayType: {
@@ -445,13 +508,13 @@ void JsonReader::_construct_column(const rapidjson::Value& objectValue, Column*
             offsets->append_numbers(&size, 4);
         } else {
             std::string json_str = JsonFunctions::get_raw_json_string(objectValue);
-            column->append_strings(std::vector<Slice>{Slice(json_str.c_str(), json_str.length())});
+            append_string(column, Slice(json_str.data(), json_str.length()));
         }
         break;
     }
     case rapidjson::Type::kObjectType: {
         std::string json_str = JsonFunctions::get_raw_json_string(objectValue);
-        column->append_strings(std::vector<Slice>{Slice(json_str.c_str(), json_str.length())});
+        append_string(column, Slice(json_str.data(), json_str.length()));
         break;
     }
     }
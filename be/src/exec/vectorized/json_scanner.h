@@ -12,6 +12,9 @@ DIAGNOSTIC_POP
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <string_view>
+#include <unordered_map>
+
 #include "env/env.h"
 #include "env/env_stream_pipe.h"
 #include "env/env_util.h"
@@ -83,8 +86,17 @@ public:
 
 private:
     Status _read_and_parse_json();
+    // Parse the message of `length` bytes at the beginning of _buf in-situ.
+    void _parse_json_insitu(size_t length);
     void _construct_column(const rapidjson::Value& objectValue, Column* column, const TypeDescriptor& type_desc);
 
+    // Build the map from column name to slot position, done once per reader.
+    void _init_slot_index(const std::vector<SlotDescriptor*>& slot_descs);
+    // Fill one row without jsonpaths: walk the members of the object once and dispatch
+    // each member to the slot with the same name, instead of looking up every slot by name.
+    void _construct_row_by_name(const rapidjson::Value* objectValue, const std::vector<Column*>& columns,
+                                const std::vector<SlotDescriptor*>& slot_descs);
+
 private:
     RuntimeState* _state = nullptr;
     ScannerCounter* _counter = nullptr;
@@ -102,6 +114,12 @@ private:
     rapidjson::Document _origin_json_doc;  // origin json document object from parsed json string
     rapidjson::Value* _json_doc = nullptr; // _json_doc equals _final_json_doc iff not set `json_root`
 
+    bool _slot_index_inited = false;
+    // column name -> position in slot_descs, keys point to the names owned by SlotDescriptor.
+    std::unordered_map<std::string_view, size_t> _slot_index;
+    // whether the slot has been filled for the current row.
+    std::vector<uint8_t> _slot_filled;
+
     // only used in unit test.
     // TODO: The semantics of Streaming Load And Routine Load is non-consistent.
     //       Import a json library supporting streaming parse.
@@ -110,6 +128,11 @@ private:
 #else
     size_t _buf_size = 104857600; // 100MB, the max size rapidjson can parse
 #endif
+    // Each message is followed by a null character and kParsePadding bytes in _buf, since with
+    // RAPIDJSON_SSE42 rapidjson skips whitespace by reading whole 16-byte blocks.
+    static constexpr size_t kParsePadding = 16;
+    // The json text is parsed in-situ in this buffer, so string values of _origin_json_doc
+    // point into it and it must not be modified until the next message is parsed.
     raw::RawVector<char> _buf;
 };
 
@@ -19,12 +19,14 @@
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "gutil/casts.h"
 #include "gutil/map_util.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/current_mem_tracker.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "storage/vectorized/chunk_helper.h"
 #include "util/priority_thread_pool.hpp"
+#include "util/time.h"
 
 namespace starrocks::vectorized {
 
@@ -62,6 +64,7 @@ Status OlapScanNode::prepare(RuntimeState* state) {
         _runtime_profile->add_info_string("Predicates", _olap_scan_node.sql_predicates);
     }
     _runtime_state = state;
+    _query_acct = ScanQueryAcctManager::instance()->get_or_register(state->query_id());
     return Status::OK();
 }
 
@@ -149,7 +152,7 @@ Status OlapScanNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
         mem_tracker()->release(ptr->memory_usage());
         *chunk = std::shared_ptr<Chunk>(ptr);
         eval_join_runtime_filters(chunk);
-        _num_rows_returned += (*chunk)->num_rows();
+        _num_rows_returned += (*chunk)->num_selected_rows();
         COUNTER_SET(_rows_returned_counter, _num_rows_returned);
         // reach scan node limit
         if (reached_limit()) {
@@ -183,6 +186,10 @@ Status OlapScanNode::close(RuntimeState* state) {
     }
 
     _close_pending_scanners();
+    _update_conjuncts_order_profile();
+    if (_query_acct != nullptr) {
+        _query_acct->update_profile(_runtime_profile.get());
+    }
 
     // free chunks in _chunk_pool.
     while (!_chunk_pool.empty()) {
@@ -219,16 +226,18 @@ void OlapScanNode::_fill_chunk_pool(int count, bool force_column_pool) {
     }
 }
 
-void OlapScanNode::_scanner_thread(OlapScanner* scanner) {
+void OlapScanNode::_scanner_thread(OlapScanner* scanner, int64_t queue_time_ns) {
     CurrentThread::set_query_id(scanner->runtime_state()->query_id());
     CurrentThread::set_mem_tracker(mem_tracker());
+    COUNTER_UPDATE(_scanner_queue_timer, queue_time_ns);
+    _query_acct->start_task(queue_time_ns);
+    const int64_t start_ns = MonotonicNanos();
 
     Status status = scanner->open(_runtime_state);
     if (!status.ok()) {
         QUERY_LOG_IF(ERROR, !status.is_end_of_file()) << status;
         _update_status(status);
     }
-    scanner->set_keep_priority(false);
     // Because we use thread pool to scan data from storage. One scanner can't
     // use this thread too long, this can starve other query's scanner. So, we
     // need yield this thread when we do enough work. However, OlapStorage read
@@ -243,7 +252,6 @@ void OlapScanNode::_scanner_thread(OlapScanner* scanner) {
             std::lock_guard<std::mutex> l(_mtx);
             if (_chunk_pool.empty()) {
                 // NOTE: DO NOT move these operations out of current lock scope.
-                scanner->set_keep_priority(true);
                 _pending_scanners.push(scanner);
                 scanner = nullptr;
                 break;
@@ -271,6 +279,8 @@ void OlapScanNode::_scanner_thread(OlapScanner* scanner) {
             break;
         }
     }
+    // account the time before resubmitting, so the next task of the query gets the updated priority.
+    _query_acct->finish_task(MonotonicNanos() - start_ns);
     Status global_status = _get_status();
     if (global_status.ok()) {
         if (status.ok() && resubmit) {
@@ -310,12 +320,19 @@ void OlapScanNode::_scanner_thread(OlapScanner* scanner) {
     if (_closed_scanners.load(std::memory_order_acquire) == _num_scanners) {
         _result_chunks.shutdown();
     }
-    _running_threads.fetch_sub(1, std::memory_order_release);
+    // Flush the cached consumption before the node, which owns the tracker, may be destructed.
     CurrentThread::set_query_id(TUniqueId());
     CurrentThread::set_mem_tracker(nullptr);
+    _running_threads.fetch_sub(1, std::memory_order_release);
     // DO NOT touch any shared variables since here, as they may have been destructed.
 }
 
+void OlapScanNode::_normalize_contains_predicates(const TabletSchema& tablet_schema,
+                                                  std::vector<TCondition>* olap_filter) const {
+    details::normalize_contains_predicates(tablet_schema, _tuple_desc->slots(), _conjunct_ctxs, _normalized_conjuncts,
+                                           *olap_filter);
+}
+
 Status OlapScanNode::set_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) {
     for (auto& scan_range : scan_ranges) {
         DCHECK(scan_range.scan_range.__isset.internal_scan_range);
@@ -399,45 +416,56 @@ void OlapScanNode::_init_counter(RuntimeState* state) {
 
     /// IOTime
     _io_timer = ADD_TIMER(_scan_profile, "IOTime");
+
+    /// ScannerQueueTime
+    _scanner_queue_timer = ADD_TIMER(_runtime_profile, "ScannerQueueTime");
+
+    _conjuncts_reorder_counter = ADD_COUNTER(_runtime_profile, "ConjunctsReorderTimes", TUnit::UNIT);
+}
+
+void OlapScanNode::_add_conjuncts_order(const std::vector<size_t>& order) {
+    std::lock_guard<std::mutex> l(_conjuncts_orders_mtx);
+    _conjuncts_orders[order]++;
 }
 
-// The more tasks you submit, the less priority you get.
-int OlapScanNode::_compute_priority(int32_t num_submitted_tasks) {
-    // int nice = 20;
-    // while (nice > 0 && num_submitted_tasks > (22 - nice) * (20 - nice) * 6) {
-    //     --nice;
-    // }
-    // return nice;
-    if (num_submitted_tasks < 5) return 20;
-    if (num_submitted_tasks < 19) return 19;
-    if (num_submitted_tasks < 49) return 18;
-    if (num_submitted_tasks < 91) return 17;
-    if (num_submitted_tasks < 145) return 16;
-    if (num_submitted_tasks < 211) return 15;
-    if (num_submitted_tasks < 289) return 14;
-    if (num_submitted_tasks < 379) return 13;
-    if (num_submitted_tasks < 481) return 12;
-    if (num_submitted_tasks < 595) return 11;
-    if (num_submitted_tasks < 721) return 10;
-    if (num_submitted_tasks < 859) return 9;
-    if (num_submitted_tasks < 1009) return 8;
-    if (num_submitted_tasks < 1171) return 7;
-    if (num_submitted_tasks < 1345) return 6;
-    if (num_submitted_tasks < 1531) return 5;
-    if (num_submitted_tasks < 1729) return 4;
-    if (num_submitted_tasks < 1939) return 3;
-    if (num_submitted_tasks < 2161) return 2;
-    if (num_submitted_tasks < 2395) return 1;
-    return 0;
+// Show the most common final orders of the scanners, e.g. "1,0: 12 scanners; 0,1: 3 scanners".
+void OlapScanNode::_update_conjuncts_order_profile() {
+    constexpr size_t kMaxShownOrders = 4;
+    std::vector<std::pair<int64_t, const std::vector<size_t>*>> orders;
+    std::lock_guard<std::mutex> l(_conjuncts_orders_mtx);
+    if (_conjuncts_orders.empty()) {
+        return;
+    }
+    for (const auto& [order, num_scanners] : _conjuncts_orders) {
+        orders.emplace_back(num_scanners, &order);
+    }
+    std::stable_sort(orders.begin(), orders.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::string orders_str;
+    for (size_t i = 0; i < orders.size() && i < kMaxShownOrders; i++) {
+        if (!orders_str.empty()) {
+            orders_str.append("; ");
+        }
+        for (size_t j = 0; j < orders[i].second->size(); j++) {
+            if (j > 0) {
+                orders_str.append(",");
+            }
+            orders_str.append(std::to_string((*orders[i].second)[j]));
+        }
+        orders_str.append(strings::Substitute(": $0 scanner$1", orders[i].first, orders[i].first > 1 ? "s" : ""));
+    }
+    if (orders.size() > kMaxShownOrders) {
+        orders_str.append(strings::Substitute("; $0 other orders", orders.size() - kMaxShownOrders));
+    }
+    _runtime_profile->add_info_string("ConjunctsOrder", orders_str);
 }
 
 bool OlapScanNode::_submit_scanner(OlapScanner* scanner, bool blockable) {
     PriorityThreadPool* thread_pool = _runtime_state->exec_env()->thread_pool();
-    int delta = !scanner->keep_priority();
-    int32_t num_submit = _scanner_submit_count.fetch_add(delta, std::memory_order_relaxed);
+    const int64_t submit_ns = MonotonicNanos();
     PriorityThreadPool::Task task;
-    task.work_function = [this, scanner] { _scanner_thread(scanner); };
-    task.priority = _compute_priority(num_submit);
+    task.work_function = [this, scanner, submit_ns] { _scanner_thread(scanner, MonotonicNanos() - submit_ns); };
+    // tasks of the queries having taken less scan time go first.
+    task.priority = _query_acct->compute_priority();
     _running_threads.fetch_add(1, std::memory_order_release);
     if (LIKELY(thread_pool->try_offer(task))) {
         return true;
@@ -447,7 +475,6 @@ bool OlapScanNode::_submit_scanner(OlapScanner* scanner, bool blockable) {
     } else {
         LOG(WARNING) << "thread pool busy";
         _running_threads.fetch_sub(1, std::memory_order_release);
-        _scanner_submit_count.fetch_sub(delta, std::memory_order_relaxed);
         return false;
     }
 }
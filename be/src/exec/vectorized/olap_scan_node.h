@@ -3,6 +3,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -11,6 +12,7 @@
 #include "exec/olap_common.h"
 #include "exec/scan_node.h"
 #include "exec/vectorized/olap_scanner.h"
+#include "exec/vectorized/scan_query_acct.h"
 
 namespace starrocks {
 class DescriptorTbl;
@@ -93,7 +95,9 @@ private:
 
     Status _start_scan(RuntimeState* state);
     Status _start_scan_thread(RuntimeState* state);
-    void _scanner_thread(OlapScanner* scanner);
+    // Append the `contains` conditions of the LIKE conjuncts on the indexed columns of |tablet_schema|.
+    void _normalize_contains_predicates(const TabletSchema& tablet_schema, std::vector<TCondition>* olap_filter) const;
+    void _scanner_thread(OlapScanner* scanner, int64_t queue_time_ns);
 
     void _init_counter(RuntimeState* state);
 
@@ -101,9 +105,11 @@ private:
     Status _get_status();
 
     void _fill_chunk_pool(int count, bool force_column_pool);
+    // Called by the scanners on close, thread-safe.
+    void _add_conjuncts_order(const std::vector<size_t>& order);
+    void _update_conjuncts_order_profile();
     bool _submit_scanner(OlapScanner* scanner, bool blockable);
     void _close_pending_scanners();
-    int _compute_priority(int32_t num_submitted_tasks);
 
     // params
     TOlapScanNode _olap_scan_node;
@@ -138,10 +144,14 @@ private:
     UnboundedBlockingQueue<Chunk*> _result_chunks;
 
     // used to compute task priority.
-    std::atomic<int32_t> _scanner_submit_count{0};
+    ScanQueryAcctPtr _query_acct;
     std::atomic<int32_t> _running_threads{0};
     std::atomic<int32_t> _closed_scanners{0};
 
+    // number of scanners by the final order of their conjuncts.
+    std::mutex _conjuncts_orders_mtx;
+    std::map<std::vector<size_t>, int64_t> _conjuncts_orders;
+
     // profile
     RuntimeProfile* _scan_profile = nullptr;
 
@@ -150,6 +160,8 @@ private:
     RuntimeProfile::Counter* _tablet_counter = nullptr;
     RuntimeProfile::Counter* _reader_init_timer = nullptr;
     RuntimeProfile::Counter* _io_timer = nullptr;
+    // time the scanner tasks wait in the thread pool.
+    RuntimeProfile::Counter* _scanner_queue_timer = nullptr;
     RuntimeProfile::Counter* _read_compressed_counter = nullptr;
     RuntimeProfile::Counter* _decompress_timer = nullptr;
     RuntimeProfile::Counter* _read_uncompressed_counter = nullptr;
@@ -173,6 +185,7 @@ private:
     RuntimeProfile::Counter* _bi_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bi_filter_timer = nullptr;
     RuntimeProfile::Counter* _pushdown_predicates_counter = nullptr;
+    RuntimeProfile::Counter* _conjuncts_reorder_counter = nullptr;
 };
 
 } // namespace starrocks::vectorized
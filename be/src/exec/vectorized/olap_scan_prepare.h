@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "column/binary_column.h"
+#include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/type_traits.h"
 #include "common/status.h"
@@ -12,6 +14,7 @@
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "gutil/map_util.h"
+#include "storage/tablet_schema.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -642,6 +645,145 @@ static Status normalize_conjuncts(const std::vector<SlotDescriptor*>& slots, Obj
     return Status::OK();
 }
 
+// Split a LIKE pattern by the wildcards into the literal substrings that every matched value contains.
+static std::vector<std::string> like_pattern_substrings(const Slice& pattern) {
+    std::vector<std::string> substrings;
+    std::string current;
+    for (size_t i = 0; i < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == '\\') {
+            if (++i < pattern.size) {
+                current.push_back(pattern.data[i]);
+            }
+        } else if (c == '%' || c == '_') {
+            if (!current.empty()) {
+                substrings.emplace_back(std::move(current));
+                current.clear();
+            }
+        } else {
+            current.push_back(c);
+        }
+    }
+    if (!current.empty()) {
+        substrings.emplace_back(std::move(current));
+    }
+    return substrings;
+}
+
+static bool is_slot_ref_of(const Expr* expr, const SlotDescriptor& slot) {
+    std::vector<SlotId> slot_ids;
+    return expr->node_type() == TExprNodeType::SLOT_REF && expr->get_slot_ids(&slot_ids) == 1 &&
+           slot_ids[0] == slot.id();
+}
+
+static bool get_const_string(ExprContext* ctx, Expr* expr, std::string* value) {
+    if (!expr->is_constant() || !expr->type().is_string_type()) {
+        return false;
+    }
+    ColumnPtr column = ctx->evaluate(expr, nullptr);
+    if (column == nullptr || column->only_null() || column->is_null(0)) {
+        return false;
+    }
+    *value = down_cast<BinaryColumn*>(ColumnHelper::get_data_column(column.get()))->get_slice(0).to_string();
+    return true;
+}
+
+static bool is_const_zero(ExprContext* ctx, Expr* expr) {
+    PrimitiveType type = expr->type().type;
+    if (!expr->is_constant() || (type != TYPE_INT && type != TYPE_BIGINT)) {
+        return false;
+    }
+    ColumnPtr column = ctx->evaluate(expr, nullptr);
+    if (column == nullptr || column->only_null() || column->is_null(0)) {
+        return false;
+    }
+    Column* data = ColumnHelper::get_data_column(column.get());
+    if (type == TYPE_INT) {
+        return down_cast<Int32Column*>(data)->get_data()[0] == 0;
+    }
+    return down_cast<Int64Column*>(data)->get_data()[0] == 0;
+}
+
+// Get the substrings that the values of |slot| must contain to satisfy the conjunct, which is one of
+// (c LIKE 'pattern'), (instr(c, 'str') > 0) and (locate('str', c) > 0).
+static bool get_contained_substrings(const SlotDescriptor& slot, ExprContext* ctx,
+                                     std::vector<std::string>* substrings) {
+    Expr* root_expr = ctx->root();
+    if (root_expr->node_type() == TExprNodeType::BINARY_PRED && root_expr->op() == TExprOpcode::GT &&
+        is_const_zero(ctx, root_expr->get_child(1))) {
+        Expr* fn_expr = root_expr->get_child(0);
+        if (fn_expr->node_type() != TExprNodeType::FUNCTION_CALL || fn_expr->get_num_children() != 2) {
+            return false;
+        }
+        const std::string& fn_name = fn_expr->fn().name.function_name;
+        int column_child = 0;
+        if (fn_name == "locate") {
+            column_child = 1;
+        } else if (fn_name != "instr") {
+            return false;
+        }
+        std::string str;
+        if (!is_slot_ref_of(fn_expr->get_child(column_child), slot) ||
+            !get_const_string(ctx, fn_expr->get_child(1 - column_child), &str) || str.empty()) {
+            return false;
+        }
+        substrings->emplace_back(std::move(str));
+        return true;
+    }
+    if (root_expr->node_type() == TExprNodeType::FUNCTION_CALL && root_expr->fn().name.function_name == "like" &&
+        root_expr->get_num_children() == 2) {
+        std::string pattern;
+        if (!is_slot_ref_of(root_expr->get_child(0), slot) ||
+            !get_const_string(ctx, root_expr->get_child(1), &pattern)) {
+            return false;
+        }
+        *substrings = like_pattern_substrings(pattern);
+        return !substrings->empty();
+    }
+    return false;
+}
+
+// Build a `contains` condition for each of the LIKE, instr and locate conjuncts on the CHAR/VARCHAR columns
+// of |tablet_schema| that have an n-gram bloom filter or inverted index. It's only used to skip the data pages
+// or rows by the index, so the conjunct itself is neither normalized nor removed. The columns whose predicates
+// can't be pushed down into the storage, i.e. the aggregated value columns, are skipped, otherwise the
+// condition is evaluated once more along with the conjunct.
+static void normalize_contains_predicates(const TabletSchema& tablet_schema, const std::vector<SlotDescriptor*>& slots,
+                                          const std::vector<ExprContext*>& conjunct_ctxs,
+                                          const std::vector<bool>& normalized_conjuncts,
+                                          std::vector<TCondition>& olap_filter) {
+    for (const SlotDescriptor* slot : slots) {
+        if (slot->type().type != TYPE_CHAR && slot->type().type != TYPE_VARCHAR) {
+            continue;
+        }
+        size_t index = tablet_schema.field_index(slot->col_name());
+        if (index >= tablet_schema.num_columns()) {
+            continue;
+        }
+        const TabletColumn& column = tablet_schema.column(index);
+        if (column.ngram_bf_gram_size() == 0 &&
+            column.inverted_index_tokenizer() == segment_v2::UNKNOWN_TOKENIZER) {
+            continue;
+        }
+        if (tablet_schema.keys_type() != KeysType::PRIMARY_KEYS &&
+            column.aggregation() != FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE) {
+            continue;
+        }
+        for (size_t i = 0; i < conjunct_ctxs.size(); i++) {
+            std::vector<std::string> substrings;
+            if (normalized_conjuncts[i] || !get_contained_substrings(*slot, conjunct_ctxs[i], &substrings)) {
+                continue;
+            }
+            TCondition contains;
+            contains.column_name = slot->col_name();
+            contains.condition_op = "contains";
+            contains.condition_values = std::move(substrings);
+            contains.__set_is_index_filter_only(true);
+            olap_filter.push_back(std::move(contains));
+        }
+    }
+}
+
 class ExtendScanKeyVisitor : public boost::static_visitor<Status> {
 public:
     ExtendScanKeyVisitor(OlapScanKeys* scan_keys, int32_t max_scan_key_num)
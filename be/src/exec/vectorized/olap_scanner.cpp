@@ -8,6 +8,7 @@
 #include "column/column_pool.h"
 #include "column/fixed_length_column.h"
 #include "exec/vectorized/olap_scan_node.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/current_mem_tracker.h"
 #include "storage/storage_engine.h"
 #include "storage/vectorized/chunk_helper.h"
@@ -40,6 +41,9 @@ Status OlapScanner::init(RuntimeState* runtime_state, const OlapScannerParams& p
     if (!_conjunct_ctxs.empty() || !_predicates.empty()) {
         _expr_filter_timer = ADD_TIMER(_parent->_runtime_profile, "ExprFilterTime");
     }
+    // Every scanner reorders its conjuncts on its own, its order is merged into the profile of the scan node
+    // by update_counter().
+    _conjuncts_evaluator.init(_conjunct_ctxs, nullptr);
     return Status::OK();
 }
 
@@ -108,10 +112,17 @@ Status OlapScanner::_init_reader_params(const std::vector<OlapScanRange*>* key_r
     _params.chunk_size = config::vector_chunk_size;
 
     PredicateParser parser(_tablet->tablet_schema());
+    std::vector<TCondition> olap_filter = _parent->_olap_filter;
+    _parent->_normalize_contains_predicates(_tablet->tablet_schema(), &olap_filter);
 
     // Condition
-    for (auto& filter : _parent->_olap_filter) {
+    for (auto& filter : olap_filter) {
         ColumnPredicate* p = parser.parse(filter);
+        if (p == nullptr) {
+            return Status::InternalError(
+                    strings::Substitute("failed to parse the $0 condition on column $1", filter.condition_op,
+                                        filter.column_name));
+        }
         p->set_index_filter_only(filter.is_index_filter_only);
         _predicate_free_pool.emplace_back(p);
         if (parser.can_pushdown(p)) {
@@ -215,7 +226,7 @@ Status OlapScanner::get_chunk(RuntimeState* state, Chunk* chunk) {
         if (!_conjunct_ctxs.empty()) {
             int64_t old_mem_usage = chunk->memory_usage();
             SCOPED_TIMER(_expr_filter_timer);
-            ExecNode::eval_conjuncts(_conjunct_ctxs, chunk);
+            _conjuncts_evaluator.evaluate(chunk, _parent->keep_selection());
             CurrentMemTracker::consume((int64_t)chunk->memory_usage() - old_mem_usage);
             DCHECK_CHUNK(chunk);
         }
@@ -277,6 +288,11 @@ void OlapScanner::update_counter() {
 
     COUNTER_SET(_parent->_pushdown_predicates_counter, (int64_t)_params.predicates.size());
 
+    if (_conjunct_ctxs.size() > 1) {
+        COUNTER_UPDATE(_parent->_conjuncts_reorder_counter, _conjuncts_evaluator.num_reorders());
+        _parent->_add_conjuncts_order(_conjuncts_evaluator.order());
+    }
+
     StarRocksMetrics::instance()->query_scan_bytes.increment(_compressed_bytes_read);
     StarRocksMetrics::instance()->query_scan_rows.increment(_raw_rows_read);
 
@@ -7,6 +7,7 @@
 #include "column/chunk.h"
 #include "common/status.h"
 #include "exec/olap_utils.h"
+#include "exec/vectorized/adaptive_conjuncts_evaluator.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "gen_cpp/InternalService_types.h"
@@ -49,9 +50,6 @@ public:
     // REQUIRES: `init(RuntimeState*, const OlapScannerParams&)` has been called.
     const Schema& chunk_schema() const { return _prj_iter->schema(); }
 
-    void set_keep_priority(bool v) { _keep_priority = v; }
-    bool keep_priority() const { return _keep_priority; }
-
 private:
     Status _get_tablet(const TInternalScanRange* scan_range);
     Status _init_reader_params(const std::vector<OlapScanRange*>* key_ranges);
@@ -65,6 +63,7 @@ private:
     using PredicatePtr = std::unique_ptr<ColumnPredicate>;
 
     std::vector<ExprContext*> _conjunct_ctxs;
+    AdaptiveConjunctsEvaluator _conjuncts_evaluator;
     ConjunctivePredicates _predicates;
     std::vector<uint8_t> _selection;
 
@@ -98,7 +97,5 @@ private:
 
     // non-pushed-down predicates filter time.
     RuntimeProfile::Counter* _expr_filter_timer = nullptr;
-
-    bool _keep_priority = false;
 };
 } // namespace starrocks::vectorized
@@ -2,6 +2,7 @@
 
 #include "exec/vectorized/project_node.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "column/chunk.h"
@@ -67,6 +68,18 @@ Status ProjectNode::prepare(RuntimeState* state) {
 
     _expr_compute_timer = ADD_TIMER(runtime_profile(), "ExprComputeTime");
     _common_sub_expr_compute_timer = ADD_TIMER(runtime_profile(), "CommonSubExprComputeTime");
+
+    // The child may leave the filtered rows in its chunks, so only the columns read by the exprs
+    // here are compacted instead of all columns read by the child.
+    for (ExprContext* ctx : _expr_ctxs) {
+        ctx->root()->get_slot_ids(&_input_slot_ids);
+    }
+    for (ExprContext* ctx : _common_sub_expr_ctxs) {
+        ctx->root()->get_slot_ids(&_input_slot_ids);
+    }
+    std::sort(_input_slot_ids.begin(), _input_slot_ids.end());
+    _input_slot_ids.erase(std::unique(_input_slot_ids.begin(), _input_slot_ids.end()), _input_slot_ids.end());
+    _children[0]->set_keep_selection(true);
     return Status::OK();
 }
 
@@ -93,13 +106,32 @@ Status ProjectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     *eos = false;
     do {
         RETURN_IF_ERROR(_children[0]->get_next(state, chunk, eos));
-    } while (!(*eos) && ((*chunk)->num_rows() == 0));
+    } while (!(*eos) && ((*chunk)->num_selected_rows() == 0));
 
     if (*eos) {
         *chunk = nullptr;
         return Status::OK();
     }
 
+    if ((*chunk)->has_selection()) {
+        // Evaluate the exprs on the selected rows only. The columns they don't read are dropped
+        // without being compacted.
+        ChunkPtr input_chunk = std::make_shared<Chunk>();
+        for (SlotId slot_id : _input_slot_ids) {
+            if ((*chunk)->is_slot_exist(slot_id)) {
+                input_chunk->append_column((*chunk)->get_column_by_slot_id(slot_id), slot_id);
+            }
+        }
+        if (input_chunk->num_columns() == 0) {
+            // only constants, which still need the number of rows.
+            (*chunk)->materialize_selection();
+        } else {
+            input_chunk->set_selection((*chunk)->release_selection());
+            input_chunk->materialize_selection();
+            *chunk = std::move(input_chunk);
+        }
+    }
+
     {
         SCOPED_TIMER(_common_sub_expr_compute_timer);
         for (size_t i = 0; i < _common_sub_slot_ids.size(); ++i) {
@@ -143,7 +175,7 @@ Status ProjectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     *chunk = std::move(result_chunk);
     eval_join_runtime_filters(chunk);
 
-    _num_rows_returned += (*chunk)->num_rows();
+    _num_rows_returned += (*chunk)->num_selected_rows();
 
     if (reached_limit()) {
         int64_t num_rows_over = _num_rows_returned - _limit;
@@ -37,6 +37,8 @@ private:
 
     std::vector<SlotId> _common_sub_slot_ids;
     std::vector<ExprContext*> _common_sub_expr_ctxs;
+    // slots of the child read by the exprs.
+    std::vector<SlotId> _input_slot_ids;
 
     RuntimeProfile::Counter* _expr_compute_timer = nullptr;
     RuntimeProfile::Counter* _common_sub_expr_compute_timer = nullptr;
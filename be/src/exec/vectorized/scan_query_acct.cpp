@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/scan_query_acct.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "gutil/bits.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks::vectorized {
+
+int ScanQueryAcct::compute_priority() const {
+    int32_t quota = config::scan_tasks_per_query_quota;
+    if (quota > 0 && running_tasks() >= quota) {
+        return 0;
+    }
+    int64_t slice_ns = std::max<int64_t>(config::scan_query_time_slice_ms, 1) * 1000000;
+    int level = Bits::Log2Floor64(scan_time_ns() / slice_ns + 1);
+    return std::max(kMaxPriority - 2 * level, 0);
+}
+
+void ScanQueryAcct::start_task(int64_t queue_time_ns) {
+    _running_tasks.fetch_add(1, std::memory_order_relaxed);
+    _queue_time_ns.fetch_add(queue_time_ns, std::memory_order_relaxed);
+    StarRocksMetrics::instance()->query_scan_queue_time_ns.increment(queue_time_ns);
+}
+
+void ScanQueryAcct::update_profile(RuntimeProfile* profile) const {
+    // totals of the query on this backend, of the scan nodes of all its fragment instances.
+    COUNTER_SET(ADD_TIMER(profile, "QueryScanTime"), scan_time_ns());
+    COUNTER_SET(ADD_TIMER(profile, "QueryScanQueueTime"), queue_time_ns());
+}
+
+ScanQueryAcctManager::ScanQueryAcctManager() = default;
+
+ScanQueryAcctManager::~ScanQueryAcctManager() = default;
+
+ScanQueryAcctPtr ScanQueryAcctManager::get_or_register(const TUniqueId& query_id) {
+    std::lock_guard lock(_lock);
+    auto it = _accts.find(query_id);
+    if (it != _accts.end()) {
+        if (auto acct = it->second.lock(); acct != nullptr) {
+            return acct;
+        }
+    }
+    ScanQueryAcctPtr acct(new ScanQueryAcct(), [this, query_id](ScanQueryAcct* p) {
+        _unregister(query_id);
+        delete p;
+    });
+    _accts[query_id] = acct;
+    return acct;
+}
+
+void ScanQueryAcctManager::_unregister(const TUniqueId& query_id) {
+    std::lock_guard lock(_lock);
+    auto it = _accts.find(query_id);
+    // the query may have registered a new acct after the last pointer is released.
+    if (it != _accts.end() && it->second.expired()) {
+        _accts.erase(it);
+    }
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,72 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "gen_cpp/Types_types.h" // for TUniqueId
+#include "storage/olap_define.h"
+#include "util/hash_util.hpp"
+#include "util/runtime_profile.h"
+
+namespace starrocks::vectorized {
+
+// ScanQueryAcct keeps statistics of the scan tasks of one query on this backend, shared by the
+// scan nodes of all fragment instances of the query. Like DriverAcct for pipeline drivers, it is
+// used to share the scanner thread pool among queries fairly: the more scan time a query has
+// taken, the lower priority its next tasks get, so a query scanning many tablets can't starve
+// the short queries coming after it.
+class ScanQueryAcct {
+public:
+    static constexpr int kMaxPriority = 20;
+
+    // Priority of the next scan task of this query in PriorityThreadPool, in [0, kMaxPriority].
+    //
+    // The priority is one level lower each time the scan time doubles, counted in slices of
+    // config::scan_query_time_slice_ms. A level is two priorities, the increment a waiting task
+    // gets from the thread pool against starvation. A query already running
+    // config::scan_tasks_per_query_quota tasks gets the lowest priority.
+    int compute_priority() const;
+
+    // Called when a task of this query is taken by a thread after waiting `queue_time_ns`.
+    void start_task(int64_t queue_time_ns);
+
+    // Called when a task of this query yields its thread after running `scan_time_ns`.
+    void finish_task(int64_t scan_time_ns) {
+        _running_tasks.fetch_sub(1, std::memory_order_relaxed);
+        _scan_time_ns.fetch_add(scan_time_ns, std::memory_order_relaxed);
+    }
+
+    int64_t scan_time_ns() const { return _scan_time_ns.load(std::memory_order_relaxed); }
+    int64_t queue_time_ns() const { return _queue_time_ns.load(std::memory_order_relaxed); }
+    int32_t running_tasks() const { return _running_tasks.load(std::memory_order_relaxed); }
+
+    // Show the scan and queue time of the query so far in `profile` of a scan node.
+    void update_profile(RuntimeProfile* profile) const;
+
+private:
+    std::atomic<int64_t> _scan_time_ns{0};
+    std::atomic<int64_t> _queue_time_ns{0};
+    std::atomic<int32_t> _running_tasks{0};
+};
+
+using ScanQueryAcctPtr = std::shared_ptr<ScanQueryAcct>;
+
+class ScanQueryAcctManager {
+    DECLARE_SINGLETON(ScanQueryAcctManager);
+
+public:
+    // Return the acct of `query_id`, which is removed once all the returned pointers are released.
+    ScanQueryAcctPtr get_or_register(const TUniqueId& query_id);
+
+private:
+    void _unregister(const TUniqueId& query_id);
+
+    std::mutex _lock;
+    std::unordered_map<TUniqueId, std::weak_ptr<ScanQueryAcct>> _accts;
+};
+
+} // namespace starrocks::vectorized
@@ -25,6 +25,8 @@
 
 #include <sstream>
 
+#include "column/column_helper.h"
+#include "common/config.h"
 #include "exprs/anyval_util.h"
 #include "exprs/expr.h"
 #include "exprs/slot_ref.h"
@@ -439,4 +441,29 @@ ColumnPtr ExprContext::evaluate(Expr* e, vectorized::Chunk* chunk) {
     return ptr;
 }
 
+StatusOr<ColumnPtr> ExprContext::evaluate_with_large_columns(vectorized::Chunk* chunk) {
+    if (_root->is_slotref() || !chunk->has_large_column()) {
+        return evaluate(chunk);
+    }
+    ColumnPtr result;
+    const size_t num_rows = chunk->num_rows();
+    for (size_t from = 0; from < num_rows; from += config::vector_chunk_size) {
+        size_t count = std::min<size_t>(config::vector_chunk_size, num_rows - from);
+        auto slice = chunk->clone_empty(count);
+        slice->append(*chunk, from, count);
+        RETURN_IF_ERROR(slice->downgrade());
+
+        ColumnPtr column = vectorized::ColumnHelper::unpack_and_duplicate_const_column(count, evaluate(slice.get()));
+        if (result == nullptr) {
+            result = column->clone_empty();
+        }
+        result->append(*column, 0, count);
+        ColumnPtr upgraded = result->upgrade_if_overflow();
+        if (upgraded != nullptr) {
+            result = std::move(upgraded);
+        }
+    }
+    return result;
+}
+
 } // namespace starrocks
@@ -27,6 +27,7 @@
 #include "column/chunk.h"
 #include "column/column.h"
 #include "common/status.h"
+#include "common/statusor.h"
 #include "exprs/expr_value.h"
 #include "udf/udf.h"
 #include "udf/udf_internal.h" // for ArrayVal
@@ -182,6 +183,11 @@ public:
 
     ColumnPtr evaluate(Expr* expr, vectorized::Chunk* chunk);
 
+    // Evaluate on a chunk which may have columns using 64-bit offsets (see LargeBinaryColumn).
+    // Expressions only handle 32-bit offsets, so such a chunk is evaluated by slices unless
+    // the expression is a slot ref.
+    StatusOr<ColumnPtr> evaluate_with_large_columns(vectorized::Chunk* chunk);
+
 private:
     friend class Expr;
     friend class ScalarFnCall;
@@ -2,11 +2,16 @@
 
 #include "exprs/vectorized/case_expr.h"
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
 #include "column/column_builder.h"
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
 #include "common/object_pool.h"
 #include "exprs/vectorized/function_helper.h"
+#include "exprs/vectorized/short_circuit_helper.h"
 
 namespace starrocks::vectorized {
 
@@ -48,6 +53,10 @@ public:
     }
 
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* chunk) override {
+        if (ShortCircuitHelper::enabled(chunk)) {
+            return _has_case_expr ? evaluate_case_selectively(context, chunk)
+                                  : evaluate_no_case_selectively(context, chunk);
+        }
         if (_has_case_expr) {
             return evaluate_case(context, chunk);
         } else {
@@ -56,6 +65,160 @@ public:
     }
 
 private:
+    static constexpr uint32_t kNoBranch = UINT32_MAX;
+
+    // Same semantics as evaluate_case and evaluate_no_case, but every WHEN/THEN pair and ELSE
+    // is only evaluated on the rows not matched by the previous branches, see ShortCircuitHelper.
+    // The result of row `row` is value `offset[row]` of `branch_columns[branch[row]]`.
+    ColumnPtr evaluate_case_selectively(ExprContext* context, vectorized::Chunk* chunk) {
+        const size_t num_rows = chunk->num_rows();
+        ColumnPtr case_column = _children[0]->evaluate(context, chunk);
+        ColumnViewer<WhenType> case_viewer(case_column);
+
+        // rows with null `CASE` never match and go to `ELSE` directly.
+        std::vector<uint32_t> remaining;
+        std::vector<uint32_t> null_rows;
+        remaining.reserve(num_rows);
+        for (uint32_t row = 0; row < num_rows; ++row) {
+            if (case_viewer.is_null(row)) {
+                null_rows.push_back(row);
+            } else {
+                remaining.push_back(row);
+            }
+        }
+
+        Columns branch_columns;
+        std::vector<uint32_t> branch(num_rows, kNoBranch);
+        std::vector<uint32_t> offset(num_rows);
+        std::vector<uint32_t> unmatched;
+        int loop_end = _children.size() - 1;
+        for (int i = 1; i < loop_end && !remaining.empty(); i += 2) {
+            ChunkUniquePtr holder;
+            Chunk* input = ShortCircuitHelper::select_rows(chunk, remaining, &holder);
+            const bool compacted = input != chunk;
+
+            ColumnPtr when_column = _children[i]->evaluate(context, input);
+            // skip if all null
+            if (ColumnHelper::count_nulls(when_column) == when_column->size()) {
+                continue;
+            }
+            ColumnPtr then_column = _children[i + 1]->evaluate(context, input);
+
+            const auto id = static_cast<uint32_t>(branch_columns.size());
+            branch_columns.emplace_back(then_column);
+            ColumnViewer<WhenType> when_viewer(when_column);
+            unmatched.clear();
+            for (uint32_t k = 0; k < remaining.size(); ++k) {
+                uint32_t row = remaining[k];
+                uint32_t idx = compacted ? k : row;
+                if (!when_viewer.is_null(idx) && when_viewer.value(idx) == case_viewer.value(row)) {
+                    branch[row] = id;
+                    offset[row] = idx;
+                } else {
+                    unmatched.push_back(row);
+                }
+            }
+            remaining.swap(unmatched);
+        }
+
+        if (!null_rows.empty()) {
+            unmatched.clear();
+            std::merge(remaining.begin(), remaining.end(), null_rows.begin(), null_rows.end(),
+                       std::back_inserter(unmatched));
+            remaining.swap(unmatched);
+        }
+        return _evaluate_else_and_build(context, chunk, remaining, &branch_columns, &branch, &offset);
+    }
+
+    ColumnPtr evaluate_no_case_selectively(ExprContext* context, vectorized::Chunk* chunk) {
+        const size_t num_rows = chunk->num_rows();
+        std::vector<uint32_t> remaining(num_rows);
+        std::iota(remaining.begin(), remaining.end(), 0);
+
+        Columns branch_columns;
+        std::vector<uint32_t> branch(num_rows, kNoBranch);
+        std::vector<uint32_t> offset(num_rows);
+        std::vector<uint32_t> unmatched;
+        int loop_end = _children.size() - 1;
+        for (int i = 0; i < loop_end && !remaining.empty(); i += 2) {
+            ChunkUniquePtr holder;
+            Chunk* input = ShortCircuitHelper::select_rows(chunk, remaining, &holder);
+            const bool compacted = input != chunk;
+
+            ColumnPtr when_column = _children[i]->evaluate(context, input);
+            size_t trues_count = ColumnHelper::count_true_with_notnull(when_column);
+            // skip if all false or all null
+            if (trues_count == 0) {
+                continue;
+            }
+            ColumnPtr then_column = _children[i + 1]->evaluate(context, input);
+            // direct return if first when is all true
+            if (branch_columns.empty() && trues_count == when_column->size()) {
+                return then_column->clone();
+            }
+
+            const auto id = static_cast<uint32_t>(branch_columns.size());
+            branch_columns.emplace_back(then_column);
+            ColumnViewer<TYPE_BOOLEAN> when_viewer(when_column);
+            unmatched.clear();
+            for (uint32_t k = 0; k < remaining.size(); ++k) {
+                uint32_t row = remaining[k];
+                uint32_t idx = compacted ? k : row;
+                if (!when_viewer.is_null(idx) && when_viewer.value(idx)) {
+                    branch[row] = id;
+                    offset[row] = idx;
+                } else {
+                    unmatched.push_back(row);
+                }
+            }
+            remaining.swap(unmatched);
+        }
+        return _evaluate_else_and_build(context, chunk, remaining, &branch_columns, &branch, &offset);
+    }
+
+    // Evaluate `ELSE` on the `remaining` rows matched by no branch, and gather the result.
+    ColumnPtr _evaluate_else_and_build(ExprContext* context, vectorized::Chunk* chunk,
+                                       const std::vector<uint32_t>& remaining, Columns* branch_columns,
+                                       std::vector<uint32_t>* branch, std::vector<uint32_t>* offset) {
+        const size_t num_rows = chunk->num_rows();
+        if (branch_columns->empty()) {
+            if (!_has_else_expr) {
+                return ColumnHelper::create_const_null_column(num_rows);
+            }
+            return _children.back()->evaluate(context, chunk)->clone();
+        }
+
+        if (_has_else_expr && !remaining.empty()) {
+            ChunkUniquePtr holder;
+            Chunk* input = ShortCircuitHelper::select_rows(chunk, remaining, &holder);
+            const bool compacted = input != chunk;
+            const auto id = static_cast<uint32_t>(branch_columns->size());
+            branch_columns->emplace_back(_children.back()->evaluate(context, input));
+            for (uint32_t k = 0; k < remaining.size(); ++k) {
+                uint32_t row = remaining[k];
+                (*branch)[row] = id;
+                (*offset)[row] = compacted ? k : row;
+            }
+        }
+
+        std::vector<ColumnViewer<ResultType>> viewers;
+        viewers.reserve(branch_columns->size());
+        for (auto& column : *branch_columns) {
+            viewers.emplace_back(column);
+        }
+        ColumnBuilder<ResultType> builder(this->type().precision, this->type().scale);
+        builder.reserve(num_rows);
+        for (size_t row = 0; row < num_rows; ++row) {
+            uint32_t id = (*branch)[row];
+            if (id == kNoBranch || viewers[id].is_null((*offset)[row])) {
+                builder.append_null();
+            } else {
+                builder.append(viewers[id].value((*offset)[row]));
+            }
+        }
+        return builder.build(false);
+    }
+
     // CASE 1:
     //   CASE sex
     //       WHEN '1' THEN 'man'
@@ -2,9 +2,12 @@
 
 #include "exprs/vectorized/compound_predicate.h"
 
+#include "column/column_builder.h"
+#include "column/column_viewer.h"
 #include "common/object_pool.h"
 #include "exprs/predicate.h"
 #include "exprs/vectorized/binary_function.h"
+#include "exprs/vectorized/short_circuit_helper.h"
 #include "exprs/vectorized/unary_function.h"
 
 namespace starrocks {
@@ -15,6 +18,55 @@ namespace vectorized {
     virtual ~CLASS() {}                               \
     virtual Expr* clone(ObjectPool* pool) const override { return pool->add(new CLASS(*this)); }
 
+// Evaluate the right operand of AND (IsAnd = true) or OR only on the rows not decided by the
+// left operand `l`, i.e. true or null rows for AND and false or null rows for OR.
+// Return nullptr if these rows are too dense, the caller should evaluate the whole chunk.
+template <bool IsAnd>
+static ColumnPtr evaluate_short_circuit(Expr* right, ExprContext* context, Chunk* chunk, const ColumnPtr& l) {
+    if (!ShortCircuitHelper::enabled(chunk) || l->is_constant() || l->size() != chunk->num_rows()) {
+        return nullptr;
+    }
+    const size_t size = l->size();
+    ColumnViewer<TYPE_BOOLEAN> l_viewer(l);
+    std::vector<uint32_t> selection;
+    selection.reserve(size);
+    for (uint32_t row = 0; row < size; ++row) {
+        if (l_viewer.is_null(row) || l_viewer.value(row) == IsAnd) {
+            selection.push_back(row);
+        }
+    }
+
+    ChunkUniquePtr holder;
+    Chunk* selected = ShortCircuitHelper::select_rows(chunk, selection, &holder);
+    if (selected == chunk) {
+        return nullptr;
+    }
+    ColumnPtr r = right->evaluate(context, selected);
+    ColumnViewer<TYPE_BOOLEAN> r_viewer(r);
+
+    ColumnBuilder<TYPE_BOOLEAN> builder;
+    builder.reserve(size);
+    size_t k = 0;
+    for (uint32_t row = 0; row < size; ++row) {
+        if (k == selection.size() || selection[k] != row) {
+            // decided by the left operand.
+            builder.append(!IsAnd);
+            continue;
+        }
+        bool l_null = l_viewer.is_null(row);
+        bool r_null = r_viewer.is_null(k);
+        if (!r_null && r_viewer.value(k) != IsAnd) {
+            builder.append(!IsAnd);
+        } else if (l_null || r_null) {
+            builder.append_null();
+        } else {
+            builder.append(IsAnd);
+        }
+        ++k;
+    }
+    return builder.build(false);
+}
+
 /**
  * IS NULL AND IS NULL = IS NULL
  * IS NOT NULL AND IS NOT NULL = IS NOT NULL
@@ -41,6 +93,10 @@ public:
             return l->clone();
         }
 
+        if (auto result = evaluate_short_circuit<true>(_children[1], context, ptr, l); result != nullptr) {
+            return result;
+        }
+
         auto r = _children[1]->evaluate(context, ptr);
 
         return VectorizedLogicPredicateBinaryFunction<AndNullImpl, AndImpl>::template evaluate<TYPE_BOOLEAN>(l, r);
@@ -73,6 +129,10 @@ public:
             return l->clone();
         }
 
+        if (auto result = evaluate_short_circuit<false>(_children[1], context, ptr, l); result != nullptr) {
+            return result;
+        }
+
         auto r = _children[1]->evaluate(context, ptr);
 
         return VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<TYPE_BOOLEAN>(l, r);
@@ -0,0 +1,41 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/vectorized_fwd.h"
+#include "common/config.h"
+
+namespace starrocks::vectorized {
+
+// Short-circuit evaluation of AND, OR and CASE.
+//
+// The right operand of AND/OR and the later branches of CASE are only needed on the rows
+// not decided yet. The row numbers of these rows are kept in a selection vector, and when
+// they are sparse enough, the children are evaluated on a smaller chunk holding only the
+// selected rows, so that expensive expressions skip the decided rows. The i-th value of
+// a result evaluated that way belongs to row selection[i] of the original chunk.
+class ShortCircuitHelper {
+public:
+    // Whether short-circuit evaluation may be used on `chunk`.
+    static bool enabled(const Chunk* chunk) {
+        return chunk != nullptr && chunk->num_rows() > 0 && config::expr_short_circuit_density_threshold > 0;
+    }
+
+    // Return a chunk holding the rows of `chunk` in `selection` and keep it in `holder`,
+    // or `chunk` itself if the selected rows are too dense to be worth copying.
+    static Chunk* select_rows(Chunk* chunk, const std::vector<uint32_t>& selection, ChunkUniquePtr* holder) {
+        if (selection.empty() ||
+            selection.size() >= chunk->num_rows() * config::expr_short_circuit_density_threshold) {
+            return chunk;
+        }
+        *holder = chunk->clone_empty(selection.size());
+        (*holder)->append_selective(*chunk, selection.data(), 0, selection.size());
+        return holder->get();
+    }
+};
+
+} // namespace starrocks::vectorized
@@ -31,6 +31,7 @@
 #include "http/http_request.h"
 #include "http/http_response.h"
 #include "http/http_status.h"
+#include "storage/compaction_scheduler.h"
 #include "storage/olap_define.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
@@ -68,6 +69,22 @@ Status CompactionAction::_handle_show_compaction(HttpRequest* req, std::string*
     return Status::OK();
 }
 
+Status CompactionAction::_handle_update_scheduler(HttpRequest* req) {
+    CompactionScheduler* scheduler = StorageEngine::instance()->compaction_scheduler();
+    if (scheduler == nullptr) {
+        return Status::NotFound("Compaction scheduler is not started");
+    }
+    const std::string& action = req->param("action");
+    if (action == "pause") {
+        scheduler->pause();
+    } else if (action == "resume") {
+        scheduler->resume();
+    } else {
+        return Status::InvalidArgument(strings::Substitute("Unknown action: $0", action));
+    }
+    return Status::OK();
+}
+
 void CompactionAction::handle(HttpRequest* req) {
     req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
 
@@ -79,6 +96,18 @@ void CompactionAction::handle(HttpRequest* req) {
         } else {
             HttpChannel::send_reply(req, HttpStatus::OK, json_result);
         }
+    } else if (_type == CompactionActionType::SHOW_SCHEDULER) {
+        CompactionScheduler* scheduler = StorageEngine::instance()->compaction_scheduler();
+        if (scheduler == nullptr) {
+            HttpChannel::send_reply(req, HttpStatus::OK,
+                                    to_json(Status::NotFound("Compaction scheduler is not started")));
+        } else {
+            std::string json_result;
+            scheduler->get_status(&json_result);
+            HttpChannel::send_reply(req, HttpStatus::OK, json_result);
+        }
+    } else if (_type == CompactionActionType::UPDATE_SCHEDULER) {
+        HttpChannel::send_reply(req, HttpStatus::OK, to_json(_handle_update_scheduler(req)));
     } else {
         HttpChannel::send_reply(req, HttpStatus::OK, to_json(Status::NotSupported("Action not supported")));
     }
@@ -4,12 +4,18 @@
 
 #include "common/logging.h"
 #include "runtime/current_thread.h"
+#include "runtime/mem_hook.h"
 #include "runtime/mem_tracker.h"
 
 namespace starrocks {
+// Explicit accounting to the memory tracker of current thread. It is a no-op if MemHook is
+// installed, which already charges the same allocations to that tracker.
 class CurrentMemTracker {
 public:
     inline static void consume(int64_t size) {
+        if (MemHook::installed()) {
+            return;
+        }
         MemTracker* tracker = CurrentThread::mem_tracker();
         if (tracker != nullptr && size != 0) {
             tracker->consume(size);
@@ -17,6 +23,9 @@ public:
     }
 
     inline static void release(int64_t size) {
+        if (MemHook::installed()) {
+            return;
+        }
         MemTracker* tracker = CurrentThread::mem_tracker();
         if (tracker != nullptr && size != 0) {
             tracker->release(size);
@@ -5,10 +5,10 @@
 #include <string>
 
 #include "gen_cpp/Types_types.h"
+#include "runtime/mem_tracker.h"
 #include "util/uid_util.h"
 
 namespace starrocks {
-class MemTracker;
 class TUniqueId;
 } // namespace starrocks
 
@@ -25,9 +25,20 @@ public:
     // Return current memory tracker in this thread.
     static starrocks::MemTracker* mem_tracker();
 
+    // Charge `size` bytes to the current memory tracker. Consumption is cached in the thread
+    // and only applied to the tracker hierarchy once it reaches kMemTrackerBatchSize, so the
+    // atomics of all ancestors are not touched on every allocation.
+    static void mem_consume(int64_t size);
+    static void mem_release(int64_t size) { mem_consume(-size); }
+    // Apply the cached consumption to the current memory tracker.
+    static void mem_tracker_flush();
+
+    static constexpr int64_t kMemTrackerBatchSize = 1024 * 1024;
+
 private:
     // `__thread` is faster than `thread_local`.
     static inline __thread starrocks::MemTracker* s_tls_mem_tracker{nullptr}; // NOLINT
+    static inline __thread int64_t s_tls_cached_consumption{0};               // NOLINT
     static inline thread_local starrocks::TUniqueId s_tls_query_id{};         // NOLINT
     static inline thread_local std::string s_tls_str_query_id{};              // NOLINT
 };
@@ -46,6 +57,8 @@ inline const std::string& CurrentThread::query_id_string() {
 }
 
 inline starrocks::MemTracker* CurrentThread::set_mem_tracker(starrocks::MemTracker* tracker) {
+    // The cached consumption belongs to the old tracker.
+    mem_tracker_flush();
     auto* r = s_tls_mem_tracker;
     s_tls_mem_tracker = tracker;
     return r;
@@ -55,4 +68,35 @@ inline starrocks::MemTracker* CurrentThread::mem_tracker() {
     return s_tls_mem_tracker;
 }
 
+inline void CurrentThread::mem_consume(int64_t size) {
+    if (s_tls_mem_tracker == nullptr) {
+        return;
+    }
+    s_tls_cached_consumption += size;
+    if (s_tls_cached_consumption >= kMemTrackerBatchSize || s_tls_cached_consumption <= -kMemTrackerBatchSize) {
+        mem_tracker_flush();
+    }
+}
+
+inline void CurrentThread::mem_tracker_flush() {
+    if (s_tls_mem_tracker != nullptr && s_tls_cached_consumption != 0) {
+        s_tls_mem_tracker->consume(s_tls_cached_consumption);
+    }
+    s_tls_cached_consumption = 0;
+}
+
+// Set the memory tracker of current thread in a scope, and restore the old one when leaving it.
+class ScopedThreadMemTracker {
+public:
+    explicit ScopedThreadMemTracker(starrocks::MemTracker* tracker)
+            : _old_tracker(CurrentThread::set_mem_tracker(tracker)) {}
+    ~ScopedThreadMemTracker() { CurrentThread::set_mem_tracker(_old_tracker); }
+
+    ScopedThreadMemTracker(const ScopedThreadMemTracker&) = delete;
+    ScopedThreadMemTracker& operator=(const ScopedThreadMemTracker&) = delete;
+
+private:
+    starrocks::MemTracker* _old_tracker;
+};
+
 } // namespace starrocks
@@ -25,6 +25,9 @@
 
 #include "common/config.h"
 #include "common/logging.h"
+#include "env/block_cache.h"
+#include "exec/pipeline/query_cache.h"
+#include "exec/pipeline/resource_group.h"
 #include "gen_cpp/BackendService.h"
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/HeartbeatService_types.h"
@@ -99,18 +102,6 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _etl_thread_pool = new PriorityThreadPool(config::etl_thread_pool_size, config::etl_thread_pool_queue_size);
     _fragment_mgr = new FragmentMgr(this);
 
-    std::unique_ptr<ThreadPool> driver_dispatcher_thread_pool;
-    // auto thread_num_max = std::thread::hardware_concurrency();
-    auto max_thread_num = 3;
-    RETURN_IF_ERROR(ThreadPoolBuilder("driver_dispatcher_thread_pool")
-                            .set_min_threads(0)
-                            .set_max_threads(max_thread_num)
-                            .set_max_queue_size(1000)
-                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
-                            .build(&driver_dispatcher_thread_pool));
-    _driver_dispatcher = new pipeline::GlobalDriverDispatcher(std::move(driver_dispatcher_thread_pool));
-    _driver_dispatcher->initialize(max_thread_num);
-
     _master_info = new TMasterInfo();
     _load_path_mgr = new LoadPathMgr(this);
     _disk_io_mgr = new DiskIoMgr();
@@ -138,6 +129,21 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _small_file_mgr->init();
     _init_mem_tracker();
 
+    // the mem trackers of the resource groups are children of the query pool, and the driver
+    // queue of the dispatcher is built from the resource groups.
+    RETURN_IF_ERROR(pipeline::ResourceGroupManager::instance()->init(_query_pool_mem_tracker));
+    std::unique_ptr<ThreadPool> driver_dispatcher_thread_pool;
+    // auto thread_num_max = std::thread::hardware_concurrency();
+    auto max_thread_num = 3;
+    RETURN_IF_ERROR(ThreadPoolBuilder("driver_dispatcher_thread_pool")
+                            .set_min_threads(0)
+                            .set_max_threads(max_thread_num)
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&driver_dispatcher_thread_pool));
+    _driver_dispatcher = new pipeline::GlobalDriverDispatcher(std::move(driver_dispatcher_thread_pool));
+    _driver_dispatcher->initialize(max_thread_num);
+
     RETURN_IF_ERROR(_load_channel_mgr->init(_load_mem_tracker));
     _heartbeat_flags = new HeartbeatFlags();
     return Status::OK();
@@ -183,6 +189,7 @@ Status ExecEnv::init_mem_tracker() {
     _central_column_pool_mem_tracker = new MemTracker(-1, "central_column_pool", _column_pool_mem_tracker);
     _local_column_pool_mem_tracker = new MemTracker(-1, "local_column_pool", _column_pool_mem_tracker);
     _page_cache_mem_tracker = new MemTracker(-1, "page_cache", _mem_tracker);
+    _query_cache_mem_tracker = new MemTracker(-1, "query_cache", _mem_tracker);
     _update_mem_tracker = new MemTracker(bytes_limit * 0.6, "update", _mem_tracker);
 
     return Status::OK();
@@ -226,6 +233,14 @@ Status ExecEnv::_init_mem_tracker() {
                      << config::storage_page_cache_limit << ", memory=" << MemInfo::physical_mem();
     }
     StoragePageCache::create_global_cache(_page_cache_mem_tracker, storage_cache_limit);
+    pipeline::QueryCache::create_global_cache(_query_cache_mem_tracker,
+                                              std::max<int64_t>(config::query_cache_capacity, 0));
+
+    Status st = BlockCache::create_global_cache(config::block_cache_disk_path, config::block_cache_disk_size,
+                                                config::block_cache_block_size);
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to create block cache, block cache is disabled: " << st.to_string();
+    }
 
     // TODO(zc): The current memory usage configuration is a bit confusing,
     // we need to sort out the use of memory
@@ -240,6 +255,8 @@ void ExecEnv::_init_buffer_pool(int64_t min_page_size, int64_t capacity, int64_t
 }
 
 void ExecEnv::_destory() {
+    BlockCache::release_global_cache();
+    pipeline::QueryCache::release_global_cache();
     delete _runtime_filter_worker;
     delete _brpc_stub_cache;
     delete _load_stream_mgr;
@@ -257,6 +274,7 @@ void ExecEnv::_destory() {
     delete _thread_mgr;
     delete _update_mem_tracker;
     delete _page_cache_mem_tracker;
+    delete _query_cache_mem_tracker;
     delete _local_column_pool_mem_tracker;
     delete _central_column_pool_mem_tracker;
     delete _column_pool_mem_tracker;
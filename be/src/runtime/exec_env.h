@@ -123,6 +123,7 @@ public:
     MemTracker* local_column_pool_mem_tracker() { return _local_column_pool_mem_tracker; }
     MemTracker* central_column_pool_mem_tracker() { return _central_column_pool_mem_tracker; }
     MemTracker* page_cache_mem_tracker() { return _page_cache_mem_tracker; }
+    MemTracker* query_cache_mem_tracker() { return _query_cache_mem_tracker; }
     MemTracker* update_mem_tracker() { return _update_mem_tracker; }
 
     ThreadResourceMgr* thread_mgr() { return _thread_mgr; }
@@ -208,6 +209,7 @@ private:
 
     // The memory used for page cache
     MemTracker* _page_cache_mem_tracker = nullptr;
+    MemTracker* _query_cache_mem_tracker = nullptr;
 
     // The memory tracker for update manager
     MemTracker* _update_mem_tracker = nullptr;
@@ -0,0 +1,74 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/mem_hook.h"
+
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+#include <gperftools/malloc_hook.h>
+#include <gperftools/tcmalloc.h>
+#endif
+
+#include "runtime/current_thread.h"
+
+namespace starrocks {
+
+bool MemHook::_s_installed = false;
+
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+
+// Set while the hook charges a tracker, in case the tracker allocates.
+static __thread bool s_tls_in_hook = false; // NOLINT
+
+static void new_hook(const void* ptr, size_t size) {
+    if (ptr == nullptr || s_tls_in_hook || CurrentThread::mem_tracker() == nullptr) {
+        return;
+    }
+    s_tls_in_hook = true;
+    // Charge the real size of the allocation, which is what delete_hook will release.
+    CurrentThread::mem_consume(static_cast<int64_t>(tc_nallocx(size, 0)));
+    s_tls_in_hook = false;
+}
+
+static void delete_hook(const void* ptr) {
+    if (ptr == nullptr || s_tls_in_hook || CurrentThread::mem_tracker() == nullptr) {
+        return;
+    }
+    s_tls_in_hook = true;
+    CurrentThread::mem_release(static_cast<int64_t>(tc_malloc_size(const_cast<void*>(ptr))));
+    s_tls_in_hook = false;
+}
+
+bool MemHook::install() {
+    if (_s_installed) {
+        return true;
+    }
+    if (!MallocHook::AddNewHook(&new_hook)) {
+        return false;
+    }
+    if (!MallocHook::AddDeleteHook(&delete_hook)) {
+        MallocHook::RemoveNewHook(&new_hook);
+        return false;
+    }
+    _s_installed = true;
+    return true;
+}
+
+void MemHook::uninstall() {
+    if (!_s_installed) {
+        return;
+    }
+    MallocHook::RemoveNewHook(&new_hook);
+    MallocHook::RemoveDeleteHook(&delete_hook);
+    _s_installed = false;
+}
+
+#else
+
+bool MemHook::install() {
+    return false;
+}
+
+void MemHook::uninstall() {}
+
+#endif
+
+} // namespace starrocks
@@ -0,0 +1,30 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+namespace starrocks {
+
+// MemHook charges every allocation made through tcmalloc to the memory tracker of the
+// allocating thread (CurrentThread::mem_tracker()), so memory allocated by third-party
+// code is accounted as well. Consumption is batched per thread by CurrentThread.
+//
+// Memory freed by another thread is released from that thread's tracker, so a tracker
+// only reflects the net allocation of the threads it was set on.
+//
+// The hooks never fail an allocation. Limits are still enforced where operators check them,
+// e.g. with RuntimeState::check_query_state(), after flushing the consumption cached in the
+// thread. Those operators skip their own explicit accounting while the hooks are installed.
+class MemHook {
+public:
+    // Install the tcmalloc new/delete hooks. Must be called once at startup.
+    // Return false if hooks are not supported, e.g. built with sanitizers.
+    static bool install();
+    static void uninstall();
+
+    static bool installed() { return _s_installed; }
+
+private:
+    static bool _s_installed;
+};
+
+} // namespace starrocks
@@ -227,6 +227,7 @@ Status PlanFragmentExecutor::prepare(const TExecPlanFragmentParams& request) {
 Status PlanFragmentExecutor::open() {
     LOG(INFO) << "Open(): fragment_instance_id=" << print_id(_runtime_state->fragment_instance_id());
     CurrentThread::set_query_id(_runtime_state->query_id());
+    ScopedThreadMemTracker mem_tracker_guard(_runtime_state->instance_mem_tracker());
 
     Status status = Status::OK();
 
@@ -108,11 +108,15 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/api/snapshot", snapshot_action);
 #endif
 
-    // 2 compaction actions
+    // 4 compaction actions
     CompactionAction* show_compaction_action = new CompactionAction(CompactionActionType::SHOW_INFO);
     _ev_http_server->register_handler(HttpMethod::GET, "/api/compaction/show", show_compaction_action);
     CompactionAction* run_compaction_action = new CompactionAction(CompactionActionType::RUN_COMPACTION);
     _ev_http_server->register_handler(HttpMethod::POST, "/api/compaction/run", run_compaction_action);
+    CompactionAction* show_scheduler_action = new CompactionAction(CompactionActionType::SHOW_SCHEDULER);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/compaction/scheduler", show_scheduler_action);
+    CompactionAction* update_scheduler_action = new CompactionAction(CompactionActionType::UPDATE_SCHEDULER);
+    _ev_http_server->register_handler(HttpMethod::POST, "/api/compaction/scheduler", update_scheduler_action);
 
     UpdateConfigAction* update_config_action = new UpdateConfigAction();
     _ev_http_server->register_handler(HttpMethod::POST, "/api/update_config", update_config_action);
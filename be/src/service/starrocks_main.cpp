@@ -43,6 +43,7 @@
 #include "common/status.h"
 #include "runtime/exec_env.h"
 #include "runtime/heartbeat_flags.h"
+#include "runtime/mem_hook.h"
 #include "service/backend_options.h"
 #include "service/backend_service.h"
 #include "service/brpc_service.h"
@@ -143,6 +144,11 @@ int main(int argc, char** argv) {
         fprintf(stderr, "Failed to change TCMalloc total thread cache size.\n");
         return -1;
     }
+
+    if (starrocks::config::enable_mem_hook && !starrocks::MemHook::install()) {
+        fprintf(stderr, "Failed to install TCMalloc memory hooks.\n");
+        return -1;
+    }
 #endif
 
     std::vector<starrocks::StorePath> paths;
@@ -0,0 +1,338 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/compaction_scheduler.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <queue>
+
+#include "common/config.h"
+#include "storage/data_dir.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet_manager.h"
+#include "storage/vectorized/base_compaction.h"
+#include "storage/vectorized/cumulative_compaction.h"
+#include "util/monotime.h"
+#include "util/scoped_cleanup.h"
+#include "util/starrocks_metrics.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
+#include "util/time.h"
+#include "util/trace.h"
+
+namespace starrocks {
+
+int64_t CompactionIOBudget::acquire(int64_t bytes, int64_t bytes_per_sec) {
+    if (bytes_per_sec <= 0 || bytes <= 0) {
+        return 0;
+    }
+    int64_t wait_us = 0;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        int64_t now_us = MonotonicMicros();
+        if (_last_refill_us == 0) {
+            _tokens = bytes_per_sec;
+        } else {
+            _tokens = std::min<double>(bytes_per_sec, _tokens + (now_us - _last_refill_us) * bytes_per_sec / 1e6);
+        }
+        _last_refill_us = now_us;
+        _tokens -= bytes;
+        if (_tokens >= 0) {
+            return 0;
+        }
+        wait_us = static_cast<int64_t>(-_tokens * 1e6 / bytes_per_sec);
+    }
+    SleepFor(MonoDelta::FromMicroseconds(wait_us));
+    return wait_us;
+}
+
+CompactionScheduler::CompactionScheduler(MemTracker* mem_tracker) : _mem_tracker(mem_tracker) {
+    _preempt_checker = [] {
+        int64_t threshold = config::compaction_preempt_query_scan_bytes_per_second;
+        return threshold > 0 && StarRocksMetrics::instance()->query_scan_bytes_per_second.value() > threshold;
+    };
+}
+
+CompactionScheduler::~CompactionScheduler() {
+    stop();
+}
+
+Status CompactionScheduler::start(int32_t max_concurrency) {
+    _max_concurrency = max_concurrency;
+    RETURN_IF_ERROR(ThreadPoolBuilder("CompactionThreadPool")
+                            .set_min_threads(1)
+                            .set_max_threads(std::max<int32_t>(1, max_concurrency))
+                            .build(&_pool));
+    _dispatch_thread = std::thread([this] { _dispatch_loop(); });
+    return Status::OK();
+}
+
+void CompactionScheduler::stop() {
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+    }
+    _cv.notify_all();
+    if (_dispatch_thread.joinable()) {
+        _dispatch_thread.join();
+    }
+    if (_pool != nullptr) {
+        _pool->shutdown();
+    }
+}
+
+void CompactionScheduler::pause() {
+    std::lock_guard<std::mutex> l(_lock);
+    _paused = true;
+    LOG(INFO) << "compaction scheduler paused";
+}
+
+void CompactionScheduler::resume() {
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _paused = false;
+    }
+    _cv.notify_all();
+    LOG(INFO) << "compaction scheduler resumed";
+}
+
+void CompactionScheduler::set_preempt_checker(std::function<bool()> checker) {
+    std::lock_guard<std::mutex> l(_lock);
+    _preempt_checker = std::move(checker);
+}
+
+bool CompactionScheduler::is_preempted() const {
+    std::lock_guard<std::mutex> l(_lock);
+    return _paused || (_preempt_checker && _preempt_checker());
+}
+
+void CompactionScheduler::_dispatch_loop() {
+    while (true) {
+        int dispatched = 0;
+        if (!is_preempted()) {
+            dispatched = _schedule();
+        }
+
+        int32_t interval = config::cumulative_compaction_check_interval_seconds;
+        if (interval <= 0) {
+            LOG(WARNING) << "cumulative compaction check interval config is illegal:" << interval
+                         << "will be forced set to one";
+            interval = 1;
+        }
+        std::unique_lock<std::mutex> l(_lock);
+        // Wait for the next round: a finished task frees a slot and may change scores,
+        // otherwise recheck after the interval.
+        if (dispatched == 0 || _num_running_tasks() >= _max_concurrency) {
+            _cv.wait_for(l, std::chrono::seconds(interval), [this] { return _stopped || _task_finished; });
+        }
+        _task_finished = false;
+        if (_stopped) {
+            break;
+        }
+    }
+}
+
+int CompactionScheduler::_schedule() {
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_num_running_tasks() >= _max_concurrency) {
+            return 0;
+        }
+    }
+
+    std::vector<CompactionCandidate> candidates;
+    _get_candidates(&candidates);
+    return _dispatch(std::move(candidates));
+}
+
+void CompactionScheduler::_get_candidates(std::vector<CompactionCandidate>* candidates) {
+    TabletManager* tablet_manager = StorageEngine::instance()->tablet_manager();
+    tablet_manager->get_compaction_candidates(CompactionType::CUMULATIVE_COMPACTION, candidates);
+    tablet_manager->get_compaction_candidates(CompactionType::BASE_COMPACTION, candidates);
+}
+
+int CompactionScheduler::_dispatch(std::vector<CompactionCandidate> candidates) {
+    std::priority_queue<CompactionCandidate, std::vector<CompactionCandidate>, CompactionCandidateComparator> queue(
+            CompactionCandidateComparator(), std::move(candidates));
+
+    int32_t max_tasks_per_disk = config::compaction_max_tasks_per_disk;
+    int dispatched = 0;
+    while (!queue.empty()) {
+        CompactionCandidate candidate = queue.top();
+        queue.pop();
+        DataDir* data_dir = candidate.tablet->data_dir();
+        if (data_dir->reach_capacity_limit(0)) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            if (_stopped || _num_running_tasks() >= _max_concurrency) {
+                break;
+            }
+            if (max_tasks_per_disk > 0 && _running_per_disk[data_dir] >= max_tasks_per_disk) {
+                continue;
+            }
+            TaskKey key(candidate.tablet->tablet_id(), candidate.type);
+            if (_running_tasks.count(key) > 0) {
+                continue;
+            }
+            RunningTask& task = _running_tasks[key];
+            task.disk_path = data_dir->path();
+            task.start_time_ms = UnixMillis();
+            task.score = candidate.score;
+            _running_per_disk[data_dir]++;
+        }
+        Status st = _pool->submit_func([this, candidate] {
+            _do_compaction(candidate);
+            _finish(candidate);
+        });
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to submit compaction task, tablet=" << candidate.tablet->tablet_id()
+                         << ", error=" << st.to_string();
+            _finish(candidate);
+            break;
+        }
+        dispatched++;
+    }
+    return dispatched;
+}
+
+void CompactionScheduler::_finish(const CompactionCandidate& candidate) {
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _running_tasks.erase(TaskKey(candidate.tablet->tablet_id(), candidate.type));
+        _running_per_disk[candidate.tablet->data_dir()]--;
+        _task_finished = true;
+    }
+    _cv.notify_all();
+}
+
+CompactionIOBudget* CompactionScheduler::_get_io_budget(DataDir* data_dir) {
+    std::lock_guard<std::mutex> l(_lock);
+    auto& budget = _io_budgets[data_dir];
+    if (budget == nullptr) {
+        budget = std::make_unique<CompactionIOBudget>();
+    }
+    return budget.get();
+}
+
+void CompactionScheduler::throttle(DataDir* data_dir, int64_t bytes) {
+    int64_t preempt_start_ms = MonotonicMillis();
+    int64_t max_preempt_ms = config::compaction_max_preempt_seconds * 1000L;
+    // Yield the disk to queries, but not forever, since the tablet locks are held.
+    while (is_preempted() && MonotonicMillis() - preempt_start_ms < max_preempt_ms) {
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            if (_stopped) {
+                break;
+            }
+        }
+        SleepForMs(100);
+    }
+    _preempted_us += (MonotonicMillis() - preempt_start_ms) * 1000;
+    _throttled_us += _get_io_budget(data_dir)->acquire(bytes, config::compaction_disk_io_mbytes_per_sec * 1024 * 1024);
+}
+
+void CompactionScheduler::_do_compaction(const CompactionCandidate& candidate) {
+    const TabletSharedPtr& tablet = candidate.tablet;
+    bool is_base = candidate.type == CompactionType::BASE_COMPACTION;
+    scoped_refptr<Trace> trace(new Trace);
+    MonotonicStopWatch watch;
+    watch.start();
+    SCOPED_CLEANUP({
+        int32_t threshold =
+                is_base ? config::base_compaction_trace_threshold : config::cumulative_compaction_trace_threshold;
+        if (watch.elapsed_time() / 1e9 > threshold) {
+            LOG(INFO) << "Trace:" << std::endl << trace->DumpToString(Trace::INCLUDE_ALL);
+        }
+    });
+    ADOPT_TRACE(trace.get());
+    TRACE("start to perform $0 compaction of tablet $1, score $2", is_base ? "base" : "cumulative",
+          tablet->tablet_id(), candidate.score);
+
+    std::unique_ptr<vectorized::Compaction> compaction;
+    if (is_base) {
+        StarRocksMetrics::instance()->base_compaction_request_total.increment(1);
+        compaction = std::make_unique<vectorized::BaseCompaction>(_mem_tracker, tablet);
+    } else {
+        StarRocksMetrics::instance()->cumulative_compaction_request_total.increment(1);
+        compaction = std::make_unique<vectorized::CumulativeCompaction>(_mem_tracker, tablet);
+    }
+    DataDir* data_dir = tablet->data_dir();
+    compaction->set_throttle([this, data_dir](int64_t bytes) { throttle(data_dir, bytes); });
+
+    Status res = compaction->compact();
+    if (!res.ok()) {
+        if (is_base) {
+            tablet->set_last_base_compaction_failure_time(UnixMillis());
+        } else {
+            tablet->set_last_cumu_compaction_failure_time(UnixMillis());
+        }
+        if (!res.is_not_found()) {
+            _failed_count++;
+            if (is_base) {
+                StarRocksMetrics::instance()->base_compaction_request_failed.increment(1);
+            } else {
+                StarRocksMetrics::instance()->cumulative_compaction_request_failed.increment(1);
+            }
+            LOG(WARNING) << "Fail to vectorized compact table=" << tablet->full_name()
+                         << ", type=" << (is_base ? "base" : "cumulative") << ", err=" << res.to_string();
+        }
+        return;
+    }
+    _finished_count++;
+    if (is_base) {
+        tablet->set_last_base_compaction_failure_time(0);
+    } else {
+        tablet->set_last_cumu_compaction_failure_time(0);
+    }
+}
+
+void CompactionScheduler::get_status(std::string* json_result) const {
+    rapidjson::Document root;
+    root.SetObject();
+    auto& allocator = root.GetAllocator();
+
+    rapidjson::Value running_arr(rapidjson::kArrayType);
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        root.AddMember("paused", _paused, allocator);
+        root.AddMember("preempted", _paused || (_preempt_checker && _preempt_checker()), allocator);
+        root.AddMember("max concurrency", _max_concurrency, allocator);
+        root.AddMember("max tasks per disk", config::compaction_max_tasks_per_disk, allocator);
+        root.AddMember("disk io mbytes per sec", config::compaction_disk_io_mbytes_per_sec, allocator);
+        for (const auto& [key, task] : _running_tasks) {
+            rapidjson::Value task_value(rapidjson::kObjectType);
+            task_value.AddMember("tablet id", key.first, allocator);
+            task_value.AddMember(
+                    "type", rapidjson::StringRef(key.second == CompactionType::BASE_COMPACTION ? "base" : "cumulative"),
+                    allocator);
+            task_value.AddMember("score", task.score, allocator);
+            rapidjson::Value path;
+            path.SetString(task.disk_path.c_str(), task.disk_path.length(), allocator);
+            task_value.AddMember("disk", path, allocator);
+            std::string start_time = ToStringFromUnixMillis(task.start_time_ms);
+            rapidjson::Value start_value;
+            start_value.SetString(start_time.c_str(), start_time.length(), allocator);
+            task_value.AddMember("start time", start_value, allocator);
+            running_arr.PushBack(task_value, allocator);
+        }
+    }
+    root.AddMember("running tasks", running_arr, allocator);
+    root.AddMember("finished tasks", _finished_count.load(), allocator);
+    root.AddMember("failed tasks", _failed_count.load(), allocator);
+    root.AddMember("throttled time us", _throttled_us.load(), allocator);
+    root.AddMember("preempted time us", _preempted_us.load(), allocator);
+
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+    *json_result = std::string(strbuf.GetString());
+}
+
+} // namespace starrocks
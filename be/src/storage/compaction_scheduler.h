@@ -0,0 +1,139 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "gutil/macros.h"
+#include "storage/olap_common.h"
+#include "storage/tablet.h"
+
+namespace starrocks {
+
+class DataDir;
+class MemTracker;
+class ThreadPool;
+
+struct CompactionCandidate {
+    TabletSharedPtr tablet;
+    CompactionType type = CompactionType::CUMULATIVE_COMPACTION;
+    uint32_t score = 0;
+    int version_count = 0;
+};
+
+// Order of the global queue, the candidate with higher score goes first,
+// and the one with more versions wins for the same score.
+struct CompactionCandidateComparator {
+    bool operator()(const CompactionCandidate& a, const CompactionCandidate& b) const {
+        if (a.score != b.score) {
+            return a.score < b.score;
+        }
+        return a.version_count < b.version_count;
+    }
+};
+
+// Token bucket limiting how many bytes per second compaction may process on one disk.
+// Callers run ahead and then sleep off their debt, so the budget is an average over
+// about one second.
+class CompactionIOBudget {
+public:
+    // Take `bytes` from the budget refilled at `bytes_per_sec`, sleeping if it is exhausted.
+    // Return the time slept in microseconds. No limit if `bytes_per_sec` <= 0.
+    int64_t acquire(int64_t bytes, int64_t bytes_per_sec);
+
+private:
+    std::mutex _lock;
+    double _tokens = 0;
+    int64_t _last_refill_us = 0;
+};
+
+// CompactionScheduler runs base and cumulative compaction of all disks from one global
+// priority queue, instead of independent per-disk threads each picking by local score.
+//
+// One dispatch thread collects candidates of every disk, orders them by score and version
+// count and submits them to a shared worker pool, respecting:
+//  - max_compaction_concurrency for the whole BE,
+//  - compaction_max_tasks_per_disk for each disk,
+//  - compaction_disk_io_mbytes_per_sec, enforced by running tasks through throttle().
+//
+// When the preempt checker reports high query load (by default query_scan_bytes_per_second
+// above compaction_preempt_query_scan_bytes_per_second) or the scheduler is paused, no new
+// task is dispatched and running tasks sleep in throttle() until the load goes down.
+class CompactionScheduler {
+public:
+    explicit CompactionScheduler(MemTracker* mem_tracker);
+    virtual ~CompactionScheduler();
+
+    Status start(int32_t max_concurrency);
+    void stop();
+
+    // Called by a running compaction of a tablet on `data_dir` for every `bytes` it merged.
+    void throttle(DataDir* data_dir, int64_t bytes);
+
+    // Pause and resume compaction manually, e.g. from the HTTP API.
+    void pause();
+    void resume();
+
+    // Replace the hook deciding whether queries should preempt compaction.
+    void set_preempt_checker(std::function<bool()> checker);
+    bool is_preempted() const;
+
+    void get_status(std::string* json_result) const;
+
+private:
+    struct RunningTask {
+        std::string disk_path;
+        int64_t start_time_ms = 0;
+        uint32_t score = 0;
+    };
+    using TaskKey = std::pair<int64_t, CompactionType>;
+
+    void _dispatch_loop();
+    // Return the number of submitted tasks.
+    int _schedule();
+    // Collect the candidates of all disks.
+    virtual void _get_candidates(std::vector<CompactionCandidate>* candidates);
+    // Submit `candidates` in order within the limits, return the number of submitted tasks.
+    int _dispatch(std::vector<CompactionCandidate> candidates);
+    virtual void _do_compaction(const CompactionCandidate& candidate);
+    void _finish(const CompactionCandidate& candidate);
+    CompactionIOBudget* _get_io_budget(DataDir* data_dir);
+    // Must hold _lock.
+    int32_t _num_running_tasks() const { return static_cast<int32_t>(_running_tasks.size()); }
+
+    MemTracker* _mem_tracker;
+    int32_t _max_concurrency = 0;
+    std::unique_ptr<ThreadPool> _pool;
+    std::thread _dispatch_thread;
+
+    mutable std::mutex _lock;
+    std::condition_variable _cv;
+    bool _stopped = false;
+    bool _paused = false;
+    // set by finished tasks to wake up the dispatch thread.
+    bool _task_finished = false;
+    std::map<TaskKey, RunningTask> _running_tasks;
+    std::unordered_map<DataDir*, int32_t> _running_per_disk;
+    std::unordered_map<DataDir*, std::unique_ptr<CompactionIOBudget>> _io_budgets;
+    std::function<bool()> _preempt_checker;
+
+    std::atomic<int64_t> _finished_count{0};
+    std::atomic<int64_t> _failed_count{0};
+    std::atomic<int64_t> _throttled_us{0};
+    std::atomic<int64_t> _preempted_us{0};
+
+    DISALLOW_COPY_AND_ASSIGN(CompactionScheduler);
+};
+
+} // namespace starrocks
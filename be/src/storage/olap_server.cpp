@@ -28,6 +28,7 @@
 #include <string>
 
 #include "common/status.h"
+#include "storage/compaction_scheduler.h"
 #include "storage/olap_common.h"
 #include "storage/olap_define.h"
 #include "storage/storage_engine.h"
@@ -78,7 +79,7 @@ Status StorageEngine::start_bg_threads() {
     }
     int32_t data_dir_num = data_dirs.size();
 
-    // base and cumulative compaction threads
+    // base and cumulative compaction tasks of all disks are scheduled by one CompactionScheduler
     int32_t base_compaction_num_threads_per_disk = std::max<int32_t>(1, config::base_compaction_num_threads_per_disk);
     int32_t cumulative_compaction_num_threads_per_disk =
             std::max<int32_t>(1, config::cumulative_compaction_num_threads_per_disk);
@@ -93,27 +94,9 @@ Status StorageEngine::start_bg_threads() {
     }
     vectorized::Compaction::init(max_compaction_concurrency);
 
-    _base_compaction_threads.reserve(base_compaction_num_threads);
-    for (uint32_t i = 0; i < base_compaction_num_threads; ++i) {
-        _base_compaction_threads.emplace_back([this, data_dir_num, data_dirs, i] {
-            _base_compaction_thread_callback(nullptr, data_dirs[i % data_dir_num]);
-        });
-    }
-    for (auto& thread : _base_compaction_threads) {
-        thread.detach();
-    }
-    LOG(INFO) << "base compaction threads started. number: " << base_compaction_num_threads;
-
-    _cumulative_compaction_threads.reserve(cumulative_compaction_num_threads);
-    for (uint32_t i = 0; i < cumulative_compaction_num_threads; ++i) {
-        _cumulative_compaction_threads.emplace_back([this, data_dir_num, data_dirs, i] {
-            _cumulative_compaction_thread_callback(nullptr, data_dirs[i % data_dir_num]);
-        });
-    }
-    for (auto& thread : _cumulative_compaction_threads) {
-        thread.detach();
-    }
-    LOG(INFO) << "cumulative compaction threads started. number: " << cumulative_compaction_num_threads;
+    _compaction_scheduler = std::make_unique<CompactionScheduler>(_options.compaction_mem_tracker);
+    RETURN_IF_ERROR(_compaction_scheduler->start(max_compaction_concurrency));
+    LOG(INFO) << "compaction scheduler started. max concurrency: " << max_compaction_concurrency;
 
     int32_t update_compaction_num_threads_per_disk =
             std::max<int32_t>(1, config::update_compaction_num_threads_per_disk);
@@ -181,33 +164,6 @@ void* StorageEngine::_fd_cache_clean_callback(void* arg) {
     return nullptr;
 }
 
-void* StorageEngine::_base_compaction_thread_callback(void* arg, DataDir* data_dir) {
-#ifdef GOOGLE_PROFILER
-    ProfilerRegisterThread();
-#endif
-    //string last_base_compaction_fs;
-    //TTabletId last_base_compaction_tablet_id = -1;
-    Status status = Status::OK();
-    while (!_stop_bg_worker) {
-        // must be here, because this thread is start on start and
-        if (!data_dir->reach_capacity_limit(0)) {
-            status = _perform_base_compaction(data_dir);
-        }
-        if (status.ok()) {
-            continue;
-        }
-
-        int32_t interval = config::base_compaction_check_interval_seconds;
-        if (interval <= 0) {
-            LOG(WARNING) << "base compaction check interval config is illegal: " << interval << ", force set to 1";
-            interval = 1;
-        }
-        SLEEP_IN_BG_WORKER(interval);
-    }
-
-    return nullptr;
-}
-
 void* StorageEngine::_update_compaction_thread_callback(void* arg, DataDir* data_dir) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
@@ -295,34 +251,6 @@ void* StorageEngine::_disk_stat_monitor_thread_callback(void* arg) {
     return nullptr;
 }
 
-void* StorageEngine::_cumulative_compaction_thread_callback(void* arg, DataDir* data_dir) {
-#ifdef GOOGLE_PROFILER
-    ProfilerRegisterThread();
-#endif
-    LOG(INFO) << "try to start cumulative compaction process!";
-
-    Status status = Status::OK();
-    while (!_stop_bg_worker) {
-        // must be here, because this thread is start on start and
-        if (!data_dir->reach_capacity_limit(0)) {
-            status = _perform_cumulative_compaction(data_dir);
-        }
-        if (status.ok()) {
-            continue;
-        }
-
-        int32_t interval = config::cumulative_compaction_check_interval_seconds;
-        if (interval <= 0) {
-            LOG(WARNING) << "cumulative compaction check interval config is illegal:" << interval
-                         << "will be forced set to one";
-            interval = 1;
-        }
-        SLEEP_IN_BG_WORKER(interval);
-    }
-
-    return nullptr;
-}
-
 void* StorageEngine::_update_cache_expire_thread_callback(void* arg) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
@@ -30,6 +30,7 @@
 
 #include "gutil/strings/substitute.h"
 #include "storage/rowset/beta_rowset_reader.h"
+#include "storage/rowset/segment_v2/column_statistics.h"
 #include "storage/rowset/vectorized/rowset_options.h"
 #include "storage/rowset/vectorized/segment_options.h"
 #include "storage/storage_engine.h"
@@ -145,9 +146,9 @@ void BetaRowset::do_close() {
     _segments.clear();
 }
 
-Status BetaRowset::link_files_to(const std::string& dir, RowsetId new_rowset_id) {
+Status BetaRowset::link_files_to(const std::string& dir, RowsetId new_rowset_id, uint32_t segment_id_offset) {
     for (int i = 0; i < num_segments(); ++i) {
-        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i);
+        std::string dst_link_path = segment_file_path(dir, new_rowset_id, segment_id_offset + i);
         std::string src_file_path = segment_file_path(_rowset_path, rowset_id(), i);
         if (link(src_file_path.c_str(), dst_link_path.c_str()) != 0) {
             PLOG(WARNING) << "Fail to link " << src_file_path << " to " << dst_link_path;
@@ -156,7 +157,7 @@ Status BetaRowset::link_files_to(const std::string& dir, RowsetId new_rowset_id)
     }
     for (int i = 0; i < num_delete_files(); ++i) {
         std::string src_file_path = segment_del_file_path(_rowset_path, rowset_id(), i);
-        std::string dst_link_path = segment_del_file_path(dir, new_rowset_id, i);
+        std::string dst_link_path = segment_del_file_path(dir, new_rowset_id, segment_id_offset + i);
         if (link(src_file_path.c_str(), dst_link_path.c_str()) != 0) {
             PLOG(WARNING) << "Fail to link " << src_file_path << " to " << dst_link_path;
             return Status::RuntimeError("Fail to link segment delete file");
@@ -312,6 +313,17 @@ Status BetaRowset::get_segment_iterators(const vectorized::Schema& schema, const
     return Status::OK();
 }
 
+Status BetaRowset::get_column_statistics(uint32_t cid, segment_v2::ColumnStatistics* stats) {
+    RETURN_IF_ERROR(load());
+    for (const auto& segment : _segments) {
+        Status st = segment->get_column_statistics(cid, stats);
+        if (!st.ok() && !st.is_not_found()) {
+            return st;
+        }
+    }
+    return Status::OK();
+}
+
 StatusOr<std::vector<vectorized::ChunkIteratorPtr>> BetaRowset::get_segment_iterators2(const vectorized::Schema& schema,
                                                                                        OlapMeta* meta, int64_t version,
                                                                                        OlapReaderStatistics* stats) {
@@ -66,6 +66,12 @@ public:
                                                                                OlapMeta* meta, int64_t version,
                                                                                OlapReaderStatistics* stats);
 
+    // Merge the statistics of the values of the column |cid| in all the segments into |stats|.
+    // The segments without the statistics, e.g. written by an old version or with
+    // enable_segment_column_statistics off, are skipped, so the statistics cover only
+    // stats->num_rows() of the num_rows() rows of the rowset.
+    Status get_column_statistics(uint32_t cid, segment_v2::ColumnStatistics* stats);
+
     static std::string segment_file_path(const std::string& segment_dir, const RowsetId& rowset_id, int segment_id);
 
     static std::string segment_temp_file_path(const std::string& dir, const RowsetId& rowset_id, int segment_id);
@@ -80,7 +86,7 @@ public:
 
     OLAPStatus remove() override;
 
-    Status link_files_to(const std::string& dir, RowsetId new_rowset_id) override;
+    Status link_files_to(const std::string& dir, RowsetId new_rowset_id, uint32_t segment_id_offset = 0) override;
 
     OLAPStatus copy_files_to(const std::string& dir) override;
 
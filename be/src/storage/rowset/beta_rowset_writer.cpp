@@ -192,7 +192,7 @@ template OLAPStatus BetaRowsetWriter::_add_row(const ContiguousRow& row);
 
 OLAPStatus BetaRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
     assert(rowset->rowset_meta()->rowset_type() == BETA_ROWSET);
-    if (!rowset->link_files_to(_context.rowset_path_prefix, _context.rowset_id).ok()) {
+    if (!rowset->link_files_to(_context.rowset_path_prefix, _context.rowset_id, _num_segment).ok()) {
         return OLAP_ERR_OTHER_ERROR;
     }
     _num_rows_written += rowset->num_rows();
@@ -415,6 +415,11 @@ std::unique_ptr<SegmentWriter> BetaRowsetWriter::_create_segment_writer() {
     writer_options.storage_format_version = _context.storage_format_version;
     writer_options.mem_tracker = _context.mem_tracker;
     const auto* schema = _rowset_schema != nullptr ? _rowset_schema.get() : _context.tablet_schema;
+    if (schema->num_rows_per_row_block() > 0) {
+        writer_options.num_rows_per_block = schema->num_rows_per_row_block();
+    }
+    writer_options.max_short_key_columns = std::max(config::short_key_index_max_columns, 0);
+    writer_options.write_block_max_key = config::short_key_index_write_block_max_key;
     std::unique_ptr<SegmentWriter> segment_writer =
             std::make_unique<segment_v2::SegmentWriter>(std::move(wblock), _num_segment, schema, writer_options);
     // TODO set write_mbytes_per_sec based on writer type (load/base compaction/cumulative compaction)
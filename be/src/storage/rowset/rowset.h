@@ -215,7 +215,9 @@ public:
     }
 
     // hard link all files in this rowset to `dir` to form a new rowset with id `new_rowset_id`.
-    virtual Status link_files_to(const std::string& dir, RowsetId new_rowset_id) = 0;
+    // segment files are numbered from `segment_id_offset` in the new rowset, so that files of
+    // several rowsets can be linked into one.
+    virtual Status link_files_to(const std::string& dir, RowsetId new_rowset_id, uint32_t segment_id_offset = 0) = 0;
 
     // copy all files to `dir`
     virtual OLAPStatus copy_files_to(const std::string& dir) = 0;
@@ -30,6 +30,7 @@
 #include "storage/rowset/segment_v2/common.h"
 #include "storage/rowset/segment_v2/encoding_info.h"
 #include "storage/rowset/segment_v2/indexed_column_writer.h"
+#include "storage/rowset/segment_v2/tokenizer.h"
 #include "storage/types.h"
 #include "util/faststring.h"
 #include "util/slice.h"
@@ -82,6 +83,12 @@ public:
     }
 
     void add_value(const CppType& value) {
+        add_value_to_current_row(value);
+        _rid++;
+    }
+
+    // index the row being written by |value| too, without moving to the next row.
+    void add_value_to_current_row(const CppType& value) {
         auto it = _mem_index.find(value);
         uint64_t old_size = 0;
         if (it != _mem_index.end()) {
@@ -96,9 +103,10 @@ public:
             it = _mem_index.find(new_value);
         }
         _reverted_index_size += it->second.getSizeInBytes(false) - old_size;
-        _rid++;
     }
 
+    void next_row() { _rid++; }
+
     void add_nulls(uint32_t count) override {
         _null_bitmap.addRange(_rid, _rid + count);
         _rid += count;
@@ -106,8 +114,10 @@ public:
 
     Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) override {
         index_meta->set_type(BITMAP_INDEX);
-        BitmapIndexPB* meta = index_meta->mutable_bitmap_index();
+        return write(wblock, index_meta->mutable_bitmap_index());
+    }
 
+    Status write(fs::WritableBlock* wblock, BitmapIndexPB* meta) {
         meta->set_bitmap_type(BitmapIndexPB::ROARING_BITMAP);
         meta->set_has_null(!_null_bitmap.isEmpty());
 
@@ -191,6 +201,47 @@ private:
     MemPool _pool;
 };
 
+// Builder for inverted index, whose postings are the bitmap index of the tokens of the values, i.e.
+// the n-th bit of the bitmap of a token is set to 1 if the n-th row contains the token.
+// The values are CHAR or VARCHAR, whose padding is never part of a token.
+class InvertedIndexWriterImpl : public BitmapIndexWriter {
+public:
+    explicit InvertedIndexWriterImpl(std::unique_ptr<Tokenizer> tokenizer)
+            : _tokenizer(std::move(tokenizer)), _postings(get_type_info(OLAP_FIELD_TYPE_VARCHAR)) {}
+
+    ~InvertedIndexWriterImpl() override = default;
+
+    void add_values(const void* values, size_t count) override {
+        auto p = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; ++i) {
+            _tokens.clear();
+            _tokenizer->tokenize(unaligned_load<Slice>(p), &_tokens);
+            for (const std::string& token : _tokens) {
+                _postings.add_value_to_current_row(Slice(token));
+            }
+            _postings.next_row();
+            p++;
+        }
+    }
+
+    void add_nulls(uint32_t count) override { _postings.add_nulls(count); }
+
+    Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) override {
+        index_meta->set_type(INVERTED_INDEX);
+        InvertedIndexPB* meta = index_meta->mutable_inverted_index();
+        meta->set_tokenizer(_tokenizer->type());
+        return _postings.write(wblock, meta->mutable_postings());
+    }
+
+    uint64_t size() const override { return _postings.size(); }
+
+private:
+    std::unique_ptr<Tokenizer> _tokenizer;
+    BitmapIndexWriterImpl<OLAP_FIELD_TYPE_VARCHAR> _postings;
+    // tokens of the value being added
+    std::vector<std::string> _tokens;
+};
+
 } // namespace
 
 Status BitmapIndexWriter::create(const TypeInfoPtr& typeinfo, std::unique_ptr<BitmapIndexWriter>* res) {
@@ -247,5 +298,17 @@ Status BitmapIndexWriter::create(const TypeInfoPtr& typeinfo, std::unique_ptr<Bi
     return Status::OK();
 }
 
+Status BitmapIndexWriter::create_inverted(const TypeInfoPtr& typeinfo, TokenizerTypePB tokenizer_type,
+                                          std::unique_ptr<BitmapIndexWriter>* res) {
+    FieldType type = typeinfo->type();
+    if (type != OLAP_FIELD_TYPE_CHAR && type != OLAP_FIELD_TYPE_VARCHAR) {
+        return Status::NotSupported("unsupported type for inverted index: " + std::to_string(type));
+    }
+    std::unique_ptr<Tokenizer> tokenizer;
+    RETURN_IF_ERROR(Tokenizer::create(tokenizer_type, &tokenizer));
+    *res = std::make_unique<InvertedIndexWriterImpl>(std::move(tokenizer));
+    return Status::OK();
+}
+
 } // namespace segment_v2
 } // namespace starrocks
@@ -43,6 +43,11 @@ class BitmapIndexWriter {
 public:
     static Status create(const TypeInfoPtr& type_info, std::unique_ptr<BitmapIndexWriter>* res);
 
+    // Create the writer of the inverted index of a CHAR/VARCHAR column, which indexes the rows
+    // by the tokens of their values instead of the values.
+    static Status create_inverted(const TypeInfoPtr& type_info, TokenizerTypePB tokenizer,
+                                  std::unique_ptr<BitmapIndexWriter>* res);
+
     BitmapIndexWriter() = default;
     virtual ~BitmapIndexWriter() = default;
 
@@ -21,8 +21,10 @@
 
 #include "storage/rowset/segment_v2/bloom_filter_index_writer.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "env/env.h"
 #include "runtime/mem_pool.h"
@@ -33,6 +35,7 @@
 #include "storage/rowset/segment_v2/encoding_info.h"
 #include "storage/rowset/segment_v2/indexed_column_writer.h"
 #include "storage/types.h"
+#include "util/murmur_hash3.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -176,6 +179,92 @@ private:
     std::vector<std::unique_ptr<BloomFilter>> _bfs;
 };
 
+// Builder for n-gram bloom filter. Like BloomFilterIndexWriterImpl, it builds a bloom filter page
+// by every data page, but the bloom filter holds the hashes of the distinct grams, i.e. substrings
+// of |gram_size| bytes, of the values, so that a data page can be skipped if none of its values
+// may contain some substring of a LIKE pattern. Values shorter than |gram_size| add no gram.
+template <FieldType field_type>
+class NgramBloomFilterIndexWriter : public BloomFilterIndexWriter {
+public:
+    NgramBloomFilterIndexWriter(const BloomFilterOptions& bf_options, uint32_t gram_size)
+            : _bf_options(bf_options), _gram_size(gram_size) {}
+
+    ~NgramBloomFilterIndexWriter() override = default;
+
+    void add_values(const void* values, size_t count) override {
+        const auto* v = reinterpret_cast<const Slice*>(values);
+        for (size_t i = 0; i < count; ++i) {
+            Slice s = unaligned_load<Slice>(v + i);
+            if constexpr (field_type == OLAP_FIELD_TYPE_CHAR) {
+                // CHAR values are right-padded with '\0', see ColumnPredicate::padding_zeros.
+                while (s.size > 0 && s.data[s.size - 1] == '\0') {
+                    --s.size;
+                }
+            }
+            for (size_t pos = 0; pos + _gram_size <= s.size; ++pos) {
+                uint64_t hash = 0;
+                murmur_hash3_x64_64(s.data + pos, _gram_size, BloomFilter::DEFAULT_SEED, &hash);
+                _hashes.push_back(hash);
+            }
+        }
+    }
+
+    void add_nulls(uint32_t count) override { _has_null |= (count > 0); }
+
+    Status flush() override {
+        std::sort(_hashes.begin(), _hashes.end());
+        _hashes.erase(std::unique(_hashes.begin(), _hashes.end()), _hashes.end());
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+        RETURN_IF_ERROR(bf->init(_hashes.size(), _bf_options.fpp, _bf_options.strategy));
+        bf->set_has_null(_has_null);
+        for (uint64_t hash : _hashes) {
+            bf->add_hash(hash);
+        }
+        _bf_buffer_size += bf->size();
+        _bfs.push_back(std::move(bf));
+        _hashes.clear();
+        _has_null = false;
+        return Status::OK();
+    }
+
+    Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) override {
+        if (!_hashes.empty()) {
+            RETURN_IF_ERROR(flush());
+        }
+        index_meta->set_type(NGRAM_BLOOM_FILTER_INDEX);
+        BloomFilterIndexPB* meta = index_meta->mutable_ngram_bloom_filter_index();
+        meta->set_hash_strategy(_bf_options.strategy);
+        meta->set_algorithm(BLOCK_BLOOM_FILTER);
+        meta->set_gram_size(_gram_size);
+
+        TypeInfoPtr bf_typeinfo = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = true;
+        options.write_value_index = false;
+        options.encoding = PLAIN_ENCODING;
+        IndexedColumnWriter bf_writer(options, bf_typeinfo, wblock);
+        RETURN_IF_ERROR(bf_writer.init());
+        for (auto& bf : _bfs) {
+            Slice data(bf->data(), bf->size());
+            bf_writer.add(&data);
+        }
+        RETURN_IF_ERROR(bf_writer.finish(meta->mutable_bloom_filter()));
+        return Status::OK();
+    }
+
+    uint64_t size() override { return _bf_buffer_size + _hashes.capacity() * sizeof(uint64_t); }
+
+private:
+    BloomFilterOptions _bf_options;
+    uint32_t _gram_size;
+    bool _has_null = false;
+    uint64_t _bf_buffer_size = 0;
+    // hashes of the grams of the current page
+    std::vector<uint64_t> _hashes;
+    std::vector<std::unique_ptr<BloomFilter>> _bfs;
+};
+
 } // namespace
 
 // TODO currently we don't support bloom filter index for tinyint/hll/float/double
@@ -253,5 +342,20 @@ Status BloomFilterIndexWriter::create(const BloomFilterOptions& bf_options, cons
     return Status::OK();
 }
 
+Status BloomFilterIndexWriter::create_ngram(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo,
+                                            uint32_t gram_size, std::unique_ptr<BloomFilterIndexWriter>* res) {
+    DCHECK_GT(gram_size, 0);
+    switch (typeinfo->type()) {
+    case OLAP_FIELD_TYPE_CHAR:
+        *res = std::make_unique<NgramBloomFilterIndexWriter<OLAP_FIELD_TYPE_CHAR>>(bf_options, gram_size);
+        return Status::OK();
+    case OLAP_FIELD_TYPE_VARCHAR:
+        *res = std::make_unique<NgramBloomFilterIndexWriter<OLAP_FIELD_TYPE_VARCHAR>>(bf_options, gram_size);
+        return Status::OK();
+    default:
+        return Status::NotSupported("unsupported type for n-gram bloom filter: " + std::to_string(typeinfo->type()));
+    }
+}
+
 } // namespace segment_v2
 } // namespace starrocks
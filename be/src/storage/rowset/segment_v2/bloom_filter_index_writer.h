@@ -46,6 +46,11 @@ public:
     static Status create(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo,
                          std::unique_ptr<BloomFilterIndexWriter>* res);
 
+    // Create a writer of n-gram bloom filter index, whose bloom filters hold the distinct grams
+    // of |gram_size| bytes of the CHAR/VARCHAR values instead of the values.
+    static Status create_ngram(const BloomFilterOptions& bf_options, const TypeInfoPtr& typeinfo, uint32_t gram_size,
+                               std::unique_ptr<BloomFilterIndexWriter>* res);
+
     BloomFilterIndexWriter() = default;
     virtual ~BloomFilterIndexWriter() = default;
 
@@ -39,13 +39,16 @@
 #include "storage/rowset/segment_v2/binary_dict_page.h" // for BinaryDictPageDecoder
 #include "storage/rowset/segment_v2/bitmap_index_reader.h"
 #include "storage/rowset/segment_v2/bloom_filter_index_reader.h"
+#include "storage/rowset/segment_v2/dict_page.h"     // for DictPageDecoder
 #include "storage/rowset/segment_v2/encoding_info.h" // for EncodingInfo
 #include "storage/rowset/segment_v2/page_handle.h"   // for PageHandle
 #include "storage/rowset/segment_v2/page_io.h"
 #include "storage/rowset/segment_v2/page_pointer.h" // for PagePointer
 #include "storage/rowset/segment_v2/zone_map_index.h"
 #include "storage/types.h" // for TypeInfo
+#include "storage/vectorized/chunk_helper.h"
 #include "storage/vectorized/column_predicate.h"
+#include "storage/vectorized/roaring2range.h"
 #include "util/block_compression.h"
 #include "util/rle_encoding.h" // for RleDecoder
 
@@ -53,6 +56,11 @@ namespace starrocks::segment_v2 {
 
 using strings::Substitute;
 
+// Whether the dictionary encoded pages of |type| are BinaryDictPage, otherwise DictPage.
+static constexpr bool is_binary_dict_type(FieldType type) {
+    return type == OLAP_FIELD_TYPE_CHAR || type == OLAP_FIELD_TYPE_VARCHAR;
+}
+
 Status ColumnReader::create(MemTracker* mem_tracker, const ColumnReaderOptions& opts, const ColumnMetaPB& meta,
                             uint64_t num_rows, const std::string& file_name, std::unique_ptr<ColumnReader>* reader) {
     auto type = static_cast<FieldType>(meta.type());
@@ -117,7 +125,9 @@ Status ColumnReader::init(const ColumnMetaPB& meta) {
         return Status::OK();
     }
 
-    RETURN_IF_ERROR(EncodingInfo::get(delegate_type(_column_type), meta.encoding(), &_encoding_info));
+    // the pages having their own encodings are decoded by the encodings in their footers.
+    EncodingTypePB encoding = meta.encoding() == PER_PAGE_ENCODING ? meta.data_page_encoding() : meta.encoding();
+    RETURN_IF_ERROR(EncodingInfo::get(delegate_type(_column_type), encoding, &_encoding_info));
     RETURN_IF_ERROR(get_block_compression_codec(meta.compression(), &_compress_codec));
 
     for (int i = 0; i < meta.indexes_size(); i++) {
@@ -135,6 +145,13 @@ Status ColumnReader::init(const ColumnMetaPB& meta) {
         case BLOOM_FILTER_INDEX:
             _bf_index_meta = &index_meta.bloom_filter_index();
             break;
+        case NGRAM_BLOOM_FILTER_INDEX:
+            _ngram_bf_index_meta = &index_meta.ngram_bloom_filter_index();
+            break;
+        case INVERTED_INDEX:
+            _inverted_index_meta = &index_meta.inverted_index();
+            RETURN_IF_ERROR(Tokenizer::create(_inverted_index_meta->tokenizer(), &_tokenizer));
+            break;
         default:
             return Status::Corruption(
                     strings::Substitute("Bad file $0: invalid column index type $1", _file_name, index_meta.type()));
@@ -309,25 +326,29 @@ Status ColumnReader::get_row_ranges_by_bloom_filter(CondColumn* cond_column, Row
     return Status::OK();
 }
 
-// prerequisite: at least one predicate in |predicates| support bloom filter.
-Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
-                                  vectorized::SparseRange* row_ranges) {
-    vectorized::SparseRange bf_row_ranges;
-    std::unique_ptr<BloomFilterIndexIterator> bf_iter;
-    RETURN_IF_ERROR(_bloom_filter_index->new_iterator(&bf_iter));
-    size_t range_size = row_ranges->size();
-    // get covered page ids
-    std::set<int32_t> page_ids;
+void ColumnReader::_get_page_ids(const vectorized::SparseRange& row_ranges, std::set<int32_t>* page_ids) {
+    size_t range_size = row_ranges.size();
     for (int i = 0; i < range_size; ++i) {
-        vectorized::Range r = (*row_ranges)[i];
+        vectorized::Range r = row_ranges[i];
         int64_t idx = r.begin();
         auto iter = _ordinal_index->seek_at_or_before(r.begin());
         while (idx < r.end()) {
-            page_ids.insert(iter.page_index());
+            page_ids->insert(iter.page_index());
             idx = iter.last_ordinal() + 1;
             iter.next();
         }
     }
+}
+
+// prerequisite: at least one predicate in |predicates| support bloom filter.
+Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                  vectorized::SparseRange* row_ranges) {
+    vectorized::SparseRange bf_row_ranges;
+    std::unique_ptr<BloomFilterIndexIterator> bf_iter;
+    RETURN_IF_ERROR(_bloom_filter_index->new_iterator(&bf_iter));
+    // get covered page ids
+    std::set<int32_t> page_ids;
+    _get_page_ids(*row_ranges, &page_ids);
     for (const auto& pid : page_ids) {
         std::unique_ptr<BloomFilter> bf;
         RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
@@ -342,6 +363,61 @@ Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPred
     return Status::OK();
 }
 
+// prerequisite: at least one predicate in |predicates| support n-gram bloom filter.
+Status ColumnReader::ngram_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                        vectorized::SparseRange* row_ranges) {
+    const uint32_t gram_size = _ngram_bf_index_meta->gram_size();
+    vectorized::SparseRange bf_row_ranges;
+    std::unique_ptr<BloomFilterIndexIterator> bf_iter;
+    RETURN_IF_ERROR(_ngram_bloom_filter_index->new_iterator(&bf_iter));
+    std::set<int32_t> page_ids;
+    _get_page_ids(*row_ranges, &page_ids);
+    for (const auto& pid : page_ids) {
+        std::unique_ptr<BloomFilter> bf;
+        RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
+        // a page is kept only if every predicate may be satisfied by some value of the page.
+        bool keep = true;
+        for (const auto* pred : predicates) {
+            if (pred->support_ngram_bloom_filter() && !pred->ngram_bloom_filter(bf.get(), gram_size)) {
+                keep = false;
+                break;
+            }
+        }
+        if (keep) {
+            bf_row_ranges.add(vectorized::Range(_ordinal_index->get_first_ordinal(pid),
+                                                _ordinal_index->get_last_ordinal(pid) + 1));
+        }
+    }
+    *row_ranges = row_ranges->intersection(bf_row_ranges);
+    return Status::OK();
+}
+
+// prerequisite: at least one predicate in |predicates| support inverted index.
+Status ColumnReader::inverted_index_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                           vectorized::SparseRange* row_ranges) {
+    BitmapIndexIterator* iter = nullptr;
+    RETURN_IF_ERROR(_inverted_index->new_iterator(&iter));
+    std::unique_ptr<BitmapIndexIterator> iter_guard(iter);
+    Roaring row_bitmap = vectorized::range2roaring(*row_ranges);
+    const uint64_t input_rows = row_bitmap.cardinality();
+    for (const auto* pred : predicates) {
+        if (!pred->support_inverted_index()) {
+            continue;
+        }
+        Roaring rows;
+        Status st = pred->seek_inverted_index(*_tokenizer, iter, &rows);
+        if (st.ok()) {
+            row_bitmap &= rows;
+        } else if (!st.is_cancelled()) {
+            return st;
+        }
+    }
+    if (row_bitmap.cardinality() < input_rows) {
+        *row_ranges = vectorized::roaring2range(row_bitmap);
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::_load_ordinal_index(bool use_page_cache, bool kept_in_memory) {
     DCHECK(_ordinal_index_meta != nullptr);
     _ordinal_index = std::make_unique<OrdinalIndexReader>();
@@ -384,6 +460,28 @@ Status ColumnReader::_load_bloom_filter_index(bool use_page_cache, bool kept_in_
     return Status::OK();
 }
 
+Status ColumnReader::_load_ngram_bloom_filter_index(bool use_page_cache, bool kept_in_memory) {
+    if (_ngram_bf_index_meta != nullptr) {
+        _ngram_bloom_filter_index = std::make_unique<BloomFilterIndexReader>();
+        Status status = _ngram_bloom_filter_index->load(_opts.block_mgr, _file_name, _ngram_bf_index_meta,
+                                                        use_page_cache, kept_in_memory);
+        _mem_tracker->consume(_ngram_bloom_filter_index->mem_usage());
+        return status;
+    }
+    return Status::OK();
+}
+
+Status ColumnReader::_load_inverted_index(bool use_page_cache, bool kept_in_memory) {
+    if (_inverted_index_meta != nullptr) {
+        _inverted_index = std::make_unique<BitmapIndexReader>();
+        Status status = _inverted_index->load(_opts.block_mgr, _file_name, &_inverted_index_meta->postings(),
+                                              use_page_cache, kept_in_memory);
+        _mem_tracker->consume(_inverted_index->mem_usage());
+        return status;
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::seek_to_first(OrdinalPageIndexIterator* iter) {
     *iter = _ordinal_index->begin();
     if (!iter->valid()) {
@@ -495,6 +593,8 @@ Status ColumnReader::ensure_index_loaded(ReaderType reader_type) {
             RETURN_IF_ERROR(_load_zone_map_index(use_page_cache, _opts.kept_in_memory));
             RETURN_IF_ERROR(_load_bitmap_index(use_page_cache, _opts.kept_in_memory));
             RETURN_IF_ERROR(_load_bloom_filter_index(use_page_cache, _opts.kept_in_memory));
+            RETURN_IF_ERROR(_load_ngram_bloom_filter_index(use_page_cache, _opts.kept_in_memory));
+            RETURN_IF_ERROR(_load_inverted_index(use_page_cache, _opts.kept_in_memory));
             return Status::OK();
         });
     }
@@ -673,13 +773,27 @@ Status FileColumnIterator::init(const ColumnIteratorOptions& opts) {
         return Status::OK();
     }
 
-    if (_reader->column_type() == OLAP_FIELD_TYPE_CHAR) {
-        _init_dict_decoder_func = &FileColumnIterator::_do_init_dict_decoder<OLAP_FIELD_TYPE_CHAR>;
-    } else if (_reader->column_type() == OLAP_FIELD_TYPE_VARCHAR) {
-        _init_dict_decoder_func = &FileColumnIterator::_do_init_dict_decoder<OLAP_FIELD_TYPE_VARCHAR>;
-    } else {
+    switch (_reader->column_type()) {
+    case OLAP_FIELD_TYPE_CHAR:
+        return _init_dict<OLAP_FIELD_TYPE_CHAR>(opts);
+    case OLAP_FIELD_TYPE_VARCHAR:
+        return _init_dict<OLAP_FIELD_TYPE_VARCHAR>(opts);
+    case OLAP_FIELD_TYPE_INT:
+        return _init_dict<OLAP_FIELD_TYPE_INT>(opts);
+    case OLAP_FIELD_TYPE_BIGINT:
+        return _init_dict<OLAP_FIELD_TYPE_BIGINT>(opts);
+    case OLAP_FIELD_TYPE_DATE_V2:
+        return _init_dict<OLAP_FIELD_TYPE_DATE_V2>(opts);
+    case OLAP_FIELD_TYPE_TIMESTAMP:
+        return _init_dict<OLAP_FIELD_TYPE_TIMESTAMP>(opts);
+    default:
         return Status::NotSupported("dict encoding with unsupported field type");
     }
+}
+
+template <FieldType Type>
+Status FileColumnIterator::_init_dict(const ColumnIteratorOptions& opts) {
+    _init_dict_decoder_func = &FileColumnIterator::_do_init_dict_decoder<Type>;
 
     if (opts.check_dict_encoding) {
         if (_reader->has_all_dict_encoded()) {
@@ -697,14 +811,10 @@ Status FileColumnIterator::init(const ColumnIteratorOptions& opts) {
         }
     }
 
-    if (_all_dict_encoded && _reader->column_type() == OLAP_FIELD_TYPE_CHAR) {
-        _decode_dict_codes_func = &FileColumnIterator::_do_decode_dict_codes<OLAP_FIELD_TYPE_CHAR>;
-        _dict_lookup_func = &FileColumnIterator::_do_dict_lookup<OLAP_FIELD_TYPE_CHAR>;
-        _next_dict_codes_func = &FileColumnIterator::_do_next_dict_codes<OLAP_FIELD_TYPE_CHAR>;
-    } else if (_all_dict_encoded && _reader->column_type() == OLAP_FIELD_TYPE_VARCHAR) {
-        _decode_dict_codes_func = &FileColumnIterator::_do_decode_dict_codes<OLAP_FIELD_TYPE_VARCHAR>;
-        _dict_lookup_func = &FileColumnIterator::_do_dict_lookup<OLAP_FIELD_TYPE_VARCHAR>;
-        _next_dict_codes_func = &FileColumnIterator::_do_next_dict_codes<OLAP_FIELD_TYPE_VARCHAR>;
+    if (_all_dict_encoded) {
+        _decode_dict_codes_func = &FileColumnIterator::_do_decode_dict_codes<Type>;
+        _dict_lookup_func = &FileColumnIterator::_do_dict_lookup<Type>;
+        _next_dict_codes_func = &FileColumnIterator::_do_next_dict_codes<Type>;
     }
     return Status::OK();
 }
@@ -811,6 +921,68 @@ Status FileColumnIterator::next_batch(size_t* n, vectorized::Column* dst) {
     return Status::OK();
 }
 
+bool FileColumnIterator::support_encoded_predicate(const vectorized::ColumnPredicate* pred) const {
+    EncodingTypePB encoding = _reader->encoding_info()->encoding();
+    if (encoding == FSST_ENCODING) {
+        // CHAR values are stored with zero padding, which the predicates don't have.
+        return _reader->column_type() == OLAP_FIELD_TYPE_VARCHAR &&
+               pred->type_info()->type() == OLAP_FIELD_TYPE_VARCHAR;
+    }
+    if (encoding != RLE && encoding != FOR_ENCODING && encoding != FOR_DELTA_ENCODING) {
+        return false;
+    }
+    switch (_reader->column_type()) {
+    case OLAP_FIELD_TYPE_BOOL:
+    case OLAP_FIELD_TYPE_TINYINT:
+    case OLAP_FIELD_TYPE_SMALLINT:
+    case OLAP_FIELD_TYPE_INT:
+    case OLAP_FIELD_TYPE_BIGINT:
+    case OLAP_FIELD_TYPE_LARGEINT:
+    case OLAP_FIELD_TYPE_DATE_V2:
+    case OLAP_FIELD_TYPE_TIMESTAMP:
+        // the values of these types are stored as is in the vectorized columns.
+        return pred->type_info()->type() == _reader->column_type();
+    default:
+        return false;
+    }
+}
+
+Status FileColumnIterator::evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n,
+                                              uint8_t* selection) {
+    size_t remaining = *n;
+    while (remaining > 0) {
+        if (_page->remaining() == 0) {
+            bool eos = false;
+            RETURN_IF_ERROR(_load_next_page(&eos));
+            if (eos) {
+                break;
+            }
+        }
+
+        // number of rows to be evaluated from this page
+        size_t nread = remaining;
+        EncodingTypePB encoding = _page->encoding_type();
+        if (encoding == RLE || encoding == FOR_ENCODING || encoding == FOR_DELTA_ENCODING ||
+            encoding == FSST_ENCODING) {
+            RETURN_IF_ERROR(_page->evaluate(pred, &nread, selection));
+        } else {
+            // the pages chosen by sampling may have other encodings, decode them.
+            if (_predicate_values == nullptr) {
+                _predicate_values = vectorized::ChunkHelper::column_from_field_type(_reader->column_type(),
+                                                                                   _reader->is_nullable());
+            }
+            _predicate_values->resize(0);
+            RETURN_IF_ERROR(_page->read(_predicate_values.get(), &nread));
+            pred->evaluate(_predicate_values.get(), selection);
+        }
+        selection += nread;
+        _current_ordinal += nread;
+        remaining -= nread;
+    }
+    *n -= remaining;
+    return Status::OK();
+}
+
 Status FileColumnIterator::_load_next_page(bool* eos) {
     _page_iter.next();
     if (!_page_iter.valid()) {
@@ -833,18 +1005,35 @@ Status FileColumnIterator::_load_dict_page() {
             _reader->read_page(_opts, _reader->get_dict_page_pointer(), &_dict_page_handle, &dict_data, &dict_footer));
     // ignore dict_footer.dict_page_footer().encoding() due to only
     // PLAIN_ENCODING is supported for dict page right now
-    if (_reader->column_type() == OLAP_FIELD_TYPE_CHAR) {
+    switch (_reader->column_type()) {
+    case OLAP_FIELD_TYPE_CHAR:
         _dict_decoder = std::make_unique<BinaryPlainPageDecoder<OLAP_FIELD_TYPE_CHAR>>(dict_data);
-    } else {
+        break;
+    case OLAP_FIELD_TYPE_INT:
+        _dict_decoder = std::make_unique<PlainPageDecoder<OLAP_FIELD_TYPE_INT>>(dict_data, PageDecoderOptions());
+        break;
+    case OLAP_FIELD_TYPE_BIGINT:
+        _dict_decoder = std::make_unique<PlainPageDecoder<OLAP_FIELD_TYPE_BIGINT>>(dict_data, PageDecoderOptions());
+        break;
+    case OLAP_FIELD_TYPE_DATE_V2:
+        _dict_decoder = std::make_unique<PlainPageDecoder<OLAP_FIELD_TYPE_DATE_V2>>(dict_data, PageDecoderOptions());
+        break;
+    case OLAP_FIELD_TYPE_TIMESTAMP:
+        _dict_decoder =
+                std::make_unique<PlainPageDecoder<OLAP_FIELD_TYPE_TIMESTAMP>>(dict_data, PageDecoderOptions());
+        break;
+    default:
         _dict_decoder = std::make_unique<BinaryPlainPageDecoder<OLAP_FIELD_TYPE_VARCHAR>>(dict_data);
+        break;
     }
     return _dict_decoder->init();
 }
 
 template <FieldType Type>
 Status FileColumnIterator::_do_init_dict_decoder() {
-    static_assert(Type == OLAP_FIELD_TYPE_CHAR || Type == OLAP_FIELD_TYPE_VARCHAR);
-    auto dict_page_decoder = down_cast<BinaryDictPageDecoder<Type>*>(_page->data_decoder());
+    using DictDecoder =
+            std::conditional_t<is_binary_dict_type(Type), BinaryDictPageDecoder<Type>, DictPageDecoder<Type>>;
+    auto dict_page_decoder = down_cast<DictDecoder*>(_page->data_decoder());
     if (dict_page_decoder->encoding_type() == DICT_ENCODING) {
         if (_dict_decoder == nullptr) {
             RETURN_IF_ERROR(_load_dict_page());
@@ -859,8 +1048,14 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     Slice page_body;
     PageFooterPB footer;
     RETURN_IF_ERROR(_reader->read_page(_opts, iter.page(), &handle, &page_body, &footer));
-    RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, footer.data_page_footer(),
-                               _reader->encoding_info(), iter.page(), iter.page_index()));
+    const EncodingInfo* encoding_info = _reader->encoding_info();
+    const DataPageFooterPB& data_page_footer = footer.data_page_footer();
+    if (data_page_footer.has_encoding() && data_page_footer.encoding() != encoding_info->encoding()) {
+        RETURN_IF_ERROR(
+                EncodingInfo::get(delegate_type(_reader->column_type()), data_page_footer.encoding(), &encoding_info));
+    }
+    RETURN_IF_ERROR(parse_page(&_page, std::move(handle), page_body, data_page_footer, encoding_info, iter.page(),
+                               iter.page_index()));
 
     // dictionary page is read when the first data page that uses it is read,
     // this is to optimize the memory usage: when there is no query on one column, we could
@@ -904,13 +1099,30 @@ Status FileColumnIterator::get_row_ranges_by_bloom_filter(CondColumn* cond_colum
 
 Status FileColumnIterator::get_row_ranges_by_bloom_filter(
         const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
-    RETURN_IF(!_reader->has_bloom_filter_index(), Status::OK());
     bool support = false;
+    bool support_ngram = false;
     for (const auto* pred : predicates) {
         support = support | pred->support_bloom_filter();
+        support_ngram = support_ngram | pred->support_ngram_bloom_filter();
+    }
+    if (support && _reader->has_bloom_filter_index()) {
+        RETURN_IF_ERROR(_reader->bloom_filter(predicates, row_ranges));
+    }
+    if (support_ngram && _reader->has_ngram_bloom_filter_index()) {
+        RETURN_IF_ERROR(_reader->ngram_bloom_filter(predicates, row_ranges));
+    }
+    return Status::OK();
+}
+
+Status FileColumnIterator::get_row_ranges_by_inverted_index(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
+    bool support = false;
+    for (const auto* pred : predicates) {
+        support = support | pred->support_inverted_index();
+    }
+    if (support && _reader->has_inverted_index()) {
+        RETURN_IF_ERROR(_reader->inverted_index_filter(predicates, row_ranges));
     }
-    RETURN_IF(!support, Status::OK());
-    RETURN_IF_ERROR(_reader->bloom_filter(predicates, row_ranges));
     return Status::OK();
 }
 
@@ -931,8 +1143,15 @@ Status FileColumnIterator::decode_dict_codes(const int32_t* codes, size_t size,
 
 template <FieldType Type>
 int FileColumnIterator::_do_dict_lookup(const Slice& word) {
-    auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
-    return dict->find(word);
+    if constexpr (is_binary_dict_type(Type)) {
+        auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
+        return dict->find(word);
+    } else {
+        using CppType = typename CppTypeTraits<Type>::CppType;
+        RETURN_IF(word.size != sizeof(CppType), -1);
+        auto dict = down_cast<PlainPageDecoder<Type>*>(_dict_decoder.get());
+        return dict->find(unaligned_load<CppType>(word.data));
+    }
 }
 
 template <FieldType Type>
@@ -964,25 +1183,39 @@ Status FileColumnIterator::_do_next_dict_codes(size_t* n, vectorized::Column* ds
 
 template <FieldType Type>
 Status FileColumnIterator::_do_decode_dict_codes(const int32_t* codes, size_t size, vectorized::Column* words) {
-    auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
-    std::vector<Slice> slices;
-    slices.reserve(size);
-    for (size_t i = 0; i < size; i++) {
-        if (codes[i] >= 0) {
-            if constexpr (Type != OLAP_FIELD_TYPE_CHAR) {
-                slices.emplace_back(dict->string_at_index(codes[i]));
+    if constexpr (is_binary_dict_type(Type)) {
+        auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
+        std::vector<Slice> slices;
+        slices.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            if (codes[i] >= 0) {
+                if constexpr (Type != OLAP_FIELD_TYPE_CHAR) {
+                    slices.emplace_back(dict->string_at_index(codes[i]));
+                } else {
+                    Slice s = dict->string_at_index(codes[i]);
+                    s.size = strnlen(s.data, s.size);
+                    slices.emplace_back(s);
+                }
             } else {
-                Slice s = dict->string_at_index(codes[i]);
-                s.size = strnlen(s.data, s.size);
-                slices.emplace_back(s);
+                slices.emplace_back("");
+            }
+        }
+        [[maybe_unused]] bool ok = words->append_strings(slices);
+        DCHECK(ok);
+        _opts.stats->bytes_read += words->byte_size() + BitmapSize(slices.size());
+    } else {
+        using CppType = typename CppTypeTraits<Type>::CppType;
+        auto dict = down_cast<PlainPageDecoder<Type>*>(_dict_decoder.get());
+        std::vector<CppType> values(size);
+        for (size_t i = 0; i < size; i++) {
+            if (codes[i] >= 0) {
+                values[i] = dict->value_at(codes[i]);
             }
-        } else {
-            slices.emplace_back("");
         }
+        [[maybe_unused]] size_t n = words->append_numbers(values.data(), size * sizeof(CppType));
+        DCHECK_EQ(size, n);
+        _opts.stats->bytes_read += size * sizeof(CppType) + BitmapSize(size);
     }
-    [[maybe_unused]] bool ok = words->append_strings(slices);
-    DCHECK(ok);
-    _opts.stats->bytes_read += words->byte_size() + BitmapSize(slices.size());
     return Status::OK();
 }
 
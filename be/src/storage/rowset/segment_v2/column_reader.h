@@ -25,6 +25,7 @@
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
 #include <memory>  // for unique_ptr
+#include <set>
 
 #include "column/datum.h"
 #include "column/fixed_length_column.h"
@@ -39,6 +40,7 @@
 #include "storage/rowset/segment_v2/common.h"
 #include "storage/rowset/segment_v2/ordinal_page_index.h" // for OrdinalPageIndexIterator
 #include "storage/rowset/segment_v2/page_handle.h"
+#include "storage/rowset/segment_v2/tokenizer.h"
 #include "storage/rowset/segment_v2/zone_map_index.h"
 #include "storage/vectorized/range.h"
 #include "util/once.h"
@@ -141,6 +143,8 @@ public:
     bool has_zone_map() const { return _zone_map_index_meta != nullptr; }
     bool has_bitmap_index() const { return _bitmap_index_meta != nullptr; }
     bool has_bloom_filter_index() const { return _bf_index_meta != nullptr; }
+    bool has_ngram_bloom_filter_index() const { return _ngram_bf_index_meta != nullptr; }
+    bool has_inverted_index() const { return _inverted_index_meta != nullptr; }
 
     // Check if this column could match `cond' using segment zone map.
     // Since segment zone map is stored in metadata, this function is fast without I/O.
@@ -183,6 +187,15 @@ public:
     Status bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
                         vectorized::SparseRange* ranges);
 
+    // prerequisite: at least one predicate in |predicates| support n-gram bloom filter.
+    Status ngram_bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
+                              vectorized::SparseRange* ranges);
+
+    // prerequisite: at least one predicate in |predicates| support inverted index.
+    // keep the rows of |row_ranges| that may satisfy all the predicates supporting inverted index.
+    Status inverted_index_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
+                                 vectorized::SparseRange* row_ranges);
+
     uint32_t version() const { return _opts.storage_format_version; }
 
     // Read and load necessary column indexes into memory if it hasn't been loaded.
@@ -199,6 +212,8 @@ private:
     Status _load_ordinal_index(bool use_page_cache, bool kept_in_memory);
     Status _load_bitmap_index(bool use_page_cache, bool kept_in_memory);
     Status _load_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
+    Status _load_ngram_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
+    Status _load_inverted_index(bool use_page_cache, bool kept_in_memory);
 
     static bool _zone_map_match_condition(const ZoneMapPB& zone_map, WrapperField* min_value_container,
                                           WrapperField* max_value_container, CondColumn* cond);
@@ -216,6 +231,9 @@ private:
 
     Status _calculate_row_ranges(const std::vector<uint32_t>& page_indexes, vectorized::SparseRange* row_ranges);
 
+    // get the ids of the pages covered by |row_ranges|.
+    void _get_page_ids(const vectorized::SparseRange& row_ranges, std::set<int32_t>* page_ids);
+
     Status _zone_map_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                             const vectorized::ColumnPredicate* del_predicate,
                             std::unordered_set<uint32_t>* del_partial_filtered_pages, std::vector<uint32_t>* pages);
@@ -244,6 +262,8 @@ private:
     const OrdinalIndexPB* _ordinal_index_meta = nullptr;
     const BitmapIndexPB* _bitmap_index_meta = nullptr;
     const BloomFilterIndexPB* _bf_index_meta = nullptr;
+    const BloomFilterIndexPB* _ngram_bf_index_meta = nullptr;
+    const InvertedIndexPB* _inverted_index_meta = nullptr;
 
     // The read operation comprise of compaction, query, checksum and so on.
     // The ordinal index must be loaded before read operation.
@@ -256,6 +276,10 @@ private:
     std::unique_ptr<OrdinalIndexReader> _ordinal_index;
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
+    std::unique_ptr<BloomFilterIndexReader> _ngram_bloom_filter_index;
+    // the postings of the inverted index, and the tokenizer of the values.
+    std::unique_ptr<BitmapIndexReader> _inverted_index;
+    std::unique_ptr<Tokenizer> _tokenizer;
 
     std::vector<std::unique_ptr<ColumnReader>> _sub_readers;
 };
@@ -313,13 +337,18 @@ public:
         return Status::OK();
     }
 
+    virtual Status get_row_ranges_by_inverted_index(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                    vectorized::SparseRange* row_ranges) {
+        return Status::OK();
+    }
+
     // return true iff all data pages of this column are encoded as dictionary encoding.
     // NOTE: the ColumnIterator must have been initialized with `check_dict_encoding`,
     // otherwise this method will always return false.
     virtual bool all_page_dict_encoded() const { return false; }
 
     // return a non-negative dictionary code of |word| if it exist in this segment file,
-    // otherwise -1 is returned.
+    // otherwise -1 is returned. |word| is the bytes of the value for the integer and date types.
     // NOTE: this method can be invoked only if `all_page_dict_encoded` returns true.
     virtual int dict_lookup(const Slice& word) { return -1; }
 
@@ -351,6 +380,17 @@ public:
 
     Status fetch_values_by_rowid(const vectorized::Column& rowids, vectorized::Column* values);
 
+    // return true if `evaluate_predicate` evaluates |pred| on the encoded values of this column.
+    virtual bool support_encoded_predicate(const vectorized::ColumnPredicate* pred) const { return false; }
+
+    // like `next_batch` but instead of return a batch of column values, this method evaluates |pred|
+    // on them without decoding them out when possible, and sets |selection[i]| to 1 if the i-th value
+    // is selected, 0 otherwise. NULL values are never selected.
+    // this method can be invoked only if `support_encoded_predicate` returns true.
+    virtual Status evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n, uint8_t* selection) {
+        return Status::NotSupported("");
+    }
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -394,6 +434,9 @@ public:
     Status get_row_ranges_by_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                                           vectorized::SparseRange* range) override;
 
+    Status get_row_ranges_by_inverted_index(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                            vectorized::SparseRange* range) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     int dict_lookup(const Slice& word) override;
@@ -404,6 +447,10 @@ public:
 
     Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, vectorized::Column* values) override;
 
+    bool support_encoded_predicate(const vectorized::ColumnPredicate* pred) const override;
+
+    Status evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n, uint8_t* selection) override;
+
     ParsedPage* get_current_page() { return _page.get(); }
 
     bool is_nullable() { return _reader->is_nullable(); }
@@ -424,6 +471,9 @@ private:
     template <FieldType Type>
     Status _do_decode_dict_codes(const int32_t* codes, size_t size, vectorized::Column* words);
 
+    template <FieldType Type>
+    Status _init_dict(const ColumnIteratorOptions& opts);
+
     template <FieldType Type>
     Status _do_init_dict_decoder();
 
@@ -475,6 +525,9 @@ private:
     int64_t _element_ordinal = 0;
 
     vectorized::UInt32Column _array_size;
+
+    // the decoded values of the pages that `evaluate_predicate` cannot evaluate on encoded values.
+    vectorized::ColumnPtr _predicate_values;
 };
 
 class ArrayFileColumnIterator final : public ColumnIterator {
@@ -0,0 +1,291 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/column_statistics.h"
+
+#include <cmath>
+
+#include "column/datum_convert.h"
+#include "gutil/strings/substitute.h"
+#include "storage/field.h"
+#include "util/hash_util.hpp"
+#include "util/slice.h"
+#include "util/unaligned_access.h"
+
+namespace starrocks::segment_v2 {
+
+// The sketch is stored as the (index, value) pairs of the registers set if it saves space.
+static constexpr uint8_t kSparseNdvSketch = 0;
+static constexpr uint8_t kDenseNdvSketch = 1;
+static constexpr uint8_t kMaxRegisterValue = 64 - NdvSketch::PRECISION + 1;
+
+static constexpr size_t kSampleSize = 512;
+static constexpr size_t kMaxSampledStringLength = 64;
+
+int64_t NdvSketch::estimate() const {
+    constexpr double m = NUM_REGISTERS;
+    double sum = 0;
+    int num_zeros = 0;
+    for (uint8_t r : _registers) {
+        sum += std::ldexp(1.0, -r);
+        num_zeros += r == 0;
+    }
+    double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+    if (estimate <= 2.5 * m && num_zeros > 0) {
+        // linear counting is more accurate for small cardinalities.
+        estimate = m * std::log(m / num_zeros);
+    }
+    return std::llround(estimate);
+}
+
+void NdvSketch::serialize(std::string* buf) const {
+    int num_set = NUM_REGISTERS - std::count(_registers, _registers + NUM_REGISTERS, 0);
+    buf->clear();
+    if (num_set * 3 < NUM_REGISTERS) {
+        buf->reserve(1 + num_set * 3);
+        buf->push_back(kSparseNdvSketch);
+        for (int i = 0; i < NUM_REGISTERS; i++) {
+            if (_registers[i] != 0) {
+                buf->push_back(static_cast<char>(i & 0xFF));
+                buf->push_back(static_cast<char>(i >> 8));
+                buf->push_back(static_cast<char>(_registers[i]));
+            }
+        }
+    } else {
+        buf->reserve(1 + NUM_REGISTERS);
+        buf->push_back(kDenseNdvSketch);
+        buf->append(reinterpret_cast<const char*>(_registers), NUM_REGISTERS);
+    }
+}
+
+Status NdvSketch::deserialize(const std::string& buf) {
+    clear();
+    const auto* data = reinterpret_cast<const uint8_t*>(buf.data());
+    if (!buf.empty() && data[0] == kDenseNdvSketch && buf.size() == 1 + NUM_REGISTERS) {
+        memcpy(_registers, data + 1, NUM_REGISTERS);
+    } else if (!buf.empty() && data[0] == kSparseNdvSketch && (buf.size() - 1) % 3 == 0) {
+        for (size_t i = 1; i < buf.size(); i += 3) {
+            uint32_t index = data[i] | (data[i + 1] << 8);
+            if (index >= NUM_REGISTERS) {
+                return Status::Corruption(strings::Substitute("bad register index $0 of ndv sketch", index));
+            }
+            _registers[index] = data[i + 2];
+        }
+    } else {
+        return Status::Corruption(strings::Substitute("bad ndv sketch of $0 bytes", buf.size()));
+    }
+    if (*std::max_element(_registers, _registers + NUM_REGISTERS) > kMaxRegisterValue) {
+        return Status::Corruption("bad register value of ndv sketch");
+    }
+    return Status::OK();
+}
+
+bool ColumnStatisticsWriter::is_supported(FieldType type) {
+    switch (type) {
+    case OLAP_FIELD_TYPE_BOOL:
+    case OLAP_FIELD_TYPE_TINYINT:
+    case OLAP_FIELD_TYPE_SMALLINT:
+    case OLAP_FIELD_TYPE_INT:
+    case OLAP_FIELD_TYPE_BIGINT:
+    case OLAP_FIELD_TYPE_LARGEINT:
+    case OLAP_FIELD_TYPE_FLOAT:
+    case OLAP_FIELD_TYPE_DOUBLE:
+    case OLAP_FIELD_TYPE_DATE:
+    case OLAP_FIELD_TYPE_DATE_V2:
+    case OLAP_FIELD_TYPE_DATETIME:
+    case OLAP_FIELD_TYPE_TIMESTAMP:
+    case OLAP_FIELD_TYPE_DECIMAL:
+    case OLAP_FIELD_TYPE_DECIMAL_V2:
+    case OLAP_FIELD_TYPE_DECIMAL32:
+    case OLAP_FIELD_TYPE_DECIMAL64:
+    case OLAP_FIELD_TYPE_DECIMAL128:
+    case OLAP_FIELD_TYPE_CHAR:
+    case OLAP_FIELD_TYPE_VARCHAR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+ColumnStatisticsWriter::ColumnStatisticsWriter(Field* field, uint32_t num_buckets)
+        : _field(field),
+          _num_buckets(std::max<uint32_t>(num_buckets, 1)),
+          _is_slice(field->type() == OLAP_FIELD_TYPE_CHAR || field->type() == OLAP_FIELD_TYPE_VARCHAR),
+          _type_size(field->size()) {}
+
+void ColumnStatisticsWriter::add_values(const void* values, size_t count) {
+    const auto* cell = reinterpret_cast<const uint8_t*>(values);
+    for (size_t i = 0; i < count; i++, cell += _type_size) {
+        uint64_t hash;
+        if (_is_slice) {
+            auto value = unaligned_load<Slice>(cell);
+            hash = HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
+        } else {
+            hash = HashUtil::murmur_hash64A(cell, _type_size, HashUtil::MURMUR_SEED);
+        }
+        _sketch.update(hash);
+        _add_to_sample(cell);
+        _num_values++;
+    }
+}
+
+void ColumnStatisticsWriter::_add_to_sample(const uint8_t* cell) {
+    size_t index = _sample.size();
+    if (index == kSampleSize) {
+        // the value replaces a sampled one with the probability of kSampleSize / (_num_values + 1).
+        _random ^= _random << 13;
+        _random ^= _random >> 7;
+        _random ^= _random << 17;
+        index = _random % (_num_values + 1);
+        if (index >= kSampleSize) {
+            return;
+        }
+        _sample_bytes -= _sample[index].size();
+    } else {
+        _sample.emplace_back();
+    }
+    if (_is_slice) {
+        auto value = unaligned_load<Slice>(cell);
+        _sample[index].assign(value.data, std::min(value.size, kMaxSampledStringLength));
+    } else {
+        _sample[index].assign(reinterpret_cast<const char*>(cell), _type_size);
+    }
+    _sample_bytes += _sample[index].size();
+}
+
+void ColumnStatisticsWriter::finish(ColumnStatisticsPB* statistics) {
+    statistics->set_num_rows(_num_values + _num_nulls);
+    statistics->set_num_nulls(_num_nulls);
+    _sketch.serialize(statistics->mutable_ndv_sketch());
+    if (_sample.empty()) {
+        return;
+    }
+
+    std::vector<Slice> slices;
+    std::vector<const void*> cells;
+    cells.reserve(_sample.size());
+    if (_is_slice) {
+        slices.assign(_sample.begin(), _sample.end());
+        for (const Slice& slice : slices) {
+            cells.push_back(&slice);
+        }
+    } else {
+        for (const std::string& value : _sample) {
+            cells.push_back(value.data());
+        }
+    }
+    const TypeInfoPtr& type_info = _field->type_info();
+    std::sort(cells.begin(), cells.end(),
+              [&type_info](const void* lhs, const void* rhs) { return type_info->cmp(lhs, rhs) < 0; });
+
+    // the bound of each bucket is the last sampled value of its depth, or the last one equal with
+    // it, so that a value is counted in a single bucket.
+    size_t n = cells.size();
+    size_t end = 0;
+    for (uint32_t bucket = 1; bucket <= _num_buckets && end < n; bucket++) {
+        size_t last = std::max(end, (bucket * n + _num_buckets - 1) / _num_buckets - 1);
+        while (last + 1 < n && type_info->cmp(cells[last], cells[last + 1]) == 0) {
+            last++;
+        }
+        end = last + 1;
+        statistics->add_histogram_bounds(_field->to_zone_map_string(static_cast<const char*>(cells[last])));
+        statistics->add_histogram_cumulative_counts(end == n ? _num_values : end * _num_values / n);
+    }
+}
+
+template <typename Container>
+static Status parse_bounds(TypeInfo* type_info, const Container& bounds, std::vector<vectorized::Datum>* datums) {
+    datums->resize(bounds.size());
+    for (size_t i = 0; i < bounds.size(); i++) {
+        RETURN_IF_ERROR(vectorized::datum_from_string(type_info, &(*datums)[i], bounds[i], nullptr));
+    }
+    return Status::OK();
+}
+
+// DECIMAL32/DECIMAL64/DECIMAL128 are stored as INT32/INT64/INT128 in zone maps and histograms.
+ColumnStatistics::ColumnStatistics(FieldType type, uint32_t num_buckets)
+        : _type(type), _type_info(get_type_info(delegate_type(type))), _num_buckets(std::max<uint32_t>(num_buckets, 1)) {}
+
+Status ColumnStatistics::merge(const ColumnStatisticsPB& statistics) {
+    if (statistics.histogram_bounds_size() != statistics.histogram_cumulative_counts_size()) {
+        return Status::Corruption(strings::Substitute("histogram of $0 bounds and $1 counts",
+                                                      statistics.histogram_bounds_size(),
+                                                      statistics.histogram_cumulative_counts_size()));
+    }
+    NdvSketch sketch;
+    if (statistics.has_ndv_sketch()) {
+        RETURN_IF_ERROR(sketch.deserialize(statistics.ndv_sketch()));
+    }
+    std::vector<vectorized::Datum> lhs;
+    std::vector<vectorized::Datum> rhs;
+    RETURN_IF_ERROR(parse_bounds(_type_info.get(), _bounds, &lhs));
+    RETURN_IF_ERROR(parse_bounds(_type_info.get(), statistics.histogram_bounds(), &rhs));
+
+    // The number of values up to each bound of both histograms is the sum of the counts of the
+    // last bounds not greater than it of each one.
+    std::vector<std::pair<std::string, uint64_t>> points;
+    points.reserve(lhs.size() + rhs.size());
+    size_t i = 0;
+    size_t j = 0;
+    while (i < lhs.size() || j < rhs.size()) {
+        int c = i == lhs.size() ? 1 : (j == rhs.size() ? -1 : _type_info->cmp(lhs[i], rhs[j]));
+        const std::string& bound = c <= 0 ? _bounds[i] : statistics.histogram_bounds(j);
+        i += c <= 0;
+        j += c >= 0;
+        uint64_t count = (i > 0 ? _cumulative_counts[i - 1] : 0) +
+                         (j > 0 ? statistics.histogram_cumulative_counts(j - 1) : 0);
+        points.emplace_back(bound, count);
+    }
+
+    // Keep the first bound reaching the depth of each bucket.
+    std::vector<std::string> bounds;
+    std::vector<uint64_t> counts;
+    uint64_t total = points.empty() ? 0 : points.back().second;
+    uint32_t bucket = 1;
+    for (size_t k = 0; k < points.size(); k++) {
+        uint64_t depth = (total * bucket + _num_buckets - 1) / _num_buckets;
+        if (points[k].second < depth && k + 1 < points.size()) {
+            continue;
+        }
+        bounds.emplace_back(std::move(points[k].first));
+        counts.emplace_back(points[k].second);
+        while (bucket < _num_buckets && (total * bucket + _num_buckets - 1) / _num_buckets <= counts.back()) {
+            bucket++;
+        }
+    }
+    _bounds = std::move(bounds);
+    _cumulative_counts = std::move(counts);
+    _num_rows += statistics.num_rows();
+    _num_nulls += statistics.num_nulls();
+    _sketch.merge(sketch);
+    return Status::OK();
+}
+
+double ColumnStatistics::fraction_le(const vectorized::Datum& value) const {
+    std::vector<vectorized::Datum> datums;
+    if (_bounds.empty() || !parse_bounds(_type_info.get(), _bounds, &datums).ok()) {
+        return 0;
+    }
+    auto iter = std::upper_bound(datums.begin(), datums.end(), value,
+                                 [this](const auto& lhs, const auto& rhs) { return _type_info->cmp(lhs, rhs) < 0; });
+    size_t k = iter - datums.begin();
+    if (k == datums.size()) {
+        return 1;
+    }
+    // assume that half of the values of the bucket are not greater than the value.
+    uint64_t lower = k > 0 ? _cumulative_counts[k - 1] : 0;
+    uint64_t upper = _cumulative_counts[k];
+    return (lower + (upper - lower) / 2.0) / _cumulative_counts.back();
+}
+
+void ColumnStatistics::to_pb(ColumnStatisticsPB* statistics) const {
+    statistics->Clear();
+    statistics->set_num_rows(_num_rows);
+    statistics->set_num_nulls(_num_nulls);
+    _sketch.serialize(statistics->mutable_ndv_sketch());
+    for (size_t i = 0; i < _bounds.size(); i++) {
+        statistics->add_histogram_bounds(_bounds[i]);
+        statistics->add_histogram_cumulative_counts(_cumulative_counts[i]);
+    }
+}
+
+} // namespace starrocks::segment_v2
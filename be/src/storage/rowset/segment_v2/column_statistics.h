@@ -0,0 +1,139 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "column/datum.h"
+#include "common/status.h"
+#include "gen_cpp/segment_v2.pb.h"
+#include "storage/olap_common.h"
+#include "storage/types.h"
+
+namespace starrocks {
+
+class Field;
+
+namespace segment_v2 {
+
+// A HyperLogLog sketch of 2^10 one-byte registers, whose standard error is about 3.3%. It is
+// much smaller than the sketch of HLL columns, so that one can be kept for every column in the
+// footer of a segment.
+class NdvSketch {
+public:
+    static constexpr int PRECISION = 10;
+    static constexpr int NUM_REGISTERS = 1 << PRECISION;
+
+    NdvSketch() { clear(); }
+
+    void clear() { memset(_registers, 0, sizeof(_registers)); }
+
+    void update(uint64_t hash) {
+        uint32_t index = hash & (NUM_REGISTERS - 1);
+        uint64_t w = hash >> PRECISION;
+        auto rank = static_cast<uint8_t>(w == 0 ? 64 - PRECISION + 1 : __builtin_ctzll(w) + 1);
+        _registers[index] = std::max(_registers[index], rank);
+    }
+
+    void merge(const NdvSketch& other) {
+        for (int i = 0; i < NUM_REGISTERS; i++) {
+            _registers[i] = std::max(_registers[i], other._registers[i]);
+        }
+    }
+
+    // The estimated number of distinct values added.
+    int64_t estimate() const;
+
+    // The registers are stored as (index, value) pairs if few of them are set, e.g. for a column
+    // of a few distinct values, otherwise as is.
+    void serialize(std::string* buf) const;
+
+    Status deserialize(const std::string& buf);
+
+private:
+    uint8_t _registers[NUM_REGISTERS];
+};
+
+// Build the statistics of the values of a column in a segment, a HyperLogLog sketch of all the
+// values and an equi-depth histogram of a uniform sample of them. Values are added in the same
+// way as to ZoneMapIndexWriter.
+class ColumnStatisticsWriter {
+public:
+    // Whether the statistics of a column of |type| can be collected.
+    static bool is_supported(FieldType type);
+
+    ColumnStatisticsWriter(Field* field, uint32_t num_buckets);
+
+    void add_values(const void* values, size_t count);
+
+    void add_nulls(uint32_t count) { _num_nulls += count; }
+
+    void finish(ColumnStatisticsPB* statistics);
+
+    uint64_t size() const { return sizeof(ColumnStatisticsWriter) + _sample_bytes; }
+
+private:
+    void _add_to_sample(const uint8_t* cell);
+
+    Field* _field;
+    uint32_t _num_buckets;
+    bool _is_slice;
+    size_t _type_size;
+
+    uint64_t _num_values = 0;
+    uint64_t _num_nulls = 0;
+    NdvSketch _sketch;
+
+    // A reservoir sample of the non-null values, chosen by a fixed seeded generator so that the
+    // same values produce the same statistics. Values of fixed length types are kept as their
+    // bytes, and strings as their prefixes, which keep the order of the strings.
+    std::vector<std::string> _sample;
+    uint64_t _sample_bytes = 0;
+    uint64_t _random = 0x9E3779B97F4A7C15ULL;
+};
+
+// The statistics of the values of a column in one or more segments, merged from their
+// ColumnStatisticsPB. Used to estimate the number of distinct values and the selectivity
+// of range predicates of a column, e.g. to choose the build side of a join.
+class ColumnStatistics {
+public:
+    // |type| is the type of the column in the segments, see ColumnMetaPB::type.
+    ColumnStatistics(FieldType type, uint32_t num_buckets);
+
+    FieldType type() const { return _type; }
+
+    // Merge the statistics of the column in another segment into this one.
+    Status merge(const ColumnStatisticsPB& statistics);
+
+    uint64_t num_rows() const { return _num_rows; }
+
+    uint64_t num_nulls() const { return _num_nulls; }
+
+    // The estimated number of distinct non-null values.
+    int64_t ndv() const { return _sketch.estimate(); }
+
+    // The estimated fraction of the non-null values less than or equal with |value|, a value of
+    // the delegate type of the column, as the values of zone maps.
+    double fraction_le(const vectorized::Datum& value) const;
+
+    void to_pb(ColumnStatisticsPB* statistics) const;
+
+private:
+    FieldType _type;
+    TypeInfoPtr _type_info;
+    uint32_t _num_buckets;
+
+    uint64_t _num_rows = 0;
+    uint64_t _num_nulls = 0;
+    NdvSketch _sketch;
+    // the histogram of the merged values, whose bounds are parsed when used.
+    std::vector<std::string> _bounds;
+    std::vector<uint64_t> _cumulative_counts;
+};
+
+} // namespace segment_v2
+} // namespace starrocks
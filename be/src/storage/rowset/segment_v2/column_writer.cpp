@@ -21,13 +21,16 @@
 
 #include "storage/rowset/segment_v2/column_writer.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <limits>
 #include <memory>
 
 #include "column/array_column.h"
 #include "column/column_helper.h"
 #include "column/hash_set.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "env/env.h"
 #include "gutil/strings/substitute.h"
@@ -37,12 +40,16 @@
 #include "storage/rowset/segment_v2/bitshuffle_page.h"
 #include "storage/rowset/segment_v2/bloom_filter.h"
 #include "storage/rowset/segment_v2/bloom_filter_index_writer.h"
+#include "storage/rowset/segment_v2/column_statistics.h"
+#include "storage/rowset/segment_v2/decimal_scaling_page.h"
 #include "storage/rowset/segment_v2/encoding_info.h"
 #include "storage/rowset/segment_v2/options.h"
 #include "storage/rowset/segment_v2/ordinal_page_index.h"
 #include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
 #include "storage/rowset/segment_v2/page_io.h"
 #include "storage/rowset/segment_v2/zone_map_index.h"
+#include "storage/vectorized/chunk_helper.h"
 #include "util/block_compression.h"
 #include "util/faststring.h"
 #include "util/rle_encoding.h"
@@ -167,12 +174,16 @@ private:
     faststring _encode_buf;
 };
 
-class StringColumnWriter final : public ColumnWriter {
+// SpeculativeColumnWriter chooses between dictionary encoding and the default encoding of
+// char/varchar and integer/date columns by the cardinality of their first rows. The integer/date
+// columns whose first rows are mostly ascending use frame-of-reference encoding instead, and the
+// float/double columns whose first rows have few decimal digits use decimal scaling encoding.
+class SpeculativeColumnWriter final : public ColumnWriter {
 public:
-    StringColumnWriter(const ColumnWriterOptions& opts, std::unique_ptr<Field> field,
-                       std::unique_ptr<ScalarColumnWriter> column_writer);
+    SpeculativeColumnWriter(const ColumnWriterOptions& opts, std::unique_ptr<Field> field,
+                            std::unique_ptr<ScalarColumnWriter> column_writer);
 
-    ~StringColumnWriter() override = default;
+    ~SpeculativeColumnWriter() override = default;
 
     Status init() override { return _scalar_column_writer->init(); };
 
@@ -193,12 +204,19 @@ public:
         return append(p, &is_null, 1, is_null);
     }
 
-    // Speculate char/varchar encoding and reset encoding
+    // Speculate the encoding of the first rows and reset encoding
     void speculate_column_and_set_encoding(const vectorized::Column& column);
 
     // Speculate char/varchar encoding
     EncodingTypePB speculate_string_encoding(const vectorized::BinaryColumn& bin_col);
 
+    // Speculate integer/date encoding
+    EncodingTypePB speculate_fixed_length_encoding(const vectorized::Column& data_col);
+
+    // Speculate float/double encoding
+    template <typename T>
+    EncodingTypePB speculate_float_encoding(const vectorized::Column& data_col);
+
     Status finish_current_page() override { return _scalar_column_writer->finish_current_page(); };
 
     uint64_t estimate_buffer_size() override { return _scalar_column_writer->estimate_buffer_size(); };
@@ -220,16 +238,30 @@ private:
     vectorized::ColumnPtr _buf_column = nullptr;
 };
 
+// The integer and date types that may be dictionary encoded by DictPageBuilder or delta encoded
+// by FrameOfReferencePageBuilder, and the float types that may be encoded by DecimalScalingPageBuilder.
+static bool use_speculative_fixed_length_encoding(FieldType type) {
+    if (type == OLAP_FIELD_TYPE_FLOAT || type == OLAP_FIELD_TYPE_DOUBLE) {
+        return config::enable_decimal_scaling_encoding_for_float_column;
+    }
+    if (config::dictionary_encoding_ratio_for_non_string_column <= 0 &&
+        !config::enable_delta_encoding_for_ascending_column) {
+        return false;
+    }
+    return type == OLAP_FIELD_TYPE_INT || type == OLAP_FIELD_TYPE_BIGINT || type == OLAP_FIELD_TYPE_DATE_V2 ||
+           type == OLAP_FIELD_TYPE_TIMESTAMP;
+}
+
 Status ColumnWriter::create(const ColumnWriterOptions& opts, const TabletColumn* column, fs::WritableBlock* _wblock,
                             std::unique_ptr<ColumnWriter>* writer) {
     std::unique_ptr<Field> field(FieldFactory::create(*column));
     DCHECK(field.get() != nullptr);
-    if (is_string_type(delegate_type(column->type()))) {
+    if (is_string_type(delegate_type(column->type())) || use_speculative_fixed_length_encoding(column->type())) {
         std::unique_ptr<Field> field_clone(FieldFactory::create(*column));
         ColumnWriterOptions str_opts = opts;
         str_opts.need_speculate_encoding = true;
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, std::move(field_clone), _wblock);
-        *writer = std::make_unique<StringColumnWriter>(str_opts, std::move(field), std::move(column_writer));
+        *writer = std::make_unique<SpeculativeColumnWriter>(str_opts, std::move(field), std::move(column_writer));
         return Status::OK();
     } else if (is_scalar_type(delegate_type(column->type()))) {
         std::unique_ptr<ColumnWriter> writer_local =
@@ -356,6 +388,21 @@ Status ScalarColumnWriter::init() {
         RETURN_IF_ERROR(BloomFilterIndexWriter::create(BloomFilterOptions(), get_field()->type_info(),
                                                        &_bloom_filter_index_builder));
     }
+    if (_opts.ngram_bf_gram_size > 0) {
+        _has_index_builder = true;
+        RETURN_IF_ERROR(BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), get_field()->type_info(),
+                                                             _opts.ngram_bf_gram_size, &_ngram_bf_index_builder));
+    }
+    if (_opts.inverted_index_tokenizer != UNKNOWN_TOKENIZER) {
+        _has_index_builder = true;
+        RETURN_IF_ERROR(BitmapIndexWriter::create_inverted(get_field()->type_info(), _opts.inverted_index_tokenizer,
+                                                           &_inverted_index_builder));
+    }
+    if (_opts.need_statistics) {
+        _has_index_builder = true;
+        _statistics_builder = std::make_unique<ColumnStatisticsWriter>(
+                get_field(), config::segment_column_statistics_histogram_buckets);
+    }
     return Status::OK();
 }
 
@@ -379,12 +426,30 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_bloom_filter_index_builder != nullptr) {
         size += _bloom_filter_index_builder->size();
     }
+    if (_ngram_bf_index_builder != nullptr) {
+        size += _ngram_bf_index_builder->size();
+    }
+    if (_inverted_index_builder != nullptr) {
+        size += _inverted_index_builder->size();
+    }
+    if (_statistics_builder != nullptr) {
+        size += _statistics_builder->size();
+    }
     return size;
 }
 
 Status ScalarColumnWriter::finish() {
     RETURN_IF_ERROR(finish_current_page());
     _opts.meta->set_num_rows(_next_rowid);
+    if (_num_sampled_pages > 0) {
+        // The sampled pages record their encodings and compressions only in their footers, which
+        // the older versions ignore, so mark the column by an encoding they fail to read.
+        _opts.meta->set_data_page_encoding(_encoding_info->encoding());
+        _opts.meta->set_encoding(PER_PAGE_ENCODING);
+    }
+    if (_statistics_builder != nullptr) {
+        _statistics_builder->finish(_opts.meta->mutable_statistics());
+    }
     return Status::OK();
 }
 
@@ -438,6 +503,8 @@ inline Status ScalarColumnWriter::set_encoding(const EncodingTypePB& encoding) {
     // because the default encoding of a data type can be changed in the future
     DCHECK_NE(_opts.meta->encoding(), DEFAULT_ENCODING);
     _page_builder.reset(page_builder);
+    _sample_encodings = encoding == DEFAULT_ENCODING && config::adaptive_encoding_sample_pages > 0 &&
+                        _num_sampled_pages == 0 && _can_sample_encodings();
     return Status::OK();
 }
 
@@ -454,14 +521,20 @@ Status ScalarColumnWriter::write_zone_map() {
 
 Status ScalarColumnWriter::write_bitmap_index() {
     if (_bitmap_index_builder != nullptr) {
-        return _bitmap_index_builder->finish(_wblock, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bitmap_index_builder->finish(_wblock, _opts.meta->add_indexes()));
+    }
+    if (_inverted_index_builder != nullptr) {
+        RETURN_IF_ERROR(_inverted_index_builder->finish(_wblock, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
 
 Status ScalarColumnWriter::write_bloom_filter_index() {
     if (_bloom_filter_index_builder != nullptr) {
-        return _bloom_filter_index_builder->finish(_wblock, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_bloom_filter_index_builder->finish(_wblock, _opts.meta->add_indexes()));
+    }
+    if (_ngram_bf_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bf_index_builder->finish(_wblock, _opts.meta->add_indexes()));
     }
     return Status::OK();
 }
@@ -487,9 +560,21 @@ Status ScalarColumnWriter::finish_current_page() {
         RETURN_IF_ERROR(_bloom_filter_index_builder->flush());
     }
 
+    if (_ngram_bf_index_builder != nullptr) {
+        RETURN_IF_ERROR(_ngram_bf_index_builder->flush());
+    }
+
     // build data page body : encoded values + [nullmap]
     std::vector<Slice> body;
     faststring* encoded_values = _page_builder->finish();
+    const BlockCompressionCodec* compress_codec = _compress_codec;
+    EncodingTypePB page_encoding = _encoding_info->encoding();
+    CompressionTypePB page_compression = _opts.meta->compression();
+    bool sampled = _sample_encodings && _num_sampled_pages < config::adaptive_encoding_sample_pages;
+    if (sampled) {
+        RETURN_IF_ERROR(_encode_sampled_page(&encoded_values, &page_encoding, &page_compression));
+        RETURN_IF_ERROR(get_block_compression_codec(page_compression, &compress_codec));
+    }
     body.push_back(Slice(*encoded_values));
 
     OwnedSlice nullmap;
@@ -517,10 +602,14 @@ Status ScalarColumnWriter::finish_current_page() {
     data_page_footer->set_nullmap_size(nullmap.slice().size);
     data_page_footer->set_format_version(_curr_page_format);
     data_page_footer->set_corresponding_element_ordinal(_element_ordinal);
+    if (sampled) {
+        // the encoding of the column may change after sampling.
+        data_page_footer->set_encoding(page_encoding);
+    }
     // trying to compress page body
     faststring compressed_body;
     RETURN_IF_ERROR(
-            PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+            PageIO::compress_page_body(compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
     if (compressed_body.size() == 0) {
         // page body is uncompressed
         page->data.emplace_back(encoded_values->build());
@@ -530,6 +619,9 @@ Status ScalarColumnWriter::finish_current_page() {
         encoded_values->swap(compressed_body);
     } else {
         // page body is compressed
+        if (sampled) {
+            page->footer.set_compression(page_compression);
+        }
         page->data.emplace_back(compressed_body.build());
     }
 
@@ -549,6 +641,120 @@ Status ScalarColumnWriter::finish_current_page() {
     _page_builder->reset();
     _first_rowid = _next_rowid;
 
+    if (sampled && _num_sampled_pages == config::adaptive_encoding_sample_pages) {
+        RETURN_IF_ERROR(_choose_sampled_encoding());
+    }
+    return Status::OK();
+}
+
+bool ScalarColumnWriter::_can_sample_encodings() const {
+    // The values of the other types, e.g. strings and decimal v2, are not stored as they are in memory.
+    auto column = vectorized::ChunkHelper::column_from_field_type(delegate_type(get_field()->type()), false);
+    return column != nullptr && !column->is_binary() && !column->is_object() &&
+           column->type_size() == get_field()->size();
+}
+
+// Compressed size of the page, ZSTD is weighted by adaptive_encoding_zstd_min_space_saving for its slower
+// decompression. The decoding of the encodings is not timed, it is noisy while loading and would make the
+// chosen encoding differ from run to run.
+static uint64_t weighted_page_size(CompressionTypePB compression, uint64_t size) {
+    if (compression != ZSTD) {
+        return size;
+    }
+    return static_cast<uint64_t>(size / std::max(1 - config::adaptive_encoding_zstd_min_space_saving, 0.01));
+}
+
+Status ScalarColumnWriter::_encode_sampled_page(faststring** encoded_values, EncodingTypePB* encoding,
+                                                CompressionTypePB* compression) {
+    PageDecoder* decoder_ptr = nullptr;
+    RETURN_IF_ERROR(_encoding_info->create_page_decoder(Slice(**encoded_values), PageDecoderOptions(), &decoder_ptr));
+    std::unique_ptr<PageDecoder> decoder(decoder_ptr);
+    RETURN_IF_ERROR(decoder->init());
+    size_t num_values = decoder->count();
+    if (num_values == 0) {
+        return Status::OK();
+    }
+    auto values = vectorized::ChunkHelper::column_from_field_type(delegate_type(get_field()->type()), false);
+    size_t n = num_values;
+    RETURN_IF_ERROR(decoder->next_batch(&n, values.get()));
+    DCHECK_EQ(num_values, n);
+
+    std::vector<CompressionTypePB> compressions{_opts.meta->compression()};
+    if (_opts.meta->compression() != ZSTD) {
+        compressions.emplace_back(ZSTD);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = _opts.data_page_size;
+    faststring* page_values = *encoded_values;
+    uint64_t best_size = std::numeric_limits<uint64_t>::max();
+    for (const EncodingInfo* encoding_info : EncodingInfo::get_all(get_field()->type())) {
+        // dictionary encoding needs the dictionary of the whole column.
+        if (encoding_info->encoding() == DICT_ENCODING) {
+            continue;
+        }
+        faststring* data = page_values;
+        std::unique_ptr<PageBuilder> builder;
+        if (encoding_info != _encoding_info) {
+            PageBuilder* builder_ptr = nullptr;
+            RETURN_IF_ERROR(encoding_info->create_page_builder(builder_options, &builder_ptr));
+            builder.reset(builder_ptr);
+            // the page is full before all the values are added, e.g. PLAIN of the values larger than a page.
+            if (builder == nullptr || builder->add(values->raw_data(), num_values) < num_values) {
+                continue;
+            }
+            data = builder->finish();
+        }
+        for (CompressionTypePB compression_type : compressions) {
+            const BlockCompressionCodec* codec = nullptr;
+            RETURN_IF_ERROR(get_block_compression_codec(compression_type, &codec));
+            RETURN_IF_ERROR(PageIO::compress_page_body(codec, _opts.compression_min_space_saving, {Slice(*data)},
+                                                       &_sampled_compressed_values));
+            size_t size = _sampled_compressed_values.size() > 0 ? _sampled_compressed_values.size() : data->size();
+            uint64_t weighted_size = weighted_page_size(compression_type, size);
+            auto& sampled_size = _sampled_sizes[{encoding_info->encoding(), compression_type}];
+            sampled_size.first += weighted_size;
+            sampled_size.second++;
+            if (weighted_size < best_size) {
+                best_size = weighted_size;
+                *encoding = encoding_info->encoding();
+                *compression = compression_type;
+                if (data == page_values) {
+                    *encoded_values = page_values;
+                } else {
+                    _sampled_values.assign_copy(data->data(), data->size());
+                    *encoded_values = &_sampled_values;
+                }
+            }
+        }
+    }
+    _num_sampled_pages++;
+    return Status::OK();
+}
+
+Status ScalarColumnWriter::_choose_sampled_encoding() {
+    // only the combinations that encoded all the sampled pages are comparable, the current encoding
+    // and compression of the column are always among them.
+    auto best = _sampled_sizes.end();
+    for (auto it = _sampled_sizes.begin(); it != _sampled_sizes.end(); ++it) {
+        if (it->second.second < _num_sampled_pages) {
+            continue;
+        }
+        if (best == _sampled_sizes.end() || it->second.first < best->second.first) {
+            best = it;
+        }
+    }
+    DCHECK(best != _sampled_sizes.end());
+    if (best != _sampled_sizes.end()) {
+        RETURN_IF_ERROR(set_encoding(best->first.first));
+        _opts.meta->set_compression(best->first.second);
+        RETURN_IF_ERROR(get_block_compression_codec(best->first.second, &_compress_codec));
+    }
+    _sample_encodings = false;
+    _sampled_sizes.clear();
+    _sampled_values.clear();
+    _sampled_values.shrink_to_fit();
+    _sampled_compressed_values.clear();
+    _sampled_compressed_values.shrink_to_fit();
     return Status::OK();
 }
 
@@ -675,10 +881,16 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
+                    INDEX_ADD_NULLS(_ngram_bf_index_builder, run);
+                    INDEX_ADD_NULLS(_inverted_index_builder, run);
+                    INDEX_ADD_NULLS(_statistics_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ngram_bf_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_statistics_builder, pdata, run);
                 }
                 pdata += get_field()->size() * run;
             }
@@ -686,6 +898,9 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ngram_bf_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_statistics_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -823,11 +1038,11 @@ Status ArrayColumnWriter::finish_current_page() {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-StringColumnWriter::StringColumnWriter(const ColumnWriterOptions& opts, std::unique_ptr<Field> field,
-                                       std::unique_ptr<ScalarColumnWriter> column_writer)
+SpeculativeColumnWriter::SpeculativeColumnWriter(const ColumnWriterOptions& opts, std::unique_ptr<Field> field,
+                                                 std::unique_ptr<ScalarColumnWriter> column_writer)
         : ColumnWriter(std::move(field), opts.meta->is_nullable()), _scalar_column_writer(std::move(column_writer)) {}
 
-Status StringColumnWriter::append(const vectorized::Column& column) {
+Status SpeculativeColumnWriter::append(const vectorized::Column& column) {
     if (_is_speculated) {
         return _scalar_column_writer->append(column);
     }
@@ -856,20 +1071,24 @@ Status StringColumnWriter::append(const vectorized::Column& column) {
     }
 }
 
-inline void StringColumnWriter::speculate_column_and_set_encoding(const vectorized::Column& column) {
+inline void SpeculativeColumnWriter::speculate_column_and_set_encoding(const vectorized::Column& column) {
+    const vectorized::Column* data_col = &column;
     if (column.is_nullable()) {
-        const auto& data_col = down_cast<const vectorized::NullableColumn&>(column).data_column();
-        const auto& bin_col = down_cast<vectorized::BinaryColumn&>(*data_col);
-        const auto detect_encoding = speculate_string_encoding(bin_col);
-        _scalar_column_writer->set_encoding(detect_encoding);
-    } else if (column.is_binary()) {
-        const auto& bin_col = down_cast<const vectorized::BinaryColumn&>(column);
-        auto detect_encoding = speculate_string_encoding(bin_col);
-        _scalar_column_writer->set_encoding(detect_encoding);
+        data_col = down_cast<const vectorized::NullableColumn&>(column).data_column().get();
+    }
+    if (data_col->is_binary()) {
+        const auto& bin_col = down_cast<const vectorized::BinaryColumn&>(*data_col);
+        _scalar_column_writer->set_encoding(speculate_string_encoding(bin_col));
+    } else if (get_field()->type() == OLAP_FIELD_TYPE_FLOAT) {
+        _scalar_column_writer->set_encoding(speculate_float_encoding<float>(*data_col));
+    } else if (get_field()->type() == OLAP_FIELD_TYPE_DOUBLE) {
+        _scalar_column_writer->set_encoding(speculate_float_encoding<double>(*data_col));
+    } else {
+        _scalar_column_writer->set_encoding(speculate_fixed_length_encoding(*data_col));
     }
 }
 
-inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const vectorized::BinaryColumn& bin_col) {
+inline EncodingTypePB SpeculativeColumnWriter::speculate_string_encoding(const vectorized::BinaryColumn& bin_col) {
     auto row_count = bin_col.size();
     auto ratio = config::dictionary_encoding_ratio;
     auto max_card = static_cast<size_t>(static_cast<double>(row_count) * ratio);
@@ -878,13 +1097,63 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const vector
         size_t hash = vectorized::SliceHash()(bin_col.get_slice(i));
         hash_set.insert(hash);
         if (hash_set.size() > max_card) {
-            return PLAIN_ENCODING;
+            return config::enable_fsst_encoding_for_string_column ? FSST_ENCODING : PLAIN_ENCODING;
         }
     }
     return DICT_ENCODING;
 }
 
-Status StringColumnWriter::finish() {
+template <typename T>
+static size_t count_distinct_values(const vectorized::Column& data_col, size_t max_card) {
+    const auto* values = reinterpret_cast<const T*>(data_col.raw_data());
+    phmap::flat_hash_set<T> hash_set;
+    for (size_t i = 0; i < data_col.size() && hash_set.size() <= max_card; i++) {
+        hash_set.insert(values[i]);
+    }
+    return hash_set.size();
+}
+
+// Return true if at least 90% of the consecutive values are non-decreasing.
+template <typename T>
+static bool is_mostly_ascending(const vectorized::Column& data_col) {
+    const auto* values = reinterpret_cast<const T*>(data_col.raw_data());
+    size_t num_descending = 0;
+    for (size_t i = 1; i < data_col.size(); i++) {
+        num_descending += values[i] < values[i - 1];
+    }
+    return num_descending * 10 <= data_col.size();
+}
+
+inline EncodingTypePB SpeculativeColumnWriter::speculate_fixed_length_encoding(const vectorized::Column& data_col) {
+    bool is_int32 = data_col.type_size() == sizeof(int32_t);
+    auto ratio = config::dictionary_encoding_ratio_for_non_string_column;
+    if (ratio > 0) {
+        auto max_card = static_cast<size_t>(static_cast<double>(data_col.size()) * ratio);
+        size_t num_distinct = is_int32 ? count_distinct_values<int32_t>(data_col, max_card)
+                                       : count_distinct_values<int64_t>(data_col, max_card);
+        if (num_distinct <= max_card) {
+            return DICT_ENCODING;
+        }
+    }
+    if (config::enable_delta_encoding_for_ascending_column) {
+        bool ascending = is_int32 ? is_mostly_ascending<int32_t>(data_col) : is_mostly_ascending<int64_t>(data_col);
+        if (ascending) {
+            return FOR_DELTA_ENCODING;
+        }
+    }
+    return DEFAULT_ENCODING;
+}
+
+template <typename T>
+inline EncodingTypePB SpeculativeColumnWriter::speculate_float_encoding(const vectorized::Column& data_col) {
+    const auto* values = reinterpret_cast<const T*>(data_col.raw_data());
+    if (DecimalScaling<T>::find_exponent(values, data_col.size()) >= 0) {
+        return DECIMAL_SCALING;
+    }
+    return DEFAULT_ENCODING;
+}
+
+Status SpeculativeColumnWriter::finish() {
     if (_is_speculated) {
         return _scalar_column_writer->finish();
     }
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory> // for unique_ptr
 
 #include "common/status.h"         // for Status
@@ -31,6 +32,7 @@
 #include "storage/rowset/segment_v2/page_pointer.h" // for PagePointer
 #include "storage/tablet_schema.h"                  // for TabletColumn
 #include "util/bitmap.h"                            // for BitmapChange
+#include "util/faststring.h"
 #include "util/slice.h"                             // for OwnedSlice
 
 namespace starrocks {
@@ -44,7 +46,6 @@ class WritableBlock;
 
 namespace vectorized {
 class Column;
-class BinaryColumn;
 } // namespace vectorized
 
 namespace segment_v2 {
@@ -62,6 +63,12 @@ struct ColumnWriterOptions {
     bool need_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
+    // build an n-gram bloom filter index of grams of this many bytes if it's positive.
+    uint32_t ngram_bf_gram_size = 0;
+    // build an inverted index of the tokens split by this tokenizer if it's known.
+    TokenizerTypePB inverted_index_tokenizer = UNKNOWN_TOKENIZER;
+    // write the statistics of the values into the column meta.
+    bool need_statistics = false;
     bool adaptive_page_format = false;
     // for char/varchar will speculate encoding in append
     // for others will decide encoding in init method
@@ -75,6 +82,7 @@ class NullMapBitshuffleBuilder;
 class OrdinalIndexWriter;
 class PageBuilder;
 class BloomFilterIndexWriter;
+class ColumnStatisticsWriter;
 class ZoneMapIndexWriter;
 
 class ColumnWriter {
@@ -204,6 +212,10 @@ private:
 
     Status _write_data_page(Page* page);
 
+    bool _can_sample_encodings() const;
+    Status _encode_sampled_page(faststring** encoded_values, EncodingTypePB* encoding, CompressionTypePB* compression);
+    Status _choose_sampled_encoding();
+
     ColumnWriterOptions _opts;
     fs::WritableBlock* _wblock;
     uint32_t _curr_page_format;
@@ -220,6 +232,17 @@ private:
 
     std::unique_ptr<PageBuilder> _page_builder;
 
+    // The first config::adaptive_encoding_sample_pages data pages of a column with the default
+    // encoding are encoded by all the encodings and compressions, each page is written with its
+    // smallest combination, and the rest pages with the smallest combination of all the sampled pages.
+    bool _sample_encodings = false;
+    int32_t _num_sampled_pages = 0;
+    // total compressed size and number of the sampled pages of each combination of encoding and
+    // compression, a combination may fail to encode some pages, e.g. PLAIN of the values larger than a page.
+    std::map<std::pair<EncodingTypePB, CompressionTypePB>, std::pair<uint64_t, int32_t>> _sampled_sizes;
+    faststring _sampled_values;
+    faststring _sampled_compressed_values;
+
     // Used when _opts.page_format == 1, using Run-Length encoding to build the null map.
     std::unique_ptr<NullMapRLEBuilder> _null_map_builder_v1;
 
@@ -230,7 +253,10 @@ private:
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
-    // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL
+    std::unique_ptr<BloomFilterIndexWriter> _ngram_bf_index_builder;
+    std::unique_ptr<BitmapIndexWriter> _inverted_index_builder;
+    std::unique_ptr<ColumnStatisticsWriter> _statistics_builder;
+    // any of the index builders above except the ordinal index builder is not NULL
     bool _has_index_builder = false;
     int64_t _element_ordinal = 0;
     int64_t _previous_ordinal = 0;
@@ -0,0 +1,300 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "column/column.h"
+#include "gen_cpp/segment_v2.pb.h"
+#include "gutil/strings/substitute.h"
+#include "storage/column_block.h"
+#include "storage/rowset/segment_v2/bitshuffle_page.h"
+#include "storage/rowset/segment_v2/options.h"
+#include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/types.h"
+#include "util/coding.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace starrocks {
+namespace segment_v2 {
+
+enum { DECIMAL_SCALING_PAGE_HEADER_SIZE = 8 };
+
+// DecimalScaling losslessly maps the float/double values with few decimal digits, e.g. the
+// readings of sensors and prices, to integers: value = integer / 10^exponent.
+template <typename CppType>
+class DecimalScaling {
+public:
+    // Largest exponent find_exponent() tries, it only bounds the search. The bound encode() enforces on
+    // each value is that the scaled integer is below 2^53 in magnitude, so it converts to and from a double
+    // exactly, and that it decodes back to the same bits. Every power of 10 up to 10^22 is exact in a
+    // double, so decode() divides by an exact POWERS_OF_10 for all the exponents up to this one.
+    static constexpr int MAX_EXPONENT = 18;
+
+    static CppType decode(int64_t integer, int exponent) {
+        return static_cast<CppType>(static_cast<double>(integer) / POWERS_OF_10[exponent]);
+    }
+
+    // Return true if `value` is decoded back bit by bit from `*integer` with `exponent`.
+    static bool encode(CppType value, int exponent, int64_t* integer) {
+        double scaled = std::round(static_cast<double>(value) * POWERS_OF_10[exponent]);
+        // false for NaN and infinity as well.
+        if (!(std::fabs(scaled) < MAX_EXACT_INTEGER)) {
+            return false;
+        }
+        *integer = static_cast<int64_t>(scaled);
+        CppType decoded = decode(*integer, exponent);
+        return memcmp(&decoded, &value, sizeof(CppType)) == 0;
+    }
+
+    // Return the smallest exponent that encodes all the values, -1 if there is none.
+    static int find_exponent(const CppType* values, size_t count) {
+        int exponent = 0;
+        int64_t integer;
+        for (size_t i = 0; i < count; i++) {
+            while (!encode(values[i], exponent, &integer)) {
+                if (++exponent > MAX_EXPONENT) {
+                    return -1;
+                }
+            }
+        }
+        // The values before the last increment are checked with smaller exponents.
+        for (size_t i = 0; i < count; i++) {
+            if (!encode(values[i], exponent, &integer)) {
+                return -1;
+            }
+        }
+        return exponent;
+    }
+
+private:
+    static constexpr double MAX_EXACT_INTEGER = 9007199254740992.0; // 2^53
+    static constexpr double POWERS_OF_10[MAX_EXPONENT + 1] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                                              1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                                              1e14, 1e15, 1e16, 1e17, 1e18};
+};
+
+// DecimalScalingPageBuilder encodes the float/double values of a page by DecimalScaling, the
+// integers are encoded by frame-of-reference coding, which stores small integers and regular
+// deltas in a few bits.
+//
+// Layout of the page:
+// Either header + frame-of-reference encoded integers, when the encoding type is DECIMAL_SCALING.
+// Or     header + embedded bitshuffle page of the values, when the encoding type is BIT_SHUFFLE.
+// The header is the 32-bit encoding type followed by the 32-bit exponent. A page falls back to
+// bitshuffle, the default encoding of these types, if any of its values cannot be scaled, e.g.
+// NaN or values with too many significant digits.
+template <FieldType Type>
+class DecimalScalingPageBuilder final : public PageBuilder {
+public:
+    explicit DecimalScalingPageBuilder(const PageBuilderOptions& options)
+            : _options(options), _max_count(options.data_page_size / sizeof(CppType)) {
+        reset();
+    }
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        DCHECK(!_finished);
+        size_t to_add = std::min<size_t>(_max_count - _values.size(), count);
+        size_t old_size = _values.size();
+        _values.resize(old_size + to_add);
+        memcpy(_values.data() + old_size, vals, to_add * sizeof(CppType));
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        int exponent = DecimalScaling<CppType>::find_exponent(_values.data(), _values.size());
+        if (exponent < 0) {
+            return _finish_bitshuffle_page();
+        }
+        std::vector<int64_t> integers(_values.size());
+        for (size_t i = 0; i < _values.size(); i++) {
+            DecimalScaling<CppType>::encode(_values[i], exponent, &integers[i]);
+        }
+        _buffer.clear();
+        _buffer.resize(DECIMAL_SCALING_PAGE_HEADER_SIZE);
+        encode_fixed32_le(_buffer.data(), DECIMAL_SCALING);
+        encode_fixed32_le(_buffer.data() + 4, exponent);
+        // the readers of DECIMAL_SCALING pages read the delta-of-delta frames as well.
+        ForEncoder<int64_t> encoder(&_buffer, true);
+        encoder.put_batch(integers.data(), integers.size());
+        encoder.flush();
+        return &_buffer;
+    }
+
+    void reset() override {
+        _values.clear();
+        _values.reserve(_max_count);
+        _finished = false;
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    faststring* _finish_bitshuffle_page() {
+        if (_bitshuffle_builder == nullptr) {
+            _bitshuffle_builder = std::make_unique<BitshufflePageBuilder<Type>>(_options);
+            _bitshuffle_builder->reserve_head(DECIMAL_SCALING_PAGE_HEADER_SIZE);
+        } else {
+            _bitshuffle_builder->reset();
+        }
+        [[maybe_unused]] size_t added =
+                _bitshuffle_builder->add(reinterpret_cast<const uint8_t*>(_values.data()), _values.size());
+        DCHECK_EQ(_values.size(), added);
+        faststring* data = _bitshuffle_builder->finish();
+        encode_fixed32_le(data->data(), BIT_SHUFFLE);
+        encode_fixed32_le(data->data() + 4, 0);
+        return data;
+    }
+
+    PageBuilderOptions _options;
+    const size_t _max_count;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buffer;
+    std::unique_ptr<BitshufflePageBuilder<Type>> _bitshuffle_builder;
+};
+
+template <FieldType Type>
+class DecimalScalingPageDecoder final : public PageDecoder {
+public:
+    DecimalScalingPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < DECIMAL_SCALING_PAGE_HEADER_SIZE) {
+            return Status::Corruption(strings::Substitute("invalid data size:$0, header size:$1", _data.size,
+                                                          DECIMAL_SCALING_PAGE_HEADER_SIZE));
+        }
+        _encoding_type = static_cast<EncodingTypePB>(decode_fixed32_le((const uint8_t*)&_data.data[0]));
+        _exponent = decode_fixed32_le((const uint8_t*)&_data.data[4]);
+        _data.remove_prefix(DECIMAL_SCALING_PAGE_HEADER_SIZE);
+        if (_encoding_type == DECIMAL_SCALING) {
+            if (_exponent > DecimalScaling<CppType>::MAX_EXPONENT) {
+                return Status::Corruption(strings::Substitute("invalid exponent:$0", _exponent));
+            }
+            _decoder = std::make_unique<ForDecoder<int64_t>>((const uint8_t*)_data.data, _data.size);
+            if (!_decoder->init()) {
+                return Status::Corruption("The decimal scaling page metadata maybe broken");
+            }
+            _num_elements = _decoder->count();
+        } else if (_encoding_type == BIT_SHUFFLE) {
+            _bitshuffle_decoder = std::make_unique<BitShufflePageDecoder<Type>>(_data, _options);
+            RETURN_IF_ERROR(_bitshuffle_decoder->init());
+        } else {
+            return Status::Corruption(strings::Substitute("invalid encoding type:$0", _encoding_type));
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_bitshuffle_decoder != nullptr) {
+            return _bitshuffle_decoder->seek_to_position_in_page(pos);
+        }
+        DCHECK_LE(pos, _num_elements);
+        // If the block is empty (e.g. the column is filled with nulls), there is no data to seek.
+        if (PREDICT_FALSE(_num_elements == 0)) {
+            return Status::OK();
+        }
+        if (!_decoder->skip(static_cast<int32_t>(pos - _cur_index))) {
+            return Status::Corruption(strings::Substitute("fail to seek to $0 of $1 values", pos, _num_elements));
+        }
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_bitshuffle_decoder != nullptr) {
+            return _bitshuffle_decoder->next_batch(n, dst);
+        }
+        *n = std::min(*n, _num_elements - _cur_index);
+        _decode(reinterpret_cast<CppType*>(dst->data()), *n);
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_bitshuffle_decoder != nullptr) {
+            return _bitshuffle_decoder->next_batch(n, dst);
+        }
+        *n = std::min(*n, _num_elements - _cur_index);
+        const size_t ori_size = dst->size();
+        dst->resize(ori_size + *n);
+        _decode(reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size, *n);
+        return Status::OK();
+    }
+
+    size_t count() const override {
+        return _bitshuffle_decoder != nullptr ? _bitshuffle_decoder->count() : _num_elements;
+    }
+
+    size_t current_index() const override {
+        return _bitshuffle_decoder != nullptr ? _bitshuffle_decoder->current_index() : _cur_index;
+    }
+
+    EncodingTypePB encoding_type() const override { return _encoding_type; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    void _decode(CppType* dst, size_t n) {
+        if (n == 0) {
+            return;
+        }
+        _integers.resize(n);
+        [[maybe_unused]] bool r = _decoder->get_batch(_integers.data(), n);
+        DCHECK(r);
+        // A branch-free loop of conversions and divisions.
+        const int exponent = _exponent;
+        for (size_t i = 0; i < n; i++) {
+            dst[i] = DecimalScaling<CppType>::decode(_integers[i], exponent);
+        }
+        _cur_index += n;
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    EncodingTypePB _encoding_type = UNKNOWN_ENCODING;
+    uint32_t _exponent = 0;
+    size_t _num_elements = 0;
+    size_t _cur_index = 0;
+    std::unique_ptr<ForDecoder<int64_t>> _decoder;
+    std::unique_ptr<BitShufflePageDecoder<Type>> _bitshuffle_decoder;
+    std::vector<int64_t> _integers;
+};
+
+} // namespace segment_v2
+} // namespace starrocks
@@ -0,0 +1,254 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "column/column.h"
+#include "gen_cpp/segment_v2.pb.h"
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+#include "storage/column_block.h"
+#include "storage/rowset/segment_v2/bitshuffle_page.h"
+#include "storage/rowset/segment_v2/options.h"
+#include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/rowset/segment_v2/plain_page.h"
+#include "storage/types.h"
+#include "storage/vectorized/chunk_helper.h"
+#include "util/coding.h"
+#include "util/phmap/phmap.h"
+#include "util/unaligned_access.h"
+
+namespace starrocks {
+namespace segment_v2 {
+
+enum { DICT_PAGE_HEADER_SIZE = 4 };
+
+// DictPageBuilder uses dictionary encoding for fixed length types, e.g. integer and date,
+// the counterpart of BinaryDictPageBuilder for strings.
+// There is only one dictionary page, a PlainPage of the distinct values, for all the data
+// pages within a column.
+//
+// Layout for dictionary encoded page:
+// Either header + embedded bitshuffle page of the codewords, when mode_ = DICT_ENCODING.
+// Or     header + embedded bitshuffle page of the values, when mode_ = BIT_SHUFFLE.
+// Data pages start with mode_ = DICT_ENCODING, when the size of dictionary page go beyond
+// the option_->dict_page_size, the subsequent data pages will switch to bitshuffle page,
+// the default encoding of these types, automatically.
+template <FieldType Type>
+class DictPageBuilder final : public PageBuilder {
+public:
+    explicit DictPageBuilder(const PageBuilderOptions& options) : _options(options) {
+        _data_page_builder = std::make_unique<BitshufflePageBuilder<OLAP_FIELD_TYPE_INT>>(options);
+        _data_page_builder->reserve_head(DICT_PAGE_HEADER_SIZE);
+        PageBuilderOptions dict_builder_options;
+        dict_builder_options.data_page_size = _options.dict_page_size;
+        _dict_builder = std::make_unique<PlainPageBuilder<Type>>(dict_builder_options);
+        reset();
+    }
+
+    bool is_page_full() override {
+        if (_data_page_builder->is_page_full()) {
+            return true;
+        }
+        return _encoding_type == DICT_ENCODING && _dict_builder->is_page_full();
+    }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        DCHECK(!_finished);
+        if (_encoding_type != DICT_ENCODING) {
+            return _data_page_builder->add(vals, count);
+        }
+        // Manually devirtualization.
+        auto* code_page = down_cast<BitshufflePageBuilder<OLAP_FIELD_TYPE_INT>*>(_data_page_builder.get());
+        const auto* src = reinterpret_cast<const CppType*>(vals);
+        if (_data_page_builder->count() == 0 && count > 0) {
+            _first_value = unaligned_load<CppType>(src);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            auto value = unaligned_load<CppType>(src + i);
+            int32_t value_code;
+            auto iter = _dictionary.find(value);
+            if (iter != _dictionary.end()) {
+                value_code = iter->second;
+            } else if (!_dict_builder->is_page_full()) {
+                value_code = _dictionary.size();
+                _dict_builder->add(reinterpret_cast<const uint8_t*>(&value), 1);
+                _dictionary.emplace(value, value_code);
+            } else {
+                return i;
+            }
+            if (code_page->add_one(reinterpret_cast<const uint8_t*>(&value_code)) < 1) {
+                return i;
+            }
+            _last_value = value;
+        }
+        return count;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        faststring* data_slice = _data_page_builder->finish();
+        encode_fixed32_le(data_slice->data(), _encoding_type);
+        return data_slice;
+    }
+
+    void reset() override {
+        if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
+            _data_page_builder = std::make_unique<BitshufflePageBuilder<Type>>(_options);
+            _data_page_builder->reserve_head(DICT_PAGE_HEADER_SIZE);
+            _encoding_type = BIT_SHUFFLE;
+        } else {
+            _data_page_builder->reset();
+        }
+        _finished = false;
+    }
+
+    size_t count() const override { return _data_page_builder->count(); }
+
+    uint64_t size() const override { return _dict_builder->size() + _data_page_builder->size(); }
+
+    faststring* get_dictionary_page() override { return _dict_builder->finish(); }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_data_page_builder->count() == 0) {
+            return Status::NotFound("page is empty");
+        }
+        if (_encoding_type != DICT_ENCODING) {
+            return _data_page_builder->get_first_value(value);
+        }
+        memcpy(value, &_first_value, sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_data_page_builder->count() == 0) {
+            return Status::NotFound("page is empty");
+        }
+        if (_encoding_type != DICT_ENCODING) {
+            return _data_page_builder->get_last_value(value);
+        }
+        memcpy(value, &_last_value, sizeof(CppType));
+        return Status::OK();
+    }
+
+    // Return true iff all pages so far are encoded by dictionary encoding.
+    bool all_dict_encoded() const override { return _encoding_type == DICT_ENCODING; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    PageBuilderOptions _options;
+    bool _finished = false;
+    EncodingTypePB _encoding_type = DICT_ENCODING;
+
+    std::unique_ptr<PageBuilder> _data_page_builder;
+    std::unique_ptr<PlainPageBuilder<Type>> _dict_builder;
+    // query for dict item -> dict id
+    phmap::flat_hash_map<CppType, int32_t> _dictionary;
+    CppType _first_value{};
+    CppType _last_value{};
+};
+
+template <FieldType Type>
+class DictPageDecoder final : public PageDecoder {
+public:
+    DictPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < DICT_PAGE_HEADER_SIZE) {
+            return Status::Corruption(
+                    strings::Substitute("invalid data size:$0, header size:$1", _data.size, DICT_PAGE_HEADER_SIZE));
+        }
+        _encoding_type = static_cast<EncodingTypePB>(decode_fixed32_le((const uint8_t*)&_data.data[0]));
+        _data.remove_prefix(DICT_PAGE_HEADER_SIZE);
+        if (_encoding_type == DICT_ENCODING) {
+            _data_page_decoder = std::make_unique<BitShufflePageDecoder<OLAP_FIELD_TYPE_INT>>(_data, _options);
+        } else if (_encoding_type == BIT_SHUFFLE) {
+            _data_page_decoder = std::make_unique<BitShufflePageDecoder<Type>>(_data, _options);
+        } else {
+            return Status::Corruption(strings::Substitute("invalid encoding type:$0", _encoding_type));
+        }
+        RETURN_IF_ERROR(_data_page_decoder->init());
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override { return _data_page_decoder->seek_to_position_in_page(pos); }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        if (_encoding_type != DICT_ENCODING) {
+            return _data_page_decoder->next_batch(n, dst);
+        }
+        RETURN_IF_ERROR(_next_codes(n));
+        _decode_codes(*n, reinterpret_cast<CppType*>(dst->data()));
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        if (_encoding_type != DICT_ENCODING) {
+            return _data_page_decoder->next_batch(n, dst);
+        }
+        RETURN_IF_ERROR(_next_codes(n));
+        _values.resize(*n);
+        _decode_codes(*n, _values.data());
+        [[maybe_unused]] size_t appended = dst->append_numbers(_values.data(), *n * sizeof(CppType));
+        DCHECK_EQ(*n, appended);
+        return Status::OK();
+    }
+
+    size_t count() const override { return _data_page_decoder->count(); }
+
+    size_t current_index() const override { return _data_page_decoder->current_index(); }
+
+    EncodingTypePB encoding_type() const override { return _encoding_type; }
+
+    void set_dict_decoder(PageDecoder* dict_decoder) {
+        _dict_decoder = down_cast<PlainPageDecoder<Type>*>(dict_decoder);
+    }
+
+    Status next_dict_codes(size_t* n, vectorized::Column* dst) override {
+        DCHECK(_encoding_type == DICT_ENCODING);
+        DCHECK(_parsed);
+        return _data_page_decoder->next_batch(n, dst);
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    Status _next_codes(size_t* n) {
+        DCHECK(_parsed);
+        DCHECK(_dict_decoder != nullptr) << "dict decoder pointer is nullptr";
+        if (_vec_code_buf == nullptr) {
+            _vec_code_buf = vectorized::ChunkHelper::column_from_field_type(OLAP_FIELD_TYPE_INT, false);
+        }
+        _vec_code_buf->resize(0);
+        _vec_code_buf->reserve(*n);
+        return _data_page_decoder->next_batch(n, _vec_code_buf.get());
+    }
+
+    void _decode_codes(size_t n, CppType* out) const {
+        const auto* codewords = reinterpret_cast<const int32_t*>(_vec_code_buf->raw_data());
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = _dict_decoder->value_at(codewords[i]);
+        }
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    std::unique_ptr<PageDecoder> _data_page_decoder;
+    const PlainPageDecoder<Type>* _dict_decoder = nullptr;
+    bool _parsed = false;
+    EncodingTypePB _encoding_type = UNKNOWN_ENCODING;
+    std::shared_ptr<vectorized::Column> _vec_code_buf;
+    std::vector<CppType> _values;
+};
+
+} // namespace segment_v2
+} // namespace starrocks
@@ -21,6 +21,7 @@
 
 #include "storage/rowset/segment_v2/encoding_info.h"
 
+#include <algorithm>
 #include <type_traits>
 
 #include "gutil/strings/substitute.h"
@@ -29,7 +30,10 @@
 #include "storage/rowset/segment_v2/binary_plain_page.h"
 #include "storage/rowset/segment_v2/binary_prefix_page.h"
 #include "storage/rowset/segment_v2/bitshuffle_page.h"
+#include "storage/rowset/segment_v2/decimal_scaling_page.h"
+#include "storage/rowset/segment_v2/dict_page.h"
 #include "storage/rowset/segment_v2/frame_of_reference_page.h"
+#include "storage/rowset/segment_v2/fsst_page.h"
 #include "storage/rowset/segment_v2/plain_page.h"
 #include "storage/rowset/segment_v2/rle_page.h"
 
@@ -82,14 +86,14 @@ struct TypeEncodingTraits<type, BIT_SHUFFLE, CppType,
     }
 };
 
-template <>
-struct TypeEncodingTraits<OLAP_FIELD_TYPE_BOOL, RLE, bool> {
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, RLE, CppType, typename std::enable_if<std::is_integral<CppType>::value>::type> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
-        *builder = new RlePageBuilder<OLAP_FIELD_TYPE_BOOL>(opts);
+        *builder = new RlePageBuilder<type>(opts);
         return Status::OK();
     }
     static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
-        *decoder = new RlePageDecoder<OLAP_FIELD_TYPE_BOOL>(data, opts);
+        *decoder = new RlePageDecoder<type>(data, opts);
         return Status::OK();
     }
 };
@@ -106,6 +110,19 @@ struct TypeEncodingTraits<type, DICT_ENCODING, Slice> {
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DICT_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DictPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new DictPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <>
 struct TypeEncodingTraits<OLAP_FIELD_TYPE_DATE, FOR_ENCODING, typename CppTypeTraits<OLAP_FIELD_TYPE_DATE>::CppType> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -131,6 +148,32 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, FOR_DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new FrameOfReferencePageBuilder<type, FOR_DELTA_ENCODING>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new FrameOfReferencePageDecoder<type, FOR_DELTA_ENCODING>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DECIMAL_SCALING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DecimalScalingPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new DecimalScalingPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -143,6 +186,18 @@ struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     }
 };
 
+template <FieldType type>
+struct TypeEncodingTraits<type, FSST_ENCODING, Slice> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new FsstPageBuilder(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new FsstPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType field_type, EncodingTypePB encoding_type>
 struct EncodingTraits : TypeEncodingTraits<field_type, encoding_type, typename CppTypeTraits<field_type>::CppType> {
     static const FieldType type = field_type;
@@ -165,6 +220,8 @@ public:
 
     Status get(FieldType data_type, EncodingTypePB encoding_type, const EncodingInfo** out);
 
+    std::vector<const EncodingInfo*> get_all(FieldType data_type) const;
+
 private:
     // Not thread-safe
     template <FieldType type, EncodingTypePB encoding_type, bool optimize_value_seek = false>
@@ -198,18 +255,26 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<OLAP_FIELD_TYPE_TINYINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_TINYINT, FOR_ENCODING, true>();
     _add_map<OLAP_FIELD_TYPE_TINYINT, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_TINYINT, RLE>();
 
     _add_map<OLAP_FIELD_TYPE_SMALLINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_SMALLINT, FOR_ENCODING, true>();
     _add_map<OLAP_FIELD_TYPE_SMALLINT, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_SMALLINT, RLE>();
 
     _add_map<OLAP_FIELD_TYPE_INT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_INT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_INT, FOR_DELTA_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_INT, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_INT, DICT_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_INT, RLE>();
 
     _add_map<OLAP_FIELD_TYPE_BIGINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_BIGINT, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_BIGINT, FOR_DELTA_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_BIGINT, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_BIGINT, DICT_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_BIGINT, RLE>();
 
     _add_map<OLAP_FIELD_TYPE_LARGEINT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_LARGEINT, PLAIN_ENCODING>();
@@ -217,17 +282,21 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<OLAP_FIELD_TYPE_FLOAT, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_FLOAT, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_FLOAT, DECIMAL_SCALING>();
 
     _add_map<OLAP_FIELD_TYPE_DOUBLE, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DOUBLE, PLAIN_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_DOUBLE, DECIMAL_SCALING>();
 
     _add_map<OLAP_FIELD_TYPE_CHAR, DICT_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_CHAR, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_CHAR, PREFIX_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_CHAR, FSST_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_VARCHAR, DICT_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_VARCHAR, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_VARCHAR, PREFIX_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_VARCHAR, FSST_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_BOOL, RLE>();
     _add_map<OLAP_FIELD_TYPE_BOOL, BIT_SHUFFLE>();
@@ -241,6 +310,8 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<OLAP_FIELD_TYPE_DATE_V2, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DATE_V2, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_DATE_V2, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_DATE_V2, FOR_DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_DATE_V2, DICT_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_DATETIME, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DATETIME, PLAIN_ENCODING>();
@@ -249,6 +320,8 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<OLAP_FIELD_TYPE_TIMESTAMP, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_TIMESTAMP, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_TIMESTAMP, FOR_ENCODING, true>();
+    _add_map<OLAP_FIELD_TYPE_TIMESTAMP, FOR_DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_TIMESTAMP, DICT_ENCODING>();
 
     _add_map<OLAP_FIELD_TYPE_DECIMAL, BIT_SHUFFLE>();
     _add_map<OLAP_FIELD_TYPE_DECIMAL, PLAIN_ENCODING>();
@@ -286,6 +359,18 @@ Status EncodingInfoResolver::get(FieldType data_type, EncodingTypePB encoding_ty
     return Status::OK();
 }
 
+std::vector<const EncodingInfo*> EncodingInfoResolver::get_all(FieldType data_type) const {
+    std::vector<const EncodingInfo*> encodings;
+    for (const auto& it : _encoding_map) {
+        if (it.first.first == delegate_type(data_type)) {
+            encodings.emplace_back(it.second);
+        }
+    }
+    std::sort(encodings.begin(), encodings.end(),
+              [](const EncodingInfo* lhs, const EncodingInfo* rhs) { return lhs->encoding() < rhs->encoding(); });
+    return encodings;
+}
+
 static EncodingInfoResolver s_encoding_info_resolver;
 
 template <typename TraitsClass>
@@ -303,5 +388,9 @@ EncodingTypePB EncodingInfo::get_default_encoding(const FieldType& data_type, bo
     return s_encoding_info_resolver.get_default_encoding(data_type, optimize_value_seek);
 }
 
+std::vector<const EncodingInfo*> EncodingInfo::get_all(const FieldType& data_type) {
+    return s_encoding_info_resolver.get_all(data_type);
+}
+
 } // namespace segment_v2
 } // namespace starrocks
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include "common/status.h"
 #include "gen_cpp/segment_v2.pb.h"
@@ -47,6 +48,9 @@ public:
     // and support fast value seek operation
     static EncodingTypePB get_default_encoding(const FieldType& data_type, bool optimize_value_seek);
 
+    // Get EncodingInfo of all the encodings of |data_type|, ordered by the encoding type.
+    static std::vector<const EncodingInfo*> get_all(const FieldType& data_type);
+
     Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) const {
         return _create_builder_func(opts, builder);
     }
@@ -25,17 +25,24 @@
 #include "storage/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "storage/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "storage/rowset/segment_v2/page_decoder.h" // for PageDecoder
+#include "storage/vectorized/chunk_helper.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/frame_of_reference_coding.h"
 
 namespace starrocks {
 namespace segment_v2 {
 
-// Encode page use frame-of-reference coding
-template <FieldType Type>
+// Encode page use frame-of-reference coding, the pages of FOR_DELTA_ENCODING may also store the
+// frames of regular steps by their delta-of-delta, see ForEncoder.
+template <FieldType Type, EncodingTypePB Encoding = FOR_ENCODING>
 class FrameOfReferencePageBuilder final : public PageBuilder {
 public:
     explicit FrameOfReferencePageBuilder(const PageBuilderOptions& options)
-            : _options(options), _count(0), _finished(false), _buf(), _encoder(&_buf) {}
+            : _options(options),
+              _count(0),
+              _finished(false),
+              _buf(),
+              _encoder(&_buf, Encoding == FOR_DELTA_ENCODING) {}
 
     ~FrameOfReferencePageBuilder() override = default;
 
@@ -100,7 +107,7 @@ private:
     ForEncoder<CppType> _encoder;
 };
 
-template <FieldType Type>
+template <FieldType Type, EncodingTypePB Encoding = FOR_ENCODING>
 class FrameOfReferencePageDecoder final : public PageDecoder {
 public:
     FrameOfReferencePageDecoder(Slice data, const PageDecoderOptions& options)
@@ -198,20 +205,85 @@ public:
         return Status::OK();
     }
 
+    // The predicate is evaluated on the bounds of each frame first, which decides all the values of a
+    // frame whose bounds are both selected or both filtered out by a comparison, without unpacking them.
+    Status evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n, uint8_t* selection) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if constexpr (!std::is_integral_v<CppType>) {
+            return Status::NotSupported("evaluate_predicate() not supported");
+        } else {
+            *n = std::min(*n, _num_elements - _cur_index);
+            if (_values == nullptr) {
+                _values = vectorized::ChunkHelper::column_from_field_type(Type, false);
+            }
+            size_t offset = 0;
+            while (offset < *n) {
+                size_t count = std::min<size_t>(*n - offset, _decoder.current_frame_remaining());
+                int selected = _evaluate_frame_bounds(pred);
+                if (selected >= 0) {
+                    memset(selection + offset, selected, count);
+                    _decoder.skip(static_cast<int32_t>(count));
+                } else {
+                    _values->resize(count);
+                    [[maybe_unused]] bool r =
+                            _decoder.get_batch(reinterpret_cast<CppType*>(_values->mutable_raw_data()), count);
+                    DCHECK(r);
+                    pred->evaluate(_values.get(), selection + offset);
+                }
+                offset += count;
+            }
+            _cur_index += *n;
+            return Status::OK();
+        }
+    }
+
     size_t count() const override { return _num_elements; }
 
     size_t current_index() const override { return _cur_index; }
 
-    EncodingTypePB encoding_type() const override { return FOR_ENCODING; }
+    EncodingTypePB encoding_type() const override { return Encoding; }
 
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
 
+    // Return 1 if all the values of the current frame are selected by |pred|, 0 if none of them is
+    // selected, and -1 if it cannot be decided by the bounds of the frame.
+    int _evaluate_frame_bounds(const vectorized::ColumnPredicate* pred) {
+        CppType bounds[2];
+        if (!_decoder.current_frame_bounds(&bounds[0], &bounds[1])) {
+            return -1;
+        }
+        _values->resize(2);
+        memcpy(_values->mutable_raw_data(), bounds, sizeof(bounds));
+        if (!pred->zone_map_filter(_values->get(0), _values->get(1))) {
+            return 0;
+        }
+        uint8_t selected[2];
+        pred->evaluate(_values.get(), selected);
+        if (bounds[0] == bounds[1]) {
+            return selected[0];
+        }
+        switch (pred->type()) {
+        case vectorized::PredicateType::kGT:
+        case vectorized::PredicateType::kGE:
+        case vectorized::PredicateType::kLT: // and kLE
+            // the values between the bounds are selected if and only if both bounds are selected.
+            if (selected[0] == selected[1]) {
+                return selected[0];
+            }
+            return -1;
+        default:
+            return -1;
+        }
+    }
+
     bool _parsed;
     Slice _data;
     size_t _num_elements;
     size_t _cur_index;
     ForDecoder<CppType> _decoder;
+    // the values of a frame, or its bounds, to evaluate the predicates on.
+    vectorized::ColumnPtr _values;
 };
 
 } // namespace segment_v2
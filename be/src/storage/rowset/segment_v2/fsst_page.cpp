@@ -0,0 +1,232 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/fsst_page.h"
+
+#include "util/phmap/phmap.h"
+
+namespace starrocks::segment_v2 {
+
+// The rounds of building a symbol table, each one counts the symbols of the sample compressed
+// by the table of the previous round.
+static constexpr int kSymbolTableGenerations = 5;
+
+void SymbolTable::clear() {
+    _num_symbols = 0;
+    memset(_symbols, 0, sizeof(_symbols));
+    memset(_lengths, 0, sizeof(_lengths));
+    for (auto& codes : _codes_by_first_byte) {
+        codes.clear();
+    }
+}
+
+void SymbolTable::_set_symbols(const std::vector<std::string>& symbols) {
+    clear();
+    DCHECK_LE(symbols.size(), MAX_SYMBOLS);
+    for (const std::string& symbol : symbols) {
+        DCHECK(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH);
+        memcpy(&_symbols[_num_symbols], symbol.data(), symbol.size());
+        _lengths[_num_symbols] = symbol.size();
+        _codes_by_first_byte[static_cast<uint8_t>(symbol[0])].push_back(_num_symbols);
+        _num_symbols++;
+    }
+    for (auto& codes : _codes_by_first_byte) {
+        std::stable_sort(codes.begin(), codes.end(), [this](uint8_t lhs, uint8_t rhs) {
+            return _lengths[lhs] > _lengths[rhs];
+        });
+    }
+}
+
+uint8_t SymbolTable::_find_longest_symbol(const uint8_t* p, const uint8_t* end) const {
+    size_t remaining = end - p;
+    for (uint8_t code : _codes_by_first_byte[*p]) {
+        if (_lengths[code] <= remaining && memcmp(&_symbols[code], p, _lengths[code]) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+// The symbols of the sample compressed by the table of each round are numbered by their codes,
+// and the escaped bytes by 256 plus the byte.
+static constexpr uint32_t kEscapedByteId = 256;
+
+std::string SymbolTable::_symbol_of(uint32_t id) const {
+    if (id >= kEscapedByteId) {
+        return std::string(1, static_cast<char>(id - kEscapedByteId));
+    }
+    return std::string(reinterpret_cast<const char*>(&_symbols[id]), _lengths[id]);
+}
+
+void SymbolTable::build(const std::vector<Slice>& sample) {
+    clear();
+    for (int generation = 0; generation < kSymbolTableGenerations; generation++) {
+        // The gain of a symbol is the number of bytes it covers when the sample is compressed,
+        // counted for the symbols and the concatenations of two adjacent symbols.
+        std::vector<size_t> gains(kEscapedByteId + 256, 0);
+        phmap::flat_hash_map<uint32_t, size_t> pair_gains;
+        for (const Slice& value : sample) {
+            const auto* p = reinterpret_cast<const uint8_t*>(value.data);
+            const uint8_t* end = p + value.size;
+            uint32_t prev = 0;
+            size_t prev_length = 0;
+            while (p < end) {
+                uint8_t code = _find_longest_symbol(p, end);
+                uint32_t id = code == ESCAPE_CODE ? kEscapedByteId + *p : code;
+                size_t length = code == ESCAPE_CODE ? 1 : _lengths[code];
+                gains[id] += length;
+                if (prev_length > 0 && prev_length + length <= MAX_SYMBOL_LENGTH) {
+                    pair_gains[(prev << 16) | id] += prev_length + length;
+                }
+                prev = id;
+                prev_length = length;
+                p += length;
+            }
+        }
+
+        // a symbol must cover more bytes than the codes of the bytes it replaces.
+        std::vector<std::pair<size_t, std::string>> candidates;
+        for (uint32_t id = 0; id < gains.size(); id++) {
+            if (gains[id] > 0) {
+                std::string symbol = _symbol_of(id);
+                if (gains[id] > symbol.size()) {
+                    candidates.emplace_back(gains[id], std::move(symbol));
+                }
+            }
+        }
+        for (const auto& [ids, gain] : pair_gains) {
+            std::string symbol = _symbol_of(ids >> 16) + _symbol_of(ids & 0xFFFF);
+            if (gain > symbol.size()) {
+                candidates.emplace_back(gain, std::move(symbol));
+            }
+        }
+        // a concatenation may equal a symbol of the current table, keep the larger gain of them.
+        std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+        });
+        std::vector<std::string> symbols;
+        phmap::flat_hash_set<std::string> chosen;
+        for (size_t i = 0; i < candidates.size() && symbols.size() < MAX_SYMBOLS; i++) {
+            if (chosen.insert(candidates[i].second).second) {
+                symbols.emplace_back(std::move(candidates[i].second));
+            }
+        }
+        _set_symbols(symbols);
+    }
+}
+
+void SymbolTable::serialize(faststring* buf) const {
+    buf->push_back(static_cast<uint8_t>(_num_symbols));
+    buf->append(_lengths, _num_symbols);
+    for (size_t i = 0; i < _num_symbols; i++) {
+        buf->append(&_symbols[i], _lengths[i]);
+    }
+}
+
+Status SymbolTable::deserialize(Slice* data) {
+    clear();
+    if (data->size < 1) {
+        return Status::Corruption("not enough bytes for symbol table");
+    }
+    size_t num_symbols = static_cast<uint8_t>(data->data[0]);
+    data->remove_prefix(1);
+    if (num_symbols > MAX_SYMBOLS || data->size < num_symbols) {
+        return Status::Corruption(strings::Substitute("bad symbol table, num_symbols=$0", num_symbols));
+    }
+    const auto* lengths = reinterpret_cast<const uint8_t*>(data->data);
+    size_t total_length = num_symbols;
+    std::vector<std::string> symbols;
+    symbols.reserve(num_symbols);
+    for (size_t i = 0; i < num_symbols; i++) {
+        if (lengths[i] == 0 || lengths[i] > MAX_SYMBOL_LENGTH || data->size < total_length + lengths[i]) {
+            return Status::Corruption(strings::Substitute("bad symbol table, symbol $0 of length $1", i, lengths[i]));
+        }
+        symbols.emplace_back(data->data + total_length, lengths[i]);
+        total_length += lengths[i];
+    }
+    // the same symbols in the same order, so that a value is compressed to the same codes as
+    // by the table that wrote the page.
+    _set_symbols(symbols);
+    data->remove_prefix(total_length);
+    return Status::OK();
+}
+
+void SymbolTable::compress(const Slice& value, faststring* codes) const {
+    const auto* p = reinterpret_cast<const uint8_t*>(value.data);
+    const uint8_t* end = p + value.size;
+    while (p < end) {
+        uint8_t code = _find_longest_symbol(p, end);
+        codes->push_back(code);
+        if (code == ESCAPE_CODE) {
+            codes->push_back(*p++);
+        } else {
+            p += _lengths[code];
+        }
+    }
+}
+
+int SymbolTable::compare(const uint8_t* codes, size_t n, const Slice& value) const {
+    const auto* v = reinterpret_cast<const uint8_t*>(value.data);
+    size_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t* bytes;
+        size_t length;
+        if (codes[i] != ESCAPE_CODE) {
+            bytes = reinterpret_cast<const uint8_t*>(&_symbols[codes[i]]);
+            length = _lengths[codes[i]];
+        } else if (i + 1 < n) {
+            bytes = &codes[++i];
+            length = 1;
+        } else {
+            break;
+        }
+        size_t remaining = value.size - pos;
+        int r = memcmp(bytes, v + pos, std::min(length, remaining));
+        if (r != 0) {
+            return r;
+        }
+        if (remaining < length) {
+            return 1;
+        }
+        pos += length;
+    }
+    return pos < value.size ? -1 : 0;
+}
+
+faststring* FsstPageBuilder::finish() {
+    DCHECK(!_finished);
+    _finished = true;
+    _buffer.clear();
+
+    std::vector<Slice> sample;
+    size_t sample_size = 0;
+    for (size_t i = 0; i < _offsets.size() && sample_size < SAMPLE_SIZE; i++) {
+        sample.emplace_back(_value_at(i));
+        sample_size += sample.back().size;
+    }
+    _table.build(sample);
+
+    std::vector<uint32_t> offsets;
+    offsets.reserve(_offsets.size());
+    _table.serialize(&_buffer);
+    for (size_t i = 0; i < _offsets.size(); i++) {
+        offsets.push_back(_buffer.size());
+        _table.compress(_value_at(i), &_buffer);
+    }
+    if (_buffer.size() >= _values.size() + 1) {
+        // compression does not pay off, store the values as is behind an empty symbol table.
+        _table.clear();
+        _buffer.clear();
+        _table.serialize(&_buffer);
+        for (size_t i = 0; i < _offsets.size(); i++) {
+            offsets[i] = _buffer.size() + _offsets[i];
+        }
+        _buffer.append(_values.data(), _values.size());
+    }
+    for (uint32_t offset : offsets) {
+        put_fixed32_le(&_buffer, offset);
+    }
+    put_fixed32_le(&_buffer, offsets.size());
+    return &_buffer;
+}
+
+} // namespace starrocks::segment_v2
@@ -0,0 +1,399 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/column.h"
+#include "common/logging.h"
+#include "gen_cpp/segment_v2.pb.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/mem_pool.h"
+#include "storage/column_block.h"
+#include "storage/rowset/segment_v2/options.h"
+#include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/types.h"
+#include "storage/vectorized/column_predicate.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/raw_container.h"
+#include "util/slice.h"
+
+namespace starrocks {
+namespace segment_v2 {
+
+// SymbolTable compresses strings in the manner of FSST (Fast Static Symbol Table): up to 255
+// symbols of 1 to 8 bytes, each replaced by its one byte code. A byte not covered by any symbol
+// is written as the escape code followed by the byte itself.
+//
+// Each string is compressed on its own, so any value is decompressed without the others, and a
+// string is always compressed to the same codes. Two values are equal if and only if their codes
+// are equal, which lets equality predicates compare the compressed values.
+class SymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr size_t MAX_SYMBOLS = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+
+    SymbolTable() { clear(); }
+
+    void clear();
+
+    // Build the symbols that compress |sample| the most, by a few rounds of counting the symbols of
+    // the compressed sample and their concatenations.
+    void build(const std::vector<Slice>& sample);
+
+    size_t num_symbols() const { return _num_symbols; }
+
+    // Serialized as the number of symbols, the length of each symbol and the symbols, one byte for
+    // each number and length.
+    void serialize(faststring* buf) const;
+
+    // Deserialize the table at the beginning of |data| and remove it from |data|.
+    Status deserialize(Slice* data);
+
+    void compress(const Slice& value, faststring* codes) const;
+
+    // The size of the decompressed value of |n| codes is at most max_decompressed_size(n), and
+    // `decompress` may write up to MAX_SYMBOL_LENGTH - 1 bytes after the decompressed value.
+    static size_t max_decompressed_size(size_t n) { return n * MAX_SYMBOL_LENGTH + MAX_SYMBOL_LENGTH; }
+
+    // Return the number of bytes written to |dst|.
+    size_t decompress(const uint8_t* codes, size_t n, uint8_t* dst) const {
+        uint8_t* p = dst;
+        for (size_t i = 0; i < n; i++) {
+            uint8_t code = codes[i];
+            if (PREDICT_TRUE(code != ESCAPE_CODE)) {
+                memcpy(p, &_symbols[code], sizeof(uint64_t));
+                p += _lengths[code];
+            } else if (PREDICT_TRUE(i + 1 < n)) {
+                *p++ = codes[++i];
+            }
+        }
+        return p - dst;
+    }
+
+    // Compare the value of |n| codes with |value| like Slice::compare, decompressing symbol by
+    // symbol until the first different byte.
+    int compare(const uint8_t* codes, size_t n, const Slice& value) const;
+
+private:
+    // Return the code of the longest symbol at the beginning of [p, end), or ESCAPE_CODE if none.
+    uint8_t _find_longest_symbol(const uint8_t* p, const uint8_t* end) const;
+
+    void _set_symbols(const std::vector<std::string>& symbols);
+
+    std::string _symbol_of(uint32_t id) const;
+
+    size_t _num_symbols = 0;
+    uint64_t _symbols[MAX_SYMBOLS + 1];
+    uint8_t _lengths[MAX_SYMBOLS + 1];
+    // codes of the symbols beginning with each byte, longest first. Only used by compression.
+    std::vector<uint8_t> _codes_by_first_byte[256];
+};
+
+// FsstPageBuilder compresses the strings of a page by a SymbolTable built from the page, so that
+// every value of the page can be read or compared without decompressing the others.
+//
+// Layout of the page:
+//      SymbolTable, Codes^NumElems, Offset(fixed32)^NumElems, NumElems(fixed32)
+// The offsets are the offsets of the codes of each value, relative to the start of the page.
+// The symbol table is empty and the values are stored uncompressed if compression does not
+// make the page smaller, e.g. random strings.
+class FsstPageBuilder final : public PageBuilder {
+public:
+    // The first this many bytes of the values of a page are used to build its symbol table.
+    static constexpr size_t SAMPLE_SIZE = 16 * 1024;
+
+    explicit FsstPageBuilder(const PageBuilderOptions& options) : _options(options) { reset(); }
+
+    bool is_page_full() override {
+        // data_page_size is 0, do not limit the page size
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        DCHECK(!_finished);
+        const auto* slices = reinterpret_cast<const Slice*>(vals);
+        for (size_t i = 0; i < count; i++) {
+            if (is_page_full()) {
+                return i;
+            }
+            _offsets.push_back(_values.size());
+            _values.append(slices[i].data, slices[i].size);
+            _size_estimate += slices[i].size + sizeof(uint32_t);
+        }
+        return count;
+    }
+
+    faststring* finish() override;
+
+    void reset() override {
+        _values.clear();
+        _offsets.clear();
+        _buffer.clear();
+        _size_estimate = sizeof(uint32_t);
+        _finished = false;
+    }
+
+    size_t count() const override { return _offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_offsets.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = _value_at(0);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_offsets.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = _value_at(_offsets.size() - 1);
+        return Status::OK();
+    }
+
+private:
+    Slice _value_at(size_t idx) const {
+        size_t end = idx + 1 < _offsets.size() ? _offsets[idx + 1] : _values.size();
+        return {_values.data() + _offsets[idx], end - _offsets[idx]};
+    }
+
+    PageBuilderOptions _options;
+    // the uncompressed values added to the page, and the offset of each value.
+    faststring _values;
+    std::vector<uint32_t> _offsets;
+    size_t _size_estimate = 0;
+    SymbolTable _table;
+    faststring _buffer;
+    bool _finished = false;
+};
+
+template <FieldType Type>
+class FsstPageDecoder final : public PageDecoder {
+public:
+    explicit FsstPageDecoder(Slice data) : FsstPageDecoder(data, PageDecoderOptions()) {}
+
+    FsstPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data), _options(options) {}
+
+    Status init() override {
+        RETURN_IF(_parsed, Status::OK());
+        if (_data.size < sizeof(uint32_t)) {
+            return Status::Corruption(
+                    strings::Substitute("not enough bytes for trailer in FsstPageDecoder, size=$0", _data.size));
+        }
+        _num_elems = decode_fixed32_le((const uint8_t*)&_data[_data.size - sizeof(uint32_t)]);
+        if ((static_cast<size_t>(_num_elems) + 1) * sizeof(uint32_t) > _data.size) {
+            return Status::Corruption(strings::Substitute("bad FsstPageDecoder trailer, num_elems=$0, size=$1",
+                                                          _num_elems, _data.size));
+        }
+        _offsets_pos = _data.size - (_num_elems + 1) * sizeof(uint32_t);
+        Slice table_data(_data.data, _offsets_pos);
+        RETURN_IF_ERROR(_table.deserialize(&table_data));
+        _compressed = _table.num_symbols() > 0;
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        DCHECK(_parsed);
+        *n = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        auto* out = reinterpret_cast<Slice*>(dst->data());
+        for (size_t i = 0; i < *n; i++, out++, _cur_idx++) {
+            Slice value = _decompress(_cur_idx, 0);
+            out->size = value.size;
+            if (value.size != 0) {
+                out->data = reinterpret_cast<char*>(dst->pool()->allocate(value.size));
+                if (UNLIKELY(out->data == nullptr)) {
+                    return Status::InternalError("Mem usage has exceed the limit of BE");
+                }
+                memcpy(out->data, value.data, value.size);
+            }
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::Column* dst) override {
+        DCHECK(_parsed);
+        *n = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        std::vector<Slice> strs;
+        strs.reserve(*n);
+        size_t end = _cur_idx + *n;
+        if (_compressed) {
+            // decompress all the values into |_buffer| one after another.
+            size_t num_codes = _offset(end) - _offset(_cur_idx);
+            raw::stl_vector_resize_uninitialized(&_buffer, SymbolTable::max_decompressed_size(num_codes));
+            size_t buffer_offset = 0;
+            for (; _cur_idx < end; _cur_idx++) {
+                Slice value = _decompress(_cur_idx, buffer_offset);
+                buffer_offset += value.size;
+                strs.emplace_back(value);
+            }
+        } else {
+            for (; _cur_idx < end; _cur_idx++) {
+                strs.emplace_back(_codes_at(_cur_idx));
+            }
+        }
+        if constexpr (Type == OLAP_FIELD_TYPE_CHAR) {
+            for (Slice& s : strs) {
+                s.size = strnlen(s.data, s.size);
+            }
+            if (dst->append_strings(strs)) {
+                return Status::OK();
+            }
+        } else {
+            if (dst->append_continuous_strings(strs)) {
+                return Status::OK();
+            }
+        }
+        return Status::InvalidArgument("Column::append_strings() not supported");
+    }
+
+    // EQ, NE, IN and NOT IN compare the codes of each value with the compressed operands.
+    // GT, GE, LT and LE decompress each value only until its first byte differing from the operand.
+    Status evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n, uint8_t* selection) override {
+        DCHECK(_parsed);
+        *n = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        switch (pred->type()) {
+        case vectorized::PredicateType::kEQ:
+        case vectorized::PredicateType::kNE:
+        case vectorized::PredicateType::kInList:
+        case vectorized::PredicateType::kNotInList: {
+            _compress_operands(pred);
+            bool positive = pred->type() == vectorized::PredicateType::kEQ ||
+                            pred->type() == vectorized::PredicateType::kInList;
+            for (size_t i = 0; i < *n; i++) {
+                Slice codes = _codes_at(_cur_idx + i);
+                bool found = std::binary_search(_operands.begin(), _operands.end(), codes, _slice_less);
+                selection[i] = found == positive;
+            }
+            break;
+        }
+        case vectorized::PredicateType::kGT:
+        case vectorized::PredicateType::kGE:
+        case vectorized::PredicateType::kLT: { // and kLE
+            Slice operand = pred->value().get_slice();
+            // kLT and kLE share the same type, so the result of the values equal to the operand is
+            // taken by evaluating the predicate on the operand itself.
+            uint8_t equal_selected = 0;
+            auto column = vectorized::BinaryColumn::create();
+            column->append(operand);
+            pred->evaluate(column.get(), &equal_selected);
+            bool greater = pred->type() != vectorized::PredicateType::kLT;
+            for (size_t i = 0; i < *n; i++) {
+                Slice codes = _codes_at(_cur_idx + i);
+                int cmp = _compressed ? _table.compare((const uint8_t*)codes.data, codes.size, operand)
+                                      : codes.compare(operand);
+                selection[i] = cmp == 0 ? equal_selected : (cmp > 0) == greater;
+            }
+            break;
+        }
+        default: {
+            auto column = vectorized::BinaryColumn::create();
+            size_t cur_idx = _cur_idx;
+            RETURN_IF_ERROR(next_batch(n, column.get()));
+            _cur_idx = cur_idx;
+            pred->evaluate(column.get(), selection);
+            break;
+        }
+        }
+        _cur_idx += *n;
+        return Status::OK();
+    }
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+    EncodingTypePB encoding_type() const override { return FSST_ENCODING; }
+
+private:
+    uint32_t _offset(size_t idx) const {
+        if (idx >= _num_elems) {
+            return _offsets_pos;
+        }
+        return decode_fixed32_le((const uint8_t*)&_data[_offsets_pos + idx * sizeof(uint32_t)]);
+    }
+
+    Slice _codes_at(size_t idx) const {
+        uint32_t start = _offset(idx);
+        return {&_data[start], _offset(idx + 1) - start};
+    }
+
+    // Decompress the value at |idx| into |_buffer| from |buffer_offset|.
+    Slice _decompress(size_t idx, size_t buffer_offset) {
+        Slice codes = _codes_at(idx);
+        if (!_compressed) {
+            return codes;
+        }
+        size_t required = buffer_offset + SymbolTable::max_decompressed_size(codes.size);
+        if (_buffer.size() < required) {
+            raw::stl_vector_resize_uninitialized(&_buffer, required);
+        }
+        uint8_t* dst = _buffer.data() + buffer_offset;
+        size_t size = _table.decompress((const uint8_t*)codes.data, codes.size, dst);
+        return {dst, size};
+    }
+
+    void _compress_operands(const vectorized::ColumnPredicate* pred) {
+        if (_operands_pred == pred) {
+            return;
+        }
+        _operands_pred = pred;
+        _operands.clear();
+        faststring codes;
+        for (const vectorized::Datum& datum : pred->values()) {
+            const Slice& value = datum.get_slice();
+            if (_compressed) {
+                codes.clear();
+                _table.compress(value, &codes);
+                _operands.emplace_back(reinterpret_cast<const char*>(codes.data()), codes.size());
+            } else {
+                _operands.emplace_back(value.data, value.size);
+            }
+        }
+        std::sort(_operands.begin(), _operands.end(), _slice_less);
+    }
+
+    static bool _slice_less(const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    bool _compressed = false;
+    uint32_t _num_elems = 0;
+    uint32_t _offsets_pos = 0;
+    uint32_t _cur_idx = 0;
+    SymbolTable _table;
+    std::vector<uint8_t> _buffer;
+
+    // the compressed operands of |_operands_pred|, sorted.
+    const vectorized::ColumnPredicate* _operands_pred = nullptr;
+    std::vector<std::string> _operands;
+};
+
+} // namespace segment_v2
+} // namespace starrocks
@@ -93,8 +93,8 @@ public:
     virtual Status get_last_value(void* value) const = 0;
 
     // Return true iff all data pages so far are encode by dict encoding.
-    // only `BinaryDictPageBuilder` needed to overload this method.
-    // this information is used for doing low-cardinality string column read optimization.
+    // only `BinaryDictPageBuilder` and `DictPageBuilder` needed to overload this method.
+    // this information is used for doing low-cardinality column read optimization.
     virtual bool all_dict_encoded() const { return false; }
 
 private:
@@ -28,7 +28,8 @@
 
 namespace starrocks::vectorized {
 class Column;
-}
+class ColumnPredicate;
+} // namespace starrocks::vectorized
 
 namespace starrocks {
 namespace segment_v2 {
@@ -112,6 +113,13 @@ public:
         return Status::NotSupported("next_dict_codes() not supported");
     }
 
+    // Evaluate |pred| on the next |*n| values of the page without copying them out, e.g. once per run
+    // or once per frame, and set |selection[i]| to 1 if the i-th value is selected, 0 otherwise.
+    // Like `next_batch`, the number of evaluated values is returned by |*n|.
+    virtual Status evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n, uint8_t* selection) {
+        return Status::NotSupported("evaluate_predicate() not supported");
+    }
+
     virtual const PageDecoder* dict_page_decoder() const { return nullptr; }
 
 private:
@@ -168,7 +168,11 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
 
     uint32_t body_size = page_slice.size - 4 - footer_size;
     if (body_size != footer->uncompressed_size()) { // need decompress body
-        if (opts.codec == nullptr) {
+        const BlockCompressionCodec* codec = opts.codec;
+        if (footer->has_compression()) {
+            RETURN_IF_ERROR(get_block_compression_codec(footer->compression(), &codec));
+        }
+        if (codec == nullptr) {
             return Status::Corruption("Bad page: page is compressed but codec is NO_COMPRESSION");
         }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
@@ -179,7 +183,7 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         // decompress page body
         Slice compressed_body(page_slice.data, body_size);
         Slice decompressed_body(decompressed_page.get(), footer->uncompressed_size());
-        RETURN_IF_ERROR(opts.codec->decompress(compressed_body, &decompressed_body));
+        RETURN_IF_ERROR(codec->decompress(compressed_body, &decompressed_body));
         if (decompressed_body.size != footer->uncompressed_size()) {
             return Status::Corruption(
                     strings::Substitute("Bad page: record uncompressed size=$0 vs real decompressed size=$1",
@@ -21,6 +21,7 @@
 
 #include "storage/rowset/segment_v2/parsed_page.h"
 
+#include <cstring>
 #include <memory>
 
 #include "column/nullable_column.h"
@@ -182,6 +183,32 @@ public:
         return Status::OK();
     }
 
+    Status evaluate(const vectorized::ColumnPredicate* pred, size_t* count, uint8_t* selection) override {
+        *count = std::min(*count, remaining());
+        size_t nrows_to_evaluate = *count;
+        if (_has_null) {
+            while (nrows_to_evaluate > 0) {
+                bool is_null = false;
+                size_t this_run = _null_decoder.GetNextRun(&is_null, nrows_to_evaluate);
+                size_t expect = this_run;
+                if (!is_null) {
+                    RETURN_IF_ERROR(_data_decoder->evaluate_predicate(pred, &this_run, selection));
+                    DCHECK_EQ(expect, this_run);
+                } else {
+                    memset(selection, 0, this_run);
+                }
+                selection += this_run;
+                nrows_to_evaluate -= this_run;
+                _offset_in_page += this_run;
+            }
+        } else {
+            RETURN_IF_ERROR(_data_decoder->evaluate_predicate(pred, &nrows_to_evaluate, selection));
+            DCHECK_EQ(nrows_to_evaluate, *count);
+            _offset_in_page += nrows_to_evaluate;
+        }
+        return Status::OK();
+    }
+
 private:
     friend Status parse_page_v1(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
@@ -249,6 +276,20 @@ public:
         return Status::OK();
     }
 
+    Status evaluate(const vectorized::ColumnPredicate* pred, size_t* count, uint8_t* selection) override {
+        DCHECK_EQ(_offset_in_page, _data_decoder->current_index());
+        RETURN_IF_ERROR(_data_decoder->evaluate_predicate(pred, count, selection));
+        if (_null_flags.size() > 0) {
+            // the values of NULL records are default values, which may be selected.
+            const uint8_t* null_flags = _null_flags.data() + _offset_in_page;
+            for (size_t i = 0; i < *count; i++) {
+                selection[i] &= !null_flags[i];
+            }
+        }
+        _offset_in_page += *count;
+        return Status::OK();
+    }
+
 private:
     friend Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
@@ -34,7 +34,8 @@ class Status;
 
 namespace vectorized {
 class Column;
-}
+class ColumnPredicate;
+} // namespace vectorized
 
 namespace segment_v2 {
 
@@ -106,6 +107,13 @@ public:
     // On error, the value of |*count| is undefined.
     virtual Status read_dict_codes(vectorized::Column* column, size_t* count) = 0;
 
+    // Evaluate |pred| on up to |*count| records from this page without reading them out, see
+    // `PageDecoder::evaluate_predicate`, and set |selection[i]| to 1 if the i-th record is selected,
+    // 0 otherwise. NULL records are never selected.
+    // On success, `Status::OK` is returned, and the number of evaluated records will be updated to
+    // |count|, the page offset is advanced by this number too.
+    virtual Status evaluate(const vectorized::ColumnPredicate* pred, size_t* count, uint8_t* selection) = 0;
+
 protected:
     uint32_t _page_index;
     uint64_t _num_rows;
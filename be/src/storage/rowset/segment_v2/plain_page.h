@@ -28,6 +28,7 @@
 #include "storage/types.h"
 #include "util/coding.h"
 #include "util/faststring.h"
+#include "util/unaligned_access.h"
 
 namespace starrocks {
 namespace segment_v2 {
@@ -106,6 +107,8 @@ private:
 template <FieldType Type>
 class PlainPageDecoder : public PageDecoder {
 public:
+    typedef typename TypeTraits<Type>::CppType CppType;
+
     PlainPageDecoder(Slice data, const PageDecoderOptions& options)
             : _data(data), _options(options), _parsed(false), _num_elems(0), _cur_idx(0) {}
 
@@ -229,13 +232,28 @@ public:
 
     EncodingTypePB encoding_type() const override { return PLAIN_ENCODING; }
 
+    // Return the value at |idx|, used when this page is the dictionary page of DictPageDecoder.
+    CppType value_at(size_t idx) const {
+        return unaligned_load<CppType>(&_data[PLAIN_PAGE_HEADER_SIZE + idx * SIZE_OF_TYPE]);
+    }
+
+    // Return the index of |value| in this page, or -1 if not found.
+    int find(const CppType& value) const {
+        DCHECK(_parsed);
+        for (uint32_t i = 0; i < _num_elems; i++) {
+            if (value_at(i) == value) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
 private:
     Slice _data;
     PageDecoderOptions _options;
     bool _parsed;
     uint32_t _num_elems;
     uint32_t _cur_idx;
-    typedef typename TypeTraits<Type>::CppType CppType;
     enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
 };
 
@@ -25,6 +25,8 @@
 #include "storage/rowset/segment_v2/options.h"
 #include "storage/rowset/segment_v2/page_builder.h"
 #include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/vectorized/chunk_helper.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/coding.h"
 #include "util/rle_encoding.h"
 #include "util/slice.h"
@@ -231,6 +233,36 @@ public:
         return Status::OK();
     }
 
+    // The predicate is evaluated once per run instead of once per value.
+    Status evaluate_predicate(const vectorized::ColumnPredicate* pred, size_t* n, uint8_t* selection) override {
+        DCHECK(_parsed);
+        *n = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        if (_values == nullptr) {
+            _values = vectorized::ChunkHelper::column_from_field_type(Type, false);
+            _values->resize(1);
+        }
+        auto* value = reinterpret_cast<CppType*>(_values->mutable_raw_data());
+        CppType last_value{};
+        uint8_t last_selected = 0;
+        bool evaluated = false;
+        size_t offset = 0;
+        while (offset < *n) {
+            size_t run = _rle_decoder.GetNextRun(value, *n - offset);
+            if (PREDICT_FALSE(run == 0)) {
+                return Status::Corruption("RLE decode failed");
+            }
+            if (!evaluated || *value != last_value) {
+                pred->evaluate(_values.get(), &last_selected);
+                last_value = *value;
+                evaluated = true;
+            }
+            memset(selection + offset, last_selected, run);
+            offset += run;
+        }
+        _cur_index += *n;
+        return Status::OK();
+    }
+
     size_t count() const override { return _num_elements; }
 
     size_t current_index() const override { return _cur_index; }
@@ -248,6 +280,8 @@ private:
     size_t _cur_index;
     int _bit_width;
     RleDecoder<CppType> _rle_decoder;
+    // a single value column to evaluate the predicates on.
+    vectorized::ColumnPtr _values;
 };
 
 } // namespace segment_v2
@@ -28,6 +28,7 @@
 #include "gutil/strings/substitute.h"
 #include "storage/fs/fs_util.h"
 #include "storage/rowset/segment_v2/column_reader.h"
+#include "storage/rowset/segment_v2/column_statistics.h"
 #include "storage/rowset/segment_v2/empty_segment_iterator.h"
 #include "storage/rowset/segment_v2/page_io.h"
 #include "storage/rowset/segment_v2/segment_iterator.h"
@@ -235,6 +236,34 @@ Status Segment::_load_index() {
     });
 }
 
+Status Segment::get_short_keys(std::vector<std::string>* keys) {
+    RETURN_IF_ERROR(_load_index());
+    uint32_t n = _sk_index_decoder->num_items();
+    keys->reserve(keys->size() + n);
+    for (uint32_t i = 0; i < n; i++) {
+        keys->emplace_back(_sk_index_decoder->key(i).to_string());
+    }
+    return Status::OK();
+}
+
+Status Segment::get_column_statistics(uint32_t cid, ColumnStatistics* stats) const {
+    uint32_t unique_id = _tablet_schema->column(cid).unique_id();
+    for (const auto& column_pb : _footer.columns()) {
+        if (column_pb.unique_id() != unique_id) {
+            continue;
+        }
+        if (!column_pb.has_statistics()) {
+            break;
+        }
+        if (column_pb.type() != stats->type()) {
+            return Status::InvalidArgument(strings::Substitute("column $0 of type $1 in segment $2, expected type $3",
+                                                               cid, column_pb.type(), _fname, stats->type()));
+        }
+        return stats->merge(column_pb.statistics());
+    }
+    return Status::NotFound(strings::Substitute("no statistics of column $0 in segment $1", cid, _fname));
+}
+
 Status Segment::_create_column_readers() {
     std::unordered_map<uint32_t, uint32_t> column_id_to_footer_ordinal;
     for (uint32_t ordinal = 0; ordinal < _footer.columns().size(); ++ordinal) {
@@ -59,6 +59,7 @@ namespace segment_v2 {
 class BitmapIndexIterator;
 class ColumnReader;
 class ColumnIterator;
+class ColumnStatistics;
 class Segment;
 class SegmentIterator;
 using SegmentSharedPtr = std::shared_ptr<Segment>;
@@ -95,7 +96,12 @@ public:
 
     Status new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** iter);
 
-    size_t num_short_keys() const { return _tablet_schema->num_short_key_columns(); }
+    // The number of key columns encoded by the short key index of this segment.
+    size_t num_short_keys() const {
+        DCHECK(_load_index_once.has_called() && _load_index_once.stored_result().ok());
+        uint32_t n = _sk_index_decoder->num_short_key_columns();
+        return n > 0 ? n : _tablet_schema->num_short_key_columns();
+    }
 
     uint32_t num_rows_per_block() const {
         DCHECK(_load_index_once.has_called() && _load_index_once.stored_result().ok());
@@ -112,6 +118,18 @@ public:
         return _sk_index_decoder->upper_bound(key);
     }
 
+    bool has_block_max_keys() const {
+        DCHECK(_load_index_once.has_called() && _load_index_once.stored_result().ok());
+        return _sk_index_decoder->has_max_keys();
+    }
+
+    // Return the first row block whose last key is equal with or greater than |key|, or the
+    // number of row blocks if there is no such block. Only valid if has_block_max_keys().
+    uint32_t lower_bound_by_max_key(const Slice& key) const {
+        DCHECK(_load_index_once.has_called() && _load_index_once.stored_result().ok());
+        return _sk_index_decoder->lower_bound_by_max_key(key);
+    }
+
     // This will return the last row block in this segment.
     // NOTE: Before call this function , client should assure that
     // this segment is not empty.
@@ -121,6 +139,14 @@ public:
         return _sk_index_decoder->num_items() - 1;
     }
 
+    // Merge the statistics of the values of the column |cid| into |stats|. Return NotFound if
+    // they were not collected, e.g. the segment was written by an old version.
+    Status get_column_statistics(uint32_t cid, ColumnStatistics* stats) const;
+
+    // Append the encoded short key of every row block to |keys|, in key order.
+    // Used to split the key space of a tablet, e.g. by parallel compaction.
+    Status get_short_keys(std::vector<std::string>* keys);
+
     // only used by UT
     const SegmentFooterPB& footer() const { return _footer; }
 
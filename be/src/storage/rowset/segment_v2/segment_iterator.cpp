@@ -308,7 +308,11 @@ Status SegmentIterator::_lookup_ordinal(const RowCursor& key, bool is_include, r
 
     uint32_t start_block_id = 0;
     auto start_iter = _segment->lower_bound(index_key);
-    if (start_iter.valid()) {
+    if (_segment->has_block_max_keys()) {
+        // The blocks before the first one whose last key is not less than the key contain
+        // smaller keys only.
+        start_block_id = std::min(_segment->lower_bound_by_max_key(index_key), _segment->last_block());
+    } else if (start_iter.valid()) {
         // Because previous block may contain this key, so we should set rowid to
         // last block's first row.
         start_block_id = start_iter.ordinal();
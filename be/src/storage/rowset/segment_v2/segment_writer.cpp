@@ -31,6 +31,7 @@
 #include "storage/fs/block_manager.h"
 #include "storage/row.h"                             // ContiguousRow
 #include "storage/row_cursor.h"                      // RowCursor
+#include "storage/rowset/segment_v2/column_statistics.h"
 #include "storage/rowset/segment_v2/column_writer.h" // ColumnWriter
 #include "storage/rowset/segment_v2/page_io.h"
 #include "storage/schema.h"
@@ -96,11 +97,15 @@ Status SegmentWriter::init(uint32_t write_mbytes_per_sec __attribute__((unused))
         }
         opts.need_bloom_filter = column.is_bf_column();
         opts.need_bitmap_index = column.has_bitmap_index();
+        opts.ngram_bf_gram_size = column.ngram_bf_gram_size();
+        opts.inverted_index_tokenizer = column.inverted_index_tokenizer();
+        opts.need_statistics =
+                config::enable_segment_column_statistics && ColumnStatisticsWriter::is_supported(column.type());
         if (column.type() == FieldType::OLAP_FIELD_TYPE_ARRAY) {
-            if (opts.need_bloom_filter) {
+            if (opts.need_bloom_filter || opts.ngram_bf_gram_size > 0) {
                 return Status::NotSupported("Do not support bloom filter for array type");
             }
-            if (opts.need_bitmap_index) {
+            if (opts.need_bitmap_index || opts.inverted_index_tokenizer != UNKNOWN_TOKENIZER) {
                 return Status::NotSupported("Do not support bitmap index for array type");
             }
         }
@@ -110,10 +115,35 @@ Status SegmentWriter::init(uint32_t write_mbytes_per_sec __attribute__((unused))
         RETURN_IF_ERROR(writer->init());
         _column_writers.push_back(std::move(writer));
     }
-    _index_builder = std::make_unique<ShortKeyIndexBuilder>(_segment_id, _opts.num_rows_per_block);
+    _num_short_keys = _num_index_key_columns();
+    // Record the number only if it differs from the tablet's, so that the index is readable by old versions.
+    bool extra_short_keys = _num_short_keys != _tablet_schema->num_short_key_columns();
+    uint32_t recorded_short_keys = extra_short_keys ? _num_short_keys : 0;
+    // The old versions ignore the recorded number and would seek by shorter keys, the block max keys
+    // that follow the index break their size check of the index instead.
+    _write_block_max_key = _opts.write_block_max_key || extra_short_keys;
+    _index_builder = std::make_unique<ShortKeyIndexBuilder>(_segment_id, _opts.num_rows_per_block, recorded_short_keys);
     return Status::OK();
 }
 
+// The key columns after the short key columns are indexed as long as they and the columns before
+// them are encoded in full, i.e. up to the first CHAR/VARCHAR column, whose encoded value is only a
+// prefix and would break the order of the keys of the columns after it.
+size_t SegmentWriter::_num_index_key_columns() const {
+    size_t n = _tablet_schema->num_short_key_columns();
+    size_t max_columns = std::min<size_t>(_opts.max_short_key_columns, _tablet_schema->num_key_columns());
+    while (n > 0 && n < max_columns) {
+        FieldType prev_type = _tablet_schema->column(n - 1).type();
+        FieldType type = _tablet_schema->column(n).type();
+        if (prev_type == OLAP_FIELD_TYPE_CHAR || prev_type == OLAP_FIELD_TYPE_VARCHAR ||
+            type == OLAP_FIELD_TYPE_CHAR || type == OLAP_FIELD_TYPE_VARCHAR) {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
 template <typename RowType>
 Status SegmentWriter::append_row(const RowType& row) {
     for (size_t cid = 0; cid < _column_writers.size(); ++cid) {
@@ -123,11 +153,18 @@ Status SegmentWriter::append_row(const RowType& row) {
 
     // At the begin of one block, so add a short key index entry
     if ((_row_count % _opts.num_rows_per_block) == 0) {
+        if (_row_count > 0 && _write_block_max_key) {
+            RETURN_IF_ERROR(_index_builder->add_max_item(_last_key));
+        }
         std::string encoded_key;
-        encode_key(&encoded_key, row, _tablet_schema->num_short_key_columns());
+        encode_key(&encoded_key, row, _num_short_keys);
         RETURN_IF_ERROR(_index_builder->add_item(encoded_key));
         _mem_tracker->consume(static_cast<int64_t>(estimate_segment_size()) - _mem_tracker->consumption());
     }
+    if (_write_block_max_key) {
+        _last_key.clear();
+        encode_key(&_last_key, row, _num_short_keys);
+    }
     ++_row_count;
     return Status::OK();
 }
@@ -153,6 +190,9 @@ Status SegmentWriter::finalize(uint64_t* segment_file_size, uint64_t* index_size
     for (auto& column_writer : _column_writers) {
         RETURN_IF_ERROR(column_writer->finish());
     }
+    if (_row_count > 0 && _write_block_max_key) {
+        RETURN_IF_ERROR(_index_builder->add_max_item(_last_key));
+    }
     RETURN_IF_ERROR(_write_data());
     uint64_t index_offset = _wblock->bytes_appended();
     RETURN_IF_ERROR(_write_ordinal_index());
@@ -254,13 +294,25 @@ Status SegmentWriter::append_chunk(const vectorized::Chunk& chunk) {
     for (size_t i = 0; i < chunk.num_rows(); i++) {
         // At the begin of one block, so add a short key index entry
         if ((_row_count % _opts.num_rows_per_block) == 0) {
-            size_t keys = _tablet_schema->num_short_key_columns();
+            if (_row_count > 0 && _write_block_max_key) {
+                // The last row of the previous block is the previous row of this chunk, or
+                // the last row of the previous chunk.
+                if (i > 0) {
+                    vectorized::SeekTuple tuple(*chunk.schema(), chunk.get(i - 1).datums());
+                    _last_key = tuple.short_key_encode(_num_short_keys, 0);
+                }
+                RETURN_IF_ERROR(_index_builder->add_max_item(_last_key));
+            }
             vectorized::SeekTuple tuple(*chunk.schema(), chunk.get(i).datums());
-            std::string encoded_key = tuple.short_key_encode(keys, 0);
+            std::string encoded_key = tuple.short_key_encode(_num_short_keys, 0);
             RETURN_IF_ERROR(_index_builder->add_item(encoded_key));
         }
         ++_row_count;
     }
+    if (_write_block_max_key && chunk.num_rows() > 0) {
+        vectorized::SeekTuple tuple(*chunk.schema(), chunk.get(chunk.num_rows() - 1).datums());
+        _last_key = tuple.short_key_encode(_num_short_keys, 0);
+    }
     _mem_tracker->consume(static_cast<int64_t>(estimate_segment_size()) - _mem_tracker->consumption());
     return Status::OK();
 }
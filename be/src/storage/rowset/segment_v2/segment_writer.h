@@ -57,6 +57,11 @@ extern const uint32_t k_segment_magic_length;
 struct SegmentWriterOptions {
     uint32_t storage_format_version = 1;
     uint32_t num_rows_per_block = 1024;
+    // The maximum number of key columns encoded by the short key index, see
+    // config::short_key_index_max_columns. 0 to index the short key columns only.
+    uint32_t max_short_key_columns = 0;
+    // Whether to write the last key of every block of the short key index too.
+    bool write_block_max_key = false;
     MemTracker* mem_tracker = nullptr;
 };
 
@@ -94,6 +99,7 @@ private:
     Status _write_footer();
     Status _write_raw_data(const std::vector<Slice>& slices);
     void _init_column_meta(ColumnMetaPB* meta, uint32_t* column_id, const TabletColumn& column);
+    size_t _num_index_key_columns() const;
 
     std::unique_ptr<MemTracker> _mem_tracker = nullptr;
     uint32_t _segment_id;
@@ -106,6 +112,12 @@ private:
     std::unique_ptr<ShortKeyIndexBuilder> _index_builder;
     std::vector<std::unique_ptr<ColumnWriter>> _column_writers;
     uint32_t _row_count = 0;
+    // The number of key columns encoded by the short key index.
+    size_t _num_short_keys = 0;
+    // Whether to write the last key of every block, see init().
+    bool _write_block_max_key = false;
+    // The encoded key of the last appended row, kept only if |_write_block_max_key| is true.
+    std::string _last_key;
 };
 
 } // namespace segment_v2
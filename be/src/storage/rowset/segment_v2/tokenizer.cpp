@@ -0,0 +1,76 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/tokenizer.h"
+
+#include <cctype>
+
+#include "gutil/strings/substitute.h"
+
+namespace starrocks::segment_v2 {
+
+// ASCII letters and digits, and all the bytes of multi-byte UTF-8 characters, so that
+// words of the languages without case are kept as they are. ASCII letters are lower-cased.
+class StandardTokenizer final : public Tokenizer {
+public:
+    TokenizerTypePB type() const override { return STANDARD_TOKENIZER; }
+
+protected:
+    bool is_token_char(uint8_t c) const override { return c >= 0x80 || std::isalnum(c); }
+
+    char normalize(char c) const override { return static_cast<char>(std::tolower(static_cast<uint8_t>(c))); }
+};
+
+// Everything except the ASCII whitespaces, and the '\0' padding of CHAR values.
+class WhitespaceTokenizer final : public Tokenizer {
+public:
+    TokenizerTypePB type() const override { return WHITESPACE_TOKENIZER; }
+
+protected:
+    bool is_token_char(uint8_t c) const override { return c != '\0' && !std::isspace(c); }
+};
+
+Status Tokenizer::create(TokenizerTypePB type, std::unique_ptr<Tokenizer>* res) {
+    switch (type) {
+    case STANDARD_TOKENIZER:
+        *res = std::make_unique<StandardTokenizer>();
+        return Status::OK();
+    case WHITESPACE_TOKENIZER:
+        *res = std::make_unique<WhitespaceTokenizer>();
+        return Status::OK();
+    default:
+        return Status::NotSupported(strings::Substitute("unsupported tokenizer $0", type));
+    }
+}
+
+void Tokenizer::tokenize(const Slice& text, std::vector<std::string>* tokens) const {
+    _tokenize(text, false, tokens);
+}
+
+void Tokenizer::inner_tokens(const Slice& text, std::vector<std::string>* tokens) const {
+    _tokenize(text, true, tokens);
+}
+
+void Tokenizer::_tokenize(const Slice& text, bool inner_only, std::vector<std::string>* tokens) const {
+    const auto* s = reinterpret_cast<const uint8_t*>(text.data);
+    size_t i = 0;
+    while (i < text.size) {
+        if (!is_token_char(s[i])) {
+            i++;
+            continue;
+        }
+        size_t start = i;
+        while (i < text.size && is_token_char(s[i])) {
+            i++;
+        }
+        if (inner_only && (start == 0 || i == text.size)) {
+            continue;
+        }
+        std::string token(text.data + start, i - start);
+        for (char& c : token) {
+            c = normalize(c);
+        }
+        tokens->emplace_back(std::move(token));
+    }
+}
+
+} // namespace starrocks::segment_v2
@@ -0,0 +1,42 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/segment_v2.pb.h"
+#include "util/slice.h"
+
+namespace starrocks::segment_v2 {
+
+// Splits a string into tokens, the terms of the inverted index. A token is a maximal run of token
+// characters, which are normalized before being added to the token.
+class Tokenizer {
+public:
+    static Status create(TokenizerTypePB type, std::unique_ptr<Tokenizer>* res);
+
+    virtual ~Tokenizer() = default;
+
+    virtual TokenizerTypePB type() const = 0;
+
+    // Append the tokens of |text| to |tokens| in order, duplicates included.
+    void tokenize(const Slice& text, std::vector<std::string>* tokens) const;
+
+    // Append the tokens of |text| that are also tokens of every string containing |text|, i.e.
+    // the tokens not touching the start or the end of |text|, which could be part of longer tokens.
+    // e.g. the inner tokens of "ick brown fo" are ["brown"].
+    void inner_tokens(const Slice& text, std::vector<std::string>* tokens) const;
+
+protected:
+    virtual bool is_token_char(uint8_t c) const = 0;
+
+    virtual char normalize(char c) const { return c; }
+
+private:
+    void _tokenize(const Slice& text, bool inner_only, std::vector<std::string>* tokens) const;
+};
+
+} // namespace starrocks::segment_v2
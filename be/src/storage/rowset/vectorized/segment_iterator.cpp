@@ -69,6 +69,24 @@ static int compare(const SeekTuple& tuple, const Chunk& chunk) {
     return 0;
 }
 
+// Look up |value| in the dictionary of |iter|, the column of which is of |type|.
+static int dict_lookup(ColumnIterator* iter, FieldType type, const Datum& value) {
+    switch (type) {
+    case OLAP_FIELD_TYPE_INT:
+    case OLAP_FIELD_TYPE_DATE_V2: {
+        int32_t v = type == OLAP_FIELD_TYPE_INT ? value.get_int32() : value.get_date().julian();
+        return iter->dict_lookup(Slice(reinterpret_cast<const char*>(&v), sizeof(v)));
+    }
+    case OLAP_FIELD_TYPE_BIGINT:
+    case OLAP_FIELD_TYPE_TIMESTAMP: {
+        int64_t v = type == OLAP_FIELD_TYPE_BIGINT ? value.get_int64() : value.get_timestamp().timestamp();
+        return iter->dict_lookup(Slice(reinterpret_cast<const char*>(&v), sizeof(v)));
+    }
+    default:
+        return iter->dict_lookup(value.get_slice());
+    }
+}
+
 // DictCodeColumnIterator is a wrapper/proxy on another column iterator that will
 // transform the invoking of `next_batch(size_t*, Column*)` to the invoking of
 // `next_dict_codes(size_t*, Column*)`.
@@ -201,6 +219,7 @@ private:
     Status _get_row_ranges_by_keys();
     Status _get_row_ranges_by_zone_map();
     Status _get_row_ranges_by_bloom_filter();
+    Status _get_row_ranges_by_inverted_index();
 
     uint32_t segment_id() const { return _segment->id(); }
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -240,6 +259,8 @@ private:
 
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
 
+    Status _prune_range_by_encoded_predicate(Range* r, uint8_t* selection);
+
 private:
     std::shared_ptr<Segment> _segment;
     vectorized::SegmentReadOptions _opts;
@@ -258,6 +279,10 @@ private:
 
     std::vector<const ColumnPredicate*> _vectorized_preds;
     std::vector<const ColumnPredicate*> _branchless_preds;
+    // a predicate in |_vectorized_preds| evaluated on the encoded values of its column to skip
+    // the leading and trailing rows of a range filtered out by it before reading any column, its
+    // selection of the rows read is left in |_selection| for `_filter`.
+    const ColumnPredicate* _encoded_pred = nullptr;
     // _selection is used to accelerate
     Buffer<uint8_t> _selection;
 
@@ -334,6 +359,7 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_init_bitmap_index_iterators());
     RETURN_IF_ERROR(_get_row_ranges_by_keys());
     RETURN_IF_ERROR(_apply_bitmap_index());
+    RETURN_IF_ERROR(_get_row_ranges_by_inverted_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
     _rewrite_predicates();
@@ -395,6 +421,28 @@ void SegmentIterator::_init_column_predicates() {
     if (_vectorized_preds.empty() && _branchless_preds.empty()) {
         _opts.predicates.clear();
     }
+    if (!config::enable_predicate_evaluation_on_encoded_pages) {
+        return;
+    }
+    for (const ColumnPredicate* pred : _vectorized_preds) {
+        switch (pred->type()) {
+        case PredicateType::kEQ:
+        case PredicateType::kNE:
+        case PredicateType::kGT:
+        case PredicateType::kGE:
+        case PredicateType::kLT: // and kLE
+        case PredicateType::kInList:
+        case PredicateType::kNotInList:
+            break;
+        default:
+            continue;
+        }
+        const ColumnId cid = pred->column_id();
+        if (!_predicate_need_rewrite[cid] && _column_iterators[cid]->support_encoded_predicate(pred)) {
+            _encoded_pred = pred;
+            break;
+        }
+    }
 }
 
 Status SegmentIterator::_get_row_ranges_by_keys() {
@@ -490,7 +538,11 @@ Status SegmentIterator::_lookup_ordinal(const SeekTuple& key, bool lower, rowid_
 
     uint32_t start_block_id;
     auto start_iter = _segment->lower_bound(index_key);
-    if (start_iter.valid()) {
+    if (_segment->has_block_max_keys()) {
+        // The blocks before the first one whose last key is not less than the key contain
+        // smaller keys only.
+        start_block_id = std::min(_segment->lower_bound_by_max_key(index_key), _segment->last_block());
+    } else if (start_iter.valid()) {
         // Because previous block may contain this key, so we should set rowid to
         // last block's first row.
         start_block_id = start_iter.ordinal();
@@ -565,8 +617,43 @@ Status SegmentIterator::_read_columns(const Schema& schema, Chunk* chunk, size_t
     return Status::OK();
 }
 
+// Shrink |r| to the rows between the first and the last rows selected by |_encoded_pred|, and
+// store the selection of the rows of the shrunk range in |selection|.
+Status SegmentIterator::_prune_range_by_encoded_predicate(Range* r, uint8_t* selection) {
+    SCOPED_RAW_TIMER(&_opts.stats->vec_cond_evaluate_ns);
+    ColumnIterator* iter = _column_iterators[_encoded_pred->column_id()];
+    RETURN_IF_ERROR(iter->seek_to_ordinal(r->begin()));
+    size_t n = r->span_size();
+    RETURN_IF_ERROR(iter->evaluate_predicate(_encoded_pred, &n, selection));
+    DCHECK_EQ(r->span_size(), n);
+    size_t first = 0;
+    while (first < n && !selection[first]) {
+        first++;
+    }
+    size_t last = n;
+    while (last > first && !selection[last - 1]) {
+        last--;
+    }
+    if (first > 0) {
+        memmove(selection, selection + first, last - first);
+    }
+    *r = Range(r->begin() + first, r->begin() + last);
+    if (!r->empty()) {
+        // the other columns are seeked by `_read` unless the range begins at |_cur_rowid|.
+        RETURN_IF_ERROR(iter->seek_to_ordinal(r->begin()));
+    }
+    return Status::OK();
+}
+
 inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowid, size_t n) {
     Range r = _range_iter.next(n);
+    if (_encoded_pred != nullptr) {
+        // the rows read are appended to |chunk| and filtered by `_filter` at the same offset.
+        RETURN_IF_ERROR(_prune_range_by_encoded_predicate(&r, _selection.data() + chunk->num_rows()));
+        if (r.empty()) {
+            return Status::OK();
+        }
+    }
     size_t nread = r.span_size();
     if (_cur_rowid != r.begin() || _cur_rowid == 0) {
         _cur_rowid = r.begin();
@@ -769,13 +856,19 @@ uint16_t SegmentIterator::_filter(Chunk* chunk, vector<rowid_t>* rowid, uint16_t
     // first evaluate
     if (!_vectorized_preds.empty()) {
         SCOPED_RAW_TIMER(&_opts.stats->vec_cond_evaluate_ns);
-        const ColumnPredicate* pred = _vectorized_preds[0];
-        Column* c = chunk->get_column_by_id(pred->column_id()).get();
-        pred->evaluate(c, _selection.data(), from, to);
-        for (int i = 1; i < _vectorized_preds.size(); ++i) {
-            pred = _vectorized_preds[i];
-            c = chunk->get_column_by_id(pred->column_id()).get();
-            pred->evaluate_and(c, _selection.data(), from, to);
+        // the selection of |_encoded_pred| is already in |_selection|, see `_read`.
+        bool evaluated = _encoded_pred != nullptr;
+        for (const ColumnPredicate* pred : _vectorized_preds) {
+            if (pred == _encoded_pred) {
+                continue;
+            }
+            Column* c = chunk->get_column_by_id(pred->column_id()).get();
+            if (evaluated) {
+                pred->evaluate_and(c, _selection.data(), from, to);
+            } else {
+                pred->evaluate(c, _selection.data(), from, to);
+                evaluated = true;
+            }
         }
     }
 
@@ -960,9 +1053,10 @@ bool SegmentIterator::_rewrite_predicate(const FieldPtr& field) {
     // the predicate has been erased, because of bitmap index filter.
     RETURN_IF(preds.empty(), false);
     const ColumnPredicate* pred = preds[0];
+    const FieldType type = field->type()->type();
     if (PredicateType::kEQ == pred->type()) {
         Datum value = pred->value();
-        int code = _column_iterators[cid]->dict_lookup(value.get_slice());
+        int code = dict_lookup(_column_iterators[cid], type, value);
         if (code < 0) {
             // predicate always false, clear scan range, this will make `get_next` return EOF directly.
             _scan_range = _scan_range.intersection(SparseRange());
@@ -974,7 +1068,7 @@ bool SegmentIterator::_rewrite_predicate(const FieldPtr& field) {
     }
     if (PredicateType::kNE == pred->type()) {
         Datum value = pred->value();
-        int code = _column_iterators[cid]->dict_lookup(value.get_slice());
+        int code = dict_lookup(_column_iterators[cid], type, value);
         if (code < 0) {
             if (!field->is_nullable()) {
                 // predicate always true, clear this predicate.
@@ -982,7 +1076,7 @@ bool SegmentIterator::_rewrite_predicate(const FieldPtr& field) {
                 return false;
             } else {
                 // convert this predicate to `not null` predicate.
-                auto ptr = new_column_null_predicate(get_type_info(OLAP_FIELD_TYPE_VARCHAR), cid, false);
+                auto ptr = new_column_null_predicate(field->type(), cid, false);
                 preds[0] = _obj_pool.add(ptr);
                 return false; // disable low cardinality optimization.
             }
@@ -995,7 +1089,7 @@ bool SegmentIterator::_rewrite_predicate(const FieldPtr& field) {
         std::vector<Datum> values = pred->values();
         std::vector<int> codewords;
         for (const auto& value : values) {
-            if (int code = _column_iterators[cid]->dict_lookup(value.get_slice()); code >= 0) {
+            if (int code = dict_lookup(_column_iterators[cid], type, value); code >= 0) {
                 codewords.emplace_back(code);
             }
         }
@@ -1017,7 +1111,7 @@ bool SegmentIterator::_rewrite_predicate(const FieldPtr& field) {
         std::vector<Datum> values = pred->values();
         std::vector<int> codewords;
         for (const auto& value : values) {
-            if (int code = _column_iterators[cid]->dict_lookup(value.get_slice()); code >= 0) {
+            if (int code = dict_lookup(_column_iterators[cid], type, value); code >= 0) {
                 codewords.emplace_back(code);
             }
         }
@@ -1028,7 +1122,7 @@ bool SegmentIterator::_rewrite_predicate(const FieldPtr& field) {
                 return false;
             } else {
                 // convert this predicate to `not null` predicate.
-                auto ptr = new_column_null_predicate(get_type_info(OLAP_FIELD_TYPE_VARCHAR), cid, false);
+                auto ptr = new_column_null_predicate(field->type(), cid, false);
                 preds[0] = _obj_pool.add(ptr);
                 return false; // disable low cardinality optimization.
             }
@@ -1082,7 +1176,8 @@ void SegmentIterator::_check_low_cardinality_optimization() {
     for (size_t i = 0; i < n; i++) {
         const FieldPtr& field = _schema.field(i);
         const FieldType type = field->type()->type();
-        if (type != OLAP_FIELD_TYPE_CHAR && type != OLAP_FIELD_TYPE_VARCHAR) {
+        if (type != OLAP_FIELD_TYPE_CHAR && type != OLAP_FIELD_TYPE_VARCHAR && type != OLAP_FIELD_TYPE_INT &&
+            type != OLAP_FIELD_TYPE_BIGINT && type != OLAP_FIELD_TYPE_DATE_V2 && type != OLAP_FIELD_TYPE_TIMESTAMP) {
             continue;
         }
         ColumnId cid = field->id();
@@ -1247,6 +1342,20 @@ Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     return Status::OK();
 }
 
+// filter rows by the inverted indexes, the predicates are kept since the inverted indexes
+// only tell the rows that may satisfy them.
+Status SegmentIterator::_get_row_ranges_by_inverted_index() {
+    RETURN_IF(_opts.predicates.empty() || _scan_range.empty(), Status::OK());
+    SCOPED_RAW_TIMER(&_opts.stats->bitmap_index_filter_timer);
+    size_t prev_size = _scan_range.span_size();
+    for (const auto& [cid, preds] : _opts.predicates) {
+        ColumnIterator* column_iter = _column_iterators[cid];
+        RETURN_IF_ERROR(column_iter->get_row_ranges_by_inverted_index(preds, &_scan_range));
+    }
+    _opts.stats->rows_bitmap_index_filtered += (prev_size - _scan_range.span_size());
+    return Status::OK();
+}
+
 void SegmentIterator::close() {
     _context_list[0].close();
     _context_list[1].close();
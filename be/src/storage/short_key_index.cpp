@@ -37,10 +37,39 @@ Status ShortKeyIndexBuilder::add_item(const Slice& key) {
     return Status::OK();
 }
 
+Status ShortKeyIndexBuilder::add_max_item(const Slice& key) {
+    put_varint32(&_max_offset_buf, _max_key_buf.size());
+    _max_key_buf.append(key.data, key.size);
+    _num_max_items++;
+    return Status::OK();
+}
+
+// Parse |num_items| varint offsets from |offset_slice| into |offsets|, plus |key_bytes| for the total length.
+static Status parse_key_offsets(Slice offset_slice, uint32_t num_items, uint32_t key_bytes,
+                                std::vector<uint32_t>* offsets) {
+    // +1 for record total length
+    offsets->resize(num_items + 1);
+    for (uint32_t i = 0; i < num_items; ++i) {
+        uint32_t offset = 0;
+        if (!get_varint32(&offset_slice, &offset)) {
+            return Status::Corruption("Fail to get varint from index offset buffer");
+        }
+        DCHECK(offset <= key_bytes) << "Offset is larger than total bytes, offset=" << offset
+                                    << ", key_bytes=" << key_bytes;
+        (*offsets)[i] = offset;
+    }
+    (*offsets)[num_items] = key_bytes;
+
+    if (offset_slice.size != 0) {
+        return Status::Corruption("Still has data after parse all key offset");
+    }
+    return Status::OK();
+}
+
 Status ShortKeyIndexBuilder::finalize(uint32_t num_segment_rows, std::vector<Slice>* body,
                                       segment_v2::PageFooterPB* page_footer) {
     page_footer->set_type(segment_v2::SHORT_KEY_PAGE);
-    page_footer->set_uncompressed_size(_key_buf.size() + _offset_buf.size());
+    page_footer->set_uncompressed_size(size());
 
     segment_v2::ShortKeyFooterPB* footer = page_footer->mutable_short_key_page_footer();
     footer->set_num_items(_num_items);
@@ -49,9 +78,24 @@ Status ShortKeyIndexBuilder::finalize(uint32_t num_segment_rows, std::vector<Sli
     footer->set_segment_id(_segment_id);
     footer->set_num_rows_per_block(_num_rows_per_block);
     footer->set_num_segment_rows(num_segment_rows);
+    if (_num_short_key_columns > 0) {
+        footer->set_num_short_key_columns(_num_short_key_columns);
+    }
 
     body->emplace_back(_key_buf);
     body->emplace_back(_offset_buf);
+    // the index encoding more columns than the tablet's short key columns must have the max keys,
+    // which make the older versions fail to read it, see SegmentWriter::init().
+    if (_num_max_items > 0 || _num_short_key_columns > 0) {
+        if (_num_max_items != _num_items) {
+            return Status::InternalError(strings::Substitute("Short key index has $0 items but $1 max items",
+                                                             _num_items, _num_max_items));
+        }
+        footer->set_max_key_bytes(_max_key_buf.size());
+        footer->set_max_offset_bytes(_max_offset_buf.size());
+        body->emplace_back(_max_key_buf);
+        body->emplace_back(_max_offset_buf);
+    }
     return Status::OK();
 }
 
@@ -59,9 +103,11 @@ Status ShortKeyIndexDecoder::parse(const Slice& body, const segment_v2::ShortKey
     _footer = footer;
 
     // check if body size match footer's information
-    if (body.size != (_footer.key_bytes() + _footer.offset_bytes())) {
+    size_t index_bytes = _footer.key_bytes() + _footer.offset_bytes();
+    size_t max_index_bytes = _footer.max_key_bytes() + _footer.max_offset_bytes();
+    if (body.size != index_bytes + max_index_bytes) {
         return Status::Corruption(strings::Substitute("Index size not match, need=$0, real=$1",
-                                                      _footer.key_bytes() + _footer.offset_bytes(), body.size));
+                                                      index_bytes + max_index_bytes, body.size));
     }
 
     // set index buffer
@@ -69,21 +115,13 @@ Status ShortKeyIndexDecoder::parse(const Slice& body, const segment_v2::ShortKey
 
     // parse offset information
     Slice offset_slice(body.data + _footer.key_bytes(), _footer.offset_bytes());
-    // +1 for record total length
-    _offsets.resize(_footer.num_items() + 1);
-    for (uint32_t i = 0; i < _footer.num_items(); ++i) {
-        uint32_t offset = 0;
-        if (!get_varint32(&offset_slice, &offset)) {
-            return Status::Corruption("Fail to get varint from index offset buffer");
-        }
-        DCHECK(offset <= _footer.key_bytes())
-                << "Offset is larger than total bytes, offset=" << offset << ", key_bytes=" << _footer.key_bytes();
-        _offsets[i] = offset;
-    }
-    _offsets[_footer.num_items()] = _footer.key_bytes();
+    RETURN_IF_ERROR(parse_key_offsets(offset_slice, _footer.num_items(), _footer.key_bytes(), &_offsets));
 
-    if (offset_slice.size != 0) {
-        return Status::Corruption("Still has data after parse all key offset");
+    if (_footer.has_max_key_bytes()) {
+        _max_key_data = Slice(body.data + index_bytes, _footer.max_key_bytes());
+        Slice max_offset_slice(body.data + index_bytes + _footer.max_key_bytes(), _footer.max_offset_bytes());
+        RETURN_IF_ERROR(
+                parse_key_offsets(max_offset_slice, _footer.num_items(), _footer.max_key_bytes(), &_max_offsets));
     }
     _parsed = true;
     return Status::OK();
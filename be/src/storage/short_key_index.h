@@ -114,9 +114,12 @@ void encode_key(std::string* buf, const RowType& row, size_t num_keys) {
 // otherwise error could happens. This builder would arrange the page body in the
 // following format:
 //      ShortKeyPageBody := KeyContent^NumEntry, KeyOffset(vint)^NumEntry
+//                          [MaxKeyContent^NumEntry, MaxKeyOffset(vint)^NumEntry]
 //      NumEntry, KeyBytes, OffsetBytes is stored in ShortKeyFooterPB
+// The optional max keys are the last keys of the blocks, their sizes are stored in
+// ShortKeyFooterPB too, and they are written only if add_max_item() is called.
 // Usage:
-//      ShortKeyIndexBuilder builder(segment_id, num_rows_per_block);
+//      ShortKeyIndexBuilder builder(segment_id, num_rows_per_block, num_short_key_columns);
 //      builder.add_item(key1);
 //      ...
 //      builder.add_item(keyN);
@@ -127,22 +130,34 @@ void encode_key(std::string* buf, const RowType& row, size_t num_keys) {
 //    more than short key
 class ShortKeyIndexBuilder {
 public:
-    ShortKeyIndexBuilder(uint32_t segment_id, uint32_t num_rows_per_block)
-            : _segment_id(segment_id), _num_rows_per_block(num_rows_per_block), _num_items(0) {}
+    // |num_short_key_columns| is the number of key columns encoded in each key, 0 if it's the
+    // number of the short key columns of the tablet.
+    ShortKeyIndexBuilder(uint32_t segment_id, uint32_t num_rows_per_block, uint32_t num_short_key_columns = 0)
+            : _segment_id(segment_id),
+              _num_rows_per_block(num_rows_per_block),
+              _num_short_key_columns(num_short_key_columns),
+              _num_items(0) {}
 
     Status add_item(const Slice& key);
 
-    uint64_t size() { return _key_buf.size() + _offset_buf.size(); }
+    // Add the last key of the block of the |add_item()| call with the same order.
+    Status add_max_item(const Slice& key);
+
+    uint64_t size() { return _key_buf.size() + _offset_buf.size() + _max_key_buf.size() + _max_offset_buf.size(); }
 
     Status finalize(uint32_t num_rows, std::vector<Slice>* body, segment_v2::PageFooterPB* footer);
 
 private:
     uint32_t _segment_id;
     uint32_t _num_rows_per_block;
+    uint32_t _num_short_key_columns;
     uint32_t _num_items;
+    uint32_t _num_max_items = 0;
 
     faststring _key_buf;
     faststring _offset_buf;
+    faststring _max_key_buf;
+    faststring _max_offset_buf;
 };
 
 class ShortKeyIndexDecoder;
@@ -249,15 +264,50 @@ public:
         return _footer.num_rows_per_block();
     }
 
+    // Return 0 if the index is written before the number is recorded, in which case the keys
+    // encode the short key columns of the tablet.
+    uint32_t num_short_key_columns() const {
+        DCHECK(_parsed);
+        return _footer.num_short_key_columns();
+    }
+
+    bool has_max_keys() const {
+        DCHECK(_parsed);
+        return _footer.has_max_key_bytes();
+    }
+
+    // Return the ordinal of the first block whose last key is equal with or greater than
+    // the given key, or num_items() if there is no such block.
+    uint32_t lower_bound_by_max_key(const Slice& key) const {
+        DCHECK(_parsed && has_max_keys());
+        uint32_t lo = 0;
+        uint32_t hi = num_items();
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (max_key(mid).compare(key) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
     Slice key(ssize_t ordinal) const {
         DCHECK(_parsed);
         DCHECK(ordinal >= 0 && ordinal < num_items());
         return {_key_data.data + _offsets[ordinal], _offsets[ordinal + 1] - _offsets[ordinal]};
     }
 
+    Slice max_key(ssize_t ordinal) const {
+        DCHECK(_parsed);
+        DCHECK(ordinal >= 0 && ordinal < num_items());
+        return {_max_key_data.data + _max_offsets[ordinal], _max_offsets[ordinal + 1] - _max_offsets[ordinal]};
+    }
+
     int64_t mem_usage() const {
-        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() + _key_data.size +
-               _footer.ByteSizeLong() - sizeof(_footer);
+        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * (_offsets.size() + _max_offsets.size()) +
+               _key_data.size + _max_key_data.size + _footer.ByteSizeLong() - sizeof(_footer);
     }
 
 private:
@@ -277,6 +327,8 @@ private:
     segment_v2::ShortKeyFooterPB _footer;
     std::vector<uint32_t> _offsets;
     Slice _key_data;
+    std::vector<uint32_t> _max_offsets;
+    Slice _max_key_data;
 };
 
 inline Slice ShortKeyIndexIterator::operator*() const {
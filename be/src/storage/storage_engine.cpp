@@ -39,6 +39,7 @@
 #include "common/status.h"
 #include "env/env.h"
 #include "runtime/exec_env.h"
+#include "storage/compaction_scheduler.h"
 #include "storage/data_dir.h"
 #include "storage/fs/file_block_manager.h"
 #include "storage/lru_cache.h"
@@ -54,12 +55,11 @@
 #include "storage/tablet_updates.h"
 #include "storage/update_manager.h"
 #include "storage/utils.h"
-#include "storage/vectorized/base_compaction.h"
-#include "storage/vectorized/cumulative_compaction.h"
 #include "util/file_utils.h"
 #include "util/pretty_printer.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -176,6 +176,12 @@ Status StorageEngine::_open() {
     _memtable_flush_executor.reset(new MemTableFlushExecutor());
     RETURN_IF_ERROR_WITH_WARN(_memtable_flush_executor->init(dirs), "init memtable_flush_executor failed");
 
+    RETURN_IF_ERROR_WITH_WARN(ThreadPoolBuilder("CompactionMergeThreadPool")
+                                      .set_min_threads(1)
+                                      .set_max_threads(std::max(1, config::compaction_parallel_merge_num_threads))
+                                      .build(&_compaction_merge_thread_pool),
+                              "init compaction merge thread pool failed");
+
     return Status::OK();
 }
 
@@ -442,6 +448,11 @@ bool StorageEngine::_delete_tablets_on_unused_root_path() {
 }
 
 void StorageEngine::_clear() {
+    // running compaction tasks refer to data dirs, stop them before releasing data dirs.
+    if (_compaction_scheduler != nullptr) {
+        _compaction_scheduler->stop();
+    }
+
     SAFE_DELETE(_index_stream_lru_cache);
     _file_cache.reset();
 
@@ -500,77 +511,6 @@ void StorageEngine::_start_clean_fd_cache() {
     VLOG(10) << "Cleaned file descritpor cache";
 }
 
-Status StorageEngine::_perform_cumulative_compaction(DataDir* data_dir) {
-    scoped_refptr<Trace> trace(new Trace);
-    MonotonicStopWatch watch;
-    watch.start();
-    SCOPED_CLEANUP({
-        if (watch.elapsed_time() / 1e9 > config::cumulative_compaction_trace_threshold) {
-            LOG(INFO) << "Trace:" << std::endl << trace->DumpToString(Trace::INCLUDE_ALL);
-        }
-    });
-    ADOPT_TRACE(trace.get());
-    TRACE("start to perform cumulative compaction");
-    TabletSharedPtr best_tablet =
-            _tablet_manager->find_best_tablet_to_compaction(CompactionType::CUMULATIVE_COMPACTION, data_dir);
-    if (best_tablet == nullptr) {
-        return Status::NotFound("there are no suitable tablets");
-    }
-    TRACE("found best tablet $0", best_tablet->get_tablet_info().tablet_id);
-
-    StarRocksMetrics::instance()->cumulative_compaction_request_total.increment(1);
-    vectorized::CumulativeCompaction cumulative_compaction(_options.compaction_mem_tracker, best_tablet);
-
-    Status res = cumulative_compaction.compact();
-    if (!res.ok()) {
-        best_tablet->set_last_cumu_compaction_failure_time(UnixMillis());
-        if (!res.is_not_found()) {
-            StarRocksMetrics::instance()->cumulative_compaction_request_failed.increment(1);
-            LOG(WARNING) << "Fail to vectorized compact table=" << best_tablet->full_name()
-                         << ", err=" << res.to_string();
-        }
-        return res;
-    }
-
-    best_tablet->set_last_cumu_compaction_failure_time(0);
-    return Status::OK();
-}
-
-Status StorageEngine::_perform_base_compaction(DataDir* data_dir) {
-    scoped_refptr<Trace> trace(new Trace);
-    MonotonicStopWatch watch;
-    watch.start();
-    SCOPED_CLEANUP({
-        if (watch.elapsed_time() / 1e9 > config::base_compaction_trace_threshold) {
-            LOG(INFO) << "Trace:" << std::endl << trace->DumpToString(Trace::INCLUDE_ALL);
-        }
-    });
-    ADOPT_TRACE(trace.get());
-    TRACE("start to perform base compaction");
-    TabletSharedPtr best_tablet =
-            _tablet_manager->find_best_tablet_to_compaction(CompactionType::BASE_COMPACTION, data_dir);
-    if (best_tablet == nullptr) {
-        return Status::NotFound("there are no suitable tablets");
-    }
-    TRACE("found best tablet $0", best_tablet->get_tablet_info().tablet_id);
-
-    StarRocksMetrics::instance()->base_compaction_request_total.increment(1);
-    vectorized::BaseCompaction base_compaction(_options.compaction_mem_tracker, best_tablet);
-    Status res = base_compaction.compact();
-    if (!res.ok()) {
-        best_tablet->set_last_base_compaction_failure_time(UnixMillis());
-        if (!res.is_not_found()) {
-            StarRocksMetrics::instance()->base_compaction_request_failed.increment(1);
-            LOG(WARNING) << "failed to init vectorized base compaction. res=" << res.to_string()
-                         << ", table=" << best_tablet->full_name();
-        }
-        return res;
-    }
-
-    best_tablet->set_last_base_compaction_failure_time(0);
-    return Status::OK();
-}
-
 Status StorageEngine::_perform_update_compaction(DataDir* data_dir) {
     scoped_refptr<Trace> trace(new Trace);
     MonotonicStopWatch watch;
@@ -57,8 +57,10 @@ namespace starrocks {
 class DataDir;
 class EngineTask;
 class BlockManager;
+class CompactionScheduler;
 class MemTableFlushExecutor;
 class Tablet;
+class ThreadPool;
 class UpdateManager;
 
 // StorageEngine singleton to manage all Table pointers.
@@ -149,6 +151,8 @@ public:
     MemTableFlushExecutor* memtable_flush_executor() { return _memtable_flush_executor.get(); }
     fs::BlockManager* block_manager() { return _block_manager.get(); }
     UpdateManager* update_manager() { return _update_manager.get(); }
+    CompactionScheduler* compaction_scheduler() { return _compaction_scheduler.get(); }
+    ThreadPool* compaction_merge_thread_pool() { return _compaction_merge_thread_pool.get(); }
 
     bool check_rowset_id_in_unused_rowsets(const RowsetId& rowset_id);
 
@@ -195,10 +199,6 @@ private:
     // unused rowset monitor thread
     void* _unused_rowset_monitor_thread_callback(void* arg);
 
-    // base compaction thread process function
-    void* _base_compaction_thread_callback(void* arg, DataDir* data_dir);
-    // cumulative process function
-    void* _cumulative_compaction_thread_callback(void* arg, DataDir* data_dir);
     // update compaction function
     void* _update_compaction_thread_callback(void* arg, DataDir* data_dir);
 
@@ -219,36 +219,11 @@ private:
     void* _tablet_checkpoint_callback(void* arg);
 
     void _start_clean_fd_cache();
-    Status _perform_cumulative_compaction(DataDir* data_dir);
-    Status _perform_base_compaction(DataDir* data_dir);
     Status _perform_update_compaction(DataDir* data_dir);
     OLAPStatus _start_trash_sweep(double* usage);
     void _start_disk_stat_monitor();
 
 private:
-    struct CompactionCandidate {
-        CompactionCandidate(uint32_t nicumulative_compaction_, int64_t tablet_id_, uint32_t index_)
-                : nice(nicumulative_compaction_), tablet_id(tablet_id_), disk_index(index_) {}
-        uint32_t nice;
-        int64_t tablet_id;
-        uint32_t disk_index = -1;
-    };
-
-    // In descending order
-    struct CompactionCandidateComparator {
-        bool operator()(const CompactionCandidate& a, const CompactionCandidate& b) { return a.nice > b.nice; }
-    };
-
-    struct CompactionDiskStat {
-        CompactionDiskStat(std::string path, uint32_t index, bool used)
-                : storage_path(path), disk_index(index), task_running(0), task_remaining(0), is_used(used) {}
-        const std::string storage_path;
-        const uint32_t disk_index;
-        uint32_t task_running;
-        uint32_t task_remaining;
-        bool is_used;
-    };
-
     EngineOptions _options;
     std::mutex _store_lock;
     std::map<std::string, DataDir*> _store_map;
@@ -283,10 +258,8 @@ private:
     std::thread _garbage_sweeper_thread;
     // thread to monitor disk stat
     std::thread _disk_stat_monitor_thread;
-    // threads to run base compaction
-    std::vector<std::thread> _base_compaction_threads;
-    // threads to check cumulative
-    std::vector<std::thread> _cumulative_compaction_threads;
+    // schedules base and cumulative compaction of all disks
+    std::unique_ptr<CompactionScheduler> _compaction_scheduler;
     // threads to run update compaction
     std::vector<std::thread> _update_compaction_threads;
     // threads to clean all file descriptor not actively in use
@@ -312,6 +285,9 @@ private:
 
     std::unique_ptr<MemTableFlushExecutor> _memtable_flush_executor;
 
+    // merges the key ranges of parallel compaction
+    std::unique_ptr<ThreadPool> _compaction_merge_thread_pool;
+
     std::unique_ptr<fs::BlockManager> _block_manager;
 
     std::unique_ptr<UpdateManager> _update_manager;
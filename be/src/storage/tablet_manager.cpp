@@ -30,6 +30,7 @@
 
 #include "env/env.h"
 #include "gutil/strings/strcat.h"
+#include "storage/compaction_scheduler.h"
 #include "storage/data_dir.h"
 #include "storage/olap_common.h"
 #include "storage/reader.h"
@@ -645,92 +646,93 @@ void TabletManager::get_tablet_stat(TTabletStatResult* result) {
     result->__set_tablets_stats(_tablet_stat_cache);
 }
 
-TabletSharedPtr TabletManager::find_best_tablet_to_compaction(CompactionType compaction_type, DataDir* data_dir) {
+bool TabletManager::_can_do_compaction_unlocked(const TabletSharedPtr& tablet_ptr, CompactionType compaction_type,
+                                                int64_t now_ms) {
+    if (tablet_ptr->keys_type() == PRIMARY_KEYS) {
+        return false;
+    }
+    AlterTabletTaskSharedPtr cur_alter_task = tablet_ptr->alter_task();
+    if (cur_alter_task != nullptr && cur_alter_task->alter_state() != ALTER_FINISHED &&
+        cur_alter_task->alter_state() != ALTER_FAILED) {
+        TabletSharedPtr related_tablet =
+                _get_tablet_unlocked(cur_alter_task->related_tablet_id(), cur_alter_task->related_schema_hash());
+        if (related_tablet != nullptr && tablet_ptr->creation_time() > related_tablet->creation_time()) {
+            // Current tablet is newly created during schema-change or rollup, skip it
+            return false;
+        }
+    }
+    // A not-ready tablet maybe a newly created tablet under schema-change, skip it
+    if (tablet_ptr->tablet_state() == TABLET_NOTREADY) {
+        return false;
+    }
+
+    if (!tablet_ptr->is_used() || !tablet_ptr->init_succeeded() || !tablet_ptr->can_do_compaction()) {
+        return false;
+    }
+
+    int64_t last_failure_ms = tablet_ptr->last_cumu_compaction_failure_time();
+    if (compaction_type == CompactionType::BASE_COMPACTION) {
+        last_failure_ms = tablet_ptr->last_base_compaction_failure_time();
+    }
+    if (now_ms - last_failure_ms <= config::min_compaction_failure_interval_sec * 1000) {
+        VLOG(1) << "Too often to check compaction, skip it."
+                << "compaction_type=" << (compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative")
+                << ", last_failure_time_ms=" << last_failure_ms << ", tablet_id=" << tablet_ptr->tablet_id();
+        return false;
+    }
+
+    if (compaction_type == CompactionType::BASE_COMPACTION) {
+        if (!tablet_ptr->get_base_lock().try_lock()) {
+            return false;
+        }
+        tablet_ptr->get_base_lock().unlock();
+    } else {
+        if (!tablet_ptr->get_cumulative_lock().try_lock()) {
+            return false;
+        }
+        tablet_ptr->get_cumulative_lock().unlock();
+    }
+    return true;
+}
+
+void TabletManager::get_compaction_candidates(CompactionType compaction_type,
+                                              std::vector<CompactionCandidate>* candidates) {
     int64_t now_ms = UnixMillis();
-    const std::string& compaction_type_str = compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
-    // only do compaction if compaction #rowset > 1
-    uint32_t highest_score = 1;
-    TabletSharedPtr best_tablet;
+    uint32_t highest_score = 0;
     for (const auto& tablets_shard : _tablets_shards) {
         std::shared_lock rlock(*tablets_shard.lock);
         for (const auto& tablet_map : tablets_shard.tablet_map) {
             for (const TabletSharedPtr& tablet_ptr : tablet_map.second.table_arr) {
-                if (tablet_ptr->keys_type() == PRIMARY_KEYS) {
+                if (!_can_do_compaction_unlocked(tablet_ptr, compaction_type, now_ms)) {
                     continue;
                 }
-                AlterTabletTaskSharedPtr cur_alter_task = tablet_ptr->alter_task();
-                if (cur_alter_task != nullptr && cur_alter_task->alter_state() != ALTER_FINISHED &&
-                    cur_alter_task->alter_state() != ALTER_FAILED) {
-                    TabletSharedPtr related_tablet = _get_tablet_unlocked(cur_alter_task->related_tablet_id(),
-                                                                          cur_alter_task->related_schema_hash());
-                    if (related_tablet != nullptr && tablet_ptr->creation_time() > related_tablet->creation_time()) {
-                        // Current tablet is newly created during schema-change or rollup, skip it
-                        continue;
-                    }
-                }
-                // A not-ready tablet maybe a newly created tablet under schema-change, skip it
-                if (tablet_ptr->tablet_state() == TABLET_NOTREADY) {
-                    continue;
-                }
-
-                if (tablet_ptr->data_dir()->path_hash() != data_dir->path_hash() || !tablet_ptr->is_used() ||
-                    !tablet_ptr->init_succeeded() || !tablet_ptr->can_do_compaction()) {
-                    continue;
-                }
-
-                int64_t last_failure_ms = tablet_ptr->last_cumu_compaction_failure_time();
-                if (compaction_type == CompactionType::BASE_COMPACTION) {
-                    last_failure_ms = tablet_ptr->last_base_compaction_failure_time();
-                }
-                if (now_ms - last_failure_ms <= config::min_compaction_failure_interval_sec * 1000) {
-                    VLOG(1) << "Too often to check compaction, skip it."
-                            << "compaction_type=" << compaction_type_str << ", last_failure_time_ms=" << last_failure_ms
-                            << ", tablet_id=" << tablet_ptr->tablet_id();
-                    continue;
-                }
-
-                if (compaction_type == CompactionType::BASE_COMPACTION) {
-                    if (!tablet_ptr->get_base_lock().try_lock()) {
-                        continue;
-                    }
-                    tablet_ptr->get_base_lock().unlock();
-                } else {
-                    if (!tablet_ptr->get_cumulative_lock().try_lock()) {
-                        continue;
-                    }
-                    tablet_ptr->get_cumulative_lock().unlock();
-                }
-
-                uint32_t table_score = 0;
+                CompactionCandidate candidate;
                 {
                     std::shared_lock rdlock(tablet_ptr->get_header_lock());
                     if (compaction_type == CompactionType::BASE_COMPACTION) {
-                        table_score = tablet_ptr->calc_base_compaction_score();
-                    } else if (compaction_type == CompactionType::CUMULATIVE_COMPACTION) {
-                        table_score = tablet_ptr->calc_cumulative_compaction_score();
+                        candidate.score = tablet_ptr->calc_base_compaction_score();
+                    } else {
+                        candidate.score = tablet_ptr->calc_cumulative_compaction_score();
                     }
+                    candidate.version_count = tablet_ptr->version_count();
                 }
-                if (table_score > highest_score) {
-                    highest_score = table_score;
-                    best_tablet = tablet_ptr;
+                // only do compaction if compaction #rowset > 1
+                if (candidate.score <= 1) {
+                    continue;
                 }
+                highest_score = std::max(highest_score, candidate.score);
+                candidate.tablet = tablet_ptr;
+                candidate.type = compaction_type;
+                candidates->emplace_back(std::move(candidate));
             }
         }
     }
 
-    if (best_tablet != nullptr) {
-        LOG(INFO) << "Found the best tablet to compact. "
-                  << "compaction_type=" << compaction_type_str << " tablet_id=" << best_tablet->tablet_id()
-                  << " highest_score=" << highest_score;
-        // TODO(lingbin): Remove 'max' from metric name, it would be misunderstood as the
-        // biggest in history(like peak), but it is really just the value at current moment.
-        if (compaction_type == CompactionType::BASE_COMPACTION) {
-            StarRocksMetrics::instance()->tablet_base_max_compaction_score.set_value(highest_score);
-        } else {
-            StarRocksMetrics::instance()->tablet_cumulative_max_compaction_score.set_value(highest_score);
-        }
+    if (compaction_type == CompactionType::BASE_COMPACTION) {
+        StarRocksMetrics::instance()->tablet_base_max_compaction_score.set_value(highest_score);
+    } else {
+        StarRocksMetrics::instance()->tablet_cumulative_max_compaction_score.set_value(highest_score);
     }
-    return best_tablet;
 }
 
 TabletSharedPtr TabletManager::find_best_tablet_to_do_update_compaction(DataDir* data_dir) {
@@ -44,6 +44,7 @@ namespace starrocks {
 
 class Tablet;
 class DataDir;
+struct CompactionCandidate;
 
 // TabletManager provides get, add, delete tablet method for storage engine
 // NOTE: If you want to add a method that needs to hold meta-lock before you can call it,
@@ -66,7 +67,9 @@ public:
 
     Status drop_tablets_on_error_root_path(const std::vector<TabletInfo>& tablet_info_vec);
 
-    TabletSharedPtr find_best_tablet_to_compaction(CompactionType compaction_type, DataDir* data_dir);
+    // Append tablets of all disks whose `compaction_type` score is larger than 1 to `candidates`,
+    // used by CompactionScheduler to build its global queue.
+    void get_compaction_candidates(CompactionType compaction_type, std::vector<CompactionCandidate>* candidates);
 
     TabletSharedPtr find_best_tablet_to_do_update_compaction(DataDir* data_dir);
 
@@ -148,6 +151,10 @@ private:
 
     Status _drop_tablet_unlocked(TTabletId tablet_id, SchemaHash schema_hash, bool keep_state);
 
+    // Whether `tablet` may be picked for `compaction_type` now, ignoring its score.
+    // Must hold the lock of the shard `tablet` belongs to.
+    bool _can_do_compaction_unlocked(const TabletSharedPtr& tablet, CompactionType compaction_type, int64_t now_ms);
+
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id, SchemaHash schema_hash);
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id, SchemaHash schema_hash, bool include_deleted,
                                          std::string* err);
@@ -185,6 +185,18 @@ static Status TColumn2ColumnPB(int32_t unique_id, const TColumn& t_column, Field
         if (depth == 0 && t_column.__isset.is_bloom_filter_column) {
             column_pb->set_is_bf_column(t_column.is_bloom_filter_column);
         }
+        if (depth == 0 && t_column.__isset.ngram_bloom_filter_gram_size) {
+            column_pb->set_ngram_bf_gram_size(t_column.ngram_bloom_filter_gram_size);
+        }
+        if (depth == 0 && t_column.__isset.inverted_index_tokenizer) {
+            if (boost::iequals(t_column.inverted_index_tokenizer, "standard")) {
+                column_pb->set_inverted_index_tokenizer(segment_v2::STANDARD_TOKENIZER);
+            } else if (boost::iequals(t_column.inverted_index_tokenizer, "whitespace")) {
+                column_pb->set_inverted_index_tokenizer(segment_v2::WHITESPACE_TOKENIZER);
+            } else {
+                return Status::InvalidArgument("unknown tokenizer " + t_column.inverted_index_tokenizer);
+            }
+        }
         return Status::OK();
     }
     case TTypeNodeType::ARRAY:
@@ -260,7 +272,11 @@ TabletMeta::TabletMeta(MemTracker* mem_tracker, int64_t table_id, int64_t partit
                                                                                  : TabletTypePB::TABLET_TYPE_DISK);
     TabletSchemaPB* schema = tablet_meta_pb.mutable_schema();
     schema->set_num_short_key_columns(tablet_schema.short_key_column_count);
-    schema->set_num_rows_per_row_block(config::default_num_rows_per_column_file_block);
+    if (tablet_schema.__isset.short_key_index_rows_per_block && tablet_schema.short_key_index_rows_per_block > 0) {
+        schema->set_num_rows_per_row_block(tablet_schema.short_key_index_rows_per_block);
+    } else {
+        schema->set_num_rows_per_row_block(config::default_num_rows_per_column_file_block);
+    }
     switch (tablet_schema.keys_type) {
     case TKeysType::DUP_KEYS:
         schema->set_keys_type(KeysType::DUP_KEYS);
@@ -286,6 +286,12 @@ void TabletColumn::init_from_pb(const ColumnPB& column) {
     } else {
         _has_bitmap_index = false;
     }
+    _ngram_bf_gram_size = column.ngram_bf_gram_size();
+    if (segment_v2::TokenizerTypePB_IsValid(column.inverted_index_tokenizer())) {
+        _inverted_index_tokenizer = static_cast<segment_v2::TokenizerTypePB>(column.inverted_index_tokenizer());
+    } else {
+        _inverted_index_tokenizer = segment_v2::UNKNOWN_TOKENIZER;
+    }
     _has_referenced_column = column.has_referenced_column_id();
     if (_has_referenced_column) {
         _referenced_column_id = column.referenced_column_id();
@@ -328,6 +334,12 @@ void TabletColumn::to_schema_pb(ColumnPB* column) const {
     if (_has_bitmap_index) {
         column->set_has_bitmap_index(_has_bitmap_index);
     }
+    if (_ngram_bf_gram_size > 0) {
+        column->set_ngram_bf_gram_size(_ngram_bf_gram_size);
+    }
+    if (_inverted_index_tokenizer != segment_v2::UNKNOWN_TOKENIZER) {
+        column->set_inverted_index_tokenizer(_inverted_index_tokenizer);
+    }
     for (const auto& sub_column : _sub_columns) {
         sub_column.to_schema_pb(column->add_children_columns());
     }
@@ -482,6 +494,8 @@ bool operator==(const TabletColumn& a, const TabletColumn& b) {
         if (a._referenced_column != b._referenced_column) return false;
     }
     if (a._has_bitmap_index != b._has_bitmap_index) return false;
+    if (a._ngram_bf_gram_size != b._ngram_bf_gram_size) return false;
+    if (a._inverted_index_tokenizer != b._inverted_index_tokenizer) return false;
     return true;
 }
 
@@ -518,7 +532,9 @@ std::string TabletColumn::debug_string() const {
        << ",is_decimal=" << _is_decimal << ",precision=" << _precision << ",frac=" << _scale << ",length=" << _length
        << ",index_length=" << _index_length << ",is_bf_column=" << _is_bf_column
        << ",has_reference_column=" << _has_referenced_column << ",referenced_column_id=" << _referenced_column_id
-       << ",referenced_column=" << _referenced_column << ",has_bitmap_index=" << _has_bitmap_index << ")";
+       << ",referenced_column=" << _referenced_column << ",has_bitmap_index=" << _has_bitmap_index
+       << ",ngram_bf_gram_size=" << _ngram_bf_gram_size << ",inverted_index_tokenizer=" << _inverted_index_tokenizer
+       << ")";
     return ss.str();
 }
 
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "gen_cpp/olap_file.pb.h"
+#include "gen_cpp/segment_v2.pb.h"
 #include "storage/olap_define.h"
 #include "storage/types.h"
 #include "storage/vectorized/type_utils.h"
@@ -55,6 +56,10 @@ public:
     inline bool is_nullable() const { return _is_nullable; }
     inline bool is_bf_column() const { return _is_bf_column; }
     inline bool has_bitmap_index() const { return _has_bitmap_index; }
+    // 0 if the column has no n-gram bloom filter index.
+    inline uint32_t ngram_bf_gram_size() const { return _ngram_bf_gram_size; }
+    // UNKNOWN_TOKENIZER if the column has no inverted index.
+    inline segment_v2::TokenizerTypePB inverted_index_tokenizer() const { return _inverted_index_tokenizer; }
     bool has_default_value() const { return _has_default_value; }
     std::string default_value() const { return _default_value; }
     bool has_reference_column() const { return _has_referenced_column; }
@@ -119,6 +124,10 @@ private:
 
     bool _has_bitmap_index = false;
 
+    uint32_t _ngram_bf_gram_size = 0;
+
+    segment_v2::TokenizerTypePB _inverted_index_tokenizer = segment_v2::UNKNOWN_TOKENIZER;
+
     // for hidded column, which is transparent to user
     bool _visible = true;
 
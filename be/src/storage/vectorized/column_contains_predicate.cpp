@@ -0,0 +1,178 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include <roaring/roaring.hh>
+#include <string_view>
+
+#include "column/column.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "storage/rowset/segment_v2/bitmap_index_reader.h"
+#include "storage/rowset/segment_v2/bloom_filter.h"
+#include "storage/rowset/segment_v2/tokenizer.h"
+#include "storage/vectorized/column_predicate.h"
+
+namespace starrocks::vectorized {
+
+// Matches the values containing every operand as a substring, e.g. (c LIKE '%abc%def%') implies
+// (c contains 'abc' and 'def'). Mainly used as an index filter only predicate to skip the data pages
+// by their n-gram bloom filters, or to skip the rows by the inverted index.
+class ColumnContainsPredicate : public ColumnPredicate {
+public:
+    ColumnContainsPredicate(const TypeInfoPtr& type_info, ColumnId id, std::vector<std::string> operands)
+            : ColumnPredicate(type_info, id), _operands(std::move(operands)) {}
+
+    ~ColumnContainsPredicate() override = default;
+
+    void evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        auto* v = reinterpret_cast<const Slice*>(column->raw_data());
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                selection[i] = _contains(v[i]);
+            }
+        } else {
+            const uint8_t* is_null = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                selection[i] = !is_null[i] && _contains(v[i]);
+            }
+        }
+    }
+
+    void evaluate_and(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        auto* v = reinterpret_cast<const Slice*>(column->raw_data());
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                selection[i] = selection[i] && _contains(v[i]);
+            }
+        } else {
+            const uint8_t* is_null = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                selection[i] = selection[i] && !is_null[i] && _contains(v[i]);
+            }
+        }
+    }
+
+    void evaluate_or(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        auto* v = reinterpret_cast<const Slice*>(column->raw_data());
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                selection[i] = selection[i] || _contains(v[i]);
+            }
+        } else {
+            const uint8_t* is_null = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                selection[i] = selection[i] || (!is_null[i] && _contains(v[i]));
+            }
+        }
+    }
+
+    uint16_t evaluate_branchless(const Column* column, uint16_t* sel, uint16_t sel_size) const override {
+        auto* v = reinterpret_cast<const Slice*>(column->raw_data());
+        const uint8_t* is_null = nullptr;
+        if (column->has_null()) {
+            is_null = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+        }
+        uint16_t new_size = 0;
+        for (uint16_t i = 0; i < sel_size; ++i) {
+            uint16_t data_idx = sel[i];
+            sel[new_size] = data_idx;
+            new_size += (is_null == nullptr || !is_null[data_idx]) && _contains(v[data_idx]);
+        }
+        return new_size;
+    }
+
+    bool support_ngram_bloom_filter() const override { return true; }
+
+    // Every gram of the operands must be found in the bloom filter if some value contains all the operands.
+    bool ngram_bloom_filter(const segment_v2::BloomFilter* bf, uint32_t gram_size) const override {
+        for (const std::string& operand : _operands) {
+            for (size_t pos = 0; pos + gram_size <= operand.size(); ++pos) {
+                if (!bf->test_bytes(operand.data() + pos, gram_size)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool support_inverted_index() const override { return true; }
+
+    // A value containing an operand has all the inner tokens of the operand, so the rows are
+    // the intersection of the postings of the inner tokens of all the operands.
+    Status seek_inverted_index(const segment_v2::Tokenizer& tokenizer, segment_v2::BitmapIndexIterator* iter,
+                               Roaring* rows) const override {
+        std::vector<std::string> tokens;
+        for (const std::string& operand : _operands) {
+            tokenizer.inner_tokens(Slice(operand), &tokens);
+        }
+        if (tokens.empty()) {
+            return Status::Cancelled("no inner token");
+        }
+        for (size_t i = 0; i < tokens.size(); i++) {
+            Slice token(tokens[i]);
+            bool exact_match = false;
+            Status s = iter->seek_dictionary(&token, &exact_match);
+            if (s.is_not_found() || (s.ok() && !exact_match)) {
+                *rows = Roaring();
+                return Status::OK();
+            }
+            RETURN_IF_ERROR(s);
+            Roaring postings;
+            RETURN_IF_ERROR(iter->read_bitmap(iter->current_ordinal(), &postings));
+            if (i == 0) {
+                *rows = std::move(postings);
+            } else {
+                *rows &= postings;
+            }
+        }
+        return Status::OK();
+    }
+
+    PredicateType type() const override { return PredicateType::kContains; }
+
+    bool can_vectorized() const override { return false; }
+
+    Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
+                      ObjectPool* obj_pool) const override {
+        if (target_type_info->type() == _type_info->type()) {
+            *output = this;
+            return Status::OK();
+        }
+        *output = obj_pool->add(new_column_contains_predicate(target_type_info, _column_id, _operands));
+        return Status::OK();
+    }
+
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId(" << _column_id << ") contains(";
+        for (size_t i = 0; i < _operands.size(); i++) {
+            ss << (i > 0 ? "," : "") << _operands[i];
+        }
+        ss << "))";
+        return ss.str();
+    }
+
+private:
+    bool _contains(const Slice& value) const {
+        std::string_view s(value.data, value.size);
+        for (const std::string& operand : _operands) {
+            if (s.find(operand) == std::string_view::npos) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::string> _operands;
+};
+
+// declared in column_predicate.h.
+ColumnPredicate* new_column_contains_predicate(const TypeInfoPtr& type_info, ColumnId id,
+                                               const std::vector<std::string>& operands) {
+    auto type = type_info->type();
+    if (type != OLAP_FIELD_TYPE_CHAR && type != OLAP_FIELD_TYPE_VARCHAR) {
+        return nullptr;
+    }
+    return new ColumnContainsPredicate(type_info, id, operands);
+}
+
+} // namespace starrocks::vectorized
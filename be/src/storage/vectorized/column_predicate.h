@@ -27,6 +27,7 @@ class ObjectPool;
 namespace starrocks::segment_v2 {
 class BitmapIndexIterator;
 class BloomFilter;
+class Tokenizer;
 } // namespace starrocks::segment_v2
 
 namespace starrocks::vectorized {
@@ -45,6 +46,7 @@ enum class PredicateType {
     kNotNull = 9,
     kAnd = 10,
     kOr = 11,
+    kContains = 12,
 };
 
 template <typename T>
@@ -104,10 +106,25 @@ public:
     // Return false to filter out a data page.
     virtual bool bloom_filter(const segment_v2::BloomFilter* bf) const { return true; }
 
+    virtual bool support_ngram_bloom_filter() const { return false; }
+
+    // Return false to filter out a data page, by the n-gram bloom filter holding the grams
+    // of |gram_size| bytes of the values in the page.
+    virtual bool ngram_bloom_filter(const segment_v2::BloomFilter* bf, uint32_t gram_size) const { return true; }
+
     virtual Status seek_bitmap_dictionary(segment_v2::BitmapIndexIterator* iter, SparseRange* range) const {
         return Status::Cancelled("not implemented");
     }
 
+    virtual bool support_inverted_index() const { return false; }
+
+    // Get the rows that may satisfy this predicate by the inverted index, whose tokens are split by |tokenizer|
+    // and whose postings are read by |iter|. Return Cancelled if the inverted index cannot filter any row.
+    virtual Status seek_inverted_index(const segment_v2::Tokenizer& tokenizer, segment_v2::BitmapIndexIterator* iter,
+                                       Roaring* rows) const {
+        return Status::Cancelled("not implemented");
+    }
+
     // Indicate whether or not the evaluate can be vectorized.
     // If this function return true, evaluate function will be vectorized and can achieve
     // good performance.
@@ -269,6 +286,9 @@ ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type, ColumnId id,
 ColumnPredicate* new_column_not_in_predicate(const TypeInfoPtr& type, ColumnId id,
                                              const std::vector<std::string>& operands);
 ColumnPredicate* new_column_null_predicate(const TypeInfoPtr& type, ColumnId, bool is_null);
+// Match the CHAR/VARCHAR values containing all of the |operands| as substrings.
+ColumnPredicate* new_column_contains_predicate(const TypeInfoPtr& type, ColumnId id,
+                                               const std::vector<std::string>& operands);
 
 template <FieldType field_type, template <FieldType> typename Predicate, typename NewColumnPredicateFunc>
 Status predicate_convert_to(Predicate<field_type> const& input_predicate,
@@ -2,12 +2,20 @@
 
 #include "storage/vectorized/compaction.h"
 
+#include <algorithm>
+
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/mem_pool.h"
+#include "storage/field.h"
+#include "storage/rowset/beta_rowset.h"
 #include "storage/rowset/rowset_factory.h"
+#include "storage/rowset/segment_v2/segment.h"
+#include "storage/short_key_index.h"
 #include "storage/vectorized/chunk_helper.h"
 #include "storage/vectorized/reader.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -66,7 +74,15 @@ Status Compaction::do_compaction_impl() {
 
     // 2. write combined rows to output rowset
     Statistics stats;
-    auto res = merge_rowsets(_mem_tracker.get(), &stats);
+    std::vector<OlapTuple> boundaries;
+    split_key_ranges(&boundaries);
+    Status res;
+    if (boundaries.empty()) {
+        res = merge_rowsets(_mem_tracker.get(), &stats);
+    } else {
+        TRACE_COUNTER_INCREMENT("parallel_ranges", boundaries.size() + 1);
+        res = merge_rowsets_in_parallel(boundaries, &stats);
+    }
 
     if (!res.ok()) {
         LOG(WARNING) << "fail to do " << compaction_name() << ". res=" << res.to_string()
@@ -114,6 +130,10 @@ Status Compaction::do_compaction_impl() {
 }
 
 Status Compaction::construct_output_rowset_writer() {
+    return create_rowset_writer(&_output_rs_writer);
+}
+
+Status Compaction::create_rowset_writer(std::unique_ptr<RowsetWriter>* writer) {
     RowsetWriterContext context(kDataFormatV2, config::storage_format_version);
     context.mem_tracker = _mem_tracker.get();
     context.rowset_id = StorageEngine::instance()->next_rowset_id();
@@ -128,7 +148,7 @@ Status Compaction::construct_output_rowset_writer() {
     context.version = _output_version;
     context.version_hash = _output_version_hash;
     context.segments_overlap = NONOVERLAPPING;
-    OLAPStatus olap_status = RowsetFactory::create_rowset_writer(context, &_output_rs_writer);
+    OLAPStatus olap_status = RowsetFactory::create_rowset_writer(context, writer);
     if (olap_status != OLAPStatus::OLAP_SUCCESS) {
         std::stringstream ss;
         ss << "Fail to create rowset writer. tablet_id=" << context.tablet_id << " err=" << olap_status;
@@ -140,13 +160,27 @@ Status Compaction::construct_output_rowset_writer() {
 
 Status Compaction::merge_rowsets(MemTracker* mem_tracker, Statistics* stats_output) {
     TRACE_COUNTER_SCOPE_LATENCY_US("merge_rowsets_latency_us");
+    return _merge_range(mem_tracker, nullptr, nullptr, 1, _runtime_profile.create_child("merge_rowsets"),
+                        _output_rs_writer.get(), stats_output);
+}
+
+Status Compaction::_merge_range(MemTracker* mem_tracker, const OlapTuple* lower, const OlapTuple* upper,
+                                size_t num_ranges, RuntimeProfile* profile, RowsetWriter* writer,
+                                Statistics* stats_output) {
     Schema schema = ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema());
     Reader reader(schema);
     ReaderParams reader_params;
     reader_params.tablet = _tablet;
     reader_params.reader_type = compaction_type();
-    reader_params.version = _output_rs_writer->version();
-    reader_params.profile = _runtime_profile.create_child("merge_rowsets");
+    reader_params.version = writer->version();
+    reader_params.profile = profile;
+    if (lower != nullptr || upper != nullptr) {
+        // empty tuple means unbounded.
+        reader_params.range = "ge";
+        reader_params.end_range = "lt";
+        reader_params.start_key.emplace_back(lower != nullptr ? *lower : OlapTuple());
+        reader_params.end_key.emplace_back(upper != nullptr ? *upper : OlapTuple());
+    }
 
     int64_t num_rows = 0;
     int64_t total_row_size = 0;
@@ -157,8 +191,9 @@ Status Compaction::merge_rowsets(MemTracker* mem_tracker, Statistics* stats_outp
             total_row_size += rowset->total_row_size();
         }
         int64_t avg_row_size = (total_row_size + 1) / (num_rows + 1);
-        // The result of thie division operation be zero, so added one
-        chunk_size = 1 + mem_tracker->limit() / (_input_rowsets.size() * avg_row_size + 1);
+        // The result of thie division operation be zero, so added one.
+        // Ranges merged in parallel share the memory limit.
+        chunk_size = 1 + mem_tracker->limit() / (num_ranges * _input_rowsets.size() * avg_row_size + 1);
     }
     if (chunk_size > config::vector_chunk_size) {
         chunk_size = config::vector_chunk_size;
@@ -170,7 +205,7 @@ Status Compaction::merge_rowsets(MemTracker* mem_tracker, Statistics* stats_outp
 
     auto chunk = ChunkHelper::new_chunk(schema, reader_params.chunk_size);
 
-    auto tracker = std::make_unique<MemTracker>(-1, "merge_rowsets", mem_tracker, true);
+    auto tracker = std::make_unique<MemTracker>(-1, profile->name(), mem_tracker, true);
 
     DeferOp memory_tracker_releaser([&tracker] { return tracker->release(tracker->consumption()); });
 
@@ -189,12 +224,15 @@ Status Compaction::merge_rowsets(MemTracker* mem_tracker, Statistics* stats_outp
 
         ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet->tablet_schema(), chunk.get());
 
-        OLAPStatus olap_status = _output_rs_writer->add_chunk(*chunk.get());
+        OLAPStatus olap_status = writer->add_chunk(*chunk.get());
         if (olap_status != OLAP_SUCCESS) {
             LOG(WARNING) << "writer add_chunk error, err=" << olap_status;
             return Status::InternalError("writer add_chunk error.");
         }
         output_rows += chunk->num_rows();
+        if (_throttle) {
+            _throttle(chunk->bytes_usage());
+        }
     }
 
     if (stats_output != nullptr) {
@@ -203,7 +241,7 @@ Status Compaction::merge_rowsets(MemTracker* mem_tracker, Statistics* stats_outp
         stats_output->filtered_rows = reader.stats().rows_del_filtered;
     }
 
-    OLAPStatus olap_status = _output_rs_writer->flush();
+    OLAPStatus olap_status = writer->flush();
     if (olap_status != OLAP_SUCCESS) {
         LOG(WARNING) << "failed to flush rowset when merging rowsets of tablet " + _tablet->full_name()
                      << ", err=" << olap_status;
@@ -213,6 +251,153 @@ Status Compaction::merge_rowsets(MemTracker* mem_tracker, Statistics* stats_outp
     return Status::OK();
 }
 
+// Decode the leading columns of an encoded short key into `tuple`. Only columns whose
+// short key encoding does not depend on the storage format are decoded, and decoding
+// stops at the first null or unsupported column, so `tuple` may be a prefix of the key.
+static Status decode_short_key(const TabletSchema& tablet_schema, Slice key, MemPool* pool, OlapTuple* tuple) {
+    for (size_t cid = 0; cid < tablet_schema.num_short_key_columns() && key.size > 0; cid++) {
+        if (key[0] != KEY_NORMAL_MARKER) {
+            break;
+        }
+        const TabletColumn& column = tablet_schema.column(cid);
+        switch (column.type()) {
+        case OLAP_FIELD_TYPE_TINYINT:
+        case OLAP_FIELD_TYPE_SMALLINT:
+        case OLAP_FIELD_TYPE_INT:
+        case OLAP_FIELD_TYPE_BIGINT:
+        case OLAP_FIELD_TYPE_LARGEINT:
+        case OLAP_FIELD_TYPE_VARCHAR:
+            break;
+        default:
+            return Status::OK();
+        }
+        key.remove_prefix(1);
+        std::unique_ptr<starrocks::Field> field(starrocks::FieldFactory::create(column));
+        if (field == nullptr) {
+            break;
+        }
+        auto* cell = pool->allocate(field->size());
+        RETURN_IF_ERROR(field->decode_ascending(&key, cell, pool));
+        tuple->add_value(field->to_string(reinterpret_cast<const char*>(cell)));
+    }
+    return Status::OK();
+}
+
+void Compaction::split_key_ranges(std::vector<OlapTuple>* boundaries) {
+    int64_t num_ranges = config::compaction_max_parallel_ranges;
+    if (config::compaction_min_bytes_per_parallel_range > 0) {
+        num_ranges = std::min(num_ranges, _input_rowsets_size / config::compaction_min_bytes_per_parallel_range);
+    }
+    if (num_ranges <= 1 || _tablet->keys_type() == KeysType::PRIMARY_KEYS) {
+        return;
+    }
+
+    // Every short key index entry stands for a block of num_rows_per_block rows, so
+    // evenly spaced entries of all input segments split the rows roughly evenly.
+    std::vector<std::string> keys;
+    for (auto& rowset : _input_rowsets) {
+        if (rowset->rowset_meta()->rowset_type() != BETA_ROWSET) {
+            return;
+        }
+        Status st = rowset->load();
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to load rowset " << rowset->rowset_id() << ": " << st.to_string();
+            return;
+        }
+        for (auto& segment : down_cast<BetaRowset*>(rowset.get())->segments()) {
+            st = segment->get_short_keys(&keys);
+            if (!st.ok()) {
+                LOG(WARNING) << "fail to load short key index of " << segment->file_name() << ": " << st.to_string();
+                return;
+            }
+        }
+    }
+    if (keys.size() < static_cast<size_t>(num_ranges)) {
+        return;
+    }
+    std::sort(keys.begin(), keys.end());
+
+    MemTracker tracker;
+    MemPool pool(&tracker);
+    const TabletSchema& tablet_schema = _tablet->tablet_schema();
+    for (int64_t i = 1; i < num_ranges; i++) {
+        OlapTuple tuple;
+        Status st = decode_short_key(tablet_schema, Slice(keys[i * keys.size() / num_ranges]), &pool, &tuple);
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to decode short key of tablet " << _tablet->tablet_id() << ": " << st.to_string();
+            boundaries->clear();
+            return;
+        }
+        // keys are sorted and decoded tuples are prefixes of them, so duplicates are adjacent.
+        if (tuple.size() == 0 || (!boundaries->empty() && boundaries->back().values() == tuple.values())) {
+            continue;
+        }
+        boundaries->emplace_back(std::move(tuple));
+    }
+}
+
+Status Compaction::merge_rowsets_in_parallel(const std::vector<OlapTuple>& boundaries, Statistics* stats_output) {
+    TRACE_COUNTER_SCOPE_LATENCY_US("merge_rowsets_latency_us");
+    const size_t num_ranges = boundaries.size() + 1;
+    std::vector<std::unique_ptr<RowsetWriter>> writers(num_ranges);
+    for (auto& writer : writers) {
+        RETURN_IF_ERROR(create_rowset_writer(&writer));
+    }
+
+    std::vector<Statistics> stats(num_ranges);
+    std::vector<Status> results(num_ranges);
+    std::unique_ptr<ThreadPoolToken> token =
+            StorageEngine::instance()->compaction_merge_thread_pool()->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t i = 0; i < num_ranges; i++) {
+        auto* profile = _runtime_profile.create_child(strings::Substitute("merge_rowsets_range_$0", i));
+        const OlapTuple* lower = i == 0 ? nullptr : &boundaries[i - 1];
+        const OlapTuple* upper = i + 1 == num_ranges ? nullptr : &boundaries[i];
+        auto merge_range = [&, i, profile, lower, upper] {
+            // memory allocated by the pool thread is charged to this compaction.
+            ScopedThreadMemTracker mem_tracker_guard(_mem_tracker.get());
+            results[i] = _merge_range(_mem_tracker.get(), lower, upper, num_ranges, profile, writers[i].get(),
+                                      &stats[i]);
+        };
+        Status st = token->submit_func(merge_range);
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to submit merge task of compaction range, merge it in place: " << st.to_string();
+            merge_range();
+        }
+    }
+    token->wait();
+
+    // Segments of the range rowsets are linked into the output rowset in key order,
+    // the range rowsets themselves are garbage once built.
+    std::vector<RowsetSharedPtr> range_rowsets;
+    DeferOp release_range_rowsets([&range_rowsets] {
+        for (auto& rowset : range_rowsets) {
+            StorageEngine::instance()->add_unused_rowset(rowset);
+        }
+    });
+    for (size_t i = 0; i < num_ranges; i++) {
+        RETURN_IF_ERROR(results[i]);
+        RowsetSharedPtr rowset = writers[i]->build();
+        if (rowset == nullptr) {
+            return Status::InternalError("fail to build rowset of compaction range");
+        }
+        range_rowsets.emplace_back(std::move(rowset));
+    }
+    for (auto& rowset : range_rowsets) {
+        if (_output_rs_writer->add_rowset(rowset) != OLAP_SUCCESS) {
+            return Status::InternalError("fail to link rowset of compaction range to output rowset");
+        }
+    }
+
+    if (stats_output != nullptr) {
+        for (auto& st : stats) {
+            stats_output->output_rows += st.output_rows;
+            stats_output->merged_rows += st.merged_rows;
+            stats_output->filtered_rows += st.filtered_rows;
+        }
+    }
+    return Status::OK();
+}
+
 void Compaction::modify_rowsets() {
     std::vector<RowsetSharedPtr> output_rowsets;
     output_rowsets.push_back(_output_rowset);
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "storage/olap_common.h"
@@ -11,6 +12,7 @@
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
 #include "storage/tablet_meta.h"
+#include "storage/tuple.h"
 #include "storage/utils.h"
 #include "util/semaphore.hpp"
 
@@ -42,6 +44,10 @@ public:
 
     virtual Status compact() = 0;
 
+    // `throttle` is called with the size of every chunk merged, and may block
+    // to limit the disk bandwidth used by this compaction.
+    void set_throttle(std::function<void(int64_t)> throttle) { _throttle = std::move(throttle); }
+
     static Status init(int concurreny);
 
 protected:
@@ -57,9 +63,19 @@ protected:
     // return others on error
     Status merge_rowsets(MemTracker* mem_tracker, Statistics* stats_output);
 
+    // For large input, pick boundaries splitting the key space of input rowsets into ranges
+    // with roughly equal number of rows, based on their short key indexes.
+    // `boundaries` is left empty if the compaction should not be split.
+    void split_key_ranges(std::vector<OlapTuple>* boundaries);
+
+    // Merge each range separated by `boundaries` into its own rowset in parallel, then
+    // link the segments of these rowsets in key order into `_output_rs_writer`.
+    Status merge_rowsets_in_parallel(const std::vector<OlapTuple>& boundaries, Statistics* stats_output);
+
     void modify_rowsets();
 
     Status construct_output_rowset_writer();
+    Status create_rowset_writer(std::unique_ptr<RowsetWriter>* writer);
 
     Status check_version_continuity(const std::vector<RowsetSharedPtr>& rowsets);
     Status check_correctness(const Statistics& stats);
@@ -85,6 +101,14 @@ protected:
     VersionHash _output_version_hash;
 
     RuntimeProfile _runtime_profile;
+
+    std::function<void(int64_t)> _throttle;
+
+private:
+    // merge rows in [lower, upper) into `writer`, nullptr means unbounded.
+    // `num_ranges` is the number of ranges merged at the same time, which share the memory limit.
+    Status _merge_range(MemTracker* mem_tracker, const OlapTuple* lower, const OlapTuple* upper, size_t num_ranges,
+                        RuntimeProfile* profile, RowsetWriter* writer, Statistics* stats_output);
 };
 
 } // namespace starrocks::vectorized
@@ -49,6 +49,8 @@ ColumnPredicate* PredicateParser::parse(const TCondition& condition) const {
                (condition.condition_op.size() == 2 && strcasecmp(condition.condition_op.c_str(), "is") == 0)) {
         bool is_null = strcasecmp(condition.condition_values[0].c_str(), "null") == 0;
         pred = new_column_null_predicate(type_info, index, is_null);
+    } else if (condition.condition_op == "contains" && !condition.condition_values.empty()) {
+        pred = new_column_contains_predicate(type_info, index, condition.condition_values);
     } else {
         LOG(WARNING) << "unknown condition: " << condition.condition_op;
         return pred;
@@ -176,6 +176,16 @@ public:
         }
     }
 
+    /**
+     * Add n_args values whose high 32 bits are `high` and low 32 bits are in `lows`
+     *
+     */
+    void addMany(uint32_t high, size_t n_args, const uint32_t* lows) {
+        Roaring& r = roarings[high];
+        r.addMany(n_args, lows);
+        r.setCopyOnWrite(copyOnWrite);
+    }
+
     /**
      * Remove value x
      *
@@ -938,6 +948,225 @@ inline Roaring64MapSetBitForwardIterator Roaring64Map::end() const {
 
 } // namespace detail
 
+// A read-only view over a serialized BitmapValue, see BitmapTypeCode for the format.
+//
+// The 32-bit roaring bitmaps inside are kept in the portable format of
+// https://github.com/RoaringBitmap/RoaringFormatSpec/ and read in place, so the
+// cardinality is taken from the container headers and the elements are fed to a
+// mutable bitmap in batches, without building a Roaring64Map for every stored value.
+//
+// Like Roaring64Map::read(), no bounds are checked, `data` must be a valid bitmap.
+class FrozenBitmap {
+public:
+    explicit FrozenBitmap(const Slice& data) : _data(data) { DCHECK_GT(data.size, 0); }
+
+    uint8_t type_code() const { return static_cast<uint8_t>(_data.data[0]); }
+
+    // Whether the value is a BITMAP32 or BITMAP64, i.e. it's worth merging in batches.
+    bool is_roaring() const {
+        return type_code() == BitmapTypeCode::BITMAP32 || type_code() == BitmapTypeCode::BITMAP64;
+    }
+
+    uint64_t cardinality() const {
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data) + 1;
+        switch (type_code()) {
+        case BitmapTypeCode::EMPTY:
+            return 0;
+        case BitmapTypeCode::SINGLE32:
+        case BitmapTypeCode::SINGLE64:
+            return 1;
+        case BitmapTypeCode::SET:
+            return decode_fixed32_le(p);
+        case BitmapTypeCode::BITMAP32:
+            return _roaring_cardinality(p);
+        case BitmapTypeCode::BITMAP64: {
+            uint64_t result = 0;
+            uint64_t map_size = 0;
+            p = decode_varint64_ptr(p, p + 10, &map_size);
+            for (uint64_t i = 0; i < map_size; i++) {
+                p += sizeof(uint32_t);
+                result += _roaring_cardinality(p);
+                p = _skip_roaring(p);
+            }
+            return result;
+        }
+        default:
+            DCHECK(false) << "unknown bitmap type code " << (int)type_code();
+            return 0;
+        }
+    }
+
+    // Call `f(uint32_t high, const uint32_t* lows, size_t n)` for the elements, grouped
+    // by their high 32 bits. Elements of BITMAP32/BITMAP64 come in ascending order.
+    template <typename Func>
+    void for_each_batch(Func&& f) const {
+        const auto* p = reinterpret_cast<const uint8_t*>(_data.data) + 1;
+        switch (type_code()) {
+        case BitmapTypeCode::EMPTY:
+            break;
+        case BitmapTypeCode::SINGLE32: {
+            uint32_t low = decode_fixed32_le(p);
+            f(0, &low, 1);
+            break;
+        }
+        case BitmapTypeCode::SINGLE64: {
+            uint64_t v = decode_fixed64_le(p);
+            auto low = static_cast<uint32_t>(v);
+            f(static_cast<uint32_t>(v >> 32), &low, 1);
+            break;
+        }
+        case BitmapTypeCode::SET: {
+            uint32_t size = decode_fixed32_le(p);
+            p += sizeof(uint32_t);
+            for (uint32_t i = 0; i < size; i++, p += sizeof(uint64_t)) {
+                uint64_t v = decode_fixed64_le(p);
+                auto low = static_cast<uint32_t>(v);
+                f(static_cast<uint32_t>(v >> 32), &low, 1);
+            }
+            break;
+        }
+        case BitmapTypeCode::BITMAP32:
+            _for_each_roaring_batch(0, p, f);
+            break;
+        case BitmapTypeCode::BITMAP64: {
+            uint64_t map_size = 0;
+            p = decode_varint64_ptr(p, p + 10, &map_size);
+            for (uint64_t i = 0; i < map_size; i++) {
+                uint32_t high = decode_fixed32_le(p);
+                p += sizeof(uint32_t);
+                p = _for_each_roaring_batch(high, p, f);
+            }
+            break;
+        }
+        default:
+            DCHECK(false) << "unknown bitmap type code " << (int)type_code();
+        }
+    }
+
+private:
+    static constexpr uint32_t kSerialCookieNoRunContainer = 12346;
+    static constexpr uint32_t kSerialCookie = 12347;
+    static constexpr uint32_t kNoOffsetThreshold = 4;
+    static constexpr uint32_t kMaxArrayContainerSize = 4096;
+    static constexpr size_t kBitsetContainerBytes = 8192;
+    static constexpr size_t kBatchSize = 1024;
+
+    // Header of a portable roaring bitmap.
+    struct RoaringHeader {
+        uint32_t num_containers = 0;
+        // nullptr if there is no run container.
+        const uint8_t* run_flags = nullptr;
+        // num_containers pairs of (key, cardinality - 1).
+        const uint8_t* key_cards = nullptr;
+        const uint8_t* containers = nullptr;
+
+        bool is_run(uint32_t i) const { return run_flags != nullptr && (run_flags[i / 8] & (1 << (i % 8))) != 0; }
+        uint16_t key(uint32_t i) const { return decode_fixed16_le(key_cards + 4 * i); }
+        uint32_t cardinality(uint32_t i) const { return decode_fixed16_le(key_cards + 4 * i + 2) + 1u; }
+    };
+
+    static RoaringHeader _read_header(const uint8_t* p) {
+        RoaringHeader header;
+        uint32_t cookie = decode_fixed32_le(p);
+        p += sizeof(uint32_t);
+        bool has_run = (cookie & 0xFFFF) == kSerialCookie;
+        DCHECK(has_run || cookie == kSerialCookieNoRunContainer) << "bad roaring cookie " << cookie;
+        if (has_run) {
+            header.num_containers = (cookie >> 16) + 1;
+            header.run_flags = p;
+            p += (header.num_containers + 7) / 8;
+        } else {
+            header.num_containers = decode_fixed32_le(p);
+            p += sizeof(uint32_t);
+        }
+        header.key_cards = p;
+        p += 4 * header.num_containers;
+        if (!has_run || header.num_containers >= kNoOffsetThreshold) {
+            // skip the offset header.
+            p += 4 * header.num_containers;
+        }
+        header.containers = p;
+        return header;
+    }
+
+    static size_t _container_bytes(const RoaringHeader& header, uint32_t i, const uint8_t* container) {
+        if (header.is_run(i)) {
+            return sizeof(uint16_t) + 4 * decode_fixed16_le(container);
+        }
+        uint32_t card = header.cardinality(i);
+        return card <= kMaxArrayContainerSize ? sizeof(uint16_t) * card : kBitsetContainerBytes;
+    }
+
+    static uint64_t _roaring_cardinality(const uint8_t* p) {
+        RoaringHeader header = _read_header(p);
+        uint64_t result = 0;
+        for (uint32_t i = 0; i < header.num_containers; i++) {
+            result += header.cardinality(i);
+        }
+        return result;
+    }
+
+    // Return the end of the roaring bitmap starting at `p`.
+    static const uint8_t* _skip_roaring(const uint8_t* p) {
+        RoaringHeader header = _read_header(p);
+        p = header.containers;
+        for (uint32_t i = 0; i < header.num_containers; i++) {
+            p += _container_bytes(header, i, p);
+        }
+        return p;
+    }
+
+    template <typename Func>
+    static const uint8_t* _for_each_roaring_batch(uint32_t high, const uint8_t* p, Func&& f) {
+        RoaringHeader header = _read_header(p);
+        uint32_t batch[kBatchSize];
+        size_t n = 0;
+        auto emit = [&](uint32_t low) {
+            batch[n++] = low;
+            if (n == kBatchSize) {
+                f(high, batch, n);
+                n = 0;
+            }
+        };
+
+        p = header.containers;
+        for (uint32_t i = 0; i < header.num_containers; i++) {
+            const uint32_t base = static_cast<uint32_t>(header.key(i)) << 16;
+            if (header.is_run(i)) {
+                uint16_t num_runs = decode_fixed16_le(p);
+                const uint8_t* run = p + sizeof(uint16_t);
+                for (uint16_t r = 0; r < num_runs; r++, run += 4) {
+                    uint32_t start = decode_fixed16_le(run);
+                    uint32_t length = decode_fixed16_le(run + 2);
+                    for (uint32_t v = start; v <= start + length; v++) {
+                        emit(base | v);
+                    }
+                }
+            } else if (header.cardinality(i) <= kMaxArrayContainerSize) {
+                uint32_t card = header.cardinality(i);
+                for (uint32_t k = 0; k < card; k++) {
+                    emit(base | decode_fixed16_le(p + sizeof(uint16_t) * k));
+                }
+            } else {
+                for (uint32_t w = 0; w < kBitsetContainerBytes / sizeof(uint64_t); w++) {
+                    uint64_t word = decode_fixed64_le(p + sizeof(uint64_t) * w);
+                    while (word != 0) {
+                        emit(base | (w * 64 + __builtin_ctzll(word)));
+                        word &= word - 1;
+                    }
+                }
+            }
+            p += _container_bytes(header, i, p);
+        }
+        if (n > 0) {
+            f(high, batch, n);
+        }
+        return p;
+    }
+
+    Slice _data;
+};
+
 // Represent the in-memory and on-disk structure of StarRocks's BITMAP data type.
 // Optimize for the case where the bitmap contains 0 or 1 element which is common
 // for streaming load scenario.
@@ -950,7 +1179,9 @@ public:
             : _bitmap(other._bitmap == nullptr ? nullptr : std::make_shared<detail::Roaring64Map>(*other._bitmap)),
               _set(other._set),
               _sv(other._sv),
-              _type(other._type) {}
+              _type(other._type),
+              _frozen(other._frozen),
+              _frozen_owner(other._frozen_owner) {}
 
     BitmapValue& operator=(const BitmapValue& other) {
         if (this != &other) {
@@ -959,14 +1190,22 @@ public:
             this->_set = other._set;
             this->_sv = other._sv;
             this->_type = other._type;
+            this->_frozen = other._frozen;
+            this->_frozen_owner = other._frozen_owner;
         }
         return *this;
     }
 
     BitmapValue(BitmapValue&& other)
-            : _bitmap(std::move(other._bitmap)), _set(std::move(other._set)), _sv(other._sv), _type(other._type) {
+            : _bitmap(std::move(other._bitmap)),
+              _set(std::move(other._set)),
+              _sv(other._sv),
+              _type(other._type),
+              _frozen(other._frozen),
+              _frozen_owner(std::move(other._frozen_owner)) {
         other._sv = 0;
         other._type = EMPTY;
+        other._frozen = Slice();
     }
 
     BitmapValue& operator=(BitmapValue&& other) {
@@ -975,8 +1214,11 @@ public:
             this->_set = std::move(other._set);
             this->_sv = other._sv;
             this->_type = other._type;
+            this->_frozen = other._frozen;
+            this->_frozen_owner = std::move(other._frozen_owner);
             other._sv = 0;
             other._type = EMPTY;
+            other._frozen = Slice();
         }
         return *this;
     }
@@ -992,6 +1234,16 @@ public:
 
     explicit BitmapValue(const Slice& src) { deserialize(src.data); }
 
+    // Construct a frozen bitmap referring to the serialized data in `src`, which is kept
+    // alive by `owner`. cardinality(), serialization and union into another bitmap read
+    // `src` in place, any other operation deserializes it first.
+    BitmapValue(const Slice& src, std::shared_ptr<const void> owner)
+            : _type(EMPTY), _frozen(src), _frozen_owner(std::move(owner)) {
+        DCHECK_GT(src.size, 0);
+    }
+
+    bool is_frozen() const { return _frozen.size > 0; }
+
     // Construct a bitmap from given elements.
     explicit BitmapValue(const std::vector<uint64_t>& bits) {
         switch (bits.size()) {
@@ -1010,6 +1262,7 @@ public:
     }
 
     void add(uint64_t value) {
+        _materialize();
         switch (_type) {
         case EMPTY:
             _sv = value;
@@ -1046,6 +1299,7 @@ public:
     }
 
     void to_bitmap() {
+        _materialize();
         _bitmap = std::make_shared<detail::Roaring64Map>();
         for (const auto& x : _set) {
             _bitmap->add(x);
@@ -1061,6 +1315,10 @@ public:
     // EMPTY  -> BITMAP
     // SINGLE -> BITMAP
     BitmapValue& operator|=(const BitmapValue& rhs) {
+        _materialize();
+        if (rhs.is_frozen()) {
+            return _union_frozen(rhs._frozen);
+        }
         switch (rhs._type) {
         case EMPTY:
             return *this;
@@ -1129,6 +1387,10 @@ public:
     // BITMAP -> EMPTY
     // BITMAP -> SINGLE
     BitmapValue& operator&=(const BitmapValue& rhs) {
+        _materialize();
+        if (rhs.is_frozen()) {
+            return *this &= BitmapValue(rhs._frozen);
+        }
         switch (rhs._type) {
         case EMPTY:
             clear();
@@ -1228,6 +1490,7 @@ public:
     }
 
     void remove(uint64_t rhs) {
+        _materialize();
         switch (_type) {
         case EMPTY:
             break;
@@ -1247,6 +1510,10 @@ public:
     }
 
     BitmapValue& operator-=(const BitmapValue& rhs) {
+        _materialize();
+        if (rhs.is_frozen()) {
+            return *this -= BitmapValue(rhs._frozen);
+        }
         switch (rhs._type) {
         case EMPTY:
             break;
@@ -1346,6 +1613,8 @@ public:
     }
 
     BitmapValue& operator^=(BitmapValue& rhs) {
+        _materialize();
+        rhs._materialize();
         switch (rhs._type) {
         case EMPTY:
             break;
@@ -1482,6 +1751,7 @@ public:
 
     // check if value x is present
     bool contains(uint64_t x) {
+        _materialize();
         switch (_type) {
         case EMPTY:
             return false;
@@ -1497,6 +1767,9 @@ public:
 
     // TODO should the return type be uint64_t?
     int64_t cardinality() const {
+        if (is_frozen()) {
+            return FrozenBitmap(_frozen).cardinality();
+        }
         switch (_type) {
         case EMPTY:
             return 0;
@@ -1513,6 +1786,9 @@ public:
     // Return how many bytes are required to serialize this bitmap.
     // See BitmapTypeCode for the serialized format.
     size_t getSizeInBytes() const {
+        if (is_frozen()) {
+            return _frozen.size;
+        }
         size_t res = 0;
         switch (_type) {
         case EMPTY:
@@ -1538,6 +1814,10 @@ public:
     // Serialize the bitmap value to dst, which should be large enough.
     // Client should call `getSizeInBytes` first to get the serialized size.
     void write(char* dst) const {
+        if (is_frozen()) {
+            memcpy(dst, _frozen.data, _frozen.size);
+            return;
+        }
         switch (_type) {
         case EMPTY:
             *dst = BitmapTypeCode::EMPTY;
@@ -1571,6 +1851,8 @@ public:
     // Deserialize a bitmap value from `src`.
     // Return false if `src` begins with unknown type code, true otherwise.
     bool deserialize(const char* src) {
+        _frozen = Slice();
+        _frozen_owner.reset();
         if (src == nullptr) {
             _type = EMPTY;
             return true;
@@ -1618,6 +1900,9 @@ public:
 
     // TODO limit string size to avoid OOM
     std::string to_string() const {
+        if (is_frozen()) {
+            return BitmapValue(_frozen).to_string();
+        }
         std::stringstream ss;
         switch (_type) {
         case EMPTY:
@@ -1664,6 +1949,7 @@ public:
 
     // Append values to array
     void to_array(std::vector<int64_t>* array) {
+        _materialize();
         switch (_type) {
         case EMPTY:
             break;
@@ -1692,13 +1978,16 @@ public:
     // When you persist bitmap value to disk, you could call this method.
     // This method should be called before `serialize_size`.
     void compress() const {
-        if (_type == BITMAP) {
+        // A frozen bitmap is written back as it was read.
+        if (_type == BITMAP && !is_frozen()) {
             _bitmap->runOptimize();
             _bitmap->shrinkToFit();
         }
     }
 
     void clear() {
+        _frozen = Slice();
+        _frozen_owner.reset();
         _type = EMPTY;
         if (_bitmap != nullptr) {
             _bitmap->clear();
@@ -1708,6 +1997,36 @@ public:
     }
 
 private:
+    void _materialize() {
+        if (is_frozen()) {
+            // deserialize() resets the frozen data, keep it alive until done.
+            auto owner = std::move(_frozen_owner);
+            deserialize(_frozen.data);
+        }
+    }
+
+    // Union a frozen bitmap without deserializing it into a Roaring64Map.
+    BitmapValue& _union_frozen(const Slice& src) {
+        FrozenBitmap frozen(src);
+        if (_type == EMPTY) {
+            deserialize(src.data);
+            return *this;
+        }
+        if (!frozen.is_roaring()) {
+            return *this |= BitmapValue(src);
+        }
+        if (_type == SINGLE) {
+            _bitmap = std::make_shared<detail::Roaring64Map>();
+            _bitmap->add(_sv);
+            _type = BITMAP;
+        } else if (_type == SET) {
+            to_bitmap();
+        }
+        frozen.for_each_batch(
+                [this](uint32_t high, const uint32_t* lows, size_t n) { _bitmap->addMany(high, n, lows); });
+        return *this;
+    }
+
     void _convert_to_smaller_type() {
         if (_type == BITMAP) {
             uint64_t c = _bitmap->cardinality();
@@ -1733,6 +2052,9 @@ private:
     phmap::flat_hash_set<uint64_t> _set;
     uint64_t _sv = 0; // store the single value when _type == SINGLE
     BitmapDataType _type;
+    // Serialized data of a frozen bitmap, empty if the bitmap is not frozen.
+    Slice _frozen;
+    std::shared_ptr<const void> _frozen_owner;
 };
 
 } // namespace starrocks
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
 
 #include "util/bit_util.h"
 #include "util/coding.h"
@@ -142,18 +143,14 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
     }
 
     // 2. save min value.
-    if (sizeof(T) == 16) {
-        put_fixed128_le(_buffer, min);
-    } else if (sizeof(T) == 8) {
-        put_fixed64_le(_buffer, min);
-    } else {
-        put_fixed32_le(_buffer, min);
-    }
+    put_value(min);
 
+    uint8_t storage_format = 0;
     // 3.1 save original value.
     if (is_keep_original_value) {
+        storage_format = 2;
         bit_width = sizeof(T) * 8;
-        uint32_t len = _buffered_values_num * bit_width;
+        uint32_t len = BitUtil::Ceil(_buffered_values_num * bit_width, 8);
         _buffer->reserve(_buffer->size() + len);
         size_t origin_size = _buffer->size();
         _buffer->resize(origin_size + len);
@@ -163,10 +160,26 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
         // improve for ascending order input, we could use fewer bit
         T delta_values[FRAME_VALUE_NUM];
         if (is_ascending) {
+            storage_format = 1;
             delta_values[0] = 0;
             for (uint8_t i = 1; i < _buffered_values_num; ++i) {
                 delta_values[i] = input[i] - input[i - 1];
             }
+            // The values of time series or auto-increment columns grow by regular steps, store the deltas
+            // relative to the smallest step, which takes zero bit when all the steps are equal.
+            if (_delta_of_delta && _buffered_values_num > 1) {
+                T min_delta = *std::min_element(delta_values + 1, delta_values + _buffered_values_num);
+                T max_delta = *std::max_element(delta_values + 1, delta_values + _buffered_values_num);
+                uint8_t step_bit_width = bits(static_cast<T>(max_delta - min_delta));
+                if ((bit_width - step_bit_width) * _buffered_values_num > VALUE_BYTES * 8) {
+                    storage_format = 3;
+                    bit_width = step_bit_width;
+                    put_value(min_delta);
+                    for (uint8_t i = 1; i < _buffered_values_num; ++i) {
+                        delta_values[i] = delta_values[i] - min_delta;
+                    }
+                }
+            }
         } else {
             bit_width = bits(static_cast<T>(max - min));
             for (uint8_t i = 0; i < _buffered_values_num; ++i) {
@@ -181,18 +194,23 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
         _buffer->resize(origin_size + packing_len);
         bit_pack(delta_values, _buffered_values_num, bit_width, _buffer->data() + origin_size);
     }
-    uint8_t storage_format = 0;
-    if (is_keep_original_value) {
-        storage_format = 2;
-    } else if (is_ascending) {
-        storage_format = 1;
-    }
     _storage_formats.push_back(storage_format);
     _bit_widths.push_back(bit_width);
 
     _buffered_values_num = 0;
 }
 
+template <typename T>
+void ForEncoder<T>::put_value(T value) {
+    if (sizeof(T) == 16) {
+        put_fixed128_le(_buffer, value);
+    } else if (sizeof(T) == 8) {
+        put_fixed64_le(_buffer, value);
+    } else {
+        put_fixed32_le(_buffer, value);
+    }
+}
+
 template <typename T>
 uint32_t ForEncoder<T>::flush() {
     if (_buffered_values_num != 0) {
@@ -254,12 +272,10 @@ bool ForDecoder<T>::init() {
         bit_width_offset += 2;
 
         _frame_offsets.push_back(frame_start_offset);
-        if (sizeof(T) == 16) {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 16;
-        } else if (sizeof(T) == 8) {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 8;
-        } else {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 4;
+        frame_start_offset += bit_width * _max_frame_size / 8 + VALUE_BYTES;
+        if (order_flag == 3) {
+            // the smallest step follows the min value.
+            frame_start_offset += VALUE_BYTES;
         }
     }
 
@@ -304,26 +320,32 @@ void ForDecoder<T>::decode_current_frame(T* output) {
     uint8_t current_frame_size = frame_size(frame_index);
 
     uint32_t base_offset = _frame_offsets[_current_decoded_frame];
-    T min = 0;
-    uint32_t delta_offset = 0;
-    if (sizeof(T) == 16) {
-        min = decode_fixed128_le(_buffer + base_offset);
-        delta_offset = base_offset + 16;
-    } else if (sizeof(T) == 8) {
-        min = decode_fixed64_le(_buffer + base_offset);
-        delta_offset = base_offset + 8;
-    } else {
-        min = decode_fixed32_le(_buffer + base_offset);
-        delta_offset = base_offset + 4;
-    }
+    T min = decode_value(_buffer + base_offset);
+    uint32_t delta_offset = base_offset + VALUE_BYTES;
 
     uint8_t bit_width = _bit_widths[_current_decoded_frame];
+    uint8_t storage_format = _storage_formats[_current_decoded_frame];
 
-    bool is_original_value = _storage_formats[_current_decoded_frame] == 2;
-    if (is_original_value) {
+    if (storage_format == 2) {
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
+    } else if (storage_format == 3) {
+        T min_delta = decode_value(_buffer + delta_offset);
+        delta_offset += VALUE_BYTES;
+        output[0] = min;
+        if (bit_width == 0) {
+            // all the steps are equal, nothing to unpack.
+            for (uint8_t i = 1; i < current_frame_size; i++) {
+                output[i] = output[i - 1] + min_delta;
+            }
+        } else {
+            std::vector<T> delta_values(current_frame_size);
+            bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, delta_values.data());
+            for (uint8_t i = 1; i < current_frame_size; i++) {
+                output[i] = output[i - 1] + (delta_values[i] + min_delta);
+            }
+        }
     } else {
-        bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
+        bool is_ascending = storage_format == 1;
         std::vector<T> delta_values(current_frame_size);
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, delta_values.data());
         if (is_ascending) {
@@ -342,17 +364,19 @@ void ForDecoder<T>::decode_current_frame(T* output) {
 }
 
 template <typename T>
-T ForDecoder<T>::decode_frame_min_value(uint32_t frame_index) {
-    uint32_t min_offset = _frame_offsets[frame_index];
-    T min = 0;
+T ForDecoder<T>::decode_value(const uint8_t* input) {
     if (sizeof(T) == 16) {
-        min = decode_fixed128_le(_buffer + min_offset);
+        return decode_fixed128_le(input);
     } else if (sizeof(T) == 8) {
-        min = decode_fixed64_le(_buffer + min_offset);
+        return decode_fixed64_le(input);
     } else {
-        min = decode_fixed32_le(_buffer + min_offset);
+        return decode_fixed32_le(input);
     }
-    return min;
+}
+
+template <typename T>
+T ForDecoder<T>::decode_frame_min_value(uint32_t frame_index) {
+    return decode_value(_buffer + _frame_offsets[frame_index]);
 }
 
 template <typename T>
@@ -401,13 +425,44 @@ bool ForDecoder<T>::get_batch(T* val, size_t count) {
 
 template <typename T>
 bool ForDecoder<T>::skip(int32_t skip_num) {
-    if (_current_index + skip_num >= _values_num || _current_index + skip_num < 0) {
+    // skipping to the end is allowed.
+    if (_current_index + skip_num > _values_num || _current_index + skip_num < 0) {
         return false;
     }
     _current_index = _current_index + skip_num;
     return true;
 }
 
+template <typename T>
+bool ForDecoder<T>::current_frame_bounds(T* lower, T* upper) {
+    if constexpr (!std::is_integral_v<T>) {
+        return false;
+    } else {
+        using U = std::make_unsigned_t<T>;
+        uint32_t frame_index = _current_index / _max_frame_size;
+        uint32_t base_offset = _frame_offsets[frame_index];
+        T min = decode_value(_buffer + base_offset);
+        uint8_t bit_width = _bit_widths[frame_index];
+        uint8_t storage_format = _storage_formats[frame_index];
+        *lower = min;
+        if (bit_width == 0 && storage_format == 3) {
+            T min_delta = decode_value(_buffer + base_offset + VALUE_BYTES);
+            *upper = static_cast<T>(static_cast<U>(min) + static_cast<U>(min_delta) * (frame_size(frame_index) - 1));
+        } else if (bit_width == 0) {
+            *upper = min;
+        } else if (storage_format == 0 && bit_width < sizeof(T) * 8) {
+            // Value[i] - MinValue takes at most |bit_width| bits.
+            U span = (static_cast<U>(1) << bit_width) - 1;
+            U room = static_cast<U>(std::numeric_limits<T>::max()) - static_cast<U>(min);
+            *upper = span <= room ? static_cast<T>(static_cast<U>(min) + span) : std::numeric_limits<T>::max();
+        } else {
+            // the ascending frames and the frames of original values.
+            *upper = std::numeric_limits<T>::max();
+        }
+        return true;
+    }
+}
+
 template <typename T>
 uint32_t ForDecoder<T>::seek_last_frame_before_value(T target) {
     // first of all, find the first frame >= target
@@ -22,6 +22,7 @@
 #ifndef STARROCKS_FRAME_OF_REFERENCE_CODING_H
 #define STARROCKS_FRAME_OF_REFERENCE_CODING_H
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
@@ -71,7 +72,7 @@ static inline uint8_t bits(const T v) {
 //       8 bit FrameValueNum
 //      32 bit ValuesNum
 //
-// There are currently three storage formats
+// There are currently four storage formats
 // (1) if the StorageFormat == 0: When input data order is not ascending and the BitPackingFrame format is:
 //          MinValue, (Value[i] - MinVale) * FrameValueNum
 //
@@ -81,6 +82,13 @@ static inline uint8_t bits(const T v) {
 // (3) if the StorageFormat == 2:  When overflow occurs when using (1) or (2) and save original values:
 //      MinValue, (Value[i]) * FrameValueNum
 //
+// (4) if the StorageFormat == 3: When input data order is ascending by regular steps, e.g. event time and
+//     auto-increment keys, the deltas are stored relative to the smallest delta MinDelta of the frame, it takes
+//     zero bit per value if all the deltas are equal:
+//      MinValue, MinDelta, (Value[i] - Value[i - 1] - MinDelta) * FrameValueNum
+//     It is written only if the encoder is created with |delta_of_delta|, as the decoders of older versions
+//     cannot read it, so the data must be marked by an encoding of its own, e.g. FOR_DELTA_ENCODING.
+//
 // len(MinValue) can be 32(uint32_t), 64(uint64_t), 128(uint128_t)
 //
 // The OrderFlag is 1 represents ascending order, 0 represents  not ascending order
@@ -88,7 +96,8 @@ static inline uint8_t bits(const T v) {
 template <typename T>
 class ForEncoder {
 public:
-    explicit ForEncoder(faststring* buffer) : _buffer(buffer) {}
+    explicit ForEncoder(faststring* buffer, bool delta_of_delta = false)
+            : _buffer(buffer), _delta_of_delta(delta_of_delta) {}
 
     void put(const T value) { return put_batch(&value, 1); }
 
@@ -116,14 +125,21 @@ private:
 
     const T* copy_value(const T* val, size_t count);
 
+    void put_value(T value);
+
     const T numeric_limits_max();
 
+    // bytes of MinValue and MinDelta.
+    static constexpr uint32_t VALUE_BYTES = sizeof(T) == 16 ? 16 : (sizeof(T) == 8 ? 8 : 4);
+
     uint32_t _values_num = 0;
     uint8_t _buffered_values_num = 0;
     static const uint8_t FRAME_VALUE_NUM = 128;
     T _buffered_values[FRAME_VALUE_NUM];
 
     faststring* _buffer;
+    // whether the frames of regular steps can be stored in the StorageFormat 3.
+    bool _delta_of_delta;
     std::vector<uint8_t> _storage_formats;
     std::vector<uint8_t> _bit_widths;
 };
@@ -152,6 +168,16 @@ public:
 
     uint32_t count() const { return _values_num; }
 
+    // Return the number of the values from the current index to the end of the current frame.
+    uint32_t current_frame_remaining() const {
+        return std::min<uint32_t>(_max_frame_size - _current_index % _max_frame_size, _values_num - _current_index);
+    }
+
+    // Get the lower and upper bounds of the values of the current frame from its min value and bit width,
+    // without decoding the frame. The bounds are exact for the frames of equal values or regular steps.
+    // Return false if the bounds of the frame are unknown.
+    bool current_frame_bounds(T* lower, T* upper);
+
 private:
     void bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output);
 
@@ -161,6 +187,8 @@ private:
 
     void decode_current_frame(T* output);
 
+    static T decode_value(const uint8_t* input);
+
     T decode_frame_min_value(uint32_t frame_index);
 
     // Return index of the last frame which contains value < target.
@@ -175,6 +203,8 @@ private:
 
     T* copy_value(T* val, size_t count);
 
+    static constexpr uint32_t VALUE_BYTES = sizeof(T) == 16 ? 16 : (sizeof(T) == 8 ? 8 : 4);
+
     const uint8_t* _buffer = nullptr;
     size_t _buffer_len = 0;
     bool _parsed = false;
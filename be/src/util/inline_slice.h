@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// A 16-byte string view for hash table keys and comparisons of short strings.
+//
+// Layout:
+//   | size (4 bytes) | prefix (4 bytes) | suffix (8 bytes) or pointer (8 bytes) |
+//
+// A string of at most kInlineSize bytes is stored entirely inside the view, padded with
+// zero, so hashing and comparing it never touches the original buffer. A longer string
+// keeps its first 4 bytes in the prefix and a pointer to the whole value, most unequal
+// keys are rejected by the size and prefix without dereferencing the pointer.
+//
+// Like Slice, the view does not own a non-inlined value, the caller must keep the buffer
+// alive. An inlined value lives in the view itself, so data() is invalidated when the view
+// is moved.
+class InlineSlice {
+public:
+    static constexpr size_t kPrefixSize = 4;
+    static constexpr size_t kInlineSize = 12;
+
+    InlineSlice() : _size(0) {
+        memset(_prefix, 0, kPrefixSize);
+        memset(_suffix, 0, sizeof(_suffix));
+    }
+
+    explicit InlineSlice(const Slice& s) : InlineSlice(s.data, s.size) {}
+
+    InlineSlice(const char* data, size_t size) : InlineSlice() {
+        _size = static_cast<uint32_t>(size);
+        if (size <= kPrefixSize) {
+            memcpy(_prefix, data, size);
+        } else if (size <= kInlineSize) {
+            memcpy(_prefix, data, kPrefixSize);
+            memcpy(_suffix, data + kPrefixSize, size - kPrefixSize);
+        } else {
+            memcpy(_prefix, data, kPrefixSize);
+            _ptr = data;
+        }
+    }
+
+    uint32_t size() const { return _size; }
+
+    bool is_inline() const { return _size <= kInlineSize; }
+
+    const char* data() const { return is_inline() ? _prefix : _ptr; }
+
+    Slice to_slice() const { return {data(), _size}; }
+
+    // The results of hash table lookups are read back as Slice.
+    operator Slice() const { return to_slice(); } // NOLINT(google-explicit-constructor)
+
+    bool operator==(const InlineSlice& other) const {
+        // size and prefix are compared as one word.
+        if (_head() != other._head()) {
+            return false;
+        }
+        if (is_inline()) {
+            return _suffix_word() == other._suffix_word();
+        }
+        return memcmp(_ptr + kPrefixSize, other._ptr + kPrefixSize, _size - kPrefixSize) == 0;
+    }
+
+    bool operator!=(const InlineSlice& other) const { return !(*this == other); }
+
+    // Same order as Slice::compare.
+    int compare(const InlineSlice& other) const {
+        const size_t min_size = std::min(_size, other._size);
+        int r = memcmp(_prefix, other._prefix, std::min(min_size, kPrefixSize));
+        if (r != 0) {
+            return r;
+        }
+        if (min_size > kPrefixSize) {
+            r = memcmp(data() + kPrefixSize, other.data() + kPrefixSize, min_size - kPrefixSize);
+            if (r != 0) {
+                return r;
+            }
+        }
+        return _size < other._size ? -1 : (_size > other._size ? 1 : 0);
+    }
+
+    bool operator<(const InlineSlice& other) const { return compare(other) < 0; }
+
+private:
+    uint64_t _head() const {
+        uint64_t v;
+        memcpy(&v, &_size, sizeof(v));
+        return v;
+    }
+
+    uint64_t _suffix_word() const {
+        uint64_t v;
+        memcpy(&v, _suffix, sizeof(v));
+        return v;
+    }
+
+    uint32_t _size;
+    char _prefix[kPrefixSize];
+    union {
+        char _suffix[kInlineSize - kPrefixSize];
+        const char* _ptr;
+    };
+};
+
+static_assert(sizeof(InlineSlice) == 16, "InlineSlice must be 16 bytes");
+
+} // namespace starrocks
@@ -23,6 +23,8 @@
 
 #include <gtest/gtest.h>
 
+#include "column/array_column.h"
+#include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/fixed_length_column.h"
@@ -495,4 +497,88 @@ PARALLEL_TEST(BinaryColumnTest, test_clone_empty) {
     ASSERT_EQ(0, c2->size());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_large_binary_column) {
+    auto large = LargeBinaryColumn::create();
+    ASSERT_TRUE(large->has_large_column());
+    for (int i = 0; i < 100; i++) {
+        large->append(std::string("str:").append(std::to_string(i)));
+    }
+    ASSERT_EQ(sizeof(uint64_t), sizeof(LargeBinaryColumn::Offset));
+    ASSERT_EQ("str:42", large->get_slice(42).to_string());
+    // sorting reads the values as slices.
+    const auto* slices = reinterpret_cast<const Slice*>(large->raw_data());
+    ASSERT_EQ("str:99", slices[99].to_string());
+
+    // append from 64-bit offsets to 32-bit offsets and back.
+    auto column = BinaryColumn::create();
+    std::vector<uint32_t> indexes{1, 3, 5};
+    column->append_selective(*large, indexes.data(), 0, indexes.size());
+    column->append(*large, 10, 2);
+    column->append_value_multiple_times(*large, 7, 2);
+    ASSERT_FALSE(column->has_large_column());
+    ASSERT_EQ(7, column->size());
+    ASSERT_EQ("str:5", column->get_slice(2).to_string());
+    ASSERT_EQ("str:11", column->get_slice(4).to_string());
+    ASSERT_EQ("str:7", column->get_slice(6).to_string());
+
+    auto large2 = LargeBinaryColumn::create();
+    large2->append_selective(*column, indexes.data(), 0, indexes.size());
+    ASSERT_EQ("str:10", large2->get_slice(1).to_string());
+
+    Column::Filter filter(large->size(), 0);
+    filter[3] = filter[50] = filter[99] = 1;
+    ASSERT_EQ(3, large->filter(filter));
+    ASSERT_EQ("str:50", large->get_slice(1).to_string());
+
+    // serialize the column with 64-bit sizes.
+    std::vector<uint8_t> buffer(large->serialize_size());
+    ASSERT_EQ(buffer.data() + buffer.size(), large->serialize_column(buffer.data()));
+    auto large3 = LargeBinaryColumn::create();
+    large3->deserialize_column(buffer.data());
+    ASSERT_EQ(3, large3->size());
+    ASSERT_EQ("str:99", large3->get_slice(2).to_string());
+
+    // small columns are not upgraded.
+    ASSERT_EQ(nullptr, column->upgrade_if_overflow());
+    ASSERT_EQ(nullptr, column->downgrade());
+
+    ColumnPtr downgraded = large3->downgrade();
+    ASSERT_NE(nullptr, downgraded);
+    ASSERT_FALSE(downgraded->has_large_column());
+    ASSERT_EQ(3, downgraded->size());
+    ASSERT_EQ("'str:50'", downgraded->debug_item(1));
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_downgrade_nested) {
+    auto large = LargeBinaryColumn::create();
+    large->append(Slice("a"));
+    large->append(Slice("bc"));
+    auto nullable = NullableColumn::create(large, NullColumn::create(2, 0));
+    ASSERT_TRUE(nullable->has_large_column());
+    ASSERT_EQ(nullptr, nullable->downgrade());
+    ASSERT_FALSE(nullable->has_large_column());
+    ASSERT_EQ("'bc'", nullable->debug_item(1));
+
+    // the elements of an array
+    auto elements = LargeBinaryColumn::create();
+    elements->append(Slice("a"));
+    auto offsets = UInt32Column::create();
+    offsets->append(0);
+    offsets->append(1);
+    auto array = ArrayColumn::create(elements, offsets);
+    ASSERT_TRUE(array->has_large_column());
+    ASSERT_EQ(nullptr, array->downgrade());
+    ASSERT_FALSE(array->has_large_column());
+    ASSERT_EQ(nullptr, array->upgrade_if_overflow());
+    ASSERT_EQ("['a']", array->debug_item(0));
+
+    Chunk chunk;
+    chunk.append_column(LargeBinaryColumn::create(), 1);
+    ASSERT_TRUE(chunk.has_large_column());
+    ASSERT_TRUE(chunk.downgrade().ok());
+    ASSERT_FALSE(chunk.has_large_column());
+}
+
 } // namespace starrocks::vectorized
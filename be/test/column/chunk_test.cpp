@@ -25,6 +25,7 @@
 
 #include "column/field.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 
 namespace starrocks::vectorized {
 
@@ -251,4 +252,66 @@ TEST_F(ChunkTest, test_append_chunk_safe) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_selection) {
+    auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
+    Column::Filter selection(100, 1);
+    chunk->set_selection(std::move(selection));
+    // a selection keeping all rows is dropped.
+    ASSERT_FALSE(chunk->has_selection());
+
+    selection.assign(100, 0);
+    for (size_t i = 0; i < 100; i += 2) {
+        selection[i] = 1;
+    }
+    chunk->set_selection(std::move(selection));
+    ASSERT_TRUE(chunk->has_selection());
+    ASSERT_EQ(100, chunk->num_rows());
+    ASSERT_EQ(50, chunk->num_selected_rows());
+
+    // physical filters keep the selection aligned: drop the first 10 rows.
+    Column::Filter filter(100, 1);
+    std::fill(filter.begin(), filter.begin() + 10, 0);
+    chunk->filter(filter);
+    ASSERT_EQ(90, chunk->num_rows());
+    ASSERT_EQ(45, chunk->num_selected_rows());
+
+    ASSERT_EQ(45, chunk->materialize_selection());
+    ASSERT_FALSE(chunk->has_selection());
+    for (size_t i = 0; i < 45; i++) {
+        ASSERT_EQ(static_cast<int32_t>(10 + i * 2), chunk->get_column_by_index(0)->get(i).get_int32());
+        ASSERT_EQ(static_cast<int32_t>(11 + i * 2), chunk->get_column_by_index(1)->get(i).get_int32());
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_materialize_shared_column) {
+    auto chunk = std::make_shared<Chunk>();
+    auto c1 = make_column(0);
+    chunk->append_column(c1, 0);
+    chunk->append_column(c1, 1);
+    // a nullable column wrapping the column of another slot.
+    auto null_column = NullColumn::create(100, 0);
+    null_column->get_data()[3] = 1;
+    chunk->append_column(NullableColumn::create(c1, null_column), 2);
+    auto c2 = make_column(0);
+    chunk->append_column(NullableColumn::create(c2, NullColumn::create(100, 0)), 3);
+    chunk->append_column(c2, 4);
+
+    Column::Filter selection(100, 0);
+    selection[3] = 1;
+    selection[5] = 1;
+    chunk->set_selection(std::move(selection));
+    ASSERT_EQ(2, chunk->materialize_selection());
+    for (size_t i = 0; i < chunk->num_columns(); i++) {
+        ASSERT_EQ(2, chunk->get_column_by_index(i)->size());
+    }
+    ASSERT_EQ(3, chunk->get_column_by_index(1)->get(0).get_int32());
+    ASSERT_EQ(5, chunk->get_column_by_index(1)->get(1).get_int32());
+    ASSERT_TRUE(chunk->get_column_by_index(2)->is_null(0));
+    ASSERT_EQ(5, chunk->get_column_by_index(2)->get(1).get_int32());
+    ASSERT_EQ(5, chunk->get_column_by_index(3)->get(1).get_int32());
+    ASSERT_EQ(3, chunk->get_column_by_index(4)->get(0).get_int32());
+}
+
 } // namespace starrocks::vectorized
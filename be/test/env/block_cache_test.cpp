@@ -0,0 +1,109 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "env/block_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "env/env_memory.h"
+#include "util/file_utils.h"
+
+namespace starrocks {
+
+class BlockCacheTest : public testing::Test {
+public:
+    void SetUp() override { ASSERT_TRUE(FileUtils::create_dir("./ut_dir/block_cache").ok()); }
+    void TearDown() override { ASSERT_TRUE(FileUtils::remove_all("./ut_dir").ok()); }
+};
+
+// NOLINTNEXTLINE
+TEST_F(BlockCacheTest, read_write) {
+    BlockCache cache("./ut_dir/block_cache", 4 * 16, 16);
+    ASSERT_TRUE(cache.init().ok());
+
+    std::string buf(8, '\0');
+    std::string key = BlockCache::block_key("file", 1, 0);
+    ASSERT_TRUE(cache.read(key, 0, Slice(buf)).is_not_found());
+
+    std::string data = "0123456789abcdef";
+    ASSERT_TRUE(cache.write(key, Slice(data)).ok());
+    ASSERT_TRUE(cache.read(key, 4, Slice(buf)).ok());
+    ASSERT_EQ("456789ab", buf);
+
+    // different modification time must not hit.
+    ASSERT_TRUE(cache.read(BlockCache::block_key("file", 2, 0), 0, Slice(buf)).is_not_found());
+
+    // read beyond cached length.
+    ASSERT_TRUE(cache.read(key, 12, Slice(buf)).is_not_found());
+
+    BlockCache::Stats stats;
+    cache.get_stats(&stats);
+    ASSERT_EQ(1, stats.hit_count);
+    ASSERT_EQ(8, stats.hit_bytes);
+    ASSERT_EQ(3, stats.miss_count);
+    ASSERT_EQ(16, stats.used_bytes);
+}
+
+// NOLINTNEXTLINE
+TEST_F(BlockCacheTest, evict) {
+    BlockCache cache("./ut_dir/block_cache", 2 * 16, 16);
+    ASSERT_TRUE(cache.init().ok());
+
+    std::string data(16, 'a');
+    std::string buf(16, '\0');
+    ASSERT_TRUE(cache.write(BlockCache::block_key("file", 1, 0), Slice(data)).ok());
+    ASSERT_TRUE(cache.write(BlockCache::block_key("file", 1, 1), Slice(data)).ok());
+    // touch block 0, so block 1 is the least recently used one.
+    ASSERT_TRUE(cache.read(BlockCache::block_key("file", 1, 0), 0, Slice(buf)).ok());
+    ASSERT_TRUE(cache.write(BlockCache::block_key("file", 1, 2), Slice(data)).ok());
+
+    ASSERT_TRUE(cache.read(BlockCache::block_key("file", 1, 0), 0, Slice(buf)).ok());
+    ASSERT_TRUE(cache.read(BlockCache::block_key("file", 1, 1), 0, Slice(buf)).is_not_found());
+    ASSERT_TRUE(cache.read(BlockCache::block_key("file", 1, 2), 0, Slice(buf)).ok());
+
+    BlockCache::Stats stats;
+    cache.get_stats(&stats);
+    ASSERT_EQ(1, stats.evict_count);
+    ASSERT_EQ(32, stats.used_bytes);
+}
+
+// NOLINTNEXTLINE
+TEST_F(BlockCacheTest, cached_file) {
+    BlockCache cache("./ut_dir/block_cache", 8 * 16, 16);
+    ASSERT_TRUE(cache.init().ok());
+
+    std::string content;
+    for (int i = 0; i < 40; i++) {
+        content.push_back('a' + (i % 26));
+    }
+    auto file = std::make_shared<StringRandomAccessFile>(content);
+    CachedRandomAccessFile cached_file(file, &cache, content.size(), 100);
+
+    // cross block boundary, read block 0 and block 1 from remote.
+    std::string buf(10, '\0');
+    ASSERT_TRUE(cached_file.read_at(10, Slice(buf)).ok());
+    ASSERT_EQ(content.substr(10, 10), buf);
+
+    CachedRandomAccessFile::Stats stats;
+    cached_file.get_and_clear_stats(&stats);
+    ASSERT_EQ(2, stats.miss_count);
+    ASSERT_EQ(0, stats.hit_count);
+
+    // served from cache.
+    ASSERT_TRUE(cached_file.read_at(12, Slice(buf)).ok());
+    ASSERT_EQ(content.substr(12, 10), buf);
+    cached_file.get_and_clear_stats(&stats);
+    ASSERT_EQ(0, stats.miss_count);
+    ASSERT_EQ(2, stats.hit_count);
+    ASSERT_EQ(10, stats.hit_bytes);
+
+    // last block is shorter than block size.
+    Slice tail(buf.data(), buf.size());
+    ASSERT_TRUE(cached_file.read(35, &tail).ok());
+    ASSERT_EQ(5, tail.size);
+    ASSERT_EQ(content.substr(35), tail.to_string());
+
+    // read beyond end of file.
+    ASSERT_FALSE(cached_file.read_at(35, Slice(buf)).ok());
+}
+
+} // namespace starrocks
@@ -7,6 +7,9 @@
 #include <memory>
 
 #include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "exprs/expr_context.h"
+#include "gutil/casts.h"
 #include "env/env.h"
 #include "runtime/descriptor_helper.h"
 
@@ -69,6 +72,12 @@ public:
 
     Status finish_batch() override { return Status::OK(); }
 
+    Status skip(size_t* num_records, vectorized::Column* dst) override {
+        Status st = ColumnReader::skip(num_records, dst);
+        skipped_records += *num_records;
+        return st;
+    }
+
     void get_levels(int16_t** def_levels, int16_t** rep_levels, size_t* num_levels) override {}
 
 private:
@@ -112,10 +121,35 @@ private:
         }
     }
 
+public:
+    size_t skipped_records = 0;
+
+private:
     int _step = 0;
     tparquet::Type::type _type = tparquet::Type::type::INT32;
 };
 
+// Evaluate to whether the INT column of `slot_id` is less than `limit`.
+class IntLessThanExpr : public Expr {
+public:
+    IntLessThanExpr(const TExprNode& t, SlotId slot_id, int32_t limit) : Expr(t), _slot_id(slot_id), _limit(limit) {}
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new IntLessThanExpr(*this)); }
+
+    vectorized::ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* chunk) override {
+        auto column = chunk->get_column_by_slot_id(_slot_id);
+        auto result = vectorized::BooleanColumn::create();
+        for (size_t i = 0; i < column->size(); i++) {
+            result->append(column->get(i).get_int32() < _limit);
+        }
+        return result;
+    }
+
+private:
+    SlotId _slot_id;
+    int32_t _limit;
+};
+
 class GroupReaderTest : public ::testing::Test {
 protected:
     void SetUp() override {}
@@ -411,4 +445,55 @@ TEST_F(GroupReaderTest, TestGetNext) {
     _check_chunk(param, chunk, 8, 4);
 }
 
+TEST_F(GroupReaderTest, TestLazyRead) {
+    auto* file = _create_file();
+    auto* param = _create_group_reader_param();
+    param->read_cols.resize(3);
+
+    FileMetaData* file_meta;
+    Status status = _create_filemeta(&file_meta, param);
+    ASSERT_TRUE(status.ok());
+    auto* group_reader = _pool.add(new GroupReader(file, file_meta, 0));
+    status = group_reader->init(*param);
+    ASSERT_TRUE(status.is_end_of_file());
+
+    // the INT column is filtered by c0 < 6, the others are read lazily.
+    replace_column_readers(group_reader, param);
+    group_reader->_direct_read_columns = {param->read_cols[0]};
+    group_reader->_lazy_read_columns = {param->read_cols[1], param->read_cols[2]};
+    TExprNode expr_node;
+    expr_node.node_type = TExprNodeType::BINARY_PRED;
+    expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    IntLessThanExpr expr(expr_node, 0, 6);
+    ExprContext ctx(&expr);
+    group_reader->_left_conjunct_ctxs = {&ctx};
+    group_reader->_read_chunk = _create_chunk(param);
+    group_reader->_selection.resize(config::vector_chunk_size);
+    int64_t skip_rows = param->stats->late_materialize_skip_rows;
+
+    // rows 6 and 7 of the first batch are filtered out of the lazy columns.
+    auto chunk = _create_chunk(param);
+    size_t row_count = 8;
+    status = group_reader->get_next(&chunk, &row_count);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(6, row_count);
+    _check_chunk(param, chunk, 0, 6);
+
+    // all rows of the second batch are filtered out, the lazy columns are skipped.
+    chunk = _create_chunk(param);
+    row_count = 8;
+    status = group_reader->get_next(&chunk, &row_count);
+    ASSERT_TRUE(status.is_end_of_file());
+    ASSERT_EQ(0, row_count);
+    for (size_t i = 0; i < chunk->num_columns(); i++) {
+        ASSERT_EQ(0, chunk->columns()[i]->size());
+    }
+    for (size_t i = 1; i < 3; i++) {
+        auto* reader = down_cast<MockColumnReader*>(group_reader->_column_readers[i].get());
+        ASSERT_EQ(4, reader->skipped_records);
+    }
+    ASSERT_EQ(0, down_cast<MockColumnReader*>(group_reader->_column_readers[0].get())->skipped_records);
+    ASSERT_EQ(skip_rows + 4, param->stats->late_materialize_skip_rows);
+}
+
 } // namespace starrocks::parquet
@@ -81,4 +81,44 @@ TEST_F(ParquetPageReaderTest, Normal) {
     ASSERT_FALSE(st.ok());
 }
 
+TEST_F(ParquetPageReaderTest, SkipPageData) {
+    std::string buffer;
+    for (int i = 0; i < 2; ++i) {
+        tparquet::PageHeader page_header;
+        page_header.type = tparquet::PageType::DATA_PAGE;
+        page_header.uncompressed_page_size = 100 * (i + 1);
+        page_header.compressed_page_size = 100 * (i + 1);
+
+        ThriftSerializer ser(true, 100);
+        uint32_t len = 0;
+        uint8_t* header_ser = nullptr;
+        ser.serialize(&page_header, &len, &header_ser);
+        buffer.append((char*)header_ser, len);
+
+        buffer.resize(buffer.size() + page_header.compressed_page_size);
+    }
+
+    size_t total_size = buffer.size();
+    StringRandomAccessFile file(std::move(buffer));
+    PageReader reader(&file, 0, total_size);
+
+    auto st = reader.next_header();
+    ASSERT_TRUE(st.ok());
+    ASSERT_EQ(100, reader.current_header()->uncompressed_page_size);
+
+    // skip data of page 0 without seeking
+    reader.skip_page_data();
+    st = reader.next_header();
+    ASSERT_TRUE(st.ok());
+    ASSERT_EQ(200, reader.current_header()->uncompressed_page_size);
+
+    // skip the partially read page
+    const uint8_t* data;
+    st = reader.read_bytes(&data, 50);
+    ASSERT_TRUE(st.ok());
+    reader.skip_page_data();
+    st = reader.next_header();
+    ASSERT_TRUE(st.is_end_of_file());
+}
+
 } // namespace starrocks::parquet
@@ -0,0 +1,217 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/query_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+
+namespace starrocks::pipeline {
+
+static vectorized::ChunkPtr make_chunk(int32_t start, size_t num_rows) {
+    auto column = vectorized::Int32Column::create();
+    for (size_t i = 0; i < num_rows; ++i) {
+        column->append(start + i);
+    }
+    auto chunk = std::make_shared<vectorized::Chunk>();
+    chunk->append_column(std::move(column), 1);
+    return chunk;
+}
+
+static TInternalScanRange make_scan_range(int64_t tablet_id, int64_t version) {
+    TInternalScanRange scan_range;
+    scan_range.tablet_id = tablet_id;
+    scan_range.version = std::to_string(version);
+    return scan_range;
+}
+
+static TExecPlanFragmentParams make_pre_aggregation_fragment() {
+    TExecPlanFragmentParams request;
+    TPlanNode agg_node;
+    agg_node.node_type = TPlanNodeType::AGGREGATION_NODE;
+    agg_node.limit = -1;
+    agg_node.__isset.agg_node = true;
+    agg_node.agg_node.need_finalize = false;
+    agg_node.agg_node.use_streaming_preaggregation = true;
+    TExprNode slot_ref;
+    slot_ref.node_type = TExprNodeType::SLOT_REF;
+    TExpr group_by;
+    group_by.nodes.emplace_back(slot_ref);
+    agg_node.agg_node.grouping_exprs.emplace_back(group_by);
+    TExprNode sum;
+    sum.node_type = TExprNodeType::AGG_EXPR;
+    sum.__isset.fn = true;
+    sum.fn.name.function_name = "sum";
+    TExpr agg_fn;
+    agg_fn.nodes.emplace_back(sum);
+    agg_fn.nodes.emplace_back(slot_ref);
+    agg_node.agg_node.aggregate_functions.emplace_back(agg_fn);
+
+    TPlanNode scan_node;
+    scan_node.node_type = TPlanNodeType::OLAP_SCAN_NODE;
+    scan_node.limit = -1;
+
+    request.fragment.plan.nodes.emplace_back(agg_node);
+    request.fragment.plan.nodes.emplace_back(scan_node);
+    return request;
+}
+
+// NOLINTNEXTLINE
+TEST(QueryCacheTest, lookup_and_insert) {
+    QueryCache cache(nullptr, 1024 * 1024);
+    std::string key = QueryCache::make_key(1, 10001, 5);
+    ASSERT_NE(key, QueryCache::make_key(1, 10001, 6));
+    ASSERT_NE(key, QueryCache::make_key(2, 10001, 5));
+
+    std::vector<vectorized::ChunkPtr> chunks;
+    ASSERT_FALSE(cache.lookup(key, &chunks));
+
+    std::vector<vectorized::ChunkPtr> results;
+    results.emplace_back(cache.copy_chunk(*make_chunk(0, 10)));
+    results.emplace_back(cache.copy_chunk(*make_chunk(10, 5)));
+    cache.insert(key, std::move(results));
+
+    ASSERT_TRUE(cache.lookup(key, &chunks));
+    ASSERT_EQ(2, chunks.size());
+    ASSERT_EQ(10, chunks[0]->num_rows());
+    ASSERT_EQ(5, chunks[1]->num_rows());
+    ASSERT_EQ(12, chunks[1]->get_column_by_slot_id(1)->get(2).get_int32());
+
+    // the returned chunks are copies.
+    chunks[0]->set_num_rows(1);
+    chunks.clear();
+    ASSERT_TRUE(cache.lookup(key, &chunks));
+    ASSERT_EQ(10, chunks[0]->num_rows());
+}
+
+// NOLINTNEXTLINE
+TEST(QueryCacheTest, cache_context) {
+    QueryCache cache(nullptr, 1024 * 1024);
+    {
+        QueryCacheContext ctx(&cache, 100);
+        ASSERT_FALSE(ctx.probe(make_scan_range(1, 2)));
+        ctx.finish_scan();
+        ASSERT_FALSE(ctx.probe(make_scan_range(2, 3)));
+        ctx.finish_scan();
+        ASSERT_EQ(2, ctx.num_missed_morsels());
+        ctx.collect(0, *make_chunk(0, 3));
+        ctx.collect(0, *make_chunk(3, 3));
+        ctx.finish_morsel(0);
+        // a tablet without results.
+        ctx.finish_morsel(1);
+        ASSERT_FALSE(ctx.has_hit_chunk());
+    }
+
+    QueryCacheContext ctx(&cache, 100);
+    ASSERT_TRUE(ctx.probe(make_scan_range(1, 2)));
+    ASSERT_TRUE(ctx.has_hit_chunk());
+    ASSERT_EQ(3, ctx.pop_hit_chunk()->num_rows());
+    ASSERT_EQ(3, ctx.pop_hit_chunk()->num_rows());
+    ASSERT_FALSE(ctx.has_hit_chunk());
+
+    ASSERT_TRUE(ctx.probe(make_scan_range(2, 3)));
+    ASSERT_FALSE(ctx.has_hit_chunk());
+
+    // new version or another fragment.
+    ASSERT_FALSE(ctx.probe(make_scan_range(1, 4)));
+    QueryCacheContext other_ctx(&cache, 101);
+    ASSERT_FALSE(other_ctx.probe(make_scan_range(1, 2)));
+    ASSERT_EQ(1, ctx.num_missed_morsels());
+}
+
+// NOLINTNEXTLINE
+TEST(QueryCacheTest, large_results_not_cached) {
+    const int64_t old_max_bytes = config::query_cache_entry_max_bytes;
+    config::query_cache_entry_max_bytes = 1024;
+    QueryCache cache(nullptr, 1024 * 1024);
+    {
+        QueryCacheContext ctx(&cache, 100);
+        ASSERT_FALSE(ctx.probe(make_scan_range(1, 2)));
+        ctx.finish_scan();
+        ASSERT_FALSE(ctx.probe(make_scan_range(2, 2)));
+        ctx.finish_scan();
+        ctx.collect(0, *make_chunk(0, 1024));
+        ctx.finish_morsel(0);
+        ctx.collect(1, *make_chunk(0, 10));
+        ctx.finish_morsel(1);
+    }
+    QueryCacheContext ctx(&cache, 100);
+    ASSERT_FALSE(ctx.probe(make_scan_range(1, 2)));
+    ASSERT_TRUE(ctx.probe(make_scan_range(2, 2)));
+    config::query_cache_entry_max_bytes = old_max_bytes;
+}
+
+// NOLINTNEXTLINE
+TEST(QueryCacheTest, canceled_morsel_not_cached) {
+    QueryCache cache(nullptr, 1024 * 1024);
+    {
+        // the driver is canceled in the middle of the second morsel, AggregateStreamingOperator::finish
+        // still finishes all the missed morsels.
+        QueryCacheContext ctx(&cache, 100);
+        ASSERT_FALSE(ctx.probe(make_scan_range(1, 2)));
+        ctx.collect(0, *make_chunk(0, 3));
+        ctx.finish_scan();
+        ASSERT_FALSE(ctx.probe(make_scan_range(2, 2)));
+        ctx.finish_morsel(0);
+        ctx.collect(1, *make_chunk(3, 3));
+        ctx.finish_morsel(1);
+    }
+    {
+        // the driver is canceled before any morsel is scanned to its end.
+        QueryCacheContext ctx(&cache, 100);
+        ASSERT_FALSE(ctx.probe(make_scan_range(3, 2)));
+        ctx.collect(0, *make_chunk(0, 3));
+        ctx.finish_morsel(0);
+    }
+    QueryCacheContext ctx(&cache, 100);
+    ASSERT_TRUE(ctx.probe(make_scan_range(1, 2)));
+    ASSERT_EQ(3, ctx.pop_hit_chunk()->num_rows());
+    ASSERT_FALSE(ctx.probe(make_scan_range(2, 2)));
+    ASSERT_FALSE(ctx.probe(make_scan_range(3, 2)));
+}
+
+// NOLINTNEXTLINE
+TEST(QueryCacheTest, fragment_digest) {
+    int64_t digest = 0;
+    TExecPlanFragmentParams request = make_pre_aggregation_fragment();
+    ASSERT_TRUE(QueryCache::fragment_digest(request, &digest));
+    int64_t same_digest = 0;
+    ASSERT_TRUE(QueryCache::fragment_digest(make_pre_aggregation_fragment(), &same_digest));
+    ASSERT_EQ(digest, same_digest);
+
+    request.query_globals.time_zone = "America/Los_Angeles";
+    int64_t other_digest = 0;
+    ASSERT_TRUE(QueryCache::fragment_digest(request, &other_digest));
+    ASSERT_NE(digest, other_digest);
+
+    // the final aggregation.
+    request = make_pre_aggregation_fragment();
+    request.fragment.plan.nodes[0].agg_node.need_finalize = true;
+    ASSERT_FALSE(QueryCache::fragment_digest(request, &digest));
+
+    request = make_pre_aggregation_fragment();
+    request.fragment.plan.nodes[1].limit = 10;
+    ASSERT_FALSE(QueryCache::fragment_digest(request, &digest));
+
+    request = make_pre_aggregation_fragment();
+    request.fragment.plan.nodes[1].probe_runtime_filters.emplace_back();
+    ASSERT_FALSE(QueryCache::fragment_digest(request, &digest));
+
+    request = make_pre_aggregation_fragment();
+    TExprNode rand;
+    rand.node_type = TExprNodeType::FUNCTION_CALL;
+    rand.__isset.fn = true;
+    rand.fn.name.function_name = "rand";
+    TExpr conjunct;
+    conjunct.nodes.emplace_back(rand);
+    request.fragment.plan.nodes[1].conjuncts.emplace_back(conjunct);
+    ASSERT_FALSE(QueryCache::fragment_digest(request, &digest));
+
+    request = make_pre_aggregation_fragment();
+    request.fragment.plan.nodes.pop_back();
+    ASSERT_FALSE(QueryCache::fragment_digest(request, &digest));
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,100 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/pipeline/resource_group.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+// NOLINTNEXTLINE
+TEST(ResourceGroupTest, parse) {
+    std::vector<ResourceGroupPtr> groups;
+    std::vector<ResourceGroupClassifier> classifiers;
+    ASSERT_TRUE(ResourceGroupManager::parse("etl:cpu_weight=2,mem_limit=1G,concurrency=4; dashboard:cpu_weight=8",
+                                            "etl:query_type=load;dashboard:user=bi,query_type=select", &groups,
+                                            &classifiers)
+                        .ok());
+
+    ASSERT_EQ(3, groups.size());
+    ASSERT_EQ(ResourceGroupManager::kDefaultGroupName, groups[0]->name());
+    ASSERT_EQ(1, groups[0]->cpu_weight());
+    ASSERT_EQ(0, groups[0]->mem_limit());
+    ASSERT_EQ("etl", groups[1]->name());
+    ASSERT_EQ(1, groups[1]->id());
+    ASSERT_EQ(2, groups[1]->cpu_weight());
+    ASSERT_EQ(1024L * 1024 * 1024, groups[1]->mem_limit());
+    ASSERT_EQ(4, groups[1]->max_concurrency());
+    ASSERT_EQ("dashboard", groups[2]->name());
+    ASSERT_EQ(8, groups[2]->cpu_weight());
+    ASSERT_EQ(0, groups[2]->max_concurrency());
+
+    ASSERT_EQ(2, classifiers.size());
+    ASSERT_EQ(1, classifiers[0].group_id);
+    ASSERT_TRUE(classifiers[0].match("default_cluster:root", TQueryType::LOAD));
+    ASSERT_FALSE(classifiers[0].match("default_cluster:root", TQueryType::SELECT));
+    ASSERT_EQ(2, classifiers[1].group_id);
+    ASSERT_TRUE(classifiers[1].match("default_cluster:bi", TQueryType::SELECT));
+    ASSERT_TRUE(classifiers[1].match("bi", TQueryType::SELECT));
+    ASSERT_FALSE(classifiers[1].match("default_cluster:bi2", TQueryType::SELECT));
+    ASSERT_FALSE(classifiers[1].match("default_cluster:bi", TQueryType::EXTERNAL));
+}
+
+// NOLINTNEXTLINE
+TEST(ResourceGroupTest, parse_default_group) {
+    std::vector<ResourceGroupPtr> groups;
+    std::vector<ResourceGroupClassifier> classifiers;
+    ASSERT_TRUE(ResourceGroupManager::parse("", "", &groups, &classifiers).ok());
+    ASSERT_EQ(1, groups.size());
+    ASSERT_TRUE(classifiers.empty());
+
+    ASSERT_TRUE(ResourceGroupManager::parse("default:cpu_weight=4;adhoc:concurrency=1", "default:user=root", &groups,
+                                            &classifiers)
+                        .ok());
+    ASSERT_EQ(2, groups.size());
+    ASSERT_EQ(0, groups[0]->id());
+    ASSERT_EQ(4, groups[0]->cpu_weight());
+    ASSERT_EQ(1, groups[1]->id());
+    ASSERT_EQ(1, classifiers.size());
+    ASSERT_EQ(0, classifiers[0].group_id);
+}
+
+// NOLINTNEXTLINE
+TEST(ResourceGroupTest, parse_invalid) {
+    std::vector<ResourceGroupPtr> groups;
+    std::vector<ResourceGroupClassifier> classifiers;
+    ASSERT_FALSE(ResourceGroupManager::parse(":cpu_weight=1", "", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl:cpu_weight=0", "", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl:cpu_weight=x", "", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl:concurrency=-1", "", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl:priority=1", "", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl;etl", "", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl", "adhoc:user=root", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl", "etl:query_type=insert", &groups, &classifiers).ok());
+    ASSERT_FALSE(ResourceGroupManager::parse("etl", "etl:role=admin", &groups, &classifiers).ok());
+}
+
+// NOLINTNEXTLINE
+TEST(ResourceGroupTest, concurrency_limit) {
+    ResourceGroup group(1, "etl", 1, 0, 2);
+    ASSERT_TRUE(group.acquire_query().ok());
+    ASSERT_TRUE(group.acquire_query().ok());
+    ASSERT_EQ(2, group.num_running_queries());
+
+    Status st = group.acquire_query();
+    ASSERT_EQ(TStatusCode::TOO_MANY_TASKS, st.code());
+    ASSERT_EQ(2, group.num_running_queries());
+
+    group.release_query();
+    ASSERT_TRUE(group.acquire_query().ok());
+    group.release_query();
+    group.release_query();
+    ASSERT_EQ(0, group.num_running_queries());
+
+    ResourceGroup unlimited(2, "adhoc", 1, 0, 0);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(unlimited.acquire_query().ok());
+    }
+    ASSERT_EQ(100, unlimited.num_running_queries());
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,126 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/adaptive_conjuncts_evaluator.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/mock_vectorized_expr.h"
+
+namespace starrocks::vectorized {
+
+class AdaptiveConjunctsEvaluatorTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _expr_node.node_type = TExprNodeType::BINARY_PRED;
+        _expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    }
+
+    // slot 1 is true on all rows, slot 2 is true on one of ten rows, slot 3 is true on nine of ten rows.
+    ChunkPtr create_chunk() {
+        auto all_true = BooleanColumn::create(100, 1);
+        auto selective = BooleanColumn::create();
+        auto mostly_true = BooleanColumn::create();
+        for (int i = 0; i < 100; i++) {
+            selective->append(i % 10 == 0);
+            mostly_true->append(i % 10 != 0);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(all_true, 1);
+        chunk->append_column(selective, 2);
+        chunk->append_column(mostly_true, 3);
+        return chunk;
+    }
+
+protected:
+    TExprNode _expr_node;
+};
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveConjunctsEvaluatorTest, reorder_by_selectivity) {
+    MockSlotRefExpr unselective(_expr_node, 1);
+    MockSlotRefExpr selective(_expr_node, 2);
+    ExprContext ctx0(&unselective);
+    ExprContext ctx1(&selective);
+    std::vector<ExprContext*> ctxs{&ctx0, &ctx1};
+
+    RuntimeProfile profile("test");
+    AdaptiveConjunctsEvaluator evaluator;
+    evaluator.init(ctxs, &profile);
+    ASSERT_EQ(std::vector<size_t>({0, 1}), evaluator.order());
+
+    auto chunk = create_chunk();
+    evaluator.evaluate(chunk.get());
+    ASSERT_EQ(10, chunk->num_rows());
+    // the selective conjunct goes first after the first chunk.
+    ASSERT_EQ(std::vector<size_t>({1, 0}), evaluator.order());
+    ASSERT_EQ("1,0", *profile.get_info_string("ConjunctsOrder"));
+    ASSERT_EQ(1, evaluator.num_reorders());
+
+    unselective.evaluated_rows = 0;
+    selective.evaluated_rows = 0;
+    chunk = create_chunk();
+    evaluator.evaluate(chunk.get());
+    ASSERT_EQ(10, chunk->num_rows());
+    ASSERT_EQ(100, selective.evaluated_rows);
+    // only the surviving rows are evaluated by the second conjunct.
+    ASSERT_EQ(10, unselective.evaluated_rows);
+}
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveConjunctsEvaluatorTest, all_filtered) {
+    MockSlotRefExpr selective(_expr_node, 2);
+    MockConstVectorizedExpr<TYPE_BOOLEAN> all_false(_expr_node, 0);
+    MockSlotRefExpr unselective(_expr_node, 1);
+    ExprContext ctx0(&selective);
+    ExprContext ctx1(&all_false);
+    ExprContext ctx2(&unselective);
+    std::vector<ExprContext*> ctxs{&ctx0, &ctx1, &ctx2};
+
+    AdaptiveConjunctsEvaluator evaluator;
+    evaluator.init(ctxs, nullptr);
+    auto chunk = create_chunk();
+    evaluator.evaluate(chunk.get());
+    ASSERT_EQ(0, chunk->num_rows());
+    // the last conjunct is skipped once no row is left.
+    ASSERT_EQ(0, unselective.evaluated_rows);
+}
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveConjunctsEvaluatorTest, keep_selection) {
+    MockSlotRefExpr unselective(_expr_node, 1);
+    MockSlotRefExpr mostly_true(_expr_node, 3);
+    ExprContext ctx0(&unselective);
+    ExprContext ctx1(&mostly_true);
+    std::vector<ExprContext*> ctxs{&ctx0, &ctx1};
+
+    AdaptiveConjunctsEvaluator evaluator;
+    evaluator.init(ctxs, nullptr);
+    auto chunk = create_chunk();
+    evaluator.evaluate(chunk.get(), true);
+    // most rows are selected, the filtered rows are left in the chunk.
+    ASSERT_EQ(100, chunk->num_rows());
+    ASSERT_EQ(90, chunk->num_selected_rows());
+    ASSERT_TRUE(chunk->has_selection());
+    ASSERT_EQ(0, chunk->selection()[0]);
+    ASSERT_EQ(1, chunk->selection()[1]);
+
+    chunk->materialize_selection();
+    ASSERT_EQ(90, chunk->num_rows());
+    ASSERT_FALSE(chunk->has_selection());
+
+    MockSlotRefExpr selective(_expr_node, 2);
+    ExprContext ctx2(&selective);
+    std::vector<ExprContext*> selective_ctxs{&ctx2};
+    AdaptiveConjunctsEvaluator selective_evaluator;
+    selective_evaluator.init(selective_ctxs, nullptr);
+    chunk = create_chunk();
+    selective_evaluator.evaluate(chunk.get(), true);
+    // few rows are selected, the chunk is compacted.
+    ASSERT_EQ(10, chunk->num_rows());
+    ASSERT_FALSE(chunk->has_selection());
+}
+
+} // namespace starrocks::vectorized
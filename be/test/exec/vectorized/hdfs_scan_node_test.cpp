@@ -24,6 +24,9 @@ public:
         config::enable_metric_calculator = false;
 
         _exec_env = ExecEnv::GetInstance();
+        if (_exec_env->query_pool_mem_tracker() == nullptr) {
+            ASSERT_TRUE(_exec_env->init_mem_tracker().ok());
+        }
         auto* engine = StorageEngine::instance();
         ExecEnv::init(_exec_env, engine->engine_options()->store_paths);
         _exec_env->set_storage_engine(engine);
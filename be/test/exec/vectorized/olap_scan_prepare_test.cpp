@@ -0,0 +1,171 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/olap_scan_prepare.h"
+
+#include <gtest/gtest.h>
+
+#include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/literal.h"
+#include "exprs/vectorized/mock_vectorized_expr.h"
+#include "runtime/descriptor_helper.h"
+
+namespace starrocks::vectorized {
+
+class OlapScanPrepareTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _k1 = _pool.add(new SlotDescriptor(TSlotDescriptorBuilder().type(TYPE_INT).column_name("k1").id(0).build()));
+        _v1 = _pool.add(new SlotDescriptor(TSlotDescriptorBuilder().string_type(64).column_name("v1").id(1).build()));
+        _v2 = _pool.add(new SlotDescriptor(TSlotDescriptorBuilder().string_type(64).column_name("v2").id(2).build()));
+        _slots = {_k1, _v1, _v2};
+    }
+
+    // k1 INT, v1 VARCHAR with a 3-gram bloom filter index, v2 VARCHAR without index.
+    void init_tablet_schema(KeysType keys_type, const std::string& value_aggregation, TabletSchema* tablet_schema) {
+        TabletSchemaPB tablet_schema_pb;
+        tablet_schema_pb.set_keys_type(keys_type);
+        add_column(&tablet_schema_pb, "k1", "INT", true, "NONE", 0);
+        add_column(&tablet_schema_pb, "v1", "VARCHAR", false, value_aggregation, 3);
+        add_column(&tablet_schema_pb, "v2", "VARCHAR", false, value_aggregation, 0);
+        tablet_schema->init_from_pb(tablet_schema_pb);
+    }
+
+    // like(|slot|, |pattern|)
+    ExprContext* like(const SlotDescriptor* slot, const std::string& pattern) {
+        Expr* fn = function_call("like", TPrimitiveType::BOOLEAN);
+        fn->add_child(_pool.add(new ColumnRef(slot)));
+        fn->add_child(string_literal(pattern));
+        return _pool.add(new ExprContext(fn));
+    }
+
+    // instr(|slot|, |str|) > 0, or locate(|str|, |slot|) > 0
+    ExprContext* position_gt_zero(const std::string& fn_name, const SlotDescriptor* slot, const std::string& str) {
+        Expr* fn = function_call(fn_name, TPrimitiveType::INT);
+        if (fn_name == "locate") {
+            fn->add_child(string_literal(str));
+            fn->add_child(_pool.add(new ColumnRef(slot)));
+        } else {
+            fn->add_child(_pool.add(new ColumnRef(slot)));
+            fn->add_child(string_literal(str));
+        }
+        TExprNode node;
+        node.node_type = TExprNodeType::BINARY_PRED;
+        node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        node.__set_opcode(TExprOpcode::GT);
+        Expr* gt = _pool.add(new MockCostExpr(node));
+        gt->add_child(fn);
+        gt->add_child(int_literal(0));
+        return _pool.add(new ExprContext(gt));
+    }
+
+private:
+    static void add_column(TabletSchemaPB* tablet_schema_pb, const std::string& name, const std::string& type,
+                           bool is_key, const std::string& aggregation, int32_t ngram_bf_gram_size) {
+        static int id = 0;
+        ColumnPB* column = tablet_schema_pb->add_column();
+        column->set_unique_id(++id);
+        column->set_name(name);
+        column->set_type(type);
+        column->set_is_key(is_key);
+        column->set_is_nullable(true);
+        column->set_length(type == "INT" ? 4 : 64);
+        column->set_aggregation(aggregation);
+        column->set_ngram_bf_gram_size(ngram_bf_gram_size);
+    }
+
+    Expr* function_call(const std::string& fn_name, TPrimitiveType::type ret_type) {
+        TExprNode node;
+        node.node_type = TExprNodeType::FUNCTION_CALL;
+        node.type = gen_type_desc(ret_type);
+        TFunction fn;
+        fn.name.function_name = fn_name;
+        node.__set_fn(fn);
+        return _pool.add(new MockCostExpr(node));
+    }
+
+    Expr* string_literal(const std::string& value) {
+        TExprNode node;
+        node.node_type = TExprNodeType::STRING_LITERAL;
+        node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+        node.__set_string_literal(TStringLiteral());
+        node.string_literal.value = value;
+        return _pool.add(new VectorizedLiteral(node));
+    }
+
+    Expr* int_literal(int64_t value) {
+        TExprNode node;
+        node.node_type = TExprNodeType::INT_LITERAL;
+        node.type = gen_type_desc(TPrimitiveType::INT);
+        node.__set_int_literal(TIntLiteral());
+        node.int_literal.value = value;
+        return _pool.add(new VectorizedLiteral(node));
+    }
+
+protected:
+    ObjectPool _pool;
+    SlotDescriptor* _k1 = nullptr;
+    SlotDescriptor* _v1 = nullptr;
+    SlotDescriptor* _v2 = nullptr;
+    std::vector<SlotDescriptor*> _slots;
+};
+
+// NOLINTNEXTLINE
+TEST_F(OlapScanPrepareTest, like_pattern_substrings) {
+    using Substrings = std::vector<std::string>;
+    ASSERT_EQ(Substrings({"abc"}), details::like_pattern_substrings("%abc%"));
+    ASSERT_EQ(Substrings({"abc"}), details::like_pattern_substrings("abc"));
+    // both wildcards split the pattern.
+    ASSERT_EQ(Substrings({"ab", "cd", "ef"}), details::like_pattern_substrings("ab%cd_ef"));
+    ASSERT_EQ(Substrings({"ab", "cd"}), details::like_pattern_substrings("%%ab__cd%_"));
+    ASSERT_EQ(Substrings(), details::like_pattern_substrings("%_%"));
+    ASSERT_EQ(Substrings(), details::like_pattern_substrings(""));
+    // escaped wildcards and backslashes are literals.
+    ASSERT_EQ(Substrings({"50%_off"}), details::like_pattern_substrings("%50\\%\\_off%"));
+    ASSERT_EQ(Substrings({"a\\b"}), details::like_pattern_substrings("a\\\\b"));
+    // a trailing backslash escapes nothing.
+    ASSERT_EQ(Substrings({"ab"}), details::like_pattern_substrings("ab\\"));
+    // substrings shorter than a gram are kept, the index just has no gram of them to test.
+    ASSERT_EQ(Substrings({"a", "bc", "def"}), details::like_pattern_substrings("%a_bc%def"));
+}
+
+// NOLINTNEXTLINE
+TEST_F(OlapScanPrepareTest, normalize_contains_predicates) {
+    std::vector<ExprContext*> conjunct_ctxs{like(_v1, "%abc%def"),
+                                            like(_v2, "%abc%"),
+                                            position_gt_zero("instr", _v1, "xyz"),
+                                            position_gt_zero("locate", _v1, "uvw"),
+                                            like(_v1, "%_%"),
+                                            position_gt_zero("instr", _v1, ""),
+                                            like(_v1, "%normalized%")};
+    std::vector<bool> normalized_conjuncts{false, false, false, false, false, false, true};
+
+    TabletSchema dup_schema;
+    init_tablet_schema(DUP_KEYS, "NONE", &dup_schema);
+    std::vector<TCondition> olap_filter;
+    details::normalize_contains_predicates(dup_schema, _slots, conjunct_ctxs, normalized_conjuncts, olap_filter);
+    // only v1 has the index, and the conjuncts without substrings or normalized are skipped.
+    ASSERT_EQ(3, olap_filter.size());
+    for (const TCondition& condition : olap_filter) {
+        ASSERT_EQ("v1", condition.column_name);
+        ASSERT_EQ("contains", condition.condition_op);
+        ASSERT_TRUE(condition.is_index_filter_only);
+    }
+    ASSERT_EQ(std::vector<std::string>({"abc", "def"}), olap_filter[0].condition_values);
+    ASSERT_EQ(std::vector<std::string>({"xyz"}), olap_filter[1].condition_values);
+    ASSERT_EQ(std::vector<std::string>({"uvw"}), olap_filter[2].condition_values);
+
+    // the predicates on the aggregated value columns can't be pushed down.
+    TabletSchema agg_schema;
+    init_tablet_schema(AGG_KEYS, "REPLACE", &agg_schema);
+    olap_filter.clear();
+    details::normalize_contains_predicates(agg_schema, _slots, conjunct_ctxs, normalized_conjuncts, olap_filter);
+    ASSERT_TRUE(olap_filter.empty());
+
+    TabletSchema primary_schema;
+    init_tablet_schema(PRIMARY_KEYS, "REPLACE", &primary_schema);
+    olap_filter.clear();
+    details::normalize_contains_predicates(primary_schema, _slots, conjunct_ctxs, normalized_conjuncts, olap_filter);
+    ASSERT_EQ(3, olap_filter.size());
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,93 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "exec/vectorized/scan_query_acct.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace starrocks::vectorized {
+
+// NOLINTNEXTLINE
+TEST(ScanQueryAcctTest, priority_by_scan_time) {
+    const int64_t old_slice = config::scan_query_time_slice_ms;
+    config::scan_query_time_slice_ms = 100;
+    const int64_t slice_ns = 100 * 1000000L;
+
+    ScanQueryAcct acct;
+    ASSERT_EQ(ScanQueryAcct::kMaxPriority, acct.compute_priority());
+
+    acct.start_task(1000);
+    acct.finish_task(slice_ns / 2);
+    ASSERT_EQ(ScanQueryAcct::kMaxPriority, acct.compute_priority());
+    ASSERT_EQ(1000, acct.queue_time_ns());
+
+    // [1, 3) slices.
+    acct.start_task(0);
+    acct.finish_task(slice_ns);
+    ASSERT_EQ(ScanQueryAcct::kMaxPriority - 2, acct.compute_priority());
+
+    // [3, 7) slices.
+    acct.start_task(0);
+    acct.finish_task(2 * slice_ns);
+    ASSERT_EQ(ScanQueryAcct::kMaxPriority - 4, acct.compute_priority());
+
+    acct.start_task(0);
+    acct.finish_task(100000 * slice_ns);
+    ASSERT_EQ(0, acct.compute_priority());
+    ASSERT_EQ(0, acct.running_tasks());
+
+    config::scan_query_time_slice_ms = old_slice;
+}
+
+// NOLINTNEXTLINE
+TEST(ScanQueryAcctTest, quota) {
+    const int32_t old_quota = config::scan_tasks_per_query_quota;
+    config::scan_tasks_per_query_quota = 2;
+
+    ScanQueryAcct acct;
+    acct.start_task(0);
+    ASSERT_EQ(ScanQueryAcct::kMaxPriority, acct.compute_priority());
+    acct.start_task(0);
+    ASSERT_EQ(0, acct.compute_priority());
+    acct.finish_task(0);
+    ASSERT_EQ(ScanQueryAcct::kMaxPriority, acct.compute_priority());
+
+    config::scan_tasks_per_query_quota = old_quota;
+}
+
+// NOLINTNEXTLINE
+TEST(ScanQueryAcctTest, update_profile) {
+    ScanQueryAcct acct;
+    acct.start_task(1000);
+    acct.finish_task(3000);
+    acct.start_task(500);
+
+    RuntimeProfile profile("scan");
+    acct.update_profile(&profile);
+    ASSERT_EQ(3000, profile.get_counter("QueryScanTime")->value());
+    ASSERT_EQ(1500, profile.get_counter("QueryScanQueueTime")->value());
+}
+
+// NOLINTNEXTLINE
+TEST(ScanQueryAcctTest, shared_by_query) {
+    TUniqueId query_id;
+    query_id.hi = 1;
+    query_id.lo = 2;
+    TUniqueId other_query_id;
+    other_query_id.hi = 1;
+    other_query_id.lo = 3;
+
+    auto* manager = ScanQueryAcctManager::instance();
+    ScanQueryAcctPtr acct = manager->get_or_register(query_id);
+    acct->start_task(0);
+    acct->finish_task(1000);
+    ASSERT_EQ(acct, manager->get_or_register(query_id));
+    ASSERT_NE(acct, manager->get_or_register(other_query_id));
+
+    // the acct is removed with the last fragment of the query.
+    acct.reset();
+    ASSERT_EQ(0, manager->get_or_register(query_id)->scan_time_ns());
+}
+
+} // namespace starrocks::vectorized
@@ -428,5 +428,56 @@ TEST_F(VectorizedCaseExprTest, NoCaseWhenNullReturnIntElse) {
     }
 }
 
+TEST_F(VectorizedCaseExprTest, NoCaseShortCircuit) {
+    expr_node.child_type = TPrimitiveType::BOOLEAN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.case_expr.has_case_expr = false;
+    expr_node.case_expr.has_else_expr = true;
+
+    std::unique_ptr<Expr> expr(VectorizedCaseExprFactory::from_thrift(expr_node));
+
+    // first WHEN matches all rows but row 9, the second matches none.
+    auto when1_col = BooleanColumn::create();
+    auto then1_col = Int32Column::create();
+    auto else_col = Int32Column::create();
+    for (int j = 0; j < 10; ++j) {
+        when1_col->append(j != 9);
+        then1_col->append(j);
+        else_col->append(100 + j);
+    }
+    Chunk chunk;
+    chunk.append_column(when1_col, 1);
+    chunk.append_column(then1_col, 2);
+    chunk.append_column(BooleanColumn::create(10, 0), 3);
+    chunk.append_column(Int32Column::create(10, -1), 4);
+    chunk.append_column(else_col, 5);
+
+    MockSlotRefExpr when1(expr_node, 1);
+    MockSlotRefExpr then1(expr_node, 2);
+    MockSlotRefExpr when2(expr_node, 3);
+    MockSlotRefExpr then2(expr_node, 4);
+    MockSlotRefExpr else1(expr_node, 5);
+
+    expr->_children.push_back(&when1);
+    expr->_children.push_back(&then1);
+    expr->_children.push_back(&when2);
+    expr->_children.push_back(&then2);
+    expr->_children.push_back(&else1);
+
+    ColumnPtr ptr = expr->evaluate(nullptr, &chunk);
+    ASSERT_EQ(10, when1.evaluated_rows);
+    // later branches only see the row not matched yet.
+    ASSERT_EQ(1, when2.evaluated_rows);
+    ASSERT_EQ(0, then2.evaluated_rows);
+    ASSERT_EQ(1, else1.evaluated_rows);
+
+    ASSERT_EQ(10, ptr->size());
+    auto v = ColumnHelper::cast_to_raw<TYPE_INT>(ptr);
+    for (int j = 0; j < 9; ++j) {
+        ASSERT_EQ(j, v->get_data()[j]);
+    }
+    ASSERT_EQ(109, v->get_data()[9]);
+}
+
 } // namespace vectorized
 } // namespace starrocks
@@ -5,6 +5,7 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include "column/column_viewer.h"
 #include "column/fixed_length_column.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
@@ -387,5 +388,71 @@ TEST_F(VectorizedCompoundPredicateTest, testOnlyNullAndZeroRow) {
     }
 }
 
+TEST_F(VectorizedCompoundPredicateTest, shortCircuitAndOrExpr) {
+    // left: only row 0 and row 9 are true.
+    auto left = BooleanColumn::create();
+    for (int j = 0; j < 10; ++j) {
+        left->append(j == 0 || j == 9);
+    }
+    // right: all true, row 0 is null.
+    ColumnBuilder<TYPE_BOOLEAN> builder;
+    builder.append_null();
+    for (int j = 1; j < 10; ++j) {
+        builder.append(1);
+    }
+    ColumnPtr right = builder.build(false);
+    Chunk chunk;
+    chunk.append_column(left, 1);
+    chunk.append_column(right, 2);
+
+    {
+        expr_node.opcode = TExprOpcode::COMPOUND_AND;
+        std::unique_ptr<Expr> expr(VectorizedCompoundPredicateFactory::from_thrift(expr_node));
+        MockSlotRefExpr col1(expr_node, 1);
+        MockSlotRefExpr col2(expr_node, 2);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr v = expr->evaluate(nullptr, &chunk);
+        // right operand is only evaluated on the rows where left is true.
+        ASSERT_EQ(2, col2.evaluated_rows);
+        ASSERT_EQ(10, v->size());
+        ColumnViewer<TYPE_BOOLEAN> viewer(v);
+        ASSERT_TRUE(viewer.is_null(0));
+        for (int j = 1; j < 10; ++j) {
+            ASSERT_FALSE(viewer.is_null(j));
+            ASSERT_EQ(j == 9, viewer.value(j));
+        }
+    }
+
+    {
+        // left is false only on row 0.
+        auto not_left = BooleanColumn::create();
+        for (int j = 0; j < 10; ++j) {
+            not_left->append(j != 0);
+        }
+        Chunk or_chunk;
+        or_chunk.append_column(not_left, 1);
+        or_chunk.append_column(right, 2);
+
+        expr_node.opcode = TExprOpcode::COMPOUND_OR;
+        std::unique_ptr<Expr> expr(VectorizedCompoundPredicateFactory::from_thrift(expr_node));
+        MockSlotRefExpr col1(expr_node, 1);
+        MockSlotRefExpr col2(expr_node, 2);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+
+        ColumnPtr v = expr->evaluate(nullptr, &or_chunk);
+        ASSERT_EQ(1, col2.evaluated_rows);
+        ASSERT_EQ(10, v->size());
+        ColumnViewer<TYPE_BOOLEAN> viewer(v);
+        ASSERT_TRUE(viewer.is_null(0));
+        for (int j = 1; j < 10; ++j) {
+            ASSERT_FALSE(viewer.is_null(j));
+            ASSERT_EQ(1, viewer.value(j));
+        }
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
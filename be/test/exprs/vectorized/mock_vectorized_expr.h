@@ -222,5 +222,24 @@ public:
     ColumnPtr col;
 };
 
+// Return the column of `slot_id` in the input chunk, and count the rows it is evaluated on.
+class MockSlotRefExpr : public Expr {
+public:
+    MockSlotRefExpr(const TExprNode& t, SlotId slot_id) : Expr(t), _slot_id(slot_id) {}
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new MockSlotRefExpr(*this)); }
+
+    ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        evaluated_rows += ptr->num_rows();
+        return ptr->get_column_by_slot_id(_slot_id);
+    }
+
+public:
+    size_t evaluated_rows = 0;
+
+private:
+    SlotId _slot_id;
+};
+
 } // namespace vectorized
 } // namespace starrocks
\ No newline at end of file
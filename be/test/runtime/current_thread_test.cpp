@@ -0,0 +1,54 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "runtime/current_thread.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(CurrentThreadTest, batch_consumption) {
+    MemTracker parent(-1, "parent");
+    MemTracker child(-1, "child", &parent);
+    const int64_t batch = CurrentThread::kMemTrackerBatchSize;
+
+    auto* old = CurrentThread::set_mem_tracker(&child);
+    CurrentThread::mem_consume(100);
+    // cached in thread.
+    ASSERT_EQ(0, child.consumption());
+
+    CurrentThread::mem_consume(batch);
+    ASSERT_EQ(batch + 100, child.consumption());
+    ASSERT_EQ(batch + 100, parent.consumption());
+
+    CurrentThread::mem_release(batch);
+    ASSERT_EQ(100, child.consumption());
+    CurrentThread::mem_release(50);
+    CurrentThread::mem_tracker_flush();
+    ASSERT_EQ(50, child.consumption());
+    ASSERT_EQ(50, parent.consumption());
+
+    // switching tracker flushes cached consumption to the old one.
+    CurrentThread::mem_consume(10);
+    {
+        ScopedThreadMemTracker guard(&parent);
+        ASSERT_EQ(60, child.consumption());
+        CurrentThread::mem_consume(20);
+    }
+    ASSERT_EQ(&child, CurrentThread::mem_tracker());
+    ASSERT_EQ(60, child.consumption());
+    ASSERT_EQ(80, parent.consumption());
+
+    // no tracker, nothing is charged.
+    CurrentThread::set_mem_tracker(nullptr);
+    CurrentThread::mem_consume(batch * 2);
+    CurrentThread::set_mem_tracker(&child);
+    CurrentThread::mem_release(60);
+    CurrentThread::set_mem_tracker(old);
+    ASSERT_EQ(0, child.consumption());
+    ASSERT_EQ(20, parent.consumption());
+}
+
+} // namespace starrocks
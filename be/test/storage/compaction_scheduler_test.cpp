@@ -0,0 +1,225 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/compaction_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <queue>
+#include <set>
+
+#include "common/config.h"
+#include "runtime/mem_tracker.h"
+#include "storage/data_dir.h"
+#include "storage/tablet_meta.h"
+#include "util/stopwatch.hpp"
+#include "util/time.h"
+
+namespace starrocks {
+
+// Runs fake compaction tasks, which block until they are released by the test.
+class MockCompactionScheduler : public CompactionScheduler {
+public:
+    MockCompactionScheduler() : CompactionScheduler(nullptr) {}
+    ~MockCompactionScheduler() override { stop(); }
+
+    void _get_candidates(std::vector<CompactionCandidate>* candidates) override {
+        std::lock_guard<std::mutex> l(_mock_lock);
+        candidates->insert(candidates->end(), _candidates.begin(), _candidates.end());
+    }
+
+    void _do_compaction(const CompactionCandidate& candidate) override {
+        std::unique_lock<std::mutex> l(_mock_lock);
+        _started.push_back(candidate.tablet->tablet_id());
+        _mock_cv.notify_all();
+        _mock_cv.wait(l, [&] { return _released.count(candidate.tablet->tablet_id()) > 0; });
+    }
+
+    void set_candidates(std::vector<CompactionCandidate> candidates) {
+        std::lock_guard<std::mutex> l(_mock_lock);
+        _candidates = std::move(candidates);
+    }
+
+    void release(int64_t tablet_id) {
+        std::lock_guard<std::mutex> l(_mock_lock);
+        _released.insert(tablet_id);
+        _mock_cv.notify_all();
+    }
+
+    // Wait at most 10 seconds until `num` tasks started.
+    bool wait_started(size_t num) {
+        std::unique_lock<std::mutex> l(_mock_lock);
+        return _mock_cv.wait_for(l, std::chrono::seconds(10), [&] { return _started.size() >= num; });
+    }
+
+    std::vector<int64_t> started() {
+        std::lock_guard<std::mutex> l(_mock_lock);
+        return _started;
+    }
+
+    std::set<int64_t> running_tablets() {
+        std::lock_guard<std::mutex> l(_lock);
+        std::set<int64_t> tablets;
+        for (const auto& [key, task] : _running_tasks) {
+            tablets.insert(key.first);
+        }
+        return tablets;
+    }
+
+private:
+    std::mutex _mock_lock;
+    std::condition_variable _mock_cv;
+    std::vector<CompactionCandidate> _candidates;
+    std::vector<int64_t> _started;
+    std::set<int64_t> _released;
+};
+
+class CompactionSchedulerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _mem_tracker = std::make_unique<MemTracker>(-1);
+        for (auto& data_dir : _data_dirs) {
+            data_dir = std::make_unique<DataDir>("/tmp/compaction_scheduler_test");
+            data_dir->_disk_capacity_bytes = 1L << 40;
+            data_dir->_available_bytes = 1L << 39;
+        }
+        _max_tasks_per_disk = config::compaction_max_tasks_per_disk;
+        _max_preempt_seconds = config::compaction_max_preempt_seconds;
+    }
+
+    void TearDown() override {
+        config::compaction_max_tasks_per_disk = _max_tasks_per_disk;
+        config::compaction_max_preempt_seconds = _max_preempt_seconds;
+    }
+
+    CompactionCandidate create_candidate(int64_t tablet_id, int disk, uint32_t score) {
+        TabletMetaSharedPtr tablet_meta(new TabletMeta(_mem_tracker.get()));
+        tablet_meta->_tablet_id = tablet_id;
+        CompactionCandidate candidate;
+        candidate.tablet = Tablet::create_tablet_from_meta(_mem_tracker.get(), tablet_meta, _data_dirs[disk].get());
+        candidate.type = CompactionType::CUMULATIVE_COMPACTION;
+        candidate.score = score;
+        return candidate;
+    }
+
+protected:
+    std::unique_ptr<MemTracker> _mem_tracker;
+    std::unique_ptr<DataDir> _data_dirs[2];
+    int32_t _max_tasks_per_disk = 0;
+    int32_t _max_preempt_seconds = 0;
+};
+
+// NOLINTNEXTLINE
+TEST_F(CompactionSchedulerTest, candidate_order) {
+    std::vector<CompactionCandidate> candidates(4);
+    candidates[0].score = 5;
+    candidates[0].version_count = 10;
+    candidates[1].score = 20;
+    candidates[1].version_count = 30;
+    candidates[2].score = 5;
+    candidates[2].version_count = 50;
+    candidates[3].score = 8;
+    candidates[3].version_count = 1;
+    std::priority_queue<CompactionCandidate, std::vector<CompactionCandidate>, CompactionCandidateComparator> queue(
+            CompactionCandidateComparator(), std::move(candidates));
+
+    std::vector<std::pair<uint32_t, int>> order;
+    while (!queue.empty()) {
+        order.emplace_back(queue.top().score, queue.top().version_count);
+        queue.pop();
+    }
+    std::vector<std::pair<uint32_t, int>> expected{{20, 30}, {8, 1}, {5, 50}, {5, 10}};
+    ASSERT_EQ(expected, order);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompactionSchedulerTest, io_budget) {
+    CompactionIOBudget budget;
+    // unlimited
+    ASSERT_EQ(0, budget.acquire(1L << 30, 0));
+
+    // the first second is granted at once.
+    ASSERT_EQ(0, budget.acquire(600, 1000));
+    ASSERT_EQ(0, budget.acquire(300, 1000));
+    // 100 bytes in debt at 1000 bytes/s, about 100ms.
+    int64_t wait_us = budget.acquire(200, 1000);
+    ASSERT_GT(wait_us, 50000);
+    ASSERT_LE(wait_us, 100000);
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompactionSchedulerTest, dispatch_within_limits) {
+    config::compaction_max_tasks_per_disk = 1;
+    MockCompactionScheduler scheduler;
+    // keep the dispatch thread idle, candidates are dispatched by the test.
+    scheduler.pause();
+    ASSERT_TRUE(scheduler.start(2).ok());
+
+    std::vector<CompactionCandidate> candidates{create_candidate(1, 0, 10), create_candidate(2, 0, 9),
+                                                create_candidate(3, 0, 8), create_candidate(4, 1, 5),
+                                                create_candidate(5, 1, 3)};
+    // the best tablet of each disk, one task per disk.
+    ASSERT_EQ(2, scheduler._dispatch(candidates));
+    ASSERT_EQ((std::set<int64_t>{1, 4}), scheduler.running_tablets());
+    ASSERT_TRUE(scheduler.wait_started(2));
+
+    // no free slot
+    ASSERT_EQ(0, scheduler._dispatch(candidates));
+
+    // a finished task frees the slot of its disk only.
+    scheduler.release(1);
+    for (int i = 0; i < 1000 && scheduler.running_tablets().count(1) > 0; i++) {
+        SleepForMs(10);
+    }
+    ASSERT_EQ((std::set<int64_t>{4}), scheduler.running_tablets());
+    candidates.erase(candidates.begin());
+    ASSERT_EQ(1, scheduler._dispatch(candidates));
+    ASSERT_EQ((std::set<int64_t>{2, 4}), scheduler.running_tablets());
+    ASSERT_TRUE(scheduler.wait_started(3));
+    ASSERT_EQ(3, scheduler.started().size());
+    ASSERT_EQ(2, scheduler.started()[2]);
+
+    scheduler.release(2);
+    scheduler.release(4);
+    scheduler.stop();
+    ASSERT_TRUE(scheduler.running_tablets().empty());
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompactionSchedulerTest, preempt) {
+    config::compaction_max_preempt_seconds = 1;
+    MockCompactionScheduler scheduler;
+    std::atomic<bool> high_load{true};
+    scheduler.set_preempt_checker([&] { return high_load.load(); });
+    scheduler.set_candidates({create_candidate(1, 0, 10)});
+    ASSERT_TRUE(scheduler.start(1).ok());
+
+    // nothing is dispatched under high query load.
+    ASSERT_TRUE(scheduler.is_preempted());
+    SleepForMs(1500);
+    ASSERT_TRUE(scheduler.started().empty());
+
+    // a running task yields to queries, but at most compaction_max_preempt_seconds.
+    MonotonicStopWatch watch;
+    watch.start();
+    scheduler.throttle(_data_dirs[0].get(), 0);
+    ASSERT_GE(watch.elapsed_time(), 900 * 1000 * 1000L);
+    ASSERT_GE(scheduler._preempted_us.load(), 900 * 1000L);
+
+    high_load = false;
+    ASSERT_FALSE(scheduler.is_preempted());
+    ASSERT_TRUE(scheduler.wait_started(1));
+    scheduler.set_candidates({});
+    scheduler.release(1);
+
+    // paused manually
+    scheduler.pause();
+    ASSERT_TRUE(scheduler.is_preempted());
+    scheduler.resume();
+    ASSERT_FALSE(scheduler.is_preempted());
+    watch.reset();
+    scheduler.throttle(_data_dirs[0].get(), 0);
+    ASSERT_LT(watch.elapsed_time(), 500 * 1000 * 1000L);
+    scheduler.stop();
+}
+
+} // namespace starrocks
@@ -36,6 +36,7 @@
 #include "storage/rowset/rowset_reader_context.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/rowset/segment_v2/column_statistics.h"
 #include "storage/rowset/vectorized/rowset_options.h"
 #include "storage/rowset/vectorized/segment_options.h"
 #include "storage/storage_engine.h"
@@ -755,4 +756,56 @@ TEST_F(BetaRowsetTest, FinalMergeTest) {
     }
 }
 
+TEST_F(BetaRowsetTest, ColumnStatisticsTest) {
+    const bool old_enable_statistics = config::enable_segment_column_statistics;
+    TabletSchema tablet_schema;
+    create_tablet_schema(&tablet_schema);
+    RowsetSharedPtr rowset;
+    const int num_segments = 3;
+    const uint32_t rows_per_segment = 1000;
+    {
+        RowsetWriterContext writer_context(kDataFormatUnknown, kDataFormatV2);
+        create_rowset_writer_context(&tablet_schema, &writer_context);
+        std::unique_ptr<RowsetWriter> rowset_writer;
+        ASSERT_EQ(OLAP_SUCCESS, RowsetFactory::create_rowset_writer(writer_context, &rowset_writer));
+
+        RowCursor input_row;
+        input_row.init(tablet_schema);
+        MemTracker mem_tracker(-1);
+        MemPool mem_pool(&mem_tracker);
+        for (int i = 0; i < num_segments; ++i) {
+            // the second segment is written without statistics, e.g. by an old version.
+            config::enable_segment_column_statistics = i != 1;
+            for (uint32_t rid = 0; rid < rows_per_segment; ++rid) {
+                uint32_t k1 = rid * 10 + i;
+                uint32_t k2 = k1 * 10;
+                uint32_t k3 = rows_per_segment * i + rid;
+                input_row.set_field_content(0, reinterpret_cast<char*>(&k1), &mem_pool);
+                input_row.set_field_content(1, reinterpret_cast<char*>(&k2), &mem_pool);
+                input_row.set_field_content(2, reinterpret_cast<char*>(&k3), &mem_pool);
+                ASSERT_EQ(OLAP_SUCCESS, rowset_writer->add_row(input_row));
+            }
+            ASSERT_EQ(OLAP_SUCCESS, rowset_writer->flush());
+        }
+        rowset = rowset_writer->build();
+        ASSERT_TRUE(rowset != nullptr);
+        ASSERT_EQ(num_segments, rowset->rowset_meta()->num_segments());
+    }
+    config::enable_segment_column_statistics = old_enable_statistics;
+
+    // the statistics cover the rows of the segments that have them.
+    auto* beta_rowset = static_cast<BetaRowset*>(rowset.get());
+    segment_v2::ColumnStatistics stats(OLAP_FIELD_TYPE_INT, 16);
+    ASSERT_TRUE(beta_rowset->get_column_statistics(2, &stats).ok());
+    ASSERT_EQ(2 * rows_per_segment, stats.num_rows());
+    ASSERT_LT(stats.num_rows(), rowset->num_rows());
+    ASSERT_EQ(0, stats.num_nulls());
+    ASSERT_NEAR(2 * rows_per_segment, stats.ndv(), 200);
+    // the values of the first segment are [0, 1000), those of the third one [2000, 3000).
+    ASSERT_NEAR(0.5, stats.fraction_le(vectorized::Datum(int32_t(rows_per_segment))), 0.1);
+
+    segment_v2::ColumnStatistics bad_type_stats(OLAP_FIELD_TYPE_BIGINT, 16);
+    ASSERT_FALSE(beta_rowset->get_column_statistics(2, &bad_type_stats).ok());
+}
+
 } // namespace starrocks
@@ -31,7 +31,9 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/segment_v2/bitmap_index_reader.h"
 #include "storage/rowset/segment_v2/bitmap_index_writer.h"
+#include "storage/rowset/segment_v2/tokenizer.h"
 #include "storage/types.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/file_utils.h"
 
 namespace starrocks {
@@ -236,5 +238,64 @@ TEST_F(BitmapIndexTest, test_null) {
     delete[] val;
 }
 
+TEST_F(BitmapIndexTest, test_inverted_index) {
+    std::vector<Slice> values{"The quick brown fox", "quick-thinking Foxes", "brown bear"};
+    std::string file_name = kTestDir + "/inverted";
+    ColumnIndexMetaPB meta;
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        fs::CreateBlockOptions opts({file_name});
+        ASSERT_TRUE(_block_mgr->create_block(opts, &wblock).ok());
+
+        std::unique_ptr<BitmapIndexWriter> writer;
+        ASSERT_TRUE(BitmapIndexWriter::create_inverted(get_type_info(OLAP_FIELD_TYPE_VARCHAR), STANDARD_TOKENIZER,
+                                                       &writer)
+                            .ok());
+        writer->add_values(values.data(), 2);
+        writer->add_nulls(1);
+        writer->add_values(values.data() + 2, 1);
+        ASSERT_TRUE(writer->finish(wblock.get(), &meta).ok());
+        ASSERT_EQ(INVERTED_INDEX, meta.type());
+        ASSERT_EQ(STANDARD_TOKENIZER, meta.inverted_index().tokenizer());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+
+    BitmapIndexReader reader;
+    ASSERT_TRUE(reader.load(_block_mgr, file_name, &meta.inverted_index().postings(), true, false).ok());
+    BitmapIndexIterator* iter = nullptr;
+    ASSERT_TRUE(reader.new_iterator(&iter).ok());
+    std::unique_ptr<BitmapIndexIterator> iter_guard(iter);
+    // bear, brown, fox, foxes, quick, the, thinking
+    ASSERT_EQ(7, reader.bitmap_nums() - 1);
+
+    Slice token("quick");
+    bool exact_match = false;
+    ASSERT_TRUE(iter->seek_dictionary(&token, &exact_match).ok());
+    ASSERT_TRUE(exact_match);
+    Roaring bitmap;
+    ASSERT_TRUE(iter->read_bitmap(iter->current_ordinal(), &bitmap).ok());
+    ASSERT_TRUE(Roaring::bitmapOf(2, 0, 1) == bitmap);
+    ASSERT_TRUE(iter->read_null_bitmap(&bitmap).ok());
+    ASSERT_TRUE(Roaring::bitmapOf(1, 2) == bitmap);
+
+    std::unique_ptr<Tokenizer> tokenizer;
+    ASSERT_TRUE(Tokenizer::create(STANDARD_TOKENIZER, &tokenizer).ok());
+    auto seek = [&](const std::vector<std::string>& operands, Roaring* rows) {
+        std::unique_ptr<vectorized::ColumnPredicate> pred(vectorized::new_column_contains_predicate(
+                get_type_info(OLAP_FIELD_TYPE_VARCHAR), 0, operands));
+        EXPECT_TRUE(pred->support_inverted_index());
+        return pred->seek_inverted_index(*tokenizer, iter, rows);
+    };
+    Roaring rows;
+    ASSERT_TRUE(seek({"e QUICK b"}, &rows).ok());
+    ASSERT_TRUE(Roaring::bitmapOf(2, 0, 1) == rows);
+    ASSERT_TRUE(seek({"e quick b", "k brown b"}, &rows).ok());
+    ASSERT_TRUE(Roaring::bitmapOf(1, 0) == rows);
+    ASSERT_TRUE(seek({"a cat b"}, &rows).ok());
+    ASSERT_TRUE(rows.isEmpty());
+    // "fox" could be part of "foxes".
+    ASSERT_TRUE(seek({"fox"}, &rows).is_cancelled());
+}
+
 } // namespace segment_v2
 } // namespace starrocks
@@ -30,6 +30,7 @@
 #include "storage/rowset/segment_v2/bloom_filter_index_reader.h"
 #include "storage/rowset/segment_v2/bloom_filter_index_writer.h"
 #include "storage/types.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/file_utils.h"
 
 namespace starrocks {
@@ -287,5 +288,60 @@ TEST_F(BloomFilterIndexReaderWriterTest, test_decimal) {
     delete[] val;
 }
 
+TEST_F(BloomFilterIndexReaderWriterTest, test_ngram_varchar) {
+    // there will be 3 bloom filter pages, of "apple_xxxx", "banana_xxxx" and "cherry_xxxx" respectively.
+    std::vector<std::string> prefixes{"apple_", "banana_", "cherry_"};
+    std::vector<std::string> values;
+    for (const auto& prefix : prefixes) {
+        for (int i = 0; i < 1024; ++i) {
+            values.emplace_back(prefix + std::to_string(1000 + i));
+        }
+    }
+    std::vector<Slice> slices(values.begin(), values.end());
+
+    TypeInfoPtr type_info = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+    std::string fname = kTestDir + "/bloom_filter_ngram_varchar";
+    ColumnIndexMetaPB meta;
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        fs::CreateBlockOptions opts({fname});
+        ASSERT_TRUE(_block_mgr->create_block(opts, &wblock).ok());
+        std::unique_ptr<BloomFilterIndexWriter> writer;
+        ASSERT_TRUE(BloomFilterIndexWriter::create_ngram(BloomFilterOptions(), type_info, 3, &writer).ok());
+        for (int i = 0; i < slices.size(); i += 1024) {
+            writer->add_values(slices.data() + i, 1024);
+            ASSERT_TRUE(writer->flush().ok());
+        }
+        ASSERT_TRUE(writer->finish(wblock.get(), &meta).ok());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+    ASSERT_EQ(NGRAM_BLOOM_FILTER_INDEX, meta.type());
+    ASSERT_EQ(3, meta.ngram_bloom_filter_index().gram_size());
+
+    std::unique_ptr<BloomFilterIndexReader> reader(new BloomFilterIndexReader());
+    ASSERT_TRUE(reader->load(_block_mgr, fname, &meta.ngram_bloom_filter_index(), true, false).ok());
+    std::unique_ptr<BloomFilterIndexIterator> iter;
+    ASSERT_TRUE(reader->new_iterator(&iter).ok());
+
+    auto contains = [&](std::vector<std::string> operands) {
+        return std::unique_ptr<vectorized::ColumnPredicate>(
+                vectorized::new_column_contains_predicate(type_info, 0, operands));
+    };
+    auto banana = contains({"nana_"});
+    auto banana_1234 = contains({"banan", "1234"});
+    auto short_operand = contains({"zz"});
+    auto not_exist = contains({"durian"});
+    ASSERT_TRUE(banana->support_ngram_bloom_filter());
+    for (int page = 0; page < 3; ++page) {
+        std::unique_ptr<BloomFilter> bf;
+        ASSERT_TRUE(iter->read_bloom_filter(page, &bf).ok());
+        ASSERT_EQ(page == 1, banana->ngram_bloom_filter(bf.get(), 3));
+        ASSERT_EQ(page == 1, banana_1234->ngram_bloom_filter(bf.get(), 3));
+        // operands shorter than a gram can't filter any page.
+        ASSERT_TRUE(short_operand->ngram_bloom_filter(bf.get(), 3));
+        ASSERT_FALSE(not_exist->ngram_bloom_filter(bf.get(), 3));
+    }
+}
+
 } // namespace segment_v2
 } // namespace starrocks
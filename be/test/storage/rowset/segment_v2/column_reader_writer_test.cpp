@@ -30,6 +30,7 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "env/env_memory.h"
 #include "gen_cpp/segment_v2.pb.h"
 #include "runtime/date_value.h"
@@ -42,6 +43,7 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/segment_v2/column_reader.h"
 #include "storage/rowset/segment_v2/column_writer.h"
+#include "storage/rowset/segment_v2/encoding_info.h"
 #include "storage/tablet_schema_helper.h"
 #include "storage/types.h"
 #include "storage/vectorized/chunk_helper.h"
@@ -410,6 +412,99 @@ TEST_F(ColumnReaderWriterTest, test_datetime) {
     test_nullable_data<OLAP_FIELD_TYPE_TIMESTAMP, BIT_SHUFFLE, 2>(*col);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ColumnReaderWriterTest, test_adaptive_encoding) {
+    const int32_t old_sample_pages = config::adaptive_encoding_sample_pages;
+    config::adaptive_encoding_sample_pages = 4;
+
+    // the first pages are sampled by all the encodings, and each of them may have its own encoding.
+    auto col = datetime_values(100);
+    test_nullable_data<OLAP_FIELD_TYPE_TIMESTAMP, DEFAULT_ENCODING, 1>(*col);
+    test_nullable_data<OLAP_FIELD_TYPE_TIMESTAMP, DEFAULT_ENCODING, 2>(*col);
+
+    col = numeric_data<OLAP_FIELD_TYPE_DOUBLE>(4);
+    test_nullable_data<OLAP_FIELD_TYPE_DOUBLE, DEFAULT_ENCODING, 2>(*col);
+
+    auto env = std::make_unique<EnvMemory>();
+    auto block_mgr = std::make_unique<fs::FileBlockManager>(env.get(), fs::BlockManagerOptions());
+    ASSERT_TRUE(env->create_dir(TEST_DIR).ok());
+    TabletColumn column(OLAP_FIELD_AGGREGATION_NONE, OLAP_FIELD_TYPE_BIGINT);
+    auto create_writer = [&](const std::string& fname, ColumnMetaPB* meta, std::unique_ptr<fs::WritableBlock>* wblock,
+                             std::unique_ptr<ScalarColumnWriter>* writer) {
+        ASSERT_TRUE(block_mgr->create_block(fs::CreateBlockOptions({fname}), wblock).ok());
+        meta->set_column_id(0);
+        meta->set_unique_id(0);
+        meta->set_type(OLAP_FIELD_TYPE_BIGINT);
+        meta->set_length(0);
+        meta->set_encoding(DEFAULT_ENCODING);
+        meta->set_compression(starrocks::LZ4_FRAME);
+        meta->set_is_nullable(false);
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = meta;
+        writer_opts.data_page_size = 16 * 1024;
+        writer->reset(new ScalarColumnWriter(writer_opts, std::unique_ptr<Field>(FieldFactory::create(column)),
+                                             wblock->get()));
+        ASSERT_TRUE((*writer)->init().ok());
+        ASSERT_TRUE((*writer)->_sample_encodings);
+    };
+
+    // the sampled pages record their own encoding and compression, the rest ones use those of the column.
+    {
+        ColumnMetaPB meta;
+        std::unique_ptr<fs::WritableBlock> wblock;
+        std::unique_ptr<ScalarColumnWriter> writer;
+        create_writer(TEST_DIR + "/test-adaptive-encoding.data", &meta, &wblock, &writer);
+        auto values = vectorized::Int64Column::create();
+        for (int64_t i = 0; i < 100000; i++) {
+            values->append(i * 1000 + i % 7);
+        }
+        ASSERT_TRUE(writer->append(*values).ok());
+        ASSERT_TRUE(writer->finish().ok());
+        ASSERT_FALSE(writer->_sample_encodings);
+        // the older versions fail to read the column.
+        ASSERT_EQ(PER_PAGE_ENCODING, meta.encoding());
+        ASSERT_NE(DEFAULT_ENCODING, meta.data_page_encoding());
+        ASSERT_NE(DICT_ENCODING, meta.data_page_encoding());
+        const EncodingInfo* column_encoding_info = nullptr;
+        ASSERT_FALSE(EncodingInfo::get(OLAP_FIELD_TYPE_BIGINT, meta.encoding(), &column_encoding_info).ok());
+        ASSERT_TRUE(meta.compression() == starrocks::LZ4_FRAME || meta.compression() == starrocks::ZSTD);
+
+        int num_pages = 0;
+        for (auto* page = writer->_pages.head; page != nullptr; page = page->next, num_pages++) {
+            const DataPageFooterPB& footer = page->footer.data_page_footer();
+            if (num_pages < config::adaptive_encoding_sample_pages) {
+                ASSERT_TRUE(footer.has_encoding());
+                ASSERT_NE(DICT_ENCODING, footer.encoding());
+                const EncodingInfo* encoding_info = nullptr;
+                ASSERT_TRUE(EncodingInfo::get(OLAP_FIELD_TYPE_BIGINT, footer.encoding(), &encoding_info).ok());
+                ASSERT_TRUE(!page->footer.has_compression() || page->footer.compression() == starrocks::LZ4_FRAME ||
+                            page->footer.compression() == starrocks::ZSTD);
+            } else {
+                ASSERT_FALSE(footer.has_encoding());
+                ASSERT_FALSE(page->footer.has_compression());
+            }
+        }
+        ASSERT_GT(num_pages, config::adaptive_encoding_sample_pages);
+    }
+
+    // a combination that failed to encode some of the sampled pages is not chosen, however small it is.
+    {
+        ColumnMetaPB meta;
+        std::unique_ptr<fs::WritableBlock> wblock;
+        std::unique_ptr<ScalarColumnWriter> writer;
+        create_writer(TEST_DIR + "/test-adaptive-encoding-choice.data", &meta, &wblock, &writer);
+        writer->_num_sampled_pages = 2;
+        writer->_sampled_sizes[{PLAIN_ENCODING, starrocks::ZSTD}] = {10, 1};
+        writer->_sampled_sizes[{FOR_ENCODING, starrocks::ZSTD}] = {100, 2};
+        writer->_sampled_sizes[{BIT_SHUFFLE, starrocks::LZ4_FRAME}] = {200, 2};
+        ASSERT_TRUE(writer->_choose_sampled_encoding().ok());
+        ASSERT_EQ(FOR_ENCODING, meta.encoding());
+        ASSERT_EQ(starrocks::ZSTD, meta.compression());
+    }
+
+    config::adaptive_encoding_sample_pages = old_sample_pages;
+}
+
 // NOLINTNEXTLINE
 TEST_F(ColumnReaderWriterTest, test_binary) {
     auto c = low_cardinality_strings(10000);
@@ -0,0 +1,152 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/column_statistics.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/field.h"
+#include "storage/tablet_schema_helper.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks::segment_v2 {
+
+class ColumnStatisticsTest : public testing::Test {
+public:
+    static ColumnStatisticsPB write_ints(int32_t begin, int32_t end, uint32_t num_nulls) {
+        TabletColumn int_column = create_int_key(0);
+        std::unique_ptr<Field> field(FieldFactory::create(int_column));
+        ColumnStatisticsWriter writer(field.get(), 16);
+        std::vector<int32_t> values;
+        for (int32_t v = begin; v < end; v++) {
+            values.push_back(v);
+        }
+        writer.add_values(values.data(), values.size());
+        writer.add_nulls(num_nulls);
+        ColumnStatisticsPB statistics;
+        writer.finish(&statistics);
+        return statistics;
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(ColumnStatisticsTest, test_ndv_sketch) {
+    NdvSketch sketch1;
+    NdvSketch sketch2;
+    ASSERT_EQ(0, sketch1.estimate());
+    for (uint64_t i = 0; i < 100000; i++) {
+        uint64_t hash = HashUtil::murmur_hash64A(&i, sizeof(i), HashUtil::MURMUR_SEED);
+        (i % 2 == 0 ? sketch1 : sketch2).update(hash);
+    }
+    ASSERT_NEAR(50000, sketch1.estimate(), 5000);
+    sketch1.merge(sketch2);
+    ASSERT_NEAR(100000, sketch1.estimate(), 10000);
+
+    std::string buf;
+    sketch1.serialize(&buf);
+    ASSERT_EQ(1 + NdvSketch::NUM_REGISTERS, buf.size());
+    NdvSketch sketch3;
+    ASSERT_TRUE(sketch3.deserialize(buf).ok());
+    ASSERT_EQ(sketch1.estimate(), sketch3.estimate());
+
+    // a sketch of a few values is stored sparsely
+    NdvSketch sketch4;
+    for (uint64_t i = 0; i < 10; i++) {
+        sketch4.update(HashUtil::murmur_hash64A(&i, sizeof(i), HashUtil::MURMUR_SEED));
+    }
+    sketch4.serialize(&buf);
+    ASSERT_LE(buf.size(), 1 + 10 * 3);
+    ASSERT_TRUE(sketch3.deserialize(buf).ok());
+    ASSERT_EQ(10, sketch3.estimate());
+
+    ASSERT_FALSE(sketch3.deserialize("").ok());
+    ASSERT_FALSE(sketch3.deserialize(std::string("\0\xff\xff\x01", 4)).ok());
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnStatisticsTest, test_int_histogram) {
+    ColumnStatisticsPB statistics = write_ints(0, 100000, 100);
+    ASSERT_EQ(100100, statistics.num_rows());
+    ASSERT_EQ(100, statistics.num_nulls());
+    ASSERT_EQ(16, statistics.histogram_bounds_size());
+    ASSERT_EQ(16, statistics.histogram_cumulative_counts_size());
+    ASSERT_GT(std::stoi(statistics.histogram_bounds(15)), 99000);
+    ASSERT_EQ(100000, statistics.histogram_cumulative_counts(15));
+
+    ColumnStatistics stats(OLAP_FIELD_TYPE_INT, 16);
+    ASSERT_TRUE(stats.merge(statistics).ok());
+    ASSERT_EQ(100100, stats.num_rows());
+    ASSERT_EQ(100, stats.num_nulls());
+    ASSERT_NEAR(100000, stats.ndv(), 10000);
+    ASSERT_NEAR(0.25, stats.fraction_le(vectorized::Datum(int32_t(25000))), 0.05);
+    ASSERT_NEAR(0.5, stats.fraction_le(vectorized::Datum(int32_t(50000))), 0.05);
+    ASSERT_EQ(1, stats.fraction_le(vectorized::Datum(int32_t(200000))));
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnStatisticsTest, test_duplicate_values) {
+    TabletColumn varchar_column = create_varchar_key(0);
+    std::unique_ptr<Field> field(FieldFactory::create(varchar_column));
+    ColumnStatisticsWriter writer(field.get(), 4);
+    // 90% of the values are "a"
+    std::vector<std::string> values;
+    for (int i = 0; i < 10000; i++) {
+        values.emplace_back(i % 10 == 0 ? "b" + std::to_string(i) : "a");
+    }
+    std::vector<Slice> slices(values.begin(), values.end());
+    writer.add_values(slices.data(), slices.size());
+    ColumnStatisticsPB statistics;
+    writer.finish(&statistics);
+
+    ASSERT_EQ(10000, statistics.num_rows());
+    ASSERT_EQ(0, statistics.num_nulls());
+    ASSERT_EQ("a", statistics.histogram_bounds(0));
+    ASSERT_NEAR(9000, statistics.histogram_cumulative_counts(0), 500);
+    for (int i = 1; i < statistics.histogram_bounds_size(); i++) {
+        ASSERT_LT(statistics.histogram_bounds(i - 1), statistics.histogram_bounds(i));
+        ASSERT_LT(statistics.histogram_cumulative_counts(i - 1), statistics.histogram_cumulative_counts(i));
+    }
+    ASSERT_EQ(10000, statistics.histogram_cumulative_counts(statistics.histogram_bounds_size() - 1));
+
+    ColumnStatistics stats(OLAP_FIELD_TYPE_VARCHAR, 4);
+    ASSERT_TRUE(stats.merge(statistics).ok());
+    ASSERT_NEAR(1001, stats.ndv(), 100);
+}
+
+// NOLINTNEXTLINE
+TEST_F(ColumnStatisticsTest, test_merge) {
+    ColumnStatistics stats(OLAP_FIELD_TYPE_INT, 16);
+    ASSERT_TRUE(stats.merge(write_ints(0, 30000, 0)).ok());
+    ASSERT_TRUE(stats.merge(write_ints(20000, 50000, 10)).ok());
+    ASSERT_TRUE(stats.merge(write_ints(40000, 80000, 0)).ok());
+    ASSERT_EQ(100010, stats.num_rows());
+    ASSERT_EQ(10, stats.num_nulls());
+    ASSERT_NEAR(80000, stats.ndv(), 8000);
+    // 30000 values of the first segment and 10000 of the second one
+    ASSERT_NEAR(0.4, stats.fraction_le(vectorized::Datum(int32_t(30000))), 0.05);
+    ASSERT_NEAR(0.8, stats.fraction_le(vectorized::Datum(int32_t(60000))), 0.05);
+
+    ColumnStatisticsPB merged;
+    stats.to_pb(&merged);
+    ASSERT_LE(merged.histogram_bounds_size(), 16);
+    ASSERT_EQ(100000, merged.histogram_cumulative_counts(merged.histogram_bounds_size() - 1));
+    ColumnStatistics stats2(OLAP_FIELD_TYPE_INT, 16);
+    ASSERT_TRUE(stats2.merge(merged).ok());
+    ASSERT_EQ(stats.ndv(), stats2.ndv());
+    ASSERT_EQ(stats.fraction_le(vectorized::Datum(int32_t(30000))),
+              stats2.fraction_le(vectorized::Datum(int32_t(30000))));
+
+    // merged with the statistics of an empty segment
+    ASSERT_TRUE(stats2.merge(write_ints(0, 0, 5)).ok());
+    ASSERT_EQ(100015, stats2.num_rows());
+    ASSERT_EQ(stats.ndv(), stats2.ndv());
+
+    ColumnStatisticsPB bad = merged;
+    bad.add_histogram_bounds("1");
+    ASSERT_FALSE(stats2.merge(bad).ok());
+}
+
+} // namespace starrocks::segment_v2
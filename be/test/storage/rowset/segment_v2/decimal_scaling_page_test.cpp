@@ -0,0 +1,119 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/decimal_scaling_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "column/fixed_length_column.h"
+#include "storage/rowset/segment_v2/bitshuffle_page.h"
+#include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
+
+namespace starrocks::segment_v2 {
+
+class DecimalScalingPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    static OwnedSlice build_page(PageBuilder* builder, const std::vector<typename TypeTraits<Type>::CppType>& values) {
+        EXPECT_EQ(values.size(), builder->add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+        return builder->finish()->build();
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(DecimalScalingPageTest, test_sensor_readings) {
+    PageBuilderOptions options;
+    options.data_page_size = 64 * 1024;
+
+    // temperatures with two decimal digits.
+    std::vector<double> values;
+    for (int i = 0; i < 8000; i++) {
+        values.emplace_back(std::round((20 + 5 * std::sin(i / 100.0)) * 100) / 100);
+    }
+    ASSERT_EQ(2, DecimalScaling<double>::find_exponent(values.data(), values.size()));
+
+    DecimalScalingPageBuilder<OLAP_FIELD_TYPE_DOUBLE> page_builder(options);
+    OwnedSlice page = build_page<OLAP_FIELD_TYPE_DOUBLE>(&page_builder, values);
+    BitshufflePageBuilder<OLAP_FIELD_TYPE_DOUBLE> bitshuffle_builder(options);
+    OwnedSlice bitshuffle_page = build_page<OLAP_FIELD_TYPE_DOUBLE>(&bitshuffle_builder, values);
+    ASSERT_LT(page.slice().size * 2, bitshuffle_page.slice().size);
+
+    double first_value = 0;
+    ASSERT_TRUE(page_builder.get_first_value(&first_value).ok());
+    ASSERT_EQ(values[0], first_value);
+
+    DecimalScalingPageDecoder<OLAP_FIELD_TYPE_DOUBLE> page_decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(DECIMAL_SCALING, page_decoder.encoding_type());
+    ASSERT_EQ(values.size(), page_decoder.count());
+
+    auto column = vectorized::DoubleColumn::create();
+    size_t n = values.size();
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values.size(), n);
+    ASSERT_EQ(values, column->get_data());
+
+    ASSERT_TRUE(page_decoder.seek_to_position_in_page(7000).ok());
+    column->resize(0);
+    n = 2000;
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(1000, n);
+    ASSERT_EQ(values[7000], column->get_data()[0]);
+    ASSERT_EQ(values.back(), column->get_data().back());
+}
+
+// NOLINTNEXTLINE
+TEST_F(DecimalScalingPageTest, test_float) {
+    PageBuilderOptions options;
+    options.data_page_size = 64 * 1024;
+
+    // the nearest floats of the values with one decimal digit, as parsed from text.
+    std::vector<float> values;
+    for (int i = 0; i < 1000; i++) {
+        values.emplace_back(static_cast<float>((i % 300 - 100) / 10.0));
+    }
+    ASSERT_EQ(1, DecimalScaling<float>::find_exponent(values.data(), values.size()));
+    DecimalScalingPageBuilder<OLAP_FIELD_TYPE_FLOAT> page_builder(options);
+    OwnedSlice page = build_page<OLAP_FIELD_TYPE_FLOAT>(&page_builder, values);
+
+    DecimalScalingPageDecoder<OLAP_FIELD_TYPE_FLOAT> page_decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(DECIMAL_SCALING, page_decoder.encoding_type());
+    auto column = vectorized::FloatColumn::create();
+    size_t n = values.size();
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values, column->get_data());
+}
+
+// NOLINTNEXTLINE
+TEST_F(DecimalScalingPageTest, test_fallback_to_bitshuffle) {
+    PageBuilderOptions options;
+    options.data_page_size = 64 * 1024;
+
+    std::vector<double> values;
+    for (int i = 0; i < 100; i++) {
+        values.emplace_back(i * 0.5);
+    }
+    values[10] = std::numeric_limits<double>::quiet_NaN();
+    values[20] = 1.0 / 3;
+    values[30] = -0.0;
+    ASSERT_EQ(-1, DecimalScaling<double>::find_exponent(values.data(), values.size()));
+
+    DecimalScalingPageBuilder<OLAP_FIELD_TYPE_DOUBLE> page_builder(options);
+    OwnedSlice page = build_page<OLAP_FIELD_TYPE_DOUBLE>(&page_builder, values);
+
+    DecimalScalingPageDecoder<OLAP_FIELD_TYPE_DOUBLE> page_decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(BIT_SHUFFLE, page_decoder.encoding_type());
+    ASSERT_EQ(values.size(), page_decoder.count());
+    auto column = vectorized::DoubleColumn::create();
+    size_t n = values.size();
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values.size(), n);
+    ASSERT_EQ(0, memcmp(values.data(), column->get_data().data(), values.size() * sizeof(double)));
+}
+
+} // namespace starrocks::segment_v2
@@ -0,0 +1,118 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/dict_page.h"
+
+#include <gtest/gtest.h>
+
+#include "column/fixed_length_column.h"
+#include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/rowset/segment_v2/plain_page.h"
+
+namespace starrocks::segment_v2 {
+
+class DictPageTest : public testing::Test {
+public:
+    template <FieldType Type>
+    static std::unique_ptr<PlainPageDecoder<Type>> dict_decoder(DictPageBuilder<Type>* builder, OwnedSlice* data) {
+        *data = builder->get_dictionary_page()->build();
+        auto decoder = std::make_unique<PlainPageDecoder<Type>>(data->slice(), PageDecoderOptions());
+        EXPECT_TRUE(decoder->init().ok());
+        return decoder;
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(DictPageTest, test_low_cardinality) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    options.dict_page_size = 256 * 1024;
+    DictPageBuilder<OLAP_FIELD_TYPE_BIGINT> page_builder(options);
+
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 1000; i++) {
+        values.emplace_back(100 + i % 10);
+    }
+    ASSERT_EQ(values.size(), page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+    OwnedSlice page = page_builder.finish()->build();
+    ASSERT_TRUE(page_builder.all_dict_encoded());
+
+    int64_t first_value = 0;
+    int64_t last_value = 0;
+    ASSERT_TRUE(page_builder.get_first_value(&first_value).ok());
+    ASSERT_TRUE(page_builder.get_last_value(&last_value).ok());
+    ASSERT_EQ(100, first_value);
+    ASSERT_EQ(109, last_value);
+
+    OwnedSlice dict_data;
+    auto dict = dict_decoder(&page_builder, &dict_data);
+    ASSERT_EQ(10, dict->count());
+    ASSERT_EQ(3, dict->find(103));
+    ASSERT_EQ(-1, dict->find(99));
+
+    DictPageDecoder<OLAP_FIELD_TYPE_BIGINT> page_decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(DICT_ENCODING, page_decoder.encoding_type());
+    page_decoder.set_dict_decoder(dict.get());
+    ASSERT_EQ(values.size(), page_decoder.count());
+
+    auto column = vectorized::Int64Column::create();
+    size_t n = values.size();
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values.size(), n);
+    ASSERT_EQ(values, column->get_data());
+
+    ASSERT_TRUE(page_decoder.seek_to_position_in_page(995).ok());
+    auto codes = vectorized::Int32Column::create();
+    n = 10;
+    ASSERT_TRUE(page_decoder.next_dict_codes(&n, codes.get()).ok());
+    ASSERT_EQ(5, n);
+    for (int32_t i = 0; i < 5; i++) {
+        ASSERT_EQ(5 + i, codes->get_data()[i]);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(DictPageTest, test_fallback_to_bitshuffle) {
+    PageBuilderOptions options;
+    options.data_page_size = 1024;
+    options.dict_page_size = 64;
+    DictPageBuilder<OLAP_FIELD_TYPE_INT> page_builder(options);
+
+    std::vector<int32_t> values;
+    for (int32_t i = 0; i < 100; i++) {
+        values.emplace_back(i);
+    }
+    // the dictionary is full after 16 values.
+    size_t added = page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    ASSERT_LT(added, values.size());
+    ASSERT_TRUE(page_builder.is_page_full());
+    OwnedSlice dict_page = page_builder.finish()->build();
+    ASSERT_TRUE(page_builder.all_dict_encoded());
+
+    page_builder.reset();
+    ASSERT_FALSE(page_builder.all_dict_encoded());
+    size_t remaining = values.size() - added;
+    ASSERT_EQ(remaining, page_builder.add(reinterpret_cast<const uint8_t*>(values.data() + added), remaining));
+    OwnedSlice plain_page = page_builder.finish()->build();
+
+    OwnedSlice dict_data;
+    auto dict = dict_decoder(&page_builder, &dict_data);
+    ASSERT_EQ(added, dict->count());
+
+    auto column = vectorized::Int32Column::create();
+    DictPageDecoder<OLAP_FIELD_TYPE_INT> dict_page_decoder(dict_page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(dict_page_decoder.init().ok());
+    dict_page_decoder.set_dict_decoder(dict.get());
+    size_t n = added;
+    ASSERT_TRUE(dict_page_decoder.next_batch(&n, column.get()).ok());
+
+    DictPageDecoder<OLAP_FIELD_TYPE_INT> plain_page_decoder(plain_page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(plain_page_decoder.init().ok());
+    ASSERT_EQ(BIT_SHUFFLE, plain_page_decoder.encoding_type());
+    n = remaining;
+    ASSERT_TRUE(plain_page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values, column->get_data());
+}
+
+} // namespace starrocks::segment_v2
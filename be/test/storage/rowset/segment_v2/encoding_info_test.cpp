@@ -47,11 +47,30 @@ TEST_F(EncodingInfoTest, normal) {
 }
 
 TEST_F(EncodingInfoTest, no_encoding) {
-    auto type_info = get_type_info(OLAP_FIELD_TYPE_BIGINT);
     const EncodingInfo* encoding_info = nullptr;
-    auto status = EncodingInfo::get(OLAP_FIELD_TYPE_BIGINT, DICT_ENCODING, &encoding_info);
+    auto status = EncodingInfo::get(OLAP_FIELD_TYPE_DOUBLE, DICT_ENCODING, &encoding_info);
     ASSERT_FALSE(status.ok());
 }
 
+TEST_F(EncodingInfoTest, dict_encoding_of_integers) {
+    for (FieldType type : {OLAP_FIELD_TYPE_INT, OLAP_FIELD_TYPE_BIGINT, OLAP_FIELD_TYPE_DATE_V2,
+                           OLAP_FIELD_TYPE_TIMESTAMP}) {
+        const EncodingInfo* encoding_info = nullptr;
+        ASSERT_TRUE(EncodingInfo::get(type, DICT_ENCODING, &encoding_info).ok());
+        ASSERT_EQ(DICT_ENCODING, encoding_info->encoding());
+    }
+}
+
+TEST_F(EncodingInfoTest, get_all) {
+    std::vector<const EncodingInfo*> encodings = EncodingInfo::get_all(OLAP_FIELD_TYPE_DOUBLE);
+    ASSERT_EQ(3, encodings.size());
+    ASSERT_EQ(PLAIN_ENCODING, encodings[0]->encoding());
+    ASSERT_EQ(BIT_SHUFFLE, encodings[1]->encoding());
+    ASSERT_EQ(DECIMAL_SCALING, encodings[2]->encoding());
+    for (const EncodingInfo* encoding_info : encodings) {
+        ASSERT_EQ(OLAP_FIELD_TYPE_DOUBLE, encoding_info->type());
+    }
+}
+
 } // namespace segment_v2
 } // namespace starrocks
@@ -31,6 +31,7 @@
 #include "storage/rowset/segment_v2/page_builder.h"
 #include "storage/rowset/segment_v2/page_decoder.h"
 #include "storage/vectorized/chunk_helper.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/logging.h"
 
 using starrocks::segment_v2::PageBuilderOptions;
@@ -253,6 +254,32 @@ TEST_F(FrameOfReferencePageTest, TestInt32SequenceBlockEncoderSize) {
     ASSERT_EQ(27, s.slice().size);
 }
 
+TEST_F(FrameOfReferencePageTest, TestInt32SequenceDeltaBlockEncoderSize) {
+    using PageBuilderType =
+            segment_v2::FrameOfReferencePageBuilder<OLAP_FIELD_TYPE_INT, segment_v2::FOR_DELTA_ENCODING>;
+    using PageDecoderType =
+            segment_v2::FrameOfReferencePageDecoder<OLAP_FIELD_TYPE_INT, segment_v2::FOR_DELTA_ENCODING>;
+    size_t size = 128;
+    std::unique_ptr<int32_t[]> ints(new int32_t[size]);
+    for (int i = 0; i < size; i++) {
+        ints.get()[i] = i;
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    PageBuilderType page_builder(builder_options);
+    size = page_builder.add(reinterpret_cast<const uint8_t*>(ints.get()), size);
+    OwnedSlice s = page_builder.finish()->build();
+    // body: 4 bytes min value + 4 bytes min delta, no bit for the equal deltas = 8
+    // footer: (1 + 1) * 1 + 1 + 4 = 7
+    ASSERT_EQ(15, s.slice().size);
+
+    PageDecoderType page_decoder(s.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(segment_v2::FOR_DELTA_ENCODING, page_decoder.encoding_type());
+
+    test_encode_decode_page_template<OLAP_FIELD_TYPE_INT, PageBuilderType, PageDecoderType>(ints.get(), size);
+}
+
 TEST_F(FrameOfReferencePageTest, TestFirstLastValue) {
     size_t size = 128;
     std::unique_ptr<int32_t[]> ints(new int32_t[size]);
@@ -314,4 +341,35 @@ TEST_F(FrameOfReferencePageTest, TestFindBitsOfInt) {
     ASSERT_EQ(65, bits(bits_65));
 }
 
+TEST_F(FrameOfReferencePageTest, TestEvaluatePredicate) {
+    std::vector<int64_t> values;
+    for (int64_t i = 0; i < 1000; i++) {
+        values.push_back(i < 512 ? i * 10 : 7000 + (i * 7919) % 100);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    segment_v2::FrameOfReferencePageBuilder<OLAP_FIELD_TYPE_BIGINT> page_builder(builder_options);
+    ASSERT_EQ(values.size(), page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size()));
+    OwnedSlice s = page_builder.finish()->build();
+
+    std::unique_ptr<vectorized::ColumnPredicate> ge(
+            vectorized::new_column_ge_predicate(get_type_info(OLAP_FIELD_TYPE_BIGINT), 0, "3000"));
+    std::unique_ptr<vectorized::ColumnPredicate> eq(
+            vectorized::new_column_eq_predicate(get_type_info(OLAP_FIELD_TYPE_BIGINT), 0, "7042"));
+    for (const auto* pred : {ge.get(), eq.get()}) {
+        segment_v2::FrameOfReferencePageDecoder<OLAP_FIELD_TYPE_BIGINT> page_decoder(s.slice(), PageDecoderOptions());
+        ASSERT_TRUE(page_decoder.init().ok());
+        ASSERT_TRUE(page_decoder.seek_to_position_in_page(100).ok());
+        std::vector<uint8_t> selection(1000);
+        size_t n = 1000;
+        ASSERT_TRUE(page_decoder.evaluate_predicate(pred, &n, selection.data()).ok());
+        ASSERT_EQ(900, n);
+        ASSERT_EQ(1000, page_decoder.current_index());
+        for (size_t i = 0; i < n; i++) {
+            int64_t v = values[100 + i];
+            ASSERT_EQ(pred == ge.get() ? v >= 3000 : v == 7042, selection[i]) << "index " << 100 + i;
+        }
+    }
+}
+
 } // namespace starrocks
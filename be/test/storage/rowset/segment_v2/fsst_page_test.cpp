@@ -0,0 +1,194 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+
+#include "column/binary_column.h"
+#include "storage/rowset/segment_v2/binary_plain_page.h"
+#include "storage/rowset/segment_v2/page_builder.h"
+#include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/vectorized/column_predicate.h"
+
+namespace starrocks::segment_v2 {
+
+class FsstPageTest : public testing::Test {
+public:
+    static OwnedSlice build_page(PageBuilder* builder, const std::vector<std::string>& values) {
+        std::vector<Slice> slices(values.begin(), values.end());
+        EXPECT_EQ(values.size(), builder->add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+        return builder->finish()->build();
+    }
+
+    static std::vector<std::string> urls(size_t n) {
+        static const char* hosts[] = {"www.example.com", "shop.example.org", "news.example.net"};
+        static const char* paths[] = {"/products/", "/search?q=", "/articles/2021/"};
+        std::vector<std::string> values;
+        for (size_t i = 0; i < n; i++) {
+            values.emplace_back(std::string("https://") + hosts[i % 3] + paths[i / 3 % 3] + std::to_string(i * 7919));
+        }
+        return values;
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_urls) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    std::vector<std::string> values = urls(2000);
+
+    FsstPageBuilder page_builder(options);
+    OwnedSlice page = build_page(&page_builder, values);
+    BinaryPlainPageBuilder plain_builder(options);
+    OwnedSlice plain_page = build_page(&plain_builder, values);
+    ASSERT_LT(page.slice().size * 2, plain_page.slice().size);
+
+    Slice first_value;
+    ASSERT_TRUE(page_builder.get_first_value(&first_value).ok());
+    ASSERT_EQ(values[0], first_value.to_string());
+    Slice last_value;
+    ASSERT_TRUE(page_builder.get_last_value(&last_value).ok());
+    ASSERT_EQ(values.back(), last_value.to_string());
+
+    FsstPageDecoder<OLAP_FIELD_TYPE_VARCHAR> page_decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(FSST_ENCODING, page_decoder.encoding_type());
+    ASSERT_EQ(values.size(), page_decoder.count());
+
+    auto column = vectorized::BinaryColumn::create();
+    size_t n = values.size();
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values.size(), n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(values[i], column->get_slice(i).to_string()) << "index " << i;
+    }
+
+    // random access
+    ASSERT_TRUE(page_decoder.seek_to_position_in_page(1500).ok());
+    column->resize(0);
+    n = 1;
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(1, n);
+    ASSERT_EQ(values[1500], column->get_slice(0).to_string());
+}
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_evaluate_predicate) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    std::vector<std::string> values = urls(1000);
+    FsstPageBuilder page_builder(options);
+    OwnedSlice page = build_page(&page_builder, values);
+
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+    std::vector<std::unique_ptr<vectorized::ColumnPredicate>> preds;
+    preds.emplace_back(vectorized::new_column_eq_predicate(type_info, 0, values[123]));
+    preds.emplace_back(vectorized::new_column_ne_predicate(type_info, 0, values[123]));
+    preds.emplace_back(vectorized::new_column_in_predicate(type_info, 0, {values[1], values[500], "https://"}));
+    preds.emplace_back(vectorized::new_column_not_in_predicate(type_info, 0, {values[1], values[999]}));
+    preds.emplace_back(vectorized::new_column_lt_predicate(type_info, 0, values[300]));
+    preds.emplace_back(vectorized::new_column_le_predicate(type_info, 0, values[300]));
+    preds.emplace_back(vectorized::new_column_gt_predicate(type_info, 0, "https://shop.example.org/s"));
+    preds.emplace_back(vectorized::new_column_ge_predicate(type_info, 0, values[42]));
+
+    auto column = vectorized::BinaryColumn::create();
+    for (const std::string& value : values) {
+        column->append(Slice(value));
+    }
+    for (const auto& pred : preds) {
+        std::vector<uint8_t> expected(values.size());
+        pred->evaluate(column.get(), expected.data());
+
+        FsstPageDecoder<OLAP_FIELD_TYPE_VARCHAR> page_decoder(page.slice(), PageDecoderOptions());
+        ASSERT_TRUE(page_decoder.init().ok());
+        ASSERT_TRUE(page_decoder.seek_to_position_in_page(100).ok());
+        std::vector<uint8_t> selection(values.size());
+        size_t n = values.size();
+        ASSERT_TRUE(page_decoder.evaluate_predicate(pred.get(), &n, selection.data()).ok());
+        ASSERT_EQ(values.size() - 100, n);
+        ASSERT_EQ(values.size(), page_decoder.current_index());
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(expected[100 + i], selection[i]) << pred->debug_string() << " index " << 100 + i;
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_incompressible) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    std::mt19937 rng(42);
+    std::vector<std::string> values;
+    for (int i = 0; i < 500; i++) {
+        std::string value(rng() % 20, '\0');
+        for (char& c : value) {
+            c = static_cast<char>(rng());
+        }
+        values.emplace_back(std::move(value));
+    }
+    FsstPageBuilder page_builder(options);
+    OwnedSlice page = build_page(&page_builder, values);
+
+    FsstPageDecoder<OLAP_FIELD_TYPE_VARCHAR> page_decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(page_decoder.init().ok());
+    auto column = vectorized::BinaryColumn::create();
+    size_t n = values.size();
+    ASSERT_TRUE(page_decoder.next_batch(&n, column.get()).ok());
+    ASSERT_EQ(values.size(), n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(values[i], column->get_slice(i).to_string()) << "index " << i;
+    }
+
+    std::unique_ptr<vectorized::ColumnPredicate> pred(
+            vectorized::new_column_eq_predicate(get_type_info(OLAP_FIELD_TYPE_VARCHAR), 0, values[7]));
+    ASSERT_TRUE(page_decoder.seek_to_position_in_page(0).ok());
+    std::vector<uint8_t> selection(values.size());
+    n = values.size();
+    ASSERT_TRUE(page_decoder.evaluate_predicate(pred.get(), &n, selection.data()).ok());
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(values[i] == values[7], selection[i]) << "index " << i;
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(FsstPageTest, test_symbol_table) {
+    std::vector<std::string> values = urls(500);
+    std::vector<Slice> sample(values.begin(), values.end());
+    SymbolTable table;
+    table.build(sample);
+    ASSERT_GT(table.num_symbols(), 0);
+
+    faststring buf;
+    table.serialize(&buf);
+    SymbolTable table2;
+    Slice data(buf);
+    ASSERT_TRUE(table2.deserialize(&data).ok());
+    ASSERT_EQ(0, data.size);
+    ASSERT_EQ(table.num_symbols(), table2.num_symbols());
+
+    std::vector<std::string> operands{"", "h", "https://", "https://www.example.com/products/0",
+                                      "https://www.example.com/products/00", "https://zzz", values[10]};
+    for (const std::string& value : values) {
+        faststring codes;
+        table.compress(value, &codes);
+        faststring codes2;
+        table2.compress(value, &codes2);
+        ASSERT_EQ(codes.ToString(), codes2.ToString());
+
+        std::vector<uint8_t> decompressed(SymbolTable::max_decompressed_size(codes.size()));
+        size_t size = table2.decompress(codes.data(), codes.size(), decompressed.data());
+        ASSERT_EQ(value, std::string(reinterpret_cast<const char*>(decompressed.data()), size));
+
+        for (const std::string& operand : operands) {
+            int expected = Slice(value).compare(operand);
+            int actual = table2.compare(codes.data(), codes.size(), operand);
+            ASSERT_EQ(expected < 0, actual < 0) << value << " vs " << operand;
+            ASSERT_EQ(expected == 0, actual == 0) << value << " vs " << operand;
+        }
+    }
+}
+
+} // namespace starrocks::segment_v2
@@ -32,6 +32,7 @@
 #include "storage/rowset/segment_v2/options.h"
 #include "storage/rowset/segment_v2/page_builder.h"
 #include "storage/rowset/segment_v2/page_decoder.h"
+#include "storage/vectorized/column_predicate.h"
 #include "util/logging.h"
 
 using starrocks::segment_v2::PageBuilderOptions;
@@ -234,4 +235,33 @@ TEST_F(RlePageTest, TestRleBoolBlockEncoderSize) {
     ASSERT_EQ(7, s.slice().size);
 }
 
+TEST_F(RlePageTest, TestRleInt32EvaluatePredicate) {
+    const size_t size = 1000;
+    std::vector<int32_t> ints;
+    for (size_t i = 0; i < size; i++) {
+        ints.push_back(static_cast<int32_t>(i / 50 % 5));
+    }
+    OwnedSlice s = rle_encode<OLAP_FIELD_TYPE_INT>(ints.data(), size);
+
+    std::unique_ptr<vectorized::ColumnPredicate> pred(
+            vectorized::new_column_eq_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 0, "3"));
+    segment_v2::RlePageDecoder<OLAP_FIELD_TYPE_INT> rle_page_decoder(s.slice(), PageDecoderOptions());
+    ASSERT_TRUE(rle_page_decoder.init().ok());
+    ASSERT_TRUE(rle_page_decoder.seek_to_position_in_page(120).ok());
+    std::vector<uint8_t> selection(size);
+    size_t n = 500;
+    ASSERT_TRUE(rle_page_decoder.evaluate_predicate(pred.get(), &n, selection.data()).ok());
+    ASSERT_EQ(500, n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(ints[120 + i] == 3, selection[i]) << "index " << 120 + i;
+    }
+    n = size;
+    ASSERT_TRUE(rle_page_decoder.evaluate_predicate(pred.get(), &n, selection.data()).ok());
+    ASSERT_EQ(380, n);
+    ASSERT_EQ(size, rle_page_decoder.current_index());
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(ints[620 + i] == 3, selection[i]) << "index " << 620 + i;
+    }
+}
+
 } // namespace starrocks
@@ -26,6 +26,7 @@
 #include <functional>
 #include <iostream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "env/env_memory.h"
 #include "gutil/strings/substitute.h"
@@ -39,8 +40,12 @@
 #include "storage/row_cursor.h"
 #include "storage/rowset/segment_v2/segment_iterator.h"
 #include "storage/rowset/segment_v2/segment_writer.h"
+#include "storage/rowset/vectorized/segment_options.h"
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
+#include "storage/vectorized/chunk_helper.h"
+#include "storage/vectorized/column_predicate.h"
+#include "storage/vectorized/seek_range.h"
 #include "util/file_utils.h"
 
 #define ASSERT_OK(expr)                                   \
@@ -1159,5 +1164,283 @@ TEST_F(SegmentReaderWriterTest, TestBloomFilterIndexUniqueModel) {
     ASSERT_TRUE(column_contains_index(seg2->footer().columns(3), BLOOM_FILTER_INDEX));
 }
 
+// The keys (rid / 100, rid / 10 % 10, rid % 10) are indexed by all the three key columns, though only the
+// first one is the short key column of the tablet.
+TEST_F(SegmentReaderWriterTest, TestShortKeyIndexExtraKeyColumns) {
+    TabletSchema tablet_schema =
+            create_schema({create_int_key(1), create_int_key(2), create_int_key(3), create_int_value(4)}, 1);
+    ValueGenerator data_gen = [](size_t rid, int cid, int block_id, RowCursorCell& cell) {
+        cell.set_not_null();
+        int values[] = {static_cast<int>(rid / 100), static_cast<int>(rid / 10 % 10), static_cast<int>(rid % 10),
+                        static_cast<int>(rid)};
+        *(int*)cell.mutable_cell_ptr() = values[cid];
+    };
+    const size_t num_rows = 1000;
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    opts.max_short_key_columns = 3;
+    opts.mem_tracker = _mem_tracker.get();
+
+    // The max keys are written even though write_block_max_key is off, so that the older versions fail to
+    // read the index, and each max key is the key of the last row of its block.
+    auto check_index = [&](Segment* segment) {
+        ASSERT_OK(segment->_load_index());
+        ASSERT_EQ(3, segment->num_short_keys());
+        ASSERT_TRUE(segment->has_block_max_keys());
+        ASSERT_EQ(num_rows / opts.num_rows_per_block, segment->_sk_index_decoder->num_items());
+        vectorized::Schema key_schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema, {0, 1, 2});
+        for (uint32_t block = 0; block < segment->_sk_index_decoder->num_items(); block++) {
+            int rid = block * opts.num_rows_per_block + opts.num_rows_per_block - 1;
+            vectorized::SeekTuple last_row(key_schema, {vectorized::Datum(rid / 100), vectorized::Datum(rid / 10 % 10),
+                                                        vectorized::Datum(rid % 10)});
+            ASSERT_EQ(last_row.short_key_encode(3, 0), segment->_sk_index_decoder->max_key(block).to_string());
+        }
+    };
+
+    // {lower keys, upper keys, expected first row, expected number of rows}, both bounds are inclusive.
+    struct SeekCase {
+        std::vector<int> lower;
+        std::vector<int> upper;
+        int first_row;
+        int num_rows;
+    };
+    std::vector<SeekCase> seek_cases = {{{3, 5, 7}, {3, 5, 9}, 357, 3},
+                                        // across the boundary of two blocks.
+                                        {{3, 5, 9}, {3, 6, 0}, 359, 2},
+                                        // a prefix of the indexed keys.
+                                        {{3}, {3}, 300, 100},
+                                        {{4, 2}, {4, 3}, 420, 20},
+                                        {{9, 9, 9}, {9, 9, 9}, 999, 1},
+                                        {{0, 0, 0}, {0, 0, 0}, 0, 1}};
+
+    // written row by row and read by segment_v2::SegmentIterator.
+    {
+        shared_ptr<Segment> segment;
+        build_segment(opts, tablet_schema, tablet_schema, num_rows, data_gen, &segment);
+        check_index(segment.get());
+
+        Schema schema(tablet_schema);
+        OlapReaderStatistics stats;
+        for (const auto& seek_case : seek_cases) {
+            auto make_bound = [&](const std::vector<int>& keys) {
+                std::unique_ptr<RowCursor> bound(new RowCursor());
+                bound->init(tablet_schema, keys.size());
+                for (size_t i = 0; i < keys.size(); i++) {
+                    auto cell = bound->cell(i);
+                    cell.set_not_null();
+                    *(int*)cell.mutable_cell_ptr() = keys[i];
+                }
+                return bound;
+            };
+            auto lower_bound = make_bound(seek_case.lower);
+            auto upper_bound = make_bound(seek_case.upper);
+            StorageReadOptions read_opts;
+            read_opts.block_mgr = _block_mgr;
+            read_opts.stats = &stats;
+            read_opts.key_ranges.emplace_back(lower_bound.get(), true, upper_bound.get(), true);
+            std::unique_ptr<RowwiseIterator> iter;
+            ASSERT_OK(segment->new_iterator(schema, read_opts, &iter));
+
+            RowBlockV2 block(schema, 1024);
+            ASSERT_OK(iter->next_batch(&block));
+            ASSERT_EQ(seek_case.num_rows, block.num_rows());
+            auto column_block = block.column_block(3);
+            for (int i = 0; i < seek_case.num_rows; ++i) {
+                ASSERT_EQ(seek_case.first_row + i, *(int*)column_block.cell_ptr(i));
+            }
+        }
+    }
+
+    // written by chunks of 7 rows, so the last rows of most blocks are in the chunks before the ones their
+    // next blocks start in, and read by vectorized::SegmentIterator.
+    {
+        std::string filename = kSegmentDir + "/seg_extra_key_columns.dat";
+        std::unique_ptr<fs::WritableBlock> wblock;
+        ASSERT_OK(_block_mgr->create_block(fs::CreateBlockOptions({filename}), &wblock));
+        SegmentWriter writer(std::move(wblock), 0, &tablet_schema, opts);
+        ASSERT_OK(writer.init(10));
+        vectorized::Schema schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+        for (size_t start = 0; start < num_rows; start += 7) {
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, 7);
+            for (size_t rid = start; rid < std::min(start + 7, num_rows); rid++) {
+                chunk->get_column_by_index(0)->append_datum(vectorized::Datum(static_cast<int32_t>(rid / 100)));
+                chunk->get_column_by_index(1)->append_datum(vectorized::Datum(static_cast<int32_t>(rid / 10 % 10)));
+                chunk->get_column_by_index(2)->append_datum(vectorized::Datum(static_cast<int32_t>(rid % 10)));
+                chunk->get_column_by_index(3)->append_datum(vectorized::Datum(static_cast<int32_t>(rid)));
+            }
+            ASSERT_OK(writer.append_chunk(*chunk));
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        ASSERT_OK(writer.finalize(&file_size, &index_size));
+        shared_ptr<Segment> segment;
+        ASSERT_OK(Segment::open(_mem_tracker.get(), _block_mgr, filename, 0, &tablet_schema, &segment));
+        check_index(segment.get());
+
+        OlapReaderStatistics stats;
+        for (const auto& seek_case : seek_cases) {
+            auto make_tuple = [&](const std::vector<int>& keys) {
+                std::vector<ColumnId> cids;
+                std::vector<vectorized::Datum> values;
+                for (size_t i = 0; i < keys.size(); i++) {
+                    cids.emplace_back(i);
+                    values.emplace_back(static_cast<int32_t>(keys[i]));
+                }
+                return vectorized::SeekTuple(vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema, cids),
+                                             std::move(values));
+            };
+            vectorized::SeekRange range(make_tuple(seek_case.lower), make_tuple(seek_case.upper));
+            range.set_inclusive_lower(true);
+            range.set_inclusive_upper(true);
+            vectorized::SegmentReadOptions seg_opts;
+            seg_opts.block_mgr = _block_mgr;
+            seg_opts.stats = &stats;
+            seg_opts.ranges.emplace_back(std::move(range));
+            auto res = segment->new_iterator(schema, seg_opts);
+            ASSERT_TRUE(res.ok()) << res.status().to_string();
+            auto iter = std::move(res).value();
+
+            std::vector<int32_t> values;
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, 1024);
+            while (true) {
+                chunk->reset();
+                auto st = iter->get_next(chunk.get());
+                if (st.is_end_of_file()) {
+                    break;
+                }
+                ASSERT_OK(st);
+                for (size_t i = 0; i < chunk->num_rows(); i++) {
+                    values.emplace_back(chunk->get_column_by_index(3)->get(i).get_int32());
+                }
+            }
+            ASSERT_EQ(seek_case.num_rows, values.size());
+            for (int i = 0; i < seek_case.num_rows; ++i) {
+                ASSERT_EQ(seek_case.first_row + i, values[i]);
+            }
+        }
+    }
+}
+
+// The results of the predicates evaluated on the encoded pages are the same as those evaluated on the
+// decoded values.
+TEST_F(SegmentReaderWriterTest, TestPredicateOnEncodedPages) {
+    const bool old_encoded_pages = config::enable_predicate_evaluation_on_encoded_pages;
+    const bool old_delta_encoding = config::enable_delta_encoding_for_ascending_column;
+    const int32_t old_sample_pages = config::adaptive_encoding_sample_pages;
+    const int32_t old_late_materialization_ratio = config::late_materialization_ratio;
+    // the ascending key column is delta encoded, the pages of the value columns are sampled by all the
+    // encodings, so some of them may have encodings other than that of their columns.
+    config::enable_delta_encoding_for_ascending_column = true;
+    config::adaptive_encoding_sample_pages = 2;
+
+    // c0: rid, c1: long runs with nulls, c2: scattered values with nulls.
+    TabletSchema tablet_schema = create_schema({create_int_key(1, false), create_int_value(2), create_int_value(3)});
+    const size_t num_rows = 100000;
+    std::string filename = kSegmentDir + "/seg_encoded_pages.dat";
+    {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        ASSERT_OK(_block_mgr->create_block(fs::CreateBlockOptions({filename}), &wblock));
+        SegmentWriterOptions opts;
+        opts.mem_tracker = _mem_tracker.get();
+        SegmentWriter writer(std::move(wblock), 0, &tablet_schema, opts);
+        ASSERT_OK(writer.init(10));
+        vectorized::Schema schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+        for (size_t start = 0; start < num_rows; start += 4096) {
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, 4096);
+            for (size_t rid = start; rid < std::min<size_t>(start + 4096, num_rows); rid++) {
+                chunk->get_column_by_index(0)->append_datum(vectorized::Datum(static_cast<int32_t>(rid)));
+                if (rid % 13 == 0) {
+                    chunk->get_column_by_index(1)->append_nulls(1);
+                } else {
+                    chunk->get_column_by_index(1)->append_datum(vectorized::Datum(static_cast<int32_t>(rid / 50 % 4)));
+                }
+                if (rid % 17 == 0) {
+                    chunk->get_column_by_index(2)->append_nulls(1);
+                } else {
+                    chunk->get_column_by_index(2)->append_datum(vectorized::Datum(static_cast<int32_t>(rid * 7 % 1000)));
+                }
+            }
+            ASSERT_OK(writer.append_chunk(*chunk));
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        ASSERT_OK(writer.finalize(&file_size, &index_size));
+    }
+    shared_ptr<Segment> segment;
+    ASSERT_OK(Segment::open(_mem_tracker.get(), _block_mgr, filename, 0, &tablet_schema, &segment));
+    ASSERT_EQ(FOR_DELTA_ENCODING, segment->footer().columns(0).encoding());
+
+    TypeInfoPtr int_type = get_type_info(OLAP_FIELD_TYPE_INT);
+    std::vector<std::unique_ptr<vectorized::ColumnPredicate>> preds;
+    auto new_pred = [&](vectorized::ColumnPredicate* pred) {
+        preds.emplace_back(pred);
+        return pred;
+    };
+    std::vector<std::vector<const vectorized::ColumnPredicate*>> cases = {
+            // several predicates on one column.
+            {new_pred(vectorized::new_column_ge_predicate(int_type, 0, "1000")),
+             new_pred(vectorized::new_column_lt_predicate(int_type, 0, "30000")),
+             new_pred(vectorized::new_column_ne_predicate(int_type, 0, "2000"))},
+            // a nullable column.
+            {new_pred(vectorized::new_column_eq_predicate(int_type, 1, "2")),
+             new_pred(vectorized::new_column_gt_predicate(int_type, 0, "500"))},
+            {new_pred(vectorized::new_column_in_predicate(int_type, 1, {"1", "3"})),
+             new_pred(vectorized::new_column_lt_predicate(int_type, 2, "500"))},
+            {new_pred(vectorized::new_column_not_in_predicate(int_type, 1, {"0"})),
+             new_pred(vectorized::new_column_eq_predicate(int_type, 0, "99999"))},
+            // no row is selected.
+            {new_pred(vectorized::new_column_lt_predicate(int_type, 0, "0"))}};
+
+    vectorized::Schema schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    auto read = [&](const std::vector<const vectorized::ColumnPredicate*>& case_preds,
+                    std::vector<std::string>* rows) {
+        OlapReaderStatistics stats;
+        vectorized::SegmentReadOptions seg_opts;
+        seg_opts.block_mgr = _block_mgr;
+        seg_opts.stats = &stats;
+        for (const auto* pred : case_preds) {
+            seg_opts.predicates[pred->column_id()].emplace_back(pred);
+        }
+        auto res = segment->new_iterator(schema, seg_opts);
+        if (res.status().is_end_of_file()) {
+            return;
+        }
+        ASSERT_TRUE(res.ok()) << res.status().to_string();
+        auto iter = std::move(res).value();
+        auto chunk = vectorized::ChunkHelper::new_chunk(schema, 1024);
+        while (true) {
+            chunk->reset();
+            auto st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows->emplace_back(chunk->debug_row(i));
+            }
+        }
+    };
+
+    // the non-predicate column is read after the predicates are evaluated, or read together with the others.
+    for (int32_t late_materialization_ratio : {0, 1000}) {
+        config::late_materialization_ratio = late_materialization_ratio;
+        for (size_t i = 0; i < cases.size(); i++) {
+            std::vector<std::string> encoded_rows;
+            config::enable_predicate_evaluation_on_encoded_pages = true;
+            read(cases[i], &encoded_rows);
+            std::vector<std::string> decoded_rows;
+            config::enable_predicate_evaluation_on_encoded_pages = false;
+            read(cases[i], &decoded_rows);
+            ASSERT_EQ(decoded_rows, encoded_rows) << "case " << i;
+            ASSERT_EQ(i + 1 == cases.size(), decoded_rows.empty()) << "case " << i;
+        }
+    }
+
+    config::enable_predicate_evaluation_on_encoded_pages = old_encoded_pages;
+    config::enable_delta_encoding_for_ascending_column = old_delta_encoding;
+    config::adaptive_encoding_sample_pages = old_sample_pages;
+    config::late_materialization_ratio = old_late_materialization_ratio;
+}
+
 } // namespace segment_v2
 } // namespace starrocks
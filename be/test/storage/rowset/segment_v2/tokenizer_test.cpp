@@ -0,0 +1,71 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "storage/rowset/segment_v2/tokenizer.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::segment_v2 {
+
+// NOLINTNEXTLINE
+TEST(TokenizerTest, test_standard) {
+    std::unique_ptr<Tokenizer> tokenizer;
+    ASSERT_TRUE(Tokenizer::create(STANDARD_TOKENIZER, &tokenizer).ok());
+    ASSERT_EQ(STANDARD_TOKENIZER, tokenizer->type());
+
+    std::vector<std::string> tokens;
+    tokenizer->tokenize(Slice("GET /api/v2/Users?id=42 HTTP/1.1"), &tokens);
+    std::vector<std::string> expected{"get", "api", "v2", "users", "id", "42", "http", "1", "1"};
+    ASSERT_EQ(expected, tokens);
+
+    // the bytes of non-ASCII characters are token characters.
+    tokens.clear();
+    tokenizer->tokenize(Slice("caf\xc3\xa9, \xe4\xbd\xa0\xe5\xa5\xbd"), &tokens);
+    expected = {"caf\xc3\xa9", "\xe4\xbd\xa0\xe5\xa5\xbd"};
+    ASSERT_EQ(expected, tokens);
+
+    tokens.clear();
+    tokenizer->tokenize(Slice(" ,;"), &tokens);
+    ASSERT_TRUE(tokens.empty());
+}
+
+// NOLINTNEXTLINE
+TEST(TokenizerTest, test_whitespace) {
+    std::unique_ptr<Tokenizer> tokenizer;
+    ASSERT_TRUE(Tokenizer::create(WHITESPACE_TOKENIZER, &tokenizer).ok());
+
+    // the '\0' padding of CHAR values is not part of the tokens.
+    std::string value("ERROR\tdisk-full  /dev/sda1");
+    value.append(3, '\0');
+    std::vector<std::string> tokens;
+    tokenizer->tokenize(Slice(value), &tokens);
+    std::vector<std::string> expected{"ERROR", "disk-full", "/dev/sda1"};
+    ASSERT_EQ(expected, tokens);
+}
+
+// NOLINTNEXTLINE
+TEST(TokenizerTest, test_inner_tokens) {
+    std::unique_ptr<Tokenizer> tokenizer;
+    ASSERT_TRUE(Tokenizer::create(STANDARD_TOKENIZER, &tokenizer).ok());
+
+    std::vector<std::string> tokens;
+    tokenizer->inner_tokens(Slice("ick Brown fox jum"), &tokens);
+    std::vector<std::string> expected{"brown", "fox"};
+    ASSERT_EQ(expected, tokens);
+
+    tokens.clear();
+    tokenizer->inner_tokens(Slice(" fox "), &tokens);
+    expected = {"fox"};
+    ASSERT_EQ(expected, tokens);
+
+    tokens.clear();
+    tokenizer->inner_tokens(Slice("fox"), &tokens);
+    ASSERT_TRUE(tokens.empty());
+}
+
+// NOLINTNEXTLINE
+TEST(TokenizerTest, test_unknown) {
+    std::unique_ptr<Tokenizer> tokenizer;
+    ASSERT_FALSE(Tokenizer::create(UNKNOWN_TOKENIZER, &tokenizer).ok());
+}
+
+} // namespace starrocks::segment_v2
@@ -97,6 +97,55 @@ TEST_F(ShortKeyIndexTest, buider) {
     }
 }
 
+TEST_F(ShortKeyIndexTest, max_keys) {
+    ShortKeyIndexBuilder builder(0, 1024, 2);
+
+    // blocks [1000, 1009], [1010, 1019], ...
+    int num_items = 0;
+    for (int i = 1000; i < 2000; i += 10) {
+        builder.add_item(std::to_string(i));
+        builder.add_max_item(std::to_string(i + 9));
+        num_items++;
+    }
+    std::vector<Slice> slices;
+    segment_v2::PageFooterPB footer;
+    ASSERT_TRUE(builder.finalize(100 * 1024, &slices, &footer).ok());
+    ASSERT_EQ(num_items, footer.short_key_page_footer().num_items());
+    ASSERT_EQ(2, footer.short_key_page_footer().num_short_key_columns());
+
+    std::string buf;
+    for (auto& slice : slices) {
+        buf.append(slice.data, slice.size);
+    }
+
+    ShortKeyIndexDecoder decoder;
+    ASSERT_TRUE(decoder.parse(buf, footer.short_key_page_footer()).ok());
+    ASSERT_TRUE(decoder.has_max_keys());
+    ASSERT_EQ(2, decoder.num_short_key_columns());
+    ASSERT_STREQ("1000", decoder.key(0).to_string().c_str());
+    ASSERT_STREQ("1009", decoder.max_key(0).to_string().c_str());
+
+    ASSERT_EQ(0, decoder.lower_bound_by_max_key("0999"));
+    ASSERT_EQ(0, decoder.lower_bound_by_max_key("1009"));
+    ASSERT_EQ(1, decoder.lower_bound_by_max_key("1010"));
+    ASSERT_EQ(50, decoder.lower_bound_by_max_key("1505"));
+    ASSERT_EQ(num_items, decoder.lower_bound_by_max_key("1999a"));
+
+    // the max keys must pair with the keys
+    ShortKeyIndexBuilder bad_builder(0, 1024);
+    bad_builder.add_item("1000");
+    bad_builder.add_item("2000");
+    bad_builder.add_max_item("1999");
+    slices.clear();
+    ASSERT_FALSE(bad_builder.finalize(2 * 1024, &slices, &footer).ok());
+
+    // the index of more key columns than the short key columns of the tablet must have the max keys
+    ShortKeyIndexBuilder no_max_builder(0, 1024, 2);
+    no_max_builder.add_item("1000");
+    slices.clear();
+    ASSERT_FALSE(no_max_builder.finalize(1024, &slices, &footer).ok());
+}
+
 TEST_F(ShortKeyIndexTest, enocde) {
     TabletSchema tablet_schema;
     tablet_schema._cols.push_back(create_int_key(0));
@@ -4,14 +4,17 @@
 
 #include <gtest/gtest.h>
 
+#include "column/chunk.h"
 #include "runtime/exec_env.h"
 #include "storage/row_cursor.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/rowset/vectorized/rowset_options.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_meta.h"
 #include "storage/vectorized/base_compaction.h"
+#include "storage/vectorized/chunk_helper.h"
 #include "storage/vectorized/compaction.h"
 #include "storage/vectorized/cumulative_compaction.h"
 #include "util/file_utils.h"
@@ -316,4 +319,89 @@ TEST_F(BaseCompactionTest, test_compact_succeed) {
     ASSERT_TRUE(base_compaction.compact().ok());
 }
 
+TEST_F(BaseCompactionTest, test_parallel_compact_succeed) {
+    config::storage_format_version = 2;
+    int32_t old_max_parallel_ranges = config::compaction_max_parallel_ranges;
+    int64_t old_min_bytes_per_range = config::compaction_min_bytes_per_parallel_range;
+    config::compaction_max_parallel_ranges = 2;
+    config::compaction_min_bytes_per_parallel_range = 1;
+    create_tablet_schema(UNIQUE_KEYS);
+
+    RowsetWriterContext rowset_writer_context(kDataFormatUnknown, config::storage_format_version);
+    create_rowset_writer_context(&rowset_writer_context);
+    TabletMetaSharedPtr tablet_meta(new TabletMeta(_tablet_meta_mem_tracker.get()));
+    create_tablet_meta(tablet_meta.get());
+    for (int i = 0; i < 3; i++) {
+        RowsetId src_rowset_id;
+        src_rowset_id.init(10000 + i);
+        rowset_writer_context.rowset_id = src_rowset_id;
+        if (i > 0) {
+            rowset_writer_context.version =
+                    Version(rowset_writer_context.version.second + 1, rowset_writer_context.version.second + 2);
+        }
+
+        std::unique_ptr<RowsetWriter> _rowset_writer;
+        ASSERT_EQ(OLAP_SUCCESS, RowsetFactory::create_rowset_writer(rowset_writer_context, &_rowset_writer));
+        rowset_writer_add_rows(_rowset_writer);
+        _rowset_writer->flush();
+        RowsetSharedPtr src_rowset = _rowset_writer->build();
+        ASSERT_TRUE(src_rowset != nullptr);
+        ASSERT_EQ(1024, src_rowset->num_rows());
+        tablet_meta->add_rs_meta(src_rowset->rowset_meta());
+    }
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(_tablet_meta_mem_tracker.get(), tablet_meta,
+                                            starrocks::ExecEnv::GetInstance()->storage_engine()->get_stores()[0]);
+    tablet->init();
+    tablet->calculate_cumulative_point();
+
+    BaseCompaction base_compaction(_compaction_mem_tracker.get(), tablet);
+    Status st = base_compaction.compact();
+    std::vector<OlapTuple> boundaries;
+    base_compaction.split_key_ranges(&boundaries);
+    config::compaction_max_parallel_ranges = old_max_parallel_ranges;
+    config::compaction_min_bytes_per_parallel_range = old_min_bytes_per_range;
+    ASSERT_TRUE(st.ok()) << st.to_string();
+    ASSERT_EQ(1, boundaries.size());
+
+    // one merge per range
+    std::vector<RuntimeProfile*> range_profiles;
+    base_compaction._runtime_profile.get_children(&range_profiles);
+    ASSERT_EQ(2, range_profiles.size());
+    ASSERT_EQ("merge_rowsets_range_0", range_profiles[0]->name());
+    ASSERT_EQ("merge_rowsets_range_1", range_profiles[1]->name());
+
+    std::vector<RowsetSharedPtr> rowsets;
+    tablet->capture_consistent_rowsets(Version(0, tablet->max_version().second), &rowsets);
+    ASSERT_EQ(1, rowsets.size());
+    ASSERT_EQ(1024, rowsets[0]->num_rows());
+
+    // the ranges are merged back in key order, and the values of the three input rowsets are summed.
+    Schema schema = ChunkHelper::convert_schema_to_format_v2(*_tablet_schema);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.stats = &stats;
+    auto iter = rowsets[0]->new_iterator(schema, rs_opts);
+    ASSERT_TRUE(iter.ok()) << iter.status().to_string();
+    auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+    int32_t num_rows = 0;
+    while (true) {
+        chunk->reset();
+        st = (*iter)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_TRUE(st.ok()) << st.to_string();
+        for (size_t i = 0; i < chunk->num_rows(); i++, num_rows++) {
+            ASSERT_EQ(num_rows, chunk->get_column_by_index(0)->get(i).get_int32());
+            ASSERT_EQ("well" + std::to_string(num_rows), chunk->get_column_by_index(1)->get(i).get_slice().to_string());
+            ASSERT_EQ(3 * (10000 + num_rows), chunk->get_column_by_index(2)->get(i).get_int32());
+        }
+    }
+    (*iter)->close();
+    ASSERT_EQ(1024, num_rows);
+}
+
 } // namespace starrocks::vectorized
@@ -1878,6 +1878,44 @@ TEST(ColumnPredicateTest, test_not_null) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, test_contains) {
+    std::unique_ptr<ColumnPredicate> p(
+            new_column_contains_predicate(get_type_info(OLAP_FIELD_TYPE_VARCHAR), 0, {"ab", "cd"}));
+    auto c = ChunkHelper::column_from_field_type(OLAP_FIELD_TYPE_VARCHAR, true);
+    c->append_datum(Datum("abcd"));
+    c->append_datum(Datum("cdxab"));
+    c->append_datum(Datum("abc"));
+    (void)c->append_nulls(1);
+    c->append_datum(Datum("acbd"));
+
+    ASSERT_EQ(PredicateType::kContains, p->type());
+    ASSERT_FALSE(p->can_vectorized());
+    ASSERT_TRUE(p->support_ngram_bloom_filter());
+    ASSERT_FALSE(p->support_bloom_filter());
+
+    std::vector<uint8_t> buff(5);
+    p->evaluate(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("1,1,0,0,0", to_string(buff));
+
+    buff.assign(5, 1);
+    buff[1] = 0;
+    p->evaluate_and(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("1,0,0,0,0", to_string(buff));
+
+    buff.assign(5, 0);
+    buff[4] = 1;
+    p->evaluate_or(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("1,1,0,0,1", to_string(buff));
+
+    std::vector<uint16_t> sel{0, 1, 2, 3, 4};
+    ASSERT_EQ(2, p->evaluate_branchless(c.get(), sel.data(), sel.size()));
+    ASSERT_EQ(0, sel[0]);
+    ASSERT_EQ(1, sel[1]);
+
+    ASSERT_EQ(nullptr, new_column_contains_predicate(get_type_info(OLAP_FIELD_TYPE_INT), 0, {"1"}));
+}
+
 // NOLINTNEXTLINE
 TEST(ColumnPredicateTest, test_or) {
     {
@@ -22,7 +22,9 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "util/coding.h"
 #define private public
@@ -326,4 +328,92 @@ TEST(BitmapValueTest, bitmap_single_convert) {
     bitmap |= bitmap_u;
     ASSERT_EQ(BitmapValue::BITMAP, bitmap._type);
 }
+
+static std::string serialize_bitmap(const BitmapValue& bitmap) {
+    std::string buf;
+    buf.resize(bitmap.getSizeInBytes());
+    bitmap.write(buf.data());
+    return buf;
+}
+
+static std::vector<std::string> frozen_test_inputs() {
+    std::vector<std::string> inputs;
+    inputs.emplace_back(serialize_bitmap(BitmapValue()));
+    inputs.emplace_back(serialize_bitmap(BitmapValue(7)));
+    inputs.emplace_back(serialize_bitmap(BitmapValue(1ULL << 40)));
+
+    config::enable_bitmap_union_disk_format_with_set = true;
+    BitmapValue set;
+    set.add(3);
+    set.add(1ULL << 35);
+    set.add(100);
+    config::enable_bitmap_union_disk_format_with_set = false;
+    inputs.emplace_back(serialize_bitmap(set));
+
+    // array containers
+    inputs.emplace_back(serialize_bitmap(BitmapValue({1, 5, 100000})));
+    // bitset container
+    BitmapValue bitset;
+    for (uint64_t i = 0; i < 10000; i += 2) {
+        bitset.add(i);
+    }
+    bitset.compress();
+    inputs.emplace_back(serialize_bitmap(bitset));
+    // run containers
+    BitmapValue runs;
+    for (uint64_t i = 0; i < 20000; i++) {
+        runs.add(i);
+        runs.add(200000 + i);
+    }
+    runs.compress();
+    inputs.emplace_back(serialize_bitmap(runs));
+    // 64-bit
+    inputs.emplace_back(serialize_bitmap(BitmapValue({1, 1ULL << 33, (1ULL << 33) + 5, (1ULL << 34) + 70000})));
+    return inputs;
+}
+
+TEST(BitmapValueTest, frozen_bitmap) {
+    auto owner = std::make_shared<int>(0);
+    for (const auto& input : frozen_test_inputs()) {
+        BitmapValue expected{Slice(input)};
+        BitmapValue frozen(Slice(input), owner);
+        ASSERT_TRUE(frozen.is_frozen());
+        ASSERT_EQ(expected.cardinality(), frozen.cardinality());
+        ASSERT_EQ(expected.to_string(), frozen.to_string());
+        ASSERT_EQ(input, serialize_bitmap(frozen));
+
+        BitmapValue copy = frozen;
+        ASSERT_TRUE(copy.is_frozen());
+        copy.add(123456789);
+        ASSERT_FALSE(copy.is_frozen());
+        expected.add(123456789);
+        ASSERT_EQ(expected.to_string(), copy.to_string());
+        ASSERT_TRUE(frozen.is_frozen());
+    }
+}
+
+TEST(BitmapValueTest, frozen_bitmap_union) {
+    auto owner = std::make_shared<int>(0);
+    std::vector<BitmapValue> states;
+    states.emplace_back();
+    states.emplace_back(3);
+    states.emplace_back(BitmapValue({3, 100000, 1ULL << 34}));
+    for (const auto& input : frozen_test_inputs()) {
+        for (const auto& state : states) {
+            BitmapValue expected = state;
+            expected |= BitmapValue(Slice(input));
+            BitmapValue actual = state;
+            actual |= BitmapValue(Slice(input), owner);
+            ASSERT_FALSE(actual.is_frozen());
+            ASSERT_EQ(expected.cardinality(), actual.cardinality());
+            ASSERT_EQ(expected.to_string(), actual.to_string());
+
+            expected = state;
+            expected &= BitmapValue(Slice(input));
+            actual = state;
+            actual &= BitmapValue(Slice(input), owner);
+            ASSERT_EQ(expected.to_string(), actual.to_string());
+        }
+    }
+}
 } // namespace starrocks
@@ -23,6 +23,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace starrocks {
 class TestForCoding : public testing::Test {
 public:
@@ -162,6 +165,58 @@ TEST_F(TestForCoding, TestBytesAlign) {
     ASSERT_EQ(2020, actual_value);
 }
 
+TEST_F(TestForCoding, TestOriginalValueFrame) {
+    faststring buffer(1);
+    ForEncoder<int32_t> encoder(&buffer);
+
+    const int32_t SIZE = 256;
+    std::vector<int32_t> data;
+    for (int32_t i = 0; i < SIZE; ++i) {
+        if (i < 128) {
+            // the deltas overflow, the original values are kept.
+            data.push_back(i % 2 == 0 ? std::numeric_limits<int32_t>::max() - i
+                                      : std::numeric_limits<int32_t>::min() + i);
+        } else {
+            data.push_back(i % 7);
+        }
+    }
+    encoder.put_batch(data.data(), SIZE);
+    encoder.flush();
+    // frames: (4 + 128 * 32 / 8) + (4 + 128 * 3 / 8), footer: 2 * 2 + 1 + 4
+    ASSERT_EQ(516 + 52 + 9, buffer.length());
+
+    ForDecoder<int32_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    ASSERT_TRUE(decoder.skip(130));
+    int32_t actual_value;
+    ASSERT_TRUE(decoder.get(&actual_value));
+    ASSERT_EQ(data[130], actual_value);
+    ASSERT_TRUE(decoder.skip(-131));
+    std::vector<int32_t> actual_result(SIZE);
+    decoder.get_batch(actual_result.data(), SIZE);
+    ASSERT_EQ(data, actual_result);
+}
+
+TEST_F(TestForCoding, TestSkipToEnd) {
+    faststring buffer(1);
+    ForEncoder<int32_t> encoder(&buffer);
+    for (int32_t i = 0; i < 300; ++i) {
+        encoder.put(i * 3);
+    }
+    encoder.flush();
+
+    ForDecoder<int32_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    ASSERT_TRUE(decoder.skip(300));
+    ASSERT_EQ(300, decoder.current_index());
+    int32_t actual_value;
+    ASSERT_FALSE(decoder.get(&actual_value));
+    ASSERT_FALSE(decoder.skip(1));
+    ASSERT_TRUE(decoder.skip(-1));
+    ASSERT_TRUE(decoder.get(&actual_value));
+    ASSERT_EQ(299 * 3, actual_value);
+}
+
 TEST_F(TestForCoding, TestValueSeekSpecialCase) {
     faststring buffer(1);
     ForEncoder<int64_t> encoder(&buffer);
@@ -247,4 +302,128 @@ TEST_F(TestForCoding, TestValueSeek) {
     ASSERT_EQ(found, false);
 }
 
+TEST_F(TestForCoding, TestRegularSteps) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer, true);
+
+    // event time in microseconds, one row per second.
+    const int64_t SIZE = 1000;
+    std::vector<int64_t> data;
+    for (int64_t i = 0; i < SIZE; ++i) {
+        data.push_back(1600000000000000L + i * 1000000);
+    }
+    encoder.put_batch(data.data(), SIZE);
+    encoder.flush();
+    // MinValue and MinDelta of 8 frames, no bit for the deltas.
+    ASSERT_EQ(8 * 16 + 8 * 2 + 5, buffer.length());
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    std::vector<int64_t> actual_result(SIZE);
+    decoder.get_batch(actual_result.data(), SIZE);
+    ASSERT_EQ(data, actual_result);
+
+    int64_t target = data[500] + 1;
+    bool exact_match;
+    ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match));
+    ASSERT_FALSE(exact_match);
+    ASSERT_EQ(501, decoder.current_index());
+}
+
+TEST_F(TestForCoding, TestRegularStepsWithoutDeltaOfDelta) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer);
+
+    const int64_t SIZE = 128;
+    std::vector<int64_t> data;
+    for (int64_t i = 0; i < SIZE; ++i) {
+        data.push_back(1600000000000000L + i * 1000000);
+    }
+    encoder.put_batch(data.data(), SIZE);
+    encoder.flush();
+    // the frame is stored by its deltas, readable by the decoders of older versions.
+    ASSERT_EQ(1, buffer.data()[buffer.length() - 7]);
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    std::vector<int64_t> actual_result(SIZE);
+    decoder.get_batch(actual_result.data(), SIZE);
+    ASSERT_EQ(data, actual_result);
+}
+
+TEST_F(TestForCoding, TestIrregularSteps) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer, true);
+
+    const int64_t SIZE = 700;
+    std::vector<int64_t> data;
+    for (int64_t i = 0; i < SIZE; ++i) {
+        data.push_back(1600000000000000L + i * 1000000 + i % 8);
+    }
+    // a frame that is not ascending between the frames of regular steps.
+    std::reverse(data.begin() + 256, data.begin() + 384);
+    encoder.put_batch(data.data(), SIZE);
+    encoder.flush();
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    std::vector<int64_t> actual_result(SIZE);
+    decoder.get_batch(actual_result.data(), SIZE);
+    ASSERT_EQ(data, actual_result);
+
+    ASSERT_TRUE(decoder.skip(-300));
+    int64_t actual_value;
+    decoder.get(&actual_value);
+    ASSERT_EQ(data[400], actual_value);
+}
+
+TEST_F(TestForCoding, TestFrameBounds) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer, true);
+
+    const int64_t SIZE = 500;
+    std::vector<int64_t> data;
+    for (int64_t i = 0; i < SIZE; ++i) {
+        if (i < 128) {
+            data.push_back(1000 + i * 10); // regular steps
+        } else if (i < 256) {
+            data.push_back(i % 2 == 0 ? std::numeric_limits<int64_t>::max() - i
+                                      : std::numeric_limits<int64_t>::min() + i); // original values
+        } else {
+            data.push_back(-50 + i % 7);
+        }
+    }
+    encoder.put_batch(data.data(), SIZE);
+    encoder.flush();
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    decoder.init();
+    int64_t lower;
+    int64_t upper;
+    ASSERT_EQ(128, decoder.current_frame_remaining());
+    ASSERT_TRUE(decoder.current_frame_bounds(&lower, &upper));
+    ASSERT_EQ(1000, lower);
+    ASSERT_EQ(1000 + 127 * 10, upper);
+
+    ASSERT_TRUE(decoder.skip(200));
+    ASSERT_EQ(56, decoder.current_frame_remaining());
+    ASSERT_TRUE(decoder.current_frame_bounds(&lower, &upper));
+    ASSERT_EQ(std::numeric_limits<int64_t>::min() + 129, lower);
+    ASSERT_EQ(std::numeric_limits<int64_t>::max(), upper);
+
+    ASSERT_TRUE(decoder.skip(100));
+    ASSERT_TRUE(decoder.current_frame_bounds(&lower, &upper));
+    ASSERT_EQ(-50, lower);
+    ASSERT_EQ(-50 + 7, upper);
+
+    // the frames after a frame of original values are decoded correctly.
+    ASSERT_TRUE(decoder.skip(-300));
+    std::vector<int64_t> actual_result(SIZE);
+    decoder.get_batch(actual_result.data(), SIZE);
+    ASSERT_EQ(data, actual_result);
+    ASSERT_TRUE(decoder.skip(-SIZE));
+    ASSERT_TRUE(decoder.skip(SIZE));
+    ASSERT_EQ(SIZE, decoder.current_index());
+}
+
 } // namespace starrocks
@@ -0,0 +1,62 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021 StarRocks Limited.
+
+#include "util/inline_slice.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(InlineSliceTest, test_inline) {
+    std::vector<std::string> values{"", "a", "abcd", "abcde", "abcdefghijkl", "abcdefghijklm", "abcdefghijklmnopq"};
+    for (const auto& value : values) {
+        InlineSlice key(value.data(), value.size());
+        ASSERT_EQ(value.size(), key.size());
+        ASSERT_EQ(value.size() <= InlineSlice::kInlineSize, key.is_inline());
+        ASSERT_EQ(value, key.to_slice().to_string());
+        if (key.is_inline()) {
+            ASSERT_NE(value.data(), key.data());
+        } else {
+            ASSERT_EQ(value.data(), key.data());
+        }
+
+        // an inlined value is copied with the view.
+        InlineSlice copy = key;
+        ASSERT_EQ(value, copy.to_slice().to_string());
+        ASSERT_TRUE(copy == key);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST(InlineSliceTest, test_equal) {
+    std::string a = "abcdefghijklmnopq";
+    std::string b = "abcdefghijklmnopq";
+    std::string c = "abcdefghijklmnopz";
+    std::string d = "abcdefghijkl";
+    ASSERT_TRUE(InlineSlice(Slice(a)) == InlineSlice(Slice(b)));
+    ASSERT_TRUE(InlineSlice(Slice(a)) != InlineSlice(Slice(c)));
+    ASSERT_TRUE(InlineSlice(Slice(a)) != InlineSlice(Slice(d)));
+    ASSERT_TRUE(InlineSlice(Slice(d)) == InlineSlice(Slice("abcdefghijkl")));
+    ASSERT_TRUE(InlineSlice(Slice(d)) != InlineSlice(Slice("abcdefghijkm")));
+    ASSERT_TRUE(InlineSlice(Slice("ab")) != InlineSlice(Slice("ab\0", 3)));
+    ASSERT_TRUE(InlineSlice() == InlineSlice(Slice("")));
+}
+
+// NOLINTNEXTLINE
+TEST(InlineSliceTest, test_compare) {
+    std::vector<std::string> values{"", "\xff", "a", "ab", "abcd", "abce", "b", "abcdefghijkl", "abcdefghijklm",
+                                    "abcdefghijklmnopq", "bcdefghijklmnopq"};
+    for (const auto& x : values) {
+        for (const auto& y : values) {
+            int expected = Slice(x).compare(Slice(y));
+            int actual = InlineSlice(Slice(x)).compare(InlineSlice(Slice(y)));
+            ASSERT_EQ(expected < 0, actual < 0) << x << " " << y;
+            ASSERT_EQ(expected == 0, actual == 0) << x << " " << y;
+        }
+    }
+}
+
+} // namespace starrocks
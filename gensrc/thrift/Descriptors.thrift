@@ -130,6 +130,10 @@ struct TColumn {
     6: optional string default_value               
     7: optional bool is_bloom_filter_column     
     8: optional Exprs.TExpr define_expr                                                               
+    // gram size of the n-gram bloom filter index of a CHAR/VARCHAR column, unset or 0 for no such index.
+    9: optional i32 ngram_bloom_filter_gram_size
+    // tokenizer of the inverted index of a CHAR/VARCHAR column, "standard" or "whitespace", unset for no such index.
+    10: optional string inverted_index_tokenizer
                                                                                                       
     // How many bytes used for short key index encoding.
     // For fixed-length column, this value may be ignored by BE when creating a tablet.
@@ -211,6 +211,9 @@ struct THdfsScanRange {
 
     // file format of hdfs file
     6: optional Descriptors.THdfsFileFormat file_format
+
+    // last modification time of hdfs file, used as part of block cache key
+    7: optional i64 modification_time
 }
 
 // Specification of an individual data range which is held in its entirety